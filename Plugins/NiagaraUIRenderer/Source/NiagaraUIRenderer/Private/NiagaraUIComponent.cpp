@@ -2,6 +2,9 @@
 
 #include "NiagaraUIComponent.h"
 #include "Stats/Stats.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
 #include "NiagaraRenderer.h"
 #include "NiagaraRibbonRendererProperties.h"
 #include "NiagaraSpriteRendererProperties.h"
@@ -163,6 +166,270 @@ FORCEINLINE FVector2D FastRotate(const FVector2D Vector, float Sin, float Cos)
                      Sin * Vector.X + Cos * Vector.Y);
 }
 
+namespace NiagaraUISpriteBatch
+{
+	// Particles are processed in fixed size batches so the per-batch scratch stays on the stack and in cache
+	static constexpr int32 BatchSize = 64;
+	static_assert(BatchSize % 4 == 0, "Batches are processed four particles at a time");
+
+	// Particles per ParallelFor task, must be a multiple of BatchSize
+	static constexpr int32 ParallelChunkSize = 1024;
+	static_assert(ParallelChunkSize % BatchSize == 0, "Parallel chunks must contain whole batches");
+
+	static TAutoConsoleVariable<int32> CVarSpriteParallelThreshold(
+		TEXT("NiagaraUI.SpriteParallelThreshold"),
+		4096,
+		TEXT("Sprite emitters with at least this many particles generate their vertices with ParallelFor (0 = never)."));
+
+	// Inputs shared by every particle of an emitter
+	struct FParams
+	{
+		float ScaleFactor = 1.f;
+		FVector2f ParentTopLeft = FVector2f::ZeroVector;
+		bool bLocalSpace = false;
+		FVector2f ComponentScale = FVector2f::UnitVector;	// Component X / Z scale
+		FVector2f ComponentOffset = FVector2f::ZeroVector;	// Component X / -Z location, already multiplied by ScaleFactor
+		float ComponentPitch = 0.f;							// Degrees
+		bool bVelocityAligned = false;
+		bool bFakeDepthScale = false;
+		float FakeDepthScaleDistance = 1.f;
+		FVector2f SubImageSize = FVector2f::UnitVector;
+	};
+
+	// One batch of particle attributes in structure-of-arrays layout
+	struct FBatch
+	{
+		float PositionX[BatchSize];
+		float PositionY[BatchSize];
+		float Depth[BatchSize];
+		float SizeX[BatchSize];
+		float SizeY[BatchSize];
+		float Rotation[BatchSize];	// Degrees, only filled when the sprite is not velocity aligned
+		float VelocityX[BatchSize];	// Only filled when the sprite is velocity aligned
+		float VelocityY[BatchSize];
+		float SubImage[BatchSize];	// Only filled when the renderer uses sub images
+		float MaterialX[BatchSize];
+		float MaterialY[BatchSize];
+		FColor Color[BatchSize];
+	};
+
+	FORCEINLINE void Fill(float* Dest, int32 Count, float Value)
+	{
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Dest[Index] = Value;
+		}
+	}
+
+	// Zero the lanes past Count so the last group of four never works on garbage (denormals / NaNs)
+	void PadBatch(FBatch& Batch, int32 Count, int32 VectorCount)
+	{
+		for (int32 j = Count; j < VectorCount; ++j)
+		{
+			Batch.PositionX[j] = Batch.PositionY[j] = Batch.Depth[j] = 0.f;
+			Batch.SizeX[j] = Batch.SizeY[j] = 0.f;
+			Batch.Rotation[j] = Batch.VelocityX[j] = Batch.VelocityY[j] = 0.f;
+		}
+	}
+
+	/**
+	 * Generates 4 vertices / 6 indices per particle for particles [Start, End).
+	 * Gather(Start, Count, Batch) fills one batch of attributes; positions, sizes, rotations and corners
+	 * are then computed four particles at a time before the vertices are written out.
+	 * Writes only touch the particle's own vertex / index range, so disjoint ranges can run in parallel.
+	 */
+	template <typename GatherType>
+	void BuildVertices(const GatherType& Gather, const FParams& Params, int32 Start, int32 End, FSlateVertex* VertexData, SlateIndex* IndexData)
+	{
+		const FVector2f Scale = (Params.bLocalSpace ? Params.ComponentScale : FVector2f::UnitVector) * Params.ScaleFactor;
+		const FVector2f Offset = Params.bLocalSpace ? Params.ParentTopLeft + Params.ComponentOffset : Params.ParentTopLeft;
+
+		// Local space positions are rotated by -Pitch (FVector2f::GetRotated)
+		float FrameSin, FrameCos;
+		FMath::SinCos(&FrameSin, &FrameCos, FMath::DegreesToRadians(-Params.ComponentPitch));
+
+		const VectorRegister4Float VScaleX = VectorSetFloat1(Scale.X);
+		const VectorRegister4Float VScaleY = VectorSetFloat1(Scale.Y);
+		const VectorRegister4Float VHalfScaleX = VectorSetFloat1(Scale.X * 0.5f);
+		const VectorRegister4Float VHalfScaleY = VectorSetFloat1(Scale.Y * 0.5f);
+		const VectorRegister4Float VOffsetX = VectorSetFloat1(Offset.X);
+		const VectorRegister4Float VOffsetY = VectorSetFloat1(Offset.Y);
+		const VectorRegister4Float VFrameSin = VectorSetFloat1(FrameSin);
+		const VectorRegister4Float VFrameCos = VectorSetFloat1(FrameCos);
+		const VectorRegister4Float VPitch = VectorSetFloat1(Params.bLocalSpace ? Params.ComponentPitch : 0.f);
+		const VectorRegister4Float VDegToRad = VectorSetFloat1(UE_PI / 180.f);
+		const VectorRegister4Float VDepthDistance = VectorSetFloat1(Params.FakeDepthScaleDistance);
+		const VectorRegister4Float VDepthScaler = VectorSetFloat1(1.f / Params.FakeDepthScaleDistance);
+
+		const float PitchRadians = FMath::DegreesToRadians(Params.ComponentPitch);
+		const bool bUseSubImages = Params.SubImageSize != FVector2f::UnitVector;
+		const FVector2f SubImageDelta = FVector2f::UnitVector / Params.SubImageSize;
+		const int32 SubImagesX = (int32)Params.SubImageSize.X;
+		const int32 SubImagesY = (int32)Params.SubImageSize.Y;
+
+		FBatch Batch;
+		float RotationSin[BatchSize];
+		float RotationCos[BatchSize];
+		float CornerX[4][BatchSize];
+		float CornerY[4][BatchSize];
+
+		for (int32 BatchStart = Start; BatchStart < End; BatchStart += BatchSize)
+		{
+			const int32 Count = FMath::Min(BatchSize, End - BatchStart);
+			const int32 VectorCount = Align(Count, 4);
+
+			Gather(BatchStart, Count, Batch);
+			PadBatch(Batch, Count, VectorCount);
+
+			// 1) Sprite rotation
+			if (Params.bVelocityAligned)
+			{
+				for (int32 j = 0; j < VectorCount; ++j)
+				{
+					const FVector2D ParticleVelocity(Batch.VelocityX[j], Batch.VelocityY[j]);
+					const float ParticleRotationCos = FVector2D::DotProduct(ParticleVelocity.GetSafeNormal(), FVector2D(0.f, 1.f));
+					const float SinSign = FMath::Sign(ParticleVelocity.X);
+
+					if (Params.bLocalSpace)
+					{
+						FMath::SinCos(&RotationSin[j], &RotationCos[j], FMath::Acos(ParticleRotationCos * SinSign) - PitchRadians);
+					}
+					else
+					{
+						RotationCos[j] = ParticleRotationCos;
+						RotationSin[j] = FMath::Sqrt(1 - ParticleRotationCos * ParticleRotationCos) * SinSign;
+					}
+				}
+			}
+			else
+			{
+				for (int32 j = 0; j < VectorCount; j += 4)
+				{
+					const VectorRegister4Float Angle = VectorMultiply(VectorSubtract(VectorLoad(&Batch.Rotation[j]), VPitch), VDegToRad);
+					VectorRegister4Float Sin, Cos;
+					VectorSinCos(&Sin, &Cos, &Angle);
+					VectorStore(Sin, &RotationSin[j]);
+					VectorStore(Cos, &RotationCos[j]);
+				}
+			}
+
+			// 2) Center, half size and the four rotated corners
+			for (int32 j = 0; j < VectorCount; j += 4)
+			{
+				VectorRegister4Float X = VectorMultiply(VectorLoad(&Batch.PositionX[j]), VScaleX);
+				VectorRegister4Float Y = VectorMultiply(VectorLoad(&Batch.PositionY[j]), VScaleY);
+
+				if (Params.bLocalSpace)
+				{
+					const VectorRegister4Float RotatedX = VectorSubtract(VectorMultiply(X, VFrameCos), VectorMultiply(Y, VFrameSin));
+					Y = VectorMultiplyAdd(X, VFrameSin, VectorMultiply(Y, VFrameCos));
+					X = RotatedX;
+				}
+
+				X = VectorAdd(X, VOffsetX);
+				Y = VectorAdd(Y, VOffsetY);
+
+				VectorRegister4Float HalfX = VectorMultiply(VectorLoad(&Batch.SizeX[j]), VHalfScaleX);
+				VectorRegister4Float HalfY = VectorMultiply(VectorLoad(&Batch.SizeY[j]), VHalfScaleY);
+
+				if (Params.bFakeDepthScale)
+				{
+					const VectorRegister4Float DepthScale = VectorMultiply(VectorSubtract(VDepthDistance, VectorLoad(&Batch.Depth[j])), VDepthScaler);
+					HalfX = VectorMultiply(HalfX, DepthScale);
+					HalfY = VectorMultiply(HalfY, DepthScale);
+				}
+
+				const VectorRegister4Float Sin = VectorLoad(&RotationSin[j]);
+				const VectorRegister4Float Cos = VectorLoad(&RotationCos[j]);
+				const VectorRegister4Float CosHalfX = VectorMultiply(Cos, HalfX);
+				const VectorRegister4Float CosHalfY = VectorMultiply(Cos, HalfY);
+				const VectorRegister4Float SinHalfX = VectorMultiply(Sin, HalfX);
+				const VectorRegister4Float SinHalfY = VectorMultiply(Sin, HalfY);
+
+				// FastRotate(-Half.X, -Half.Y) and FastRotate(Half.X, -Half.Y), the opposite corners are their negations
+				const VectorRegister4Float Corner0X = VectorSubtract(SinHalfY, CosHalfX);
+				const VectorRegister4Float Corner0Y = VectorNegate(VectorAdd(SinHalfX, CosHalfY));
+				const VectorRegister4Float Corner1X = VectorAdd(CosHalfX, SinHalfY);
+				const VectorRegister4Float Corner1Y = VectorSubtract(SinHalfX, CosHalfY);
+
+				VectorStore(VectorAdd(X, Corner0X), &CornerX[0][j]);
+				VectorStore(VectorAdd(Y, Corner0Y), &CornerY[0][j]);
+				VectorStore(VectorAdd(X, Corner1X), &CornerX[1][j]);
+				VectorStore(VectorAdd(Y, Corner1Y), &CornerY[1][j]);
+				VectorStore(VectorSubtract(X, Corner1X), &CornerX[2][j]);
+				VectorStore(VectorSubtract(Y, Corner1Y), &CornerY[2][j]);
+				VectorStore(VectorSubtract(X, Corner0X), &CornerX[3][j]);
+				VectorStore(VectorSubtract(Y, Corner0Y), &CornerY[3][j]);
+			}
+
+			// 3) Vertex / index write out
+			for (int32 j = 0; j < Count; ++j)
+			{
+				float LeftUV = 0.f, RightUV = 1.f, TopUV = 0.f, BottomUV = 1.f;
+
+				if (bUseSubImages)
+				{
+					const float ParticleSubImage = Batch.SubImage[j];
+					const int32 Row = (int32)FMath::Floor(ParticleSubImage / Params.SubImageSize.X) % SubImagesY;
+					const int32 Column = (int32)(ParticleSubImage) % SubImagesX;
+
+					LeftUV = SubImageDelta.X * Column;
+					RightUV = SubImageDelta.X * (Column + 1);
+					TopUV = SubImageDelta.Y * Row;
+					BottomUV = SubImageDelta.Y * (Row + 1);
+				}
+
+				const float TextureU[4] = { LeftUV, RightUV, LeftUV, RightUV };
+				const float TextureV[4] = { TopUV, TopUV, BottomUV, BottomUV };
+
+				const int32 VertexIndex = (BatchStart + j) * 4;
+				FSlateVertex* Vertex = VertexData + VertexIndex;
+
+				for (int32 i = 0; i < 4; ++i)
+				{
+					Vertex[i].Position = FVector2f(CornerX[i][j], CornerY[i][j]);
+					Vertex[i].Color = Batch.Color[j];
+					Vertex[i].TexCoords[0] = TextureU[i];
+					Vertex[i].TexCoords[1] = TextureV[i];
+					Vertex[i].TexCoords[2] = Batch.MaterialX[j];
+					Vertex[i].TexCoords[3] = Batch.MaterialY[j];
+				}
+
+				SlateIndex* Index = IndexData + (BatchStart + j) * 6;
+				Index[0] = VertexIndex;
+				Index[1] = VertexIndex + 1;
+				Index[2] = VertexIndex + 2;
+
+				Index[3] = VertexIndex + 2;
+				Index[4] = VertexIndex + 1;
+				Index[5] = VertexIndex + 3;
+			}
+		}
+	}
+
+	// Splits large emitters into ParallelChunkSize tasks, smaller ones run inline
+	template <typename GatherType>
+	void BuildAllVertices(const GatherType& Gather, const FParams& Params, int32 ParticleCount, FSlateVertex* VertexData, SlateIndex* IndexData, bool bAllowParallel = true)
+	{
+		const int32 ParallelThreshold = CVarSpriteParallelThreshold.GetValueOnAnyThread();
+
+		if (bAllowParallel && ParallelThreshold > 0 && ParticleCount >= ParallelThreshold)
+		{
+			const int32 NumChunks = FMath::DivideAndRoundUp(ParticleCount, ParallelChunkSize);
+
+			ParallelFor(NumChunks, [&](int32 Chunk)
+			{
+				const int32 ChunkStart = Chunk * ParallelChunkSize;
+				BuildVertices(Gather, Params, ChunkStart, FMath::Min(ChunkStart + ParallelChunkSize, ParticleCount), VertexData, IndexData);
+			});
+		}
+		else
+		{
+			BuildVertices(Gather, Params, 0, ParticleCount, VertexData, IndexData);
+		}
+	}
+}
+
 
 void UNiagaraUIComponent::AddSpriteRendererData(SNiagaraUISystemWidget* NiagaraWidget, TSharedRef<const FNiagaraEmitterInstance> EmitterInst, UNiagaraSpriteRendererProperties* SpriteRenderer, float ScaleFactor, FVector2f ParentTopLeft, const FNiagaraWidgetProperties* WidgetProperties)
 {
@@ -171,7 +438,6 @@ void UNiagaraUIComponent::AddSpriteRendererData(SNiagaraUISystemWidget* NiagaraW
 	FVector ComponentLocation = GetRelativeLocation();
 	FVector ComponentScale = GetRelativeScale3D();
 	FRotator ComponentRotation = GetRelativeRotation();
-	float ComponentPitchRadians = FMath::DegreesToRadians(ComponentRotation.Pitch);
 
 #if ENGINE_MINOR_VERSION < 4
 	FNiagaraDataSet& DataSet = EmitterInst->GetData();
@@ -197,12 +463,18 @@ void UNiagaraUIComponent::AddSpriteRendererData(SNiagaraUISystemWidget* NiagaraW
 #else
 	bool LocalSpace = EmitterInst->GetVersionedEmitter().GetEmitterData()->bLocalSpace;
 #endif
-			
-
-	const float FakeDepthScaler = 1 / WidgetProperties->FakeDepthScaleDistance;
 
-	FVector2D SubImageSize = SpriteRenderer->SubImageSize;
-	FVector2D SubImageDelta = FVector2D::UnitVector / SubImageSize;
+	NiagaraUISpriteBatch::FParams Params;
+	Params.ScaleFactor = ScaleFactor;
+	Params.ParentTopLeft = ParentTopLeft;
+	Params.bLocalSpace = LocalSpace;
+	Params.ComponentScale = FVector2f(ComponentScale.X, ComponentScale.Z);
+	Params.ComponentOffset = FVector2f(ComponentLocation.X, -ComponentLocation.Z) * ScaleFactor;
+	Params.ComponentPitch = ComponentRotation.Pitch;
+	Params.bVelocityAligned = SpriteRenderer->Alignment == ENiagaraSpriteAlignment::VelocityAligned;
+	Params.bFakeDepthScale = WidgetProperties->FakeDepthScale;
+	Params.FakeDepthScaleDistance = WidgetProperties->FakeDepthScaleDistance;
+	Params.SubImageSize = FVector2f(SpriteRenderer->SubImageSize);
 
 	const auto PositionData = FNiagaraDataSetAccessor<FNiagaraPosition>::	CreateReader(DataSet, SpriteRenderer->PositionBinding.GetDataSetBindableVariable().GetName());
 	const auto ColorData	= FNiagaraDataSetAccessor<FLinearColor>::		CreateReader(DataSet, SpriteRenderer->ColorBinding.GetDataSetBindableVariable().GetName());
@@ -212,179 +484,407 @@ void UNiagaraUIComponent::AddSpriteRendererData(SNiagaraUISystemWidget* NiagaraW
 	const auto SubImageData = FNiagaraDataSetAccessor<float>::				CreateReader(DataSet, SpriteRenderer->SubImageIndexBinding.GetDataSetBindableVariable().GetName());
 	const auto DynamicMaterialData = FNiagaraDataSetAccessor<FVector4f>::	CreateReader(DataSet, SpriteRenderer->DynamicMaterialBinding.GetDataSetBindableVariable().GetName());
 
-	auto GetParticlePosition2D = [&PositionData](int32 Index)
-	{
-		const FVector3f Position3D = PositionData.GetSafe(Index, FVector3f::ZeroVector);
-		return FVector2f(Position3D.X, -Position3D.Z);
-	};
-	
-	auto GetParticleDepth = [&PositionData](int32 Index)
-	{
-		return PositionData.GetSafe(Index, FVector::ZeroVector).Y;
-	};	
+	const bool UseSubImages = Params.SubImageSize != FVector2f::UnitVector;
 
-	auto GetParticleColor = [&ColorData](int32 Index)
-	{
-		return ColorData.GetSafe(Index, FLinearColor::White);
-	};
-	
-	auto GetParticleVelocity2D = [&VelocityData](int32 Index)
-	{
-		const FVector3f Velocity3D = VelocityData.GetSafe(Index, FVector3f::ZeroVector);
-		return FVector2D(Velocity3D.X, Velocity3D.Z);
-	};
-	
-	auto GetParticleSize = [&SizeData](int32 Index)
+	// Copies one batch out of the particle buffers, one attribute stream at a time.
+	// Unbound attributes get the same defaults the per-particle GetSafe calls used to return.
+	auto GatherParticles = [&](int32 Start, int32 Count, NiagaraUISpriteBatch::FBatch& Batch)
 	{
-		return SizeData.GetSafe(Index, FVector2f::UnitVector);
-	};
-	
-	auto GetParticleRotation = [&RotationData](int32 Index)
-	{
-		return RotationData.GetSafe(Index, 0.f);
-	};
-	
-	auto GetParticleSubImage = [&SubImageData](int32 Index)
-	{
-		return SubImageData.GetSafe(Index, 0.f);
-	};
-	
-	auto GetDynamicMaterialData = [&DynamicMaterialData](int32 Index)
-	{
-		return DynamicMaterialData.GetSafe(Index, FVector4f(0.f, 0.f, 0.f, 0.f));
+		using NiagaraUISpriteBatch::Fill;
+
+		if (PositionData.IsValid())
+		{
+			for (int32 j = 0; j < Count; ++j)
+			{
+				const FNiagaraPosition Position = PositionData[Start + j];
+				Batch.PositionX[j] = Position.X;
+				Batch.PositionY[j] = -Position.Z;
+				Batch.Depth[j] = Position.Y;
+			}
+		}
+		else
+		{
+			Fill(Batch.PositionX, Count, 0.f);
+			Fill(Batch.PositionY, Count, 0.f);
+			Fill(Batch.Depth, Count, 0.f);
+		}
+
+		if (SizeData.IsValid())
+		{
+			for (int32 j = 0; j < Count; ++j)
+			{
+				const FVector2f Size = SizeData[Start + j];
+				Batch.SizeX[j] = Size.X;
+				Batch.SizeY[j] = Size.Y;
+			}
+		}
+		else
+		{
+			Fill(Batch.SizeX, Count, 1.f);
+			Fill(Batch.SizeY, Count, 1.f);
+		}
+
+		if (Params.bVelocityAligned)
+		{
+			if (VelocityData.IsValid())
+			{
+				for (int32 j = 0; j < Count; ++j)
+				{
+					const FVector3f Velocity = VelocityData[Start + j];
+					Batch.VelocityX[j] = Velocity.X;
+					Batch.VelocityY[j] = Velocity.Z;
+				}
+			}
+			else
+			{
+				Fill(Batch.VelocityX, Count, 0.f);
+				Fill(Batch.VelocityY, Count, 0.f);
+			}
+		}
+		else if (RotationData.IsValid())
+		{
+			for (int32 j = 0; j < Count; ++j)
+			{
+				Batch.Rotation[j] = RotationData[Start + j];
+			}
+		}
+		else
+		{
+			Fill(Batch.Rotation, Count, 0.f);
+		}
+
+		if (UseSubImages)
+		{
+			if (SubImageData.IsValid())
+			{
+				for (int32 j = 0; j < Count; ++j)
+				{
+					Batch.SubImage[j] = SubImageData[Start + j];
+				}
+			}
+			else
+			{
+				Fill(Batch.SubImage, Count, 0.f);
+			}
+		}
+
+		if (DynamicMaterialData.IsValid())
+		{
+			for (int32 j = 0; j < Count; ++j)
+			{
+				const FVector4f MaterialData = DynamicMaterialData[Start + j];
+				Batch.MaterialX[j] = MaterialData.X;
+				Batch.MaterialY[j] = MaterialData.Y;
+			}
+		}
+		else
+		{
+			Fill(Batch.MaterialX, Count, 0.f);
+			Fill(Batch.MaterialY, Count, 0.f);
+		}
+
+		if (ColorData.IsValid())
+		{
+			for (int32 j = 0; j < Count; ++j)
+			{
+				Batch.Color[j] = ColorData[Start + j].ToFColor(true);
+			}
+		}
+		else
+		{
+			const FColor White = FLinearColor::White.ToFColor(true);
+			for (int32 j = 0; j < Count; ++j)
+			{
+				Batch.Color[j] = White;
+			}
+		}
 	};
 	
 	FSlateVertex* VertexData;	
 	SlateIndex* IndexData;
 	
-	FSlateBrush Brush;
 	UMaterialInterface* SpriteMaterial = SpriteRenderer->Material;
 
 	NiagaraWidget->AddRenderData(&VertexData, &IndexData, SpriteMaterial, ParticleCount * 4, ParticleCount * 6);
 
-	for (int ParticleIndex = 0; ParticleIndex < ParticleCount; ++ParticleIndex)
-	{
+	NiagaraUISpriteBatch::BuildAllVertices(GatherParticles, Params, ParticleCount, VertexData, IndexData);
+}
 
-		FVector2f ParticlePosition = GetParticlePosition2D(ParticleIndex) * ScaleFactor;
-		FVector2f ParticleSize = GetParticleSize(ParticleIndex) * ScaleFactor;
+#if !UE_BUILD_SHIPPING
+namespace NiagaraUISpriteBatch
+{
+	// Synthetic particle attributes for the benchmark, laid out like the Niagara component streams
+	struct FSyntheticParticles
+	{
+		TArray<float> PositionX, PositionY, Depth, SizeX, SizeY, Rotation, VelocityX, VelocityY, SubImage, MaterialX, MaterialY;
+		TArray<FLinearColor> Color;
 
-		if (LocalSpace)
+		void Generate(int32 Num, int32 Seed, float NumSubImages)
 		{
-			ParticlePosition *= FVector2f(ComponentScale.X, ComponentScale.Z);
-			ParticlePosition  = ParticlePosition.GetRotated(-ComponentRotation.Pitch);
-			ParticlePosition += ParentTopLeft;	
-			ParticlePosition += FVector2f(ComponentLocation.X, -ComponentLocation.Z) * ScaleFactor;
-			
-			ParticleSize *= FVector2f(ComponentScale.X, ComponentScale.Z);
+			FRandomStream Stream(Seed);
+			for (TArray<float>* Attribute : { &PositionX, &PositionY, &Depth, &SizeX, &SizeY, &Rotation, &VelocityX, &VelocityY, &SubImage, &MaterialX, &MaterialY })
+			{
+				Attribute->SetNumUninitialized(Num);
+			}
+			Color.SetNumUninitialized(Num);
+
+			for (int32 i = 0; i < Num; ++i)
+			{
+				PositionX[i] = Stream.FRandRange(-500.f, 500.f);
+				PositionY[i] = Stream.FRandRange(-500.f, 500.f);
+				Depth[i] = Stream.FRandRange(-200.f, 200.f);
+				SizeX[i] = Stream.FRandRange(4.f, 64.f);
+				SizeY[i] = Stream.FRandRange(4.f, 64.f);
+				Rotation[i] = Stream.FRandRange(-360.f, 360.f);
+				VelocityX[i] = Stream.FRandRange(-300.f, 300.f);
+				VelocityY[i] = Stream.FRandRange(-300.f, 300.f);
+				SubImage[i] = Stream.FRandRange(0.f, NumSubImages);
+				MaterialX[i] = Stream.FRand();
+				MaterialY[i] = Stream.FRand();
+				Color[i] = FLinearColor(Stream.FRand(), Stream.FRand(), Stream.FRand(), Stream.FRand());
+			}
 		}
-		else
+
+		void GatherBatch(int32 Start, int32 Count, FBatch& Batch) const
 		{
-			ParticlePosition += ParentTopLeft;					
+			FMemory::Memcpy(Batch.PositionX, &PositionX[Start], Count * sizeof(float));
+			FMemory::Memcpy(Batch.PositionY, &PositionY[Start], Count * sizeof(float));
+			FMemory::Memcpy(Batch.Depth, &Depth[Start], Count * sizeof(float));
+			FMemory::Memcpy(Batch.SizeX, &SizeX[Start], Count * sizeof(float));
+			FMemory::Memcpy(Batch.SizeY, &SizeY[Start], Count * sizeof(float));
+			FMemory::Memcpy(Batch.Rotation, &Rotation[Start], Count * sizeof(float));
+			FMemory::Memcpy(Batch.VelocityX, &VelocityX[Start], Count * sizeof(float));
+			FMemory::Memcpy(Batch.VelocityY, &VelocityY[Start], Count * sizeof(float));
+			FMemory::Memcpy(Batch.SubImage, &SubImage[Start], Count * sizeof(float));
+			FMemory::Memcpy(Batch.MaterialX, &MaterialX[Start], Count * sizeof(float));
+			FMemory::Memcpy(Batch.MaterialY, &MaterialY[Start], Count * sizeof(float));
+			for (int32 j = 0; j < Count; ++j)
+			{
+				Batch.Color[j] = Color[Start + j].ToFColor(true);
+			}
 		}
+	};
 
+	// The previous per-particle scalar loop, kept as the benchmark baseline and correctness reference
+	void BuildVerticesReference(const FSyntheticParticles& Particles, const FParams& Params, int32 ParticleCount, FSlateVertex* VertexData, SlateIndex* IndexData)
+	{
+		const float ComponentPitchRadians = FMath::DegreesToRadians(Params.ComponentPitch);
+		const float FakeDepthScaler = 1 / Params.FakeDepthScaleDistance;
+		const FVector2D SubImageSize = FVector2D(Params.SubImageSize);
+		const FVector2D SubImageDelta = FVector2D::UnitVector / SubImageSize;
 
-		if (WidgetProperties->FakeDepthScale)
+		for (int ParticleIndex = 0; ParticleIndex < ParticleCount; ++ParticleIndex)
 		{
-			const float ParticleDepth = (-GetParticleDepth(ParticleIndex) + WidgetProperties->FakeDepthScaleDistance) * FakeDepthScaler;
-			ParticleSize *= ParticleDepth;
-		}
+			FVector2f ParticlePosition = FVector2f(Particles.PositionX[ParticleIndex], Particles.PositionY[ParticleIndex]) * Params.ScaleFactor;
+			FVector2f ParticleSize = FVector2f(Particles.SizeX[ParticleIndex], Particles.SizeY[ParticleIndex]) * Params.ScaleFactor;
 
-		
-		const FVector2f ParticleHalfSize = ParticleSize * 0.5;
-		
-		
-		const FColor ParticleColor = GetParticleColor(ParticleIndex).ToFColor(true);
-		
-		
-		float ParticleRotationSin, ParticleRotationCos;
+			if (Params.bLocalSpace)
+			{
+				ParticlePosition *= Params.ComponentScale;
+				ParticlePosition  = ParticlePosition.GetRotated(-Params.ComponentPitch);
+				ParticlePosition += Params.ParentTopLeft;
+				ParticlePosition += Params.ComponentOffset;
 
-		if (SpriteRenderer->Alignment == ENiagaraSpriteAlignment::VelocityAligned)
-		{
-			const FVector2D ParticleVelocity = GetParticleVelocity2D(ParticleIndex);
+				ParticleSize *= Params.ComponentScale;
+			}
+			else
+			{
+				ParticlePosition += Params.ParentTopLeft;
+			}
 
-			ParticleRotationCos = FVector2D::DotProduct(ParticleVelocity.GetSafeNormal(), FVector2D(0.f, 1.f));
-			const float SinSign = FMath::Sign(FVector2D::DotProduct(ParticleVelocity, FVector2D(1.f, 0.f)));
-			
-			if ( LocalSpace)
+			if (Params.bFakeDepthScale)
+			{
+				const float ParticleDepth = (-Particles.Depth[ParticleIndex] + Params.FakeDepthScaleDistance) * FakeDepthScaler;
+				ParticleSize *= ParticleDepth;
+			}
+
+			const FVector2f ParticleHalfSize = ParticleSize * 0.5;
+			const FColor ParticleColor = Particles.Color[ParticleIndex].ToFColor(true);
+
+			float ParticleRotationSin, ParticleRotationCos;
+
+			if (Params.bVelocityAligned)
 			{
-				const float ParticleRotation = FMath::Acos(ParticleRotationCos * SinSign) - ComponentPitchRadians;
-				FMath::SinCos(&ParticleRotationSin, &ParticleRotationCos, ParticleRotation);				
+				const FVector2D ParticleVelocity(Particles.VelocityX[ParticleIndex], Particles.VelocityY[ParticleIndex]);
+
+				ParticleRotationCos = FVector2D::DotProduct(ParticleVelocity.GetSafeNormal(), FVector2D(0.f, 1.f));
+				const float SinSign = FMath::Sign(FVector2D::DotProduct(ParticleVelocity, FVector2D(1.f, 0.f)));
+
+				if (Params.bLocalSpace)
+				{
+					const float ParticleRotation = FMath::Acos(ParticleRotationCos * SinSign) - ComponentPitchRadians;
+					FMath::SinCos(&ParticleRotationSin, &ParticleRotationCos, ParticleRotation);
+				}
+				else
+				{
+					ParticleRotationSin = FMath::Sqrt(1 - ParticleRotationCos * ParticleRotationCos) * SinSign;
+				}
 			}
 			else
 			{
-				ParticleRotationSin = FMath::Sqrt(1 - ParticleRotationCos * ParticleRotationCos) * SinSign;
+				float ParticleRotation = Particles.Rotation[ParticleIndex];
+
+				if (Params.bLocalSpace)
+					ParticleRotation -= Params.ComponentPitch;
+
+				FMath::SinCos(&ParticleRotationSin, &ParticleRotationCos, FMath::DegreesToRadians(ParticleRotation));
 			}
-		}
-		else
-		{
-			float ParticleRotation = GetParticleRotation(ParticleIndex);
-			
-			if (LocalSpace)
-				ParticleRotation -= ComponentRotation.Pitch;
-			
-			FMath::SinCos(&ParticleRotationSin, &ParticleRotationCos, FMath::DegreesToRadians(ParticleRotation));
-		}
-		
-		
-		FVector2D TextureCoordinates[4];
-		
-		if (SubImageSize != FVector2D(1.f, 1.f))
-		{
-			const float ParticleSubImage = GetParticleSubImage(ParticleIndex);
-			const int Row = (int)FMath::Floor(ParticleSubImage / SubImageSize.X) % (int)SubImageSize.Y;
-			const int Column = (int)(ParticleSubImage) % (int)(SubImageSize.X);
 
-			const float LeftUV = SubImageDelta.X * Column;
-			const float Right = SubImageDelta.X * (Column + 1);
-			const float TopUV = SubImageDelta.Y * Row;
-			const float BottomUV = SubImageDelta.Y * (Row + 1);
-			
-			TextureCoordinates[0] = FVector2D(LeftUV, TopUV);
-			TextureCoordinates[1] = FVector2D(Right, TopUV);
-			TextureCoordinates[2] = FVector2D(LeftUV, BottomUV);
-			TextureCoordinates[3] = FVector2D(Right, BottomUV);
+			FVector2D TextureCoordinates[4];
+
+			if (SubImageSize != FVector2D(1.f, 1.f))
+			{
+				const float ParticleSubImage = Particles.SubImage[ParticleIndex];
+				const int Row = (int)FMath::Floor(ParticleSubImage / SubImageSize.X) % (int)SubImageSize.Y;
+				const int Column = (int)(ParticleSubImage) % (int)(SubImageSize.X);
+
+				const float LeftUV = SubImageDelta.X * Column;
+				const float Right = SubImageDelta.X * (Column + 1);
+				const float TopUV = SubImageDelta.Y * Row;
+				const float BottomUV = SubImageDelta.Y * (Row + 1);
+
+				TextureCoordinates[0] = FVector2D(LeftUV, TopUV);
+				TextureCoordinates[1] = FVector2D(Right, TopUV);
+				TextureCoordinates[2] = FVector2D(LeftUV, BottomUV);
+				TextureCoordinates[3] = FVector2D(Right, BottomUV);
+			}
+			else
+			{
+				TextureCoordinates[0] = FVector2D(0.f, 0.f);
+				TextureCoordinates[1] = FVector2D(1.f, 0.f);
+				TextureCoordinates[2] = FVector2D(0.f, 1.f);
+				TextureCoordinates[3] = FVector2D(1.f, 1.f);
+			}
+
+			FVector2D PositionArray[4];
+			PositionArray[0] = FastRotate(FVector2D(-ParticleHalfSize.X, -ParticleHalfSize.Y), ParticleRotationSin, ParticleRotationCos);
+			PositionArray[1] = FastRotate(FVector2D(ParticleHalfSize.X, -ParticleHalfSize.Y), ParticleRotationSin, ParticleRotationCos);
+			PositionArray[2] = - PositionArray[1];
+			PositionArray[3] = - PositionArray[0];
+
+			const int VertexIndex = ParticleIndex * 4;
+			const int indexIndex = ParticleIndex * 6;
+
+			for (int i = 0; i < 4; ++i)
+			{
+				VertexData[VertexIndex + i].Position = FVector2f(PositionArray[i]) + ParticlePosition;
+				VertexData[VertexIndex + i].Color = ParticleColor;
+				VertexData[VertexIndex + i].TexCoords[0] = TextureCoordinates[i].X;
+				VertexData[VertexIndex + i].TexCoords[1] = TextureCoordinates[i].Y;
+				VertexData[VertexIndex + i].TexCoords[2] = Particles.MaterialX[ParticleIndex];
+				VertexData[VertexIndex + i].TexCoords[3] = Particles.MaterialY[ParticleIndex];
+			}
+
+			IndexData[indexIndex] = VertexIndex;
+			IndexData[indexIndex + 1] = VertexIndex + 1;
+			IndexData[indexIndex + 2] = VertexIndex + 2;
+
+			IndexData[indexIndex + 3] = VertexIndex + 2;
+			IndexData[indexIndex + 4] = VertexIndex + 1;
+			IndexData[indexIndex + 5] = VertexIndex + 3;
 		}
-		else
+	}
+
+	void RunBenchmark(int32 NumParticles, int32 Iterations)
+	{
+		NumParticles = FMath::Max(NumParticles, 1);
+		Iterations = FMath::Max(Iterations, 1);
+
+		FParams Params;
+		Params.ScaleFactor = 1.5f;
+		Params.ParentTopLeft = FVector2f(100.f, 50.f);
+		Params.bLocalSpace = true;
+		Params.ComponentScale = FVector2f(1.2f, 0.8f);
+		Params.ComponentOffset = FVector2f(30.f, -20.f);
+		Params.ComponentPitch = 30.f;
+		Params.bFakeDepthScale = true;
+		Params.FakeDepthScaleDistance = 1000.f;
+		Params.SubImageSize = FVector2f(4.f, 4.f);
+
+		FSyntheticParticles Particles;
+		Particles.Generate(NumParticles, 1, Params.SubImageSize.X * Params.SubImageSize.Y);
+
+		auto Gather = [&Particles](int32 Start, int32 Count, FBatch& Batch) { Particles.GatherBatch(Start, Count, Batch); };
+
+		TArray<FSlateVertex> ReferenceVertices, BatchedVertices;
+		TArray<SlateIndex> ReferenceIndices, BatchedIndices;
+		ReferenceVertices.SetNumZeroed(NumParticles * 4);
+		BatchedVertices.SetNumZeroed(NumParticles * 4);
+		ReferenceIndices.SetNumZeroed(NumParticles * 6);
+		BatchedIndices.SetNumZeroed(NumParticles * 6);
+
+		const double NumVertices = (double)NumParticles * 4.0 * Iterations;
+		auto VerticesPerMs = [NumVertices](double Seconds) { return Seconds > 0.0 ? NumVertices / (Seconds * 1000.0) : 0.0; };
+
+		UE_LOG(LogTemp, Log, TEXT("[NiagaraUI] Sprite vertex benchmark : %d particles x %d iterations"), NumParticles, Iterations);
+
+		for (const bool bVelocityAligned : { false, true })
 		{
-			TextureCoordinates[0] = FVector2D(0.f, 0.f);
-			TextureCoordinates[1] = FVector2D(1.f, 0.f);
-			TextureCoordinates[2] = FVector2D(0.f, 1.f);
-			TextureCoordinates[3] = FVector2D(1.f, 1.f);
-		}
+			Params.bVelocityAligned = bVelocityAligned;
 
-		
-		const FVector4f MaterialData = GetDynamicMaterialData(ParticleIndex);
+			double Start = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				BuildVerticesReference(Particles, Params, NumParticles, ReferenceVertices.GetData(), ReferenceIndices.GetData());
+			}
+			const double ReferenceSeconds = FPlatformTime::Seconds() - Start;
 
-		FVector2D PositionArray[4];
-		PositionArray[0] = FastRotate(FVector2D(-ParticleHalfSize.X, -ParticleHalfSize.Y), ParticleRotationSin, ParticleRotationCos);
-		PositionArray[1] = FastRotate(FVector2D(ParticleHalfSize.X, -ParticleHalfSize.Y), ParticleRotationSin, ParticleRotationCos);
-		PositionArray[2] = - PositionArray[1];
-		PositionArray[3] = - PositionArray[0];
-		
-		const int VertexIndex = ParticleIndex * 4;
-		const int indexIndex = ParticleIndex * 6;		
-		
-		
-		for (int i = 0; i < 4; ++i)
-		{
-			VertexData[VertexIndex + i].Position = FVector2f(PositionArray[i]) + ParticlePosition;
-			VertexData[VertexIndex + i].Color = ParticleColor;
-			VertexData[VertexIndex + i].TexCoords[0] = TextureCoordinates[i].X;
-			VertexData[VertexIndex + i].TexCoords[1] = TextureCoordinates[i].Y;
-			VertexData[VertexIndex + i].TexCoords[2] = MaterialData.X;
-			VertexData[VertexIndex + i].TexCoords[3] = MaterialData.Y;
+			Start = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				BuildAllVertices(Gather, Params, NumParticles, BatchedVertices.GetData(), BatchedIndices.GetData(), false);
+			}
+			const double BatchedSeconds = FPlatformTime::Seconds() - Start;
+
+			Start = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				const int32 NumChunks = FMath::DivideAndRoundUp(NumParticles, ParallelChunkSize);
+				ParallelFor(NumChunks, [&](int32 Chunk)
+				{
+					const int32 ChunkStart = Chunk * ParallelChunkSize;
+					BuildVertices(Gather, Params, ChunkStart, FMath::Min(ChunkStart + ParallelChunkSize, NumParticles), BatchedVertices.GetData(), BatchedIndices.GetData());
+				});
+			}
+			const double ParallelSeconds = FPlatformTime::Seconds() - Start;
+
+			// Output comparison (positions differ only by float rounding / SinCos approximation)
+			float MaxPositionError = 0.f;
+			float MaxTexCoordError = 0.f;
+			int32 ColorMismatches = 0;
+			for (int32 i = 0; i < ReferenceVertices.Num(); ++i)
+			{
+				const FSlateVertex& A = ReferenceVertices[i];
+				const FSlateVertex& B = BatchedVertices[i];
+				MaxPositionError = FMath::Max(MaxPositionError, (A.Position - B.Position).GetAbsMax());
+				for (int32 k = 0; k < 4; ++k)
+				{
+					MaxTexCoordError = FMath::Max(MaxTexCoordError, FMath::Abs(A.TexCoords[k] - B.TexCoords[k]));
+				}
+				ColorMismatches += A.Color != B.Color ? 1 : 0;
+			}
+			const bool bIndicesMatch = FMemory::Memcmp(ReferenceIndices.GetData(), BatchedIndices.GetData(), ReferenceIndices.Num() * sizeof(SlateIndex)) == 0;
+
+			UE_LOG(LogTemp, Log, TEXT("[NiagaraUI]   %s : Scalar %.0f vtx/ms | Batched %.0f vtx/ms (x%.2f) | Batched+ParallelFor %.0f vtx/ms (x%.2f)"),
+				bVelocityAligned ? TEXT("VelocityAligned") : TEXT("Rotation"),
+				VerticesPerMs(ReferenceSeconds),
+				VerticesPerMs(BatchedSeconds), BatchedSeconds > 0.0 ? ReferenceSeconds / BatchedSeconds : 0.0,
+				VerticesPerMs(ParallelSeconds), ParallelSeconds > 0.0 ? ReferenceSeconds / ParallelSeconds : 0.0);
+			UE_LOG(LogTemp, Log, TEXT("[NiagaraUI]     MaxPositionError=%.5f MaxTexCoordError=%.6f ColorMismatches=%d Indices=%s"),
+				MaxPositionError, MaxTexCoordError, ColorMismatches, bIndicesMatch ? TEXT("match") : TEXT("MISMATCH"));
 		}
-		
-		
-		IndexData[indexIndex] = VertexIndex;
-		IndexData[indexIndex + 1] = VertexIndex + 1;
-		IndexData[indexIndex + 2] = VertexIndex + 2;
-		
-		IndexData[indexIndex + 3] = VertexIndex + 2;
-		IndexData[indexIndex + 4] = VertexIndex + 1;
-		IndexData[indexIndex + 5] = VertexIndex + 3;
 	}
+
+	// NiagaraUI.BenchmarkSprites [NumParticles=10000] [Iterations=50]
+	static FAutoConsoleCommandWithArgs GBenchmarkSpritesCommand(
+		TEXT("NiagaraUI.BenchmarkSprites"),
+		TEXT("Generate sprite vertices for synthetic particles with the scalar reference, the batched path and the batched path on ParallelFor, and log vertices per millisecond. Args: [NumParticles=10000] [Iterations=50]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			RunBenchmark(Args.IsValidIndex(0) ? FCString::Atoi(*Args[0]) : 10000, Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 50);
+		}));
 }
+#endif
 
 void UNiagaraUIComponent::AddRibbonRendererData(SNiagaraUISystemWidget* NiagaraWidget, TSharedRef<const FNiagaraEmitterInstance> EmitterInst, UNiagaraRibbonRendererProperties* RibbonRenderer, float ScaleFactor, FVector2f ParentTopLeft, const FNiagaraWidgetProperties* WidgetProperties)
 {
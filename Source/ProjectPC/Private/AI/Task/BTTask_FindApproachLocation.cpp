@@ -7,9 +7,11 @@
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Character/Unit/PCBaseUnitCharacter.h"
 #include "Controller/Unit/PCUnitAIController.h"
-#include "Containers/Queue.h"
+#include "Algo/RandomShuffle.h"
 #include "Utility/PCUnitCombatUtils.h"
+#include "GameFramework/HelpActor/PCCombatBoard.h"
 #include "GameFramework/HelpActor/Component/PCTileManager.h"
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
 
 
 UBTTask_FindApproachLocation::UBTTask_FindApproachLocation()
@@ -19,6 +21,8 @@ UBTTask_FindApproachLocation::UBTTask_FindApproachLocation()
 
 EBTNodeResult::Type UBTTask_FindApproachLocation::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	FPCTelemetryScope TelemetryScope(&OwnerComp, EPCTelemetryPhase::BTTask);
+
 	UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
 	if (!BB)
 		return EBTNodeResult::Failed;
@@ -46,68 +50,86 @@ EBTNodeResult::Type UBTTask_FindApproachLocation::ExecuteTask(UBehaviorTreeCompo
 		BB->ClearValue(ApproachLocationKey.SelectedKeyName);
 		return EBTNodeResult::Failed;
 	}
+	const UPCTileManager* TileManager = Board->TileManager;
+	if (!TileManager)
+	{
+		BB->ClearValue(ApproachLocationKey.SelectedKeyName);
+		return EBTNodeResult::Failed;
+	}
+
+	// 이웃 목록은 헥스 테이블에서 조회 (방향 계산 / 범위 체크 생략)
+	const FPCHexGridTopology& Topology = TileManager->GetHexTopology();
+	const int32 StartIndex = Topology.ToIndex(StartPoint);
+	if (StartIndex == INDEX_NONE)
+	{
+		BB->ClearValue(ApproachLocationKey.SelectedKeyName);
+		return EBTNodeResult::Failed;
+	}
+	
 	struct FBfsData
 	{
-		FIntPoint GridPoint;
-		FIntPoint FirstMovePosition;
+		int32 TileIndex;
+		int32 FirstMoveIndex;
+	};
+
+	auto GetShuffledNeighbors = [&Topology](int32 TileIndex)
+	{
+		TArray<int32, TInlineAllocator<6>> Out(Topology.GetNeighbors(TileIndex));
+		Algo::RandomShuffle(Out);
+		return Out;
 	};
 	
 	// BFS
-	TQueue<FBfsData> Q;
-	TSet<FIntPoint> Visited;
-	Visited.Add(StartPoint);
+	TArray<FBfsData, TInlineAllocator<64>> Q;
+	TBitArray<TInlineAllocator<2>> Visited(false, Topology.Num());
+	Visited[StartIndex] = true;
 
-	// 탐색 방향 랜덤으로 섞인 Direction 배열 가져옴 (랜덤성 부여)
-	for (const FIntPoint& Dir : PCUnitCombatUtils::GetRandomDirections(StartPoint.Y % 2 == 0))
+	// 탐색 방향 랜덤으로 섞인 이웃 배열 가져옴 (랜덤성 부여)
+	for (const int32 NextIndex : GetShuffledNeighbors(StartIndex))
 	{
-		FIntPoint NextPoint = StartPoint + Dir;
+		const FIntPoint NextPoint = Topology.ToPoint(NextIndex);
 		
-		// 이동할 좌표가 유효한 좌표이고 이동 가능한 좌표라면 이동 방향에 추가
-		if (Board->IsInRange(NextPoint.Y, NextPoint.X) && Board->IsTileFree(NextPoint.Y, NextPoint.X))
+		// 이동 가능한 좌표라면 이동 방향에 추가
+		if (Board->IsTileFree(NextPoint.Y, NextPoint.X))
 		{
-			Q.Enqueue(FBfsData(NextPoint, NextPoint));
-			Visited.Add(NextPoint);
+			Q.Add(FBfsData(NextIndex, NextIndex));
+			Visited[NextIndex] = true;
 		}
 	}
 
-	while (!Q.IsEmpty())
+	for (int32 Head = 0; Head < Q.Num(); ++Head)
 	{
-		FBfsData HereData;
-		Q.Dequeue(HereData);
-
-		const FIntPoint HerePoint = HereData.GridPoint;
+		const FBfsData HereData = Q[Head];
 		
-		for (const FIntPoint& Dir : PCUnitCombatUtils::GetRandomDirections(HerePoint.Y % 2 == 0))
+		for (const int32 NextIndex : GetShuffledNeighbors(HereData.TileIndex))
 		{
-			const FIntPoint NextPoint = HerePoint + Dir;
+			if (Visited[NextIndex])
+				continue;
 			
-			if (Board->IsInRange(NextPoint.Y, NextPoint.X) && !Visited.Contains(NextPoint))
-			{
-				
-				const APCBaseUnitCharacter* NextUnit = Board->GetUnitAt(NextPoint.Y, NextPoint.X);
+			const FIntPoint NextPoint = Topology.ToPoint(NextIndex);
+			const APCBaseUnitCharacter* NextUnit = Board->GetUnitAt(NextPoint.Y, NextPoint.X);
 				
-				// 다음에 탐색할 지점에 유닛이 있고, 적 유닛일 경우
-				if (NextUnit && PCUnitCombatUtils::IsHostile(OwnerUnit, NextUnit))
-				{
-					FIntPoint MovePoint = HereData.FirstMovePosition;
-					const FVector MoveLocation = Board->GetTileWorldLocation(MovePoint.Y, MovePoint.X);
-
-					if (Board->SetTileState(MovePoint.Y, MovePoint.X, OwnerUnit, ETileAction::Occupy))
-					{
-						Board->SetTileState(StartPoint.Y, StartPoint.X, OwnerUnit, ETileAction::Release);
-						BB->SetValueAsVector(ApproachLocationKey.SelectedKeyName, MoveLocation);
-						UnitAIC->SetCachedPoint(MovePoint, StartPoint);
-						return EBTNodeResult::Succeeded;
-					}
-				}
+			// 다음에 탐색할 지점에 유닛이 있고, 적 유닛일 경우
+			if (NextUnit && PCUnitCombatUtils::IsHostile(OwnerUnit, NextUnit))
+			{
+				const FIntPoint MovePoint = Topology.ToPoint(HereData.FirstMoveIndex);
+				const FVector MoveLocation = Board->GetTileWorldLocation(MovePoint.Y, MovePoint.X);
 
-				// 다음에 탐색할 지점이 비어있을 경우
-				if (!NextUnit)
+				if (Board->SetTileState(MovePoint.Y, MovePoint.X, OwnerUnit, ETileAction::Occupy))
 				{
-					Q.Enqueue(FBfsData(NextPoint, HereData.FirstMovePosition));
-					Visited.Add(NextPoint);
+					Board->SetTileState(StartPoint.Y, StartPoint.X, OwnerUnit, ETileAction::Release);
+					BB->SetValueAsVector(ApproachLocationKey.SelectedKeyName, MoveLocation);
+					UnitAIC->SetCachedPoint(MovePoint, StartPoint);
+					return EBTNodeResult::Succeeded;
 				}
 			}
+
+			// 다음에 탐색할 지점이 비어있을 경우
+			if (!NextUnit)
+			{
+				Q.Add(FBfsData(NextIndex, HereData.FirstMoveIndex));
+				Visited[NextIndex] = true;
+			}
 		}
 	}
 
@@ -6,6 +6,7 @@
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Character/Unit/PCBaseUnitCharacter.h"
 #include "Controller/Unit/PCUnitAIController.h"
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
 #include "Utility/PCUnitCombatUtils.h"
 
 
@@ -17,6 +18,8 @@ UBTTask_FindReleaseLocationNearTarget::UBTTask_FindReleaseLocationNearTarget()
 EBTNodeResult::Type UBTTask_FindReleaseLocationNearTarget::ExecuteTask(UBehaviorTreeComponent& OwnerComp,
                                                                        uint8* NodeMemory)
 {
+	FPCTelemetryScope TelemetryScope(&OwnerComp, EPCTelemetryPhase::BTTask);
+
 	UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
 	if (!BB)
 		return EBTNodeResult::Failed;
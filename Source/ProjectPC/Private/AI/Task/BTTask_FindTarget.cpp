@@ -7,10 +7,11 @@
 #include "AbilitySystem/Unit/AttributeSet/PCUnitAttributeSet.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Character/Unit/PCBaseUnitCharacter.h"
-#include "Containers/Queue.h"
 #include "Controller/Unit/PCUnitAIController.h"
+#include "GameFramework/HelpActor/PCCombatBoard.h"
+#include "GameFramework/HelpActor/Component/PCTileManager.h"
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
 #include "Utility/PCUnitCombatUtils.h"
-#include "Algo/RandomShuffle.h"
 
 UBTTask_FindTarget::UBTTask_FindTarget()
 {
@@ -19,6 +20,8 @@ UBTTask_FindTarget::UBTTask_FindTarget()
 
 EBTNodeResult::Type UBTTask_FindTarget::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	FPCTelemetryScope TelemetryScope(&OwnerComp, EPCTelemetryPhase::BTTask);
+
 	UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
 	if (!BB)
 		return EBTNodeResult::Failed;
@@ -56,72 +59,66 @@ EBTNodeResult::Type UBTTask_FindTarget::ExecuteTask(UBehaviorTreeComponent& Owne
 		return EBTNodeResult::Failed;
 	}
 	
-	struct FBfsData
+	const UPCTileManager* TileManager = Board->TileManager;
+	if (!TileManager)
 	{
-		FIntPoint GridPoint;
-		// 격자 크기가 7X8 = 56, 최대 탐색 거리가 56이므로 255를 넘지 않는다는 보장이 되어있기 때문에 int8 사용
-		int8 Dist;
-	};
-	
-	// BFS
-	TQueue<FBfsData> Q;
-	TSet<FIntPoint> Visited;
-	Q.Enqueue(FBfsData(StartPoint, 0));
-	Visited.Add(StartPoint);
+		ClearTargetActorKey(BB);
+		return EBTNodeResult::Failed;
+	}
+
+	// 헥스 거리 테이블에서 반경별 링을 가까운 순서대로 훑음 (매 실행 BFS 대신 O(1) 조회)
+	const FPCHexGridTopology& Topology = TileManager->GetHexTopology();
+	const int32 StartIndex = Topology.ToIndex(StartPoint);
+	if (StartIndex == INDEX_NONE)
+	{
+		ClearTargetActorKey(BB);
+		return EBTNodeResult::Failed;
+	}
+
+	const int32 MaxRadius = TargetSearchMode == ETargetSearchMode::Farthest
+		? Topology.GetMaxDistance()
+		: FMath::Min<int32>(Range, Topology.GetMaxDistance());
 	
 	APCBaseUnitCharacter* Farthest = nullptr;
+	TArray<APCBaseUnitCharacter*, TInlineAllocator<8>> Candidates;
 	
-	while (!Q.IsEmpty())
+	for (int32 Radius = 1; Radius <= MaxRadius; ++Radius)
 	{
-		FBfsData HereData;
-		Q.Dequeue(HereData);
-
-		const FIntPoint HerePoint = HereData.GridPoint;
-		const int8 HereDist = HereData.Dist;
-		APCBaseUnitCharacter* HereUnit = Board->GetUnitAt(HerePoint.Y, HerePoint.X);
-
-		// 현재 유닛이 유효하고, 자기 자신이 아니며, 사거리 내에 있고, 적일 경우
-		if (HereUnit && OwnerUnit != HereUnit && IsTargetInRange(Range, HereDist) && PCUnitCombatUtils::IsHostile(OwnerUnit, HereUnit))
+		Candidates.Reset();
+		
+		for (const int32 TileIndex : Topology.GetRing(StartIndex, Radius))
 		{
-			switch (TargetSearchMode)
-			{
-				// 가장 가까이 있는 적을 찾는거라면 바로 Succeeded 반환
-			case ETargetSearchMode::NearestInRange:
-				SetTargetActorKey(HereUnit, BB);
-				return EBTNodeResult::Succeeded;
-				
-				// 가장 멀리 있는 적을 찾는거라면 현재 적을 Target 후보에 추가
-			case ETargetSearchMode::FarthestInRange:
-			case ETargetSearchMode::Farthest:
-				Farthest = HereUnit;
-				break;
+			const FIntPoint Point = Topology.ToPoint(TileIndex);
+			APCBaseUnitCharacter* HereUnit = Board->GetUnitAt(Point.Y, Point.X);
 
-			default:
-				break;
-			}
-		}
-
-		// 현재까지 탐색한 거리가 Range보다 크거나 같다면 더 멀리 탐색하지 않음
-		if (TargetSearchMode != ETargetSearchMode::Farthest)
-		{
-			if (HereDist >= Range)
+			// 현재 유닛이 유효하고, 자기 자신이 아니며, 적일 경우
+			if (HereUnit && OwnerUnit != HereUnit && PCUnitCombatUtils::IsHostile(OwnerUnit, HereUnit))
 			{
-				continue;
+				Candidates.Add(HereUnit);
 			}
 		}
+
+		if (Candidates.IsEmpty())
+			continue;
+
+		// 같은 거리의 후보 중 랜덤 선택 (랜덤성 부여)
+		APCBaseUnitCharacter* Picked = Candidates[FMath::RandHelper(Candidates.Num())];
 		
-		// 탐색 방향 랜덤으로 섞인 Direction 배열 가져옴 (랜덤성 부여)
-		for (const FIntPoint& Dir : PCUnitCombatUtils::GetRandomDirections(HerePoint.Y % 2 == 0))
+		switch (TargetSearchMode)
 		{
-			const FIntPoint NextPoint = HerePoint + Dir;
-			
-			// 다음 탐색 좌표가 보드 내에 존재하는 좌표이고 아직 방문하지 않은 좌표라면 탐색
-			if (Board->IsInRange(NextPoint.Y, NextPoint.X) && !Visited.Contains(NextPoint))
-			{
-				// 새롭게 탐색할 좌표를 큐에 넣고 Visited 방문 체크
-				Q.Enqueue(FBfsData(NextPoint, HereDist + 1));
-				Visited.Add(NextPoint);
-			}	
+			// 가장 가까이 있는 적을 찾는거라면 바로 Succeeded 반환
+		case ETargetSearchMode::NearestInRange:
+			SetTargetActorKey(Picked, BB);
+			return EBTNodeResult::Succeeded;
+				
+			// 가장 멀리 있는 적을 찾는거라면 현재 적을 Target 후보에 추가
+		case ETargetSearchMode::FarthestInRange:
+		case ETargetSearchMode::Farthest:
+			Farthest = Picked;
+			break;
+
+		default:
+			break;
 		}
 	}
 
@@ -148,8 +145,3 @@ void UBTTask_FindTarget::ClearTargetActorKey(UBlackboardComponent* BB) const
 {
 	BB->ClearValue(TargetUnitKey.SelectedKeyName);
 }
-
-bool UBTTask_FindTarget::IsTargetInRange(const int8 Range, const int8 TargetDist) const
-{
-	return TargetSearchMode != ETargetSearchMode::Farthest ? Range >= TargetDist : true;
-}
@@ -10,6 +10,7 @@
 #include "BaseGameplayTags.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "BehaviorTree/Blackboard/BlackboardKeyType_Vector.h"
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
 
 
 UBTTask_TryJumpAbility::UBTTask_TryJumpAbility()
@@ -21,6 +22,8 @@ UBTTask_TryJumpAbility::UBTTask_TryJumpAbility()
 
 EBTNodeResult::Type UBTTask_TryJumpAbility::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	FPCTelemetryScope TelemetryScope(&OwnerComp, EPCTelemetryPhase::BTTask);
+
 	UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
 	if (!BB)
 		return EBTNodeResult::Failed;
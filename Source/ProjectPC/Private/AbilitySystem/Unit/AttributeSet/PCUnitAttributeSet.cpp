@@ -14,9 +14,14 @@ UPCUnitAttributeSet::UPCUnitAttributeSet()
 
 float UPCUnitAttributeSet::GetEffectiveAttackSpeed() const
 {
-	const float Base = GetAttackSpeed();
-	const float IncPercent = FMath::Max(0.f, GetAttackSpeedIncreaseMultiplier());
-	const float DecPercent = FMath::Clamp(GetAttackSpeedDecreaseMultiplier(), 0.f, 100.f);
+	return CalcEffectiveAttackSpeed(GetAttackSpeed(), GetAttackSpeedIncreaseMultiplier(), GetAttackSpeedDecreaseMultiplier());
+}
+
+float UPCUnitAttributeSet::CalcEffectiveAttackSpeed(float BaseAttackSpeed, float IncreasePercent, float DecreasePercent)
+{
+	const float Base = BaseAttackSpeed;
+	const float IncPercent = FMath::Max(0.f, IncreasePercent);
+	const float DecPercent = FMath::Clamp(DecreasePercent, 0.f, 100.f);
 
 	const float IncFactor = 1.f + (IncPercent * 0.01f);
 	const float DecFactor = 1.f - (DecPercent * 0.01f);
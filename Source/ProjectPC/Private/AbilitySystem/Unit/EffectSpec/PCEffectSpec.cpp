@@ -4,7 +4,51 @@
 #include "AbilitySystem/Unit/EffectSpec/PCEffectSpec.h"
 
 #include "AbilitySystemComponent.h"
+#include "EngineUtils.h"
 #include "GenericTeamAgentInterface.h"
+#include "AbilitySystem/Unit/EffectSpec/PCEffectSpec_Static.h"
+#include "Character/Unit/PCBaseUnitCharacter.h"
+#include "GameFramework/WorldSubsystem/PCUnitGERegistrySubsystem.h"
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarPCUseOutgoingSpecCache(
+		TEXT("PC.GE.SpecCache"),
+		true,
+		TEXT("UPCEffectSpec Outgoing Spec 캐시 사용 여부 (0이면 적용마다 MakeOutgoingSpec)"));
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithWorldAndArgs GPCBenchSpecCacheCommand(
+		TEXT("PC.GE.BenchSpecCache"),
+		TEXT("글로벌 궁극기(대상 N명) 기준 Outgoing Spec 준비 비용 비교. 인자: [NumTargets=28] [NumCasts=1000]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World || World->GetNetMode() == NM_Client)
+				return;
+
+			const int32 NumTargets = Args.IsValidIndex(0) ? FCString::Atoi(*Args[0]) : 28;
+			const int32 NumCasts = Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 1000;
+
+			UAbilitySystemComponent* SourceASC = nullptr;
+			for (TActorIterator<APCBaseUnitCharacter> It(World); It; ++It)
+			{
+				SourceASC = It->GetAbilitySystemComponent();
+				if (SourceASC)
+					break;
+			}
+
+			UPCUnitGERegistrySubsystem* GERegistry = World->GetSubsystem<UPCUnitGERegistrySubsystem>();
+			const TSubclassOf<UGameplayEffect> GEClass = GERegistry ? GERegistry->GetGEClass(GameplayEffectTags::GE_Class_Unit_Damage) : nullptr;
+			if (!SourceASC || !GEClass)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[SpecCache] Benchmark needs a spawned unit and a registered damage GE"));
+				return;
+			}
+
+			UPCEffectSpec::DebugBenchmarkOutgoingSpecCache(SourceASC, GEClass, GameplayEffectTags::GE_Caller_Damage, NumTargets, NumCasts);
+		}));
+#endif
+}
 
 FActiveGameplayEffectHandle UPCEffectSpec::ApplyEffect(UAbilitySystemComponent* SourceASC, const AActor* Target, int32 EffectLevel)
 {
@@ -36,3 +80,101 @@ void UPCEffectSpec::ApplyDurationOptions(FGameplayEffectSpec& Spec) const
 		Spec.SetSetByCallerMagnitude(DurationCallerTag, DurationByCallerSeconds);
 	}
 }
+
+FGameplayEffectSpec* UPCEffectSpec::GetOutgoingSpec(UAbilitySystemComponent* SourceASC,
+	const TSubclassOf<UGameplayEffect>& GEClass, int32 Level, uint32 Variant, bool& bOutCreated)
+{
+	bOutCreated = false;
+	
+	if (!SourceASC || !GEClass)
+		return nullptr;
+
+	if (!CVarPCUseOutgoingSpecCache.GetValueOnGameThread())
+	{
+		UncachedOutgoingSpec = SourceASC->MakeOutgoingSpec(GEClass, Level, SourceASC->MakeEffectContext());
+		bOutCreated = UncachedOutgoingSpec.IsValid();
+		return UncachedOutgoingSpec.Data.Get();
+	}
+
+	const FOutgoingSpecKey Key { SourceASC, Level, Variant };
+	if (const FGameplayEffectSpecHandle* Found = CachedOutgoingSpecs.Find(Key))
+	{
+		FGameplayEffectSpec* Spec = Found->Data.Get();
+		if (Spec && Spec->Def == GEClass->GetDefaultObject<UGameplayEffect>())
+		{
+			// 소스 태그는 Spec 생성 시점에 캡처되므로 적용 시점 기준으로 갱신
+			SourceASC->GetOwnedGameplayTags(Spec->CapturedSourceTags.GetActorTags());
+			return Spec;
+		}
+	}
+
+	// 사라진 유닛의 캐시 정리
+	if (CachedOutgoingSpecs.Num() >= MaxCachedOutgoingSpecs)
+	{
+		for (auto It = CachedOutgoingSpecs.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().SourceASC.IsValid())
+				It.RemoveCurrent();
+		}
+
+		if (CachedOutgoingSpecs.Num() >= MaxCachedOutgoingSpecs)
+			CachedOutgoingSpecs.Reset();
+	}
+
+	const FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(GEClass, Level, SourceASC->MakeEffectContext());
+	if (!SpecHandle.IsValid())
+		return nullptr;
+
+	CachedOutgoingSpecs.Add(Key, SpecHandle);
+	bOutCreated = true;
+	
+	return SpecHandle.Data.Get();
+}
+
+void UPCEffectSpec::DebugBenchmarkOutgoingSpecCache(UAbilitySystemComponent* SourceASC,
+	TSubclassOf<UGameplayEffect> GEClass, FGameplayTag CallerTag, int32 NumTargets, int32 NumCasts)
+{
+#if !UE_BUILD_SHIPPING
+	if (!SourceASC || !GEClass || NumTargets <= 0 || NumCasts <= 0)
+		return;
+
+	// 1) 기존 방식: 대상마다 Context + Outgoing Spec 생성
+	int32 LegacySpecs = 0;
+	const double LegacyStart = FPlatformTime::Seconds();
+	for (int32 Cast = 0; Cast < NumCasts; ++Cast)
+	{
+		for (int32 i = 0; i < NumTargets; ++i)
+		{
+			const FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(GEClass, 1, SourceASC->MakeEffectContext());
+			if (SpecHandle.IsValid())
+			{
+				++LegacySpecs;
+				SpecHandle.Data->SetSetByCallerMagnitude(CallerTag, 100.f + i);
+			}
+		}
+	}
+	const double LegacyMs = (FPlatformTime::Seconds() - LegacyStart) * 1000.0;
+
+	// 2) 캐시 방식: 같은 EffectSpec 인스턴스로 SetByCaller 값만 교체
+	UPCEffectSpec* CacheOwner = NewObject<UPCEffectSpec_Static>(GetTransientPackage());
+	int32 CachedSpecs = 0;
+	const double CachedStart = FPlatformTime::Seconds();
+	for (int32 Cast = 0; Cast < NumCasts; ++Cast)
+	{
+		for (int32 i = 0; i < NumTargets; ++i)
+		{
+			bool bCreated = false;
+			if (FGameplayEffectSpec* Spec = CacheOwner->GetOutgoingSpec(SourceASC, GEClass, 1, 0, bCreated))
+			{
+				Spec->SetSetByCallerMagnitude(CallerTag, 100.f + i);
+			}
+			CachedSpecs += bCreated ? 1 : 0;
+		}
+	}
+	const double CachedMs = (FPlatformTime::Seconds() - CachedStart) * 1000.0;
+
+	// 할당 수는 추정하지 않고 실제로 새로 만든 Spec 수만 기록 (메모리는 memreport / LLM 으로 확인)
+	UE_LOG(LogTemp, Log, TEXT("[SpecCache] Targets=%d Casts=%d | Legacy: %.3f ms, %d specs created | Cached: %.3f ms, %d specs created (SpecCache=%d)"),
+		NumTargets, NumCasts, LegacyMs, LegacySpecs, CachedMs, CachedSpecs, CVarPCUseOutgoingSpecCache.GetValueOnGameThread() ? 1 : 0);
+#endif
+}
@@ -27,26 +27,28 @@ FActiveGameplayEffectHandle UPCEffectSpec_AttributeChange::ApplyEffectImpl(UAbil
 
 	const int32 Level = (EffectLevel > 0) ? EffectLevel : DefaultLevel;
 	
-	FGameplayEffectContextHandle Ctx = SourceASC->MakeEffectContext();
-	FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(GEClass, Level, Ctx);
-	if (!SpecHandle.IsValid())
+	bool bNewSpec = false;
+	FGameplayEffectSpec* Spec = GetOutgoingSpec(SourceASC, GEClass, Level, 0, bNewSpec);
+	if (!Spec)
 		return OutHandle;
 
-	FGameplayEffectSpec& Spec = *SpecHandle.Data.Get();
-	ApplyDurationOptions(Spec);
+	if (bNewSpec)
+	{
+		ApplyDurationOptions(*Spec);
+	}
 
 	// Editor에서 설정한 EffectCallerTag, EffectMagnitude 값을 바탕으로
 	// SetSetByCallerMagnitude 값 설정
 	const float Value = EffectMagnitude.Evaluate(Level);
-	SpecHandle.Data->SetSetByCallerMagnitude(EffectCallerTag, Value);
+	Spec->SetSetByCallerMagnitude(EffectCallerTag, Value);
 
 	if (TargetGroup == EEffectTargetGroup::Self)
 	{
-		OutHandle = SourceASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+		OutHandle = SourceASC->ApplyGameplayEffectSpecToSelf(*Spec);
 	}
 	else
 	{
-		OutHandle = SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);	
+		OutHandle = SourceASC->ApplyGameplayEffectSpecToTarget(*Spec, TargetASC);	
 	}
 	
 	return OutHandle;
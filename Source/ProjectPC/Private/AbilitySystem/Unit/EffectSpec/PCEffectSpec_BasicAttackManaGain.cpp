@@ -5,6 +5,7 @@
 
 #include "AbilitySystemComponent.h"
 #include "Character/Unit/PCBaseUnitCharacter.h"
+#include "GameFramework/WorldSubsystem/PCMatchRandomSubsystem.h"
 
 
 UPCEffectSpec_BasicAttackManaGain::UPCEffectSpec_BasicAttackManaGain()
@@ -29,15 +30,20 @@ FActiveGameplayEffectHandle UPCEffectSpec_BasicAttackManaGain::ApplyEffectImpl(U
 	if (!GEClass)
 		return OutHandle;
 	
-	const FGameplayEffectContextHandle Ctx = SourceASC->MakeEffectContext();
-	const FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(GEClass, 1.f, Ctx);
-	if (!SpecHandle.IsValid())
+	bool bNewSpec = false;
+	FGameplayEffectSpec* Spec = GetOutgoingSpec(SourceASC, GEClass, 1, 0, bNewSpec);
+	if (!Spec)
 		return OutHandle;
 
 	const APCBaseUnitCharacter* Unit = Cast<APCBaseUnitCharacter>(Target);
 	int32 UnitLevel = Unit ? Unit->GetUnitLevel() : 1;
 	// 1레벨 유닛일 경우 6~10 랜덤 회복, 2레벨 이상일 경우 10 고정 회복
-	float ManaGainValue = (UnitLevel <= 1) ? static_cast<float>(FMath::RandRange(6, 10)) : 10.f;
+	float ManaGainValue = 10.f;
+	if (UnitLevel <= 1)
+	{
+		const FPCRandomChannel* DamageRandom = UPCMatchRandomSubsystem::FindUnitBoardChannel(SourceASC->GetOwner(), PCRandomChannels::Damage);
+		ManaGainValue = static_cast<float>(DamageRandom ? DamageRandom->RandRange(6, 10) : FMath::RandRange(6, 10));
+	}
 
 	// 마법사 시너지 버프가 활성화 됐을 경우 마나회복량 2배
 	if (SourceASC->HasMatchingGameplayTag(UnitGameplayTags::Unit_Buff_Synergy_Mage_DoubleManaGain))
@@ -45,9 +51,9 @@ FActiveGameplayEffectHandle UPCEffectSpec_BasicAttackManaGain::ApplyEffectImpl(U
 		ManaGainValue *= 2.f;
 	}
 	
-	SpecHandle.Data->SetSetByCallerMagnitude(EffectCallerTag, ManaGainValue);
+	Spec->SetSetByCallerMagnitude(EffectCallerTag, ManaGainValue);
 	
-	OutHandle = SourceASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+	OutHandle = SourceASC->ApplyGameplayEffectSpecToSelf(*Spec);
 
 	return OutHandle;
 }
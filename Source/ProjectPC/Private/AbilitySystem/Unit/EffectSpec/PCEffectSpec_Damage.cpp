@@ -46,36 +46,42 @@ FActiveGameplayEffectHandle UPCEffectSpec_Damage::ApplyEffectImpl(UAbilitySystem
 	if (!TargetASC)
 		return OutHandle;
 	
-	const TSubclassOf<UGameplayEffect> GEClass = ResolveGEClass(SourceASC->GetWorld());
+	const TSubclassOf<UGameplayEffect> GEClass = GetResolvedGEClass(SourceASC);
 	if (!GEClass)
 		return OutHandle;
 	
 	const int32 Level = (EffectLevel > 0) ? EffectLevel : DefaultLevel;
-	const FGameplayEffectContextHandle Ctx = SourceASC->MakeEffectContext();
-	const FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(GEClass, Level, Ctx);
-	if (!SpecHandle.IsValid())
-		return OutHandle;
+	// 고정 데미지 변환 여부에 따라 동적 태그가 달라지므로 캐시 Variant 분리
+	const bool bTrueDamage = SourceASC->HasMatchingGameplayTag(UnitGameplayTags::Unit_Buff_Synergy_Darkness_TrueDamage);
 	
-	SpecHandle.Data->SetSetByCallerMagnitude(EffectCallerTag, BaseDamage);
-	if (DamageType.IsValid())
-		SpecHandle.Data->AddDynamicAssetTag(DamageType);
-	if (AttackType.IsValid())
-		SpecHandle.Data->AddDynamicAssetTag(AttackType);
-	if (bNoCrit)
-		SpecHandle.Data->AddDynamicAssetTag(NoCritTag);
-	if (bNoVamp)
-		SpecHandle.Data->AddDynamicAssetTag(NoVampTag);
-	if (bNoManaGain)
-		SpecHandle.Data->AddDynamicAssetTag(NoManaGainTag);
-	if (bNoSendHitEvent)
-		SpecHandle.Data->AddDynamicAssetTag(NoSendHitEventTag);
-	if (bNoSendAppliedDamageEvent)
-		SpecHandle.Data->AddDynamicAssetTag(NoSendDamageAppliedEventTag);
+	bool bNewSpec = false;
+	FGameplayEffectSpec* Spec = GetOutgoingSpec(SourceASC, GEClass, Level, bTrueDamage ? 1 : 0, bNewSpec);
+	if (!Spec)
+		return OutHandle;
 
-	if (SourceASC->HasMatchingGameplayTag(UnitGameplayTags::Unit_Buff_Synergy_Darkness_TrueDamage))
-		SpecHandle.Data->AddDynamicAssetTag(UnitGameplayTags::Unit_DamageType_TrueDamage);
+	if (bNewSpec)
+	{
+		if (DamageType.IsValid())
+			Spec->AddDynamicAssetTag(DamageType);
+		if (AttackType.IsValid())
+			Spec->AddDynamicAssetTag(AttackType);
+		if (bNoCrit)
+			Spec->AddDynamicAssetTag(NoCritTag);
+		if (bNoVamp)
+			Spec->AddDynamicAssetTag(NoVampTag);
+		if (bNoManaGain)
+			Spec->AddDynamicAssetTag(NoManaGainTag);
+		if (bNoSendHitEvent)
+			Spec->AddDynamicAssetTag(NoSendHitEventTag);
+		if (bNoSendAppliedDamageEvent)
+			Spec->AddDynamicAssetTag(NoSendDamageAppliedEventTag);
+		if (bTrueDamage)
+			Spec->AddDynamicAssetTag(UnitGameplayTags::Unit_DamageType_TrueDamage);
+	}
+	
+	Spec->SetSetByCallerMagnitude(EffectCallerTag, BaseDamage);
 	
-	OutHandle = SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+	OutHandle = SourceASC->ApplyGameplayEffectSpecToTarget(*Spec, TargetASC);
 	
 	return OutHandle;
 }
@@ -29,25 +29,27 @@ FActiveGameplayEffectHandle UPCEffectSpec_GrantTag::ApplyEffectImpl(UAbilitySyst
 
 	const int32 Level = (EffectLevel > 0) ? EffectLevel : DefaultLevel;
 
-	FGameplayEffectContextHandle Ctx = SourceASC->MakeEffectContext();
-	FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(GEClass, Level, Ctx);
-	if (!SpecHandle.IsValid())
+	bool bNewSpec = false;
+	FGameplayEffectSpec* Spec = GetOutgoingSpec(SourceASC, GEClass, Level, 0, bNewSpec);
+	if (!Spec)
 		return OutHandle;
 	
-	FGameplayEffectSpec& Spec = *SpecHandle.Data.Get();
-	ApplyDurationOptions(Spec);
+	if (bNewSpec)
+	{
+		ApplyDurationOptions(*Spec);
 
-	// DynamicGrantTags에 부여할 GrantTag를 추가하는 방식으로
-	// GE를 적용하면 태그가 부여되도록 구현
-	SpecHandle.Data->DynamicGrantedTags.AddTag(GrantTag);
+		// DynamicGrantTags에 부여할 GrantTag를 추가하는 방식으로
+		// GE를 적용하면 태그가 부여되도록 구현
+		Spec->DynamicGrantedTags.AddTag(GrantTag);
+	}
 
 	if (TargetGroup == EEffectTargetGroup::Self)
 	{
-		OutHandle = SourceASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+		OutHandle = SourceASC->ApplyGameplayEffectSpecToSelf(*Spec);
 	}
 	else
 	{
-		OutHandle = SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);	
+		OutHandle = SourceASC->ApplyGameplayEffectSpecToTarget(*Spec, TargetASC);	
 	}
 	
 	return OutHandle;
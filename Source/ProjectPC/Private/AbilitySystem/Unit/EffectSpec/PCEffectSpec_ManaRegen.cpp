@@ -35,14 +35,14 @@ FActiveGameplayEffectHandle UPCEffectSpec_ManaRegen::ApplyEffectImpl(UAbilitySys
 		return OutHandle;
 	
 	const int32 Level = (EffectLevel > 0) ? EffectLevel : DefaultLevel;
-	const FGameplayEffectContextHandle Ctx = SourceASC->MakeEffectContext();
-	const FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(GEClass, Level, Ctx);
-	if (!SpecHandle.IsValid())
+	bool bNewSpec = false;
+	FGameplayEffectSpec* Spec = GetOutgoingSpec(SourceASC, GEClass, Level, 0, bNewSpec);
+	if (!Spec)
 		return OutHandle;
 
-	SpecHandle.Data->SetSetByCallerMagnitude(EffectCallerTag, ManaRegenValue);
+	Spec->SetSetByCallerMagnitude(EffectCallerTag, ManaRegenValue);
 	
-	SourceASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+	SourceASC->ApplyGameplayEffectSpecToSelf(*Spec);
 
 	return OutHandle;
 }
@@ -3,6 +3,7 @@
 
 #include "AbilitySystem/Unit/EffectSpec/PCEffectSpec_SetByCaller.h"
 
+#include "AbilitySystemComponent.h"
 #include "GameFramework/WorldSubsystem/PCUnitGERegistrySubsystem.h"
 
 
@@ -25,3 +26,11 @@ TSubclassOf<UGameplayEffect> UPCEffectSpec_SetByCaller::ResolveGEClass(const UWo
 
 	return nullptr;
 }
+
+TSubclassOf<UGameplayEffect> UPCEffectSpec_SetByCaller::GetResolvedGEClass(const UAbilitySystemComponent* SourceASC)
+{
+	if (CachedGEClass)
+		return CachedGEClass;
+
+	return SourceASC ? ResolveGEClass(SourceASC->GetWorld()) : nullptr;
+}
@@ -24,21 +24,23 @@ FActiveGameplayEffectHandle UPCEffectSpec_Static::ApplyEffectImpl(UAbilitySystem
 
 	const int32 Level = (EffectLevel > 0) ? EffectLevel : DefaultLevel;
 
-	FGameplayEffectContextHandle Ctx = SourceASC->MakeEffectContext();
-	FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(GEClass, Level, Ctx);
-	if (!SpecHandle.IsValid())
+	bool bNewSpec = false;
+	FGameplayEffectSpec* Spec = GetOutgoingSpec(SourceASC, GEClass, Level, 0, bNewSpec);
+	if (!Spec)
 		return Result;
 
-	FGameplayEffectSpec& Spec = *SpecHandle.Data.Get();
-	ApplyDurationOptions(Spec);
+	if (bNewSpec)
+	{
+		ApplyDurationOptions(*Spec);
+	}
 	
 	if (TargetGroup == EEffectTargetGroup::Self)
 	{
-		Result = SourceASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+		Result = SourceASC->ApplyGameplayEffectSpecToSelf(*Spec);
 	}
 	else
 	{
-		Result = SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+		Result = SourceASC->ApplyGameplayEffectSpecToTarget(*Spec, TargetASC);
 	}
 
 	return Result;
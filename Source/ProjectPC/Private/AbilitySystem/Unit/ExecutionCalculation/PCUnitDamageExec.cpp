@@ -2,8 +2,11 @@
 
 
 #include "AbilitySystem/Unit/ExecutionCalculation/PCUnitDamageExec.h"
+#include "AbilitySystem/Unit/ExecutionCalculation/PCUnitDamageFormula.h"
 #include "AbilitySystem/Unit/AttributeSet/PCHeroUnitAttributeSet.h"
 #include "AbilitySystem/Unit/AttributeSet/PCUnitAttributeSet.h"
+#include "GameFramework/WorldSubsystem/PCCombatReplaySubsystem.h"
+#include "GameFramework/WorldSubsystem/PCMatchRandomSubsystem.h"
 #include "GameFramework/WorldSubsystem/PCUnitGERegistrySubsystem.h"
 
 static FGameplayEffectAttributeCaptureDefinition MakeCapture(const FGameplayAttribute& Attr,
@@ -101,6 +104,19 @@ void UPCUnitDamageExec::Execute_Implementation(const FGameplayEffectCustomExecut
 	EvalParams.SourceTags = Spec.CapturedSourceTags.GetAggregatedTags();
 	EvalParams.TargetTags = Spec.CapturedTargetTags.GetAggregatedTags();
 
+	// 치명타 / 회피 판정은 피격 유닛이 있는 전투 보드의 매치 시드 하위 채널 사용 (페어별 리플레이 재현용)
+	const FPCRandomChannel* DamageRandom = UPCMatchRandomSubsystem::FindUnitBoardChannel(TargetASC->GetOwner(), PCRandomChannels::Damage);
+
+	// 전투 리플레이 기록 (기록 중인 페어가 없으면 null)
+	UPCCombatReplaySubsystem* Replay = UPCCombatReplaySubsystem::FindRecorder(TargetASC->GetOwner());
+	uint8 ReplayFlags = 0;
+	if (bIsTrueDamage)
+		ReplayFlags |= EPCReplayDamageFlags::TrueDamage;
+	else if (bIsMagic)
+		ReplayFlags |= EPCReplayDamageFlags::Magic;
+	else if (bIsPhysical)
+		ReplayFlags |= EPCReplayDamageFlags::Physical;
+
 	// 캡처 값 가져오기
 	auto GetMagnitude = [&ExecutionParams, &EvalParams](const FGameplayEffectAttributeCaptureDefinition& Def, float& OutVal)
 	{
@@ -113,8 +129,7 @@ void UPCUnitDamageExec::Execute_Implementation(const FGameplayEffectCustomExecut
 	{
 		float Evasion = 0.f;
 		GetMagnitude(Captures.Evasion, Evasion);
-		Evasion *= 0.01f;
-		if (Evasion > 0.f && FMath::FRand() < Evasion)
+		if (PCUnitDamageFormula::RollEvasion(Evasion, DamageRandom))
 		{
 			// 데미지 입는 대상 회피 성공
 			// 빗나감 텍스트 UI 띄우고 return
@@ -124,6 +139,11 @@ void UPCUnitDamageExec::Execute_Implementation(const FGameplayEffectCustomExecut
 			CueParams.AggregatedSourceTags.AddTag(UnitGameplayTags::Unit_CombatText_Type_Miss);
 	
 			TargetASC->ExecuteGameplayCue(GameplayCueTags::GameplayCue_UI_Unit_CombatText, CueParams);
+
+			if (Replay)
+			{
+				Replay->RecordDamage(SourceASC->GetAvatarActor(), TargetASC->GetAvatarActor(), 0.f, ReplayFlags | EPCReplayDamageFlags::Evaded);
+			}
 			
 			return;
 		}
@@ -162,63 +182,46 @@ void UPCUnitDamageExec::Execute_Implementation(const FGameplayEffectCustomExecut
 		TargetASC->HandleGameplayEvent(OnHitEventTag, &OnHitData);
 	}
 	
-	// 타입 데미지 배율
-	float TypeMul = 0.f;
+	// 데미지 공식에 필요한 값 캡처
+	FPCDamageFormulaParams FormulaParams;
+	FormulaParams.BaseDamage = BaseDamage;
+	FormulaParams.bIsPhysical = bIsPhysical;
+	FormulaParams.bIsMagic = bIsMagic;
+	FormulaParams.bIsTrueDamage = bIsTrueDamage;
+	FormulaParams.bNoCrit = bNoCrit;
+	
 	if (bIsPhysical)
-		GetMagnitude(Captures.PhysDamageMultiplier, TypeMul);
+	{
+		GetMagnitude(Captures.PhysDamageMultiplier, FormulaParams.TypeDamageMultiplierPct);
+		GetMagnitude(Captures.PhysicalDefense, FormulaParams.Defense);
+	}
 	else if (bIsMagic)
-		GetMagnitude(Captures.MagicDamageMultiplier, TypeMul);
-	TypeMul *= 0.01f;
-	BaseDamage *= 1.f + TypeMul;
+	{
+		GetMagnitude(Captures.MagicDamageMultiplier, FormulaParams.TypeDamageMultiplierPct);
+		GetMagnitude(Captures.MagicDefense, FormulaParams.Defense);
+	}
 	
-	bool bIsCritical = false;
 	if (!bNoCrit)
 	{
-		// 치명타
-		float CritChance = 0.f, CritMul = 30.f;
-		GetMagnitude(Captures.CritChance, CritChance);
-		CritChance *= 0.01f;
-		GetMagnitude(Captures.CritMultiplier, CritMul);
-		CritMul *= 0.01f;
-	
-		if (CritChance > 0.f && CritMul > 0.f)
-		{
-			if (FMath::FRand() < FMath::Clamp(CritChance, 0.f, 1.f))
-			{
-				bIsCritical = true;
-				BaseDamage *= (1.f + CritMul);
-			}
-		}
+		GetMagnitude(Captures.CritChance, FormulaParams.CritChancePct);
+		GetMagnitude(Captures.CritMultiplier, FormulaParams.CritMultiplierPct);
 	}
+	
+	GetMagnitude(Captures.FlatDamageBlock, FormulaParams.FlatDamageBlock);
+	GetMagnitude(Captures.DamageMultiplier, FormulaParams.DamageMultiplierPct);
 
-	float FinalDamage = FMath::Max(0.f, BaseDamage);
+	const FPCDamageFormulaResult FormulaResult = PCUnitDamageFormula::Resolve(FormulaParams, DamageRandom);
+	if (!FormulaResult.IsApplied())
+		return;
 
-	if (!bIsTrueDamage)
-	{
-		float Defense = 0.f;
-		if (bIsPhysical)
-			GetMagnitude(Captures.PhysicalDefense, Defense);
-		else if (bIsMagic)
-			GetMagnitude(Captures.MagicDefense, Defense);
-		
-		// 데미지 경감 공식
-		const float Mitigation = 100.f / (100.f + Defense);
-		FinalDamage = FMath::Max(0.f, BaseDamage * Mitigation);
+	const float FinalDamage = FormulaResult.FinalDamage;
+	const bool bIsCritical = FormulaResult.bIsCritical;
 
-		float FlatBlock = 0.f;
-		GetMagnitude(Captures.FlatDamageBlock, FlatBlock);
-		FinalDamage = FMath::Max(0.f, FinalDamage - FMath::Max(0.f, FlatBlock));
+	if (Replay)
+	{
+		Replay->RecordDamage(SourceASC->GetAvatarActor(), TargetASC->GetAvatarActor(), FinalDamage,
+			bIsCritical ? (ReplayFlags | EPCReplayDamageFlags::Critical) : ReplayFlags);
 	}
-
-	if (FinalDamage <= KINDA_SMALL_NUMBER)
-		return;
-
-	// 최종 데미지 배율 적용
-	float FinalMul = 0.f;
-	GetMagnitude(Captures.DamageMultiplier, FinalMul);
-	FinalMul *= 0.01f;
-	FinalMul = FMath::Max(0.f, FinalMul);
-	FinalDamage *= 1.f + FinalMul;
 	
 	// Health에 음수로 적용
 	OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(
@@ -244,8 +247,7 @@ void UPCUnitDamageExec::Execute_Implementation(const FGameplayEffectCustomExecut
 		// 감소전 피해량 & 감소후 피해량에 따라 마나 회복 (영웅 전용)
 		if (!bNoManaGain)
 		{
-			float ManaGain = BaseDamage * 0.01f + FinalDamage * 0.07f;
-			ManaGain = FMath::Clamp(ManaGain, 0.f, 50.f);
+			const float ManaGain = PCUnitDamageFormula::CalcManaGainOnHit(FormulaResult);
 		
 			OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(
 				UPCHeroUnitAttributeSet::GetCurrentManaAttribute(),
@@ -260,11 +262,9 @@ void UPCUnitDamageExec::Execute_Implementation(const FGameplayEffectCustomExecut
 		float VampPct = 0.f;
 		GetMagnitude(Captures.LifeSteal, VampPct);
 		
-		VampPct *= 0.01f;
-	
 		if (VampPct > 0.f)
 		{
-			const float HealAmount = FinalDamage * VampPct;
+			const float HealAmount = PCUnitDamageFormula::CalcLifeStealHeal(FormulaResult, VampPct);
 			if (HealAmount > KINDA_SMALL_NUMBER)
 			{
 				if (const UGameplayEffect* HealGE = ResolveHealGE(SourceASC->GetWorld()))
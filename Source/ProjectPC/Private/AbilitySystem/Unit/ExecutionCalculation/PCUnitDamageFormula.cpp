@@ -0,0 +1,77 @@
+#include "AbilitySystem/Unit/ExecutionCalculation/PCUnitDamageFormula.h"
+
+float PCUnitDamageFormula::Roll(const FPCRandomChannel* Stream)
+{
+	return Stream ? Stream->FRand() : FMath::FRand();
+}
+
+bool PCUnitDamageFormula::RollEvasion(float EvasionChancePct, const FPCRandomChannel* Stream)
+{
+	const float Evasion = EvasionChancePct * 0.01f;
+	return Evasion > 0.f && Roll(Stream) < Evasion;
+}
+
+FPCDamageFormulaResult PCUnitDamageFormula::Resolve(const FPCDamageFormulaParams& Params, const FPCRandomChannel* Stream)
+{
+	FPCDamageFormulaResult Result;
+
+	if (Params.BaseDamage <= 0.f)
+		return Result;
+	
+	// 타입 데미지 배율
+	float BaseDamage = Params.BaseDamage;
+	if (Params.bIsPhysical || Params.bIsMagic)
+	{
+		BaseDamage *= 1.f + Params.TypeDamageMultiplierPct * 0.01f;
+	}
+
+	// 치명타
+	if (!Params.bNoCrit)
+	{
+		const float CritChance = Params.CritChancePct * 0.01f;
+		const float CritMul = Params.CritMultiplierPct * 0.01f;
+
+		if (CritChance > 0.f && CritMul > 0.f)
+		{
+			if (Roll(Stream) < FMath::Clamp(CritChance, 0.f, 1.f))
+			{
+				Result.bIsCritical = true;
+				BaseDamage *= (1.f + CritMul);
+			}
+		}
+	}
+
+	Result.PreMitigationDamage = BaseDamage;
+	float FinalDamage = FMath::Max(0.f, BaseDamage);
+
+	if (!Params.bIsTrueDamage)
+	{
+		// 데미지 경감 공식
+		const float Defense = (Params.bIsPhysical || Params.bIsMagic) ? Params.Defense : 0.f;
+		const float Mitigation = 100.f / (100.f + Defense);
+		FinalDamage = FMath::Max(0.f, BaseDamage * Mitigation);
+		FinalDamage = FMath::Max(0.f, FinalDamage - FMath::Max(0.f, Params.FlatDamageBlock));
+	}
+
+	if (FinalDamage <= KINDA_SMALL_NUMBER)
+		return Result;
+
+	// 최종 데미지 배율 적용
+	const float FinalMul = FMath::Max(0.f, Params.DamageMultiplierPct * 0.01f);
+	Result.FinalDamage = FinalDamage * (1.f + FinalMul);
+	
+	return Result;
+}
+
+float PCUnitDamageFormula::CalcManaGainOnHit(const FPCDamageFormulaResult& Result)
+{
+	// 감소전 피해량 & 감소후 피해량에 따라 마나 회복
+	const float ManaGain = Result.PreMitigationDamage * 0.01f + Result.FinalDamage * 0.07f;
+	return FMath::Clamp(ManaGain, 0.f, 50.f);
+}
+
+float PCUnitDamageFormula::CalcLifeStealHeal(const FPCDamageFormulaResult& Result, float LifeStealPct)
+{
+	const float VampPct = LifeStealPct * 0.01f;
+	return VampPct > 0.f ? Result.FinalDamage * VampPct : 0.f;
+}
@@ -10,6 +10,7 @@
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Character/Projectile/PCBaseProjectile.h"
 #include "Character/Unit/PCBaseUnitCharacter.h"
+#include "GameFramework/WorldSubsystem/PCProjectileSimSubsystem.h"
 
 UPCUnitBaseAttackGameplayAbility::UPCUnitBaseAttackGameplayAbility()
 {
@@ -137,6 +138,14 @@ void UPCUnitBaseAttackGameplayAbility::OnSpawnProjectileSucceed(FGameplayEventDa
 				Projectile->SetEffectSpecs(AbilityConfig.ProjectilePayloadEffectSpecs.EffectSpecs);
 				PlayAttackSound();
 			}
+			else if (P->SimProjectileId != 0)
+			{
+				if (UPCProjectileSimSubsystem* ProjectileSim = GetWorld() ? GetWorld()->GetSubsystem<UPCProjectileSimSubsystem>() : nullptr)
+				{
+					ProjectileSim->SetEffectSpecs(P->SimProjectileId, AbilityConfig.ProjectilePayloadEffectSpecs.EffectSpecs);
+				}
+				PlayAttackSound();
+			}
 		}
 	}
 }
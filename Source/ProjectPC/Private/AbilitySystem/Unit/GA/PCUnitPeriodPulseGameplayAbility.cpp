@@ -24,10 +24,11 @@ void UPCUnitPeriodPulseGameplayAbility::ActivateAbility(const FGameplayAbilitySp
 	if (!HasAuthority(&ActivationInfo) || !ActorInfo)
 		return;
 	
-	if (UWorld* World = GetWorld())
+	if (UPCCombatSchedulerSubsystem* Scheduler = GetWorld() ? GetWorld()->GetSubsystem<UPCCombatSchedulerSubsystem>() : nullptr)
 	{
-		World->GetTimerManager().SetTimer(
-			PulseTimer, this, &ThisClass::OnPulseTick, PeriodSeconds, true, PeriodSeconds);
+		Scheduler->UnregisterJob(PulseJob);
+		PulseJob = Scheduler->RegisterJob(GetClass()->GetFName(), this, PeriodSeconds, PeriodSeconds,
+			[this]() { OnPulseTick(); });
 	}
 }
 
@@ -35,13 +36,13 @@ void UPCUnitPeriodPulseGameplayAbility::EndAbility(const FGameplayAbilitySpecHan
 	const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo,
 	bool bReplicateEndAbility, bool bWasCancelled)
 {
-	if (PulseTimer.IsValid())
+	if (PulseJob.IsValid())
 	{
-		if (UWorld* World = GetWorld())
+		if (UPCCombatSchedulerSubsystem* Scheduler = GetWorld() ? GetWorld()->GetSubsystem<UPCCombatSchedulerSubsystem>() : nullptr)
 		{
-			World->GetTimerManager().ClearTimer(PulseTimer);
+			Scheduler->UnregisterJob(PulseJob);
 		}
-		PulseTimer.Invalidate();
+		PulseJob.Invalidate();
 	}
 	
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
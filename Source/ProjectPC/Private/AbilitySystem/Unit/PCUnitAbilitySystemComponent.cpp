@@ -28,6 +28,42 @@ void UPCUnitAbilitySystemComponent::InitGAS()
 	GrantSynergyTags(UnitData);
 }
 
+void UPCUnitAbilitySystemComponent::ResetForReuse()
+{
+	// 풀 리셋은 서버에서만 실행
+	if (!GetOwner() || !GetOwner()->HasAuthority())
+		return;
+
+	CancelAllAbilities();
+	CurrentMontageStop(0.f);
+
+	for (const FActiveGameplayEffectHandle& EffectHandle : ActiveGameplayEffects.GetAllActiveEffectHandles())
+	{
+		RemoveActiveGameplayEffect(EffectHandle);
+	}
+
+	// GE가 모두 제거된 뒤 남은 태그는 루즈 태그 (사망, 시너지 등)
+	const FGameplayTagContainer LooseTags = GetOwnedGameplayTags();
+	for (const FGameplayTag& LooseTag : LooseTags)
+	{
+		SetLooseGameplayTagCount(LooseTag, 0);
+	}
+
+	// 어트리뷰트는 AttributeSet CDO 기본값으로 되돌려야 InitGAS 결과가 신규 스폰과 같아짐
+	TArray<FGameplayAttribute> Attributes;
+	GetAllAttributes(Attributes);
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		const UClass* AttributeSetClass = Attribute.GetAttributeSetClass();
+		if (!AttributeSetClass)
+			continue;
+
+		SetNumericAttributeBase(Attribute, Attribute.GetNumericValue(AttributeSetClass->GetDefaultObject<UAttributeSet>()));
+	}
+
+	bInitBaseStatsApplied = false;
+}
+
 void UPCUnitAbilitySystemComponent::ApplyInitBaseStat(const APCBaseUnitCharacter* Unit, const UPCDataAsset_BaseUnitData* UnitData)
 {
 	// AttributeSet 스탯 변경은 서버에서만 실행
@@ -29,12 +29,24 @@ void UPCAnimNotifyState_ProjectileBarrage::NotifyBegin(USkeletalMeshComponent* M
 
 		SpawnProjectileAndFX(MeshComp);
 
-		FTimerHandle& Handle = TimerMap.FindOrAdd(MeshComp);
-		World->GetTimerManager().SetTimer(
-			Handle,
-			FTimerDelegate::CreateUObject(this, &UPCAnimNotifyState_ProjectileBarrage::SpawnProjectileAndFX, MeshComp),
-			FMath::Clamp(FireInterval, 0.02f, 10.f),
-			true);
+		if (UPCCombatSchedulerSubsystem* Scheduler = World->GetSubsystem<UPCCombatSchedulerSubsystem>())
+		{
+			const float Interval = FMath::Clamp(FireInterval, 0.02f, 10.f);
+			TWeakObjectPtr<UPCAnimNotifyState_ProjectileBarrage> WeakThis(this);
+			TWeakObjectPtr<USkeletalMeshComponent> WeakMesh(MeshComp);
+
+			// 메시가 사라지면 스케줄러에서 작업이 자동 정리됨
+			FPCCombatJobHandle& Handle = JobMap.FindOrAdd(MeshComp);
+			Scheduler->UnregisterJob(Handle);
+			Handle = Scheduler->RegisterJob(TEXT("ProjectileBarrage"), MeshComp, Interval, Interval,
+				[WeakThis, WeakMesh]()
+				{
+					if (WeakThis.IsValid() && WeakMesh.IsValid())
+					{
+						WeakThis->SpawnProjectileAndFX(WeakMesh.Get());
+					}
+				});
+		}
 	}
 }
 
@@ -45,12 +57,14 @@ void UPCAnimNotifyState_ProjectileBarrage::NotifyEnd(USkeletalMeshComponent* Mes
 		return;
 	if (UWorld* World = MeshComp->GetWorld())
 	{
-		if (FTimerHandle* Handle = TimerMap.Find(MeshComp))
+		FPCCombatJobHandle* Handle = JobMap.Find(MeshComp);
+		UPCCombatSchedulerSubsystem* Scheduler = World->GetSubsystem<UPCCombatSchedulerSubsystem>();
+		if (Handle && Scheduler)
 		{
-			World->GetTimerManager().ClearTimer(*Handle);
+			Scheduler->UnregisterJob(*Handle);
 		}
 	}
-	TimerMap.Remove(MeshComp);
+	JobMap.Remove(MeshComp);
 	UseLeftMap.Remove(MeshComp);
 }
 
@@ -109,14 +123,15 @@ void UPCAnimNotifyState_ProjectileBarrage::SpawnProjectileAndFX(USkeletalMeshCom
 	{
 		const FTransform SocketTransform = MeshComp->GetSocketTransform(SocketName, RTS_World);
 		APCBaseProjectile* Projectile = nullptr;
+		uint32 SimProjectileId = 0;
 		
 		if (auto* ProjectilePool = World->GetSubsystem<UPCProjectilePoolSubsystem>())
 		{
-			Projectile = ProjectilePool->SpawnProjectile(
-				SocketTransform, UnitTypeTag, ProjectileTypeTag, Owner, Target);
+			Projectile = ProjectilePool->SpawnUnitProjectile(
+				SocketTransform, UnitTypeTag, ProjectileTypeTag, Owner, Target, SimProjectileId);
 		}
 
-		if (!Projectile)
+		if (!Projectile && SimProjectileId == 0)
 			return;
 
 		if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Owner))
@@ -128,6 +143,7 @@ void UPCAnimNotifyState_ProjectileBarrage::SpawnProjectileAndFX(USkeletalMeshCom
 			FGameplayAbilityTargetDataHandle Handle;
 			FTargetData_Projectile* Data = new FTargetData_Projectile();
 			Data->Projectile = Projectile;
+			Data->SimProjectileId = SimProjectileId;
 			Handle.Add(Data);
 			Payload.TargetData = Handle;
 
@@ -37,16 +37,17 @@ void UPCAnimNotify_SpawnProjectile::Notify(USkeletalMeshComponent* MeshComp, UAn
 		return;
 
 	APCBaseProjectile* Projectile = nullptr;
+	uint32 SimProjectileId = 0;
 	if (UWorld* World = Owner->GetWorld())
 	{
 		if (auto* ProjectilePool = World->GetSubsystem<UPCProjectilePoolSubsystem>())
 		{
-			Projectile = ProjectilePool->SpawnProjectile(
-				SocketTransform, UnitTypeTag, ProjectileTypeTag, Owner, Target);
+			Projectile = ProjectilePool->SpawnUnitProjectile(
+				SocketTransform, UnitTypeTag, ProjectileTypeTag, Owner, Target, SimProjectileId);
 		}
 	}
 
-	if (!Projectile)
+	if (!Projectile && SimProjectileId == 0)
 		return;
 
 	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Owner))
@@ -58,6 +59,7 @@ void UPCAnimNotify_SpawnProjectile::Notify(USkeletalMeshComponent* MeshComp, UAn
 		FGameplayAbilityTargetDataHandle Handle;
 		FTargetData_Projectile* Data = new FTargetData_Projectile();
 		Data->Projectile = Projectile;
+		Data->SimProjectileId = SimProjectileId;
 		Handle.Add(Data);
 		Payload.TargetData = Handle;
 
@@ -8,6 +8,7 @@
 #include "KismetAnimationLibrary.h"
 #include "Character/Unit/PCBaseUnitCharacter.h"
 #include "GameFramework/GameState/PCCombatGameState.h"
+#include "Utility/PCAsyncLoad.h"
 
 void UPCUnitAnimInstance::PlayLevelStartMontage()
 {
@@ -92,18 +93,40 @@ void UPCUnitAnimInstance::SetAnimSet(UPCDataAsset_UnitAnimSet* NewSet)
 
 void UPCUnitAnimInstance::ResolveAssets(const UPCDataAsset_UnitAnimSet* AnimSet)
 {
-	MovementBS = AnimSet->LocomotionSet.MovementBS.LoadSynchronous();
-	NonCombatIdle = AnimSet->LocomotionSet.NonCombatIdle.LoadSynchronous();
-	CombatIdle = AnimSet->LocomotionSet.CombatIdle.LoadSynchronous();
-	JumpStart = AnimSet->LocomotionSet.JumpStart.LoadSynchronous();
-	JumpLoop = AnimSet->LocomotionSet.JumpLoop.LoadSynchronous();
-	JumpLand = AnimSet->LocomotionSet.JumpLand.LoadSynchronous();
-	JumpRecovery = AnimSet->LocomotionSet.JumpRecovery.LoadSynchronous();
-	StunStart = AnimSet->LocomotionSet.StunStart.LoadSynchronous();
-	StunIdle = AnimSet->LocomotionSet.StunIdle.LoadSynchronous();
-	Death = AnimSet->LocomotionSet.Death.LoadSynchronous();
-	CombatWinEmote = AnimSet->LocomotionSet.CombatWinEmote.LoadSynchronous();
-
-	if (CombatWinEmote)
-		bHasCombatWinAnim = true;
-}
\ No newline at end of file
+	ResolveAsset(AnimSet->LocomotionSet.MovementBS, MovementBS);
+	ResolveAsset(AnimSet->LocomotionSet.NonCombatIdle, NonCombatIdle);
+	ResolveAsset(AnimSet->LocomotionSet.CombatIdle, CombatIdle);
+	ResolveAsset(AnimSet->LocomotionSet.JumpStart, JumpStart);
+	ResolveAsset(AnimSet->LocomotionSet.JumpLoop, JumpLoop);
+	ResolveAsset(AnimSet->LocomotionSet.JumpLand, JumpLand);
+	ResolveAsset(AnimSet->LocomotionSet.JumpRecovery, JumpRecovery);
+	ResolveAsset(AnimSet->LocomotionSet.StunStart, StunStart);
+	ResolveAsset(AnimSet->LocomotionSet.StunIdle, StunIdle);
+	ResolveAsset(AnimSet->LocomotionSet.Death, Death);
+	ResolveAsset(AnimSet->LocomotionSet.CombatWinEmote, CombatWinEmote);
+
+	bHasCombatWinAnim = CombatWinEmote != nullptr;
+}
+
+template <typename T>
+void UPCUnitAnimInstance::ResolveAsset(const TSoftObjectPtr<T>& SoftAsset, TObjectPtr<T>& OutAsset)
+{
+	OutAsset = SoftAsset.Get();
+	if (OutAsset || SoftAsset.IsNull())
+		return;
+
+	// 로드 완료 전에 AnimSet이 바뀌었으면 결과를 버림
+	TWeakObjectPtr<UPCUnitAnimInstance> WeakThis = this;
+	const UPCDataAsset_UnitAnimSet* RequestedAnimSet = CurrentAnimSet;
+	TObjectPtr<T>* OutAssetPtr = &OutAsset;
+	
+	PCAsyncLoad::RequestAsyncLoad(SoftAsset.ToSoftObjectPath(), TEXT("UnitAnimSet"),
+		[WeakThis, RequestedAnimSet, OutAssetPtr](UObject* Loaded)
+		{
+			if (!WeakThis.IsValid() || WeakThis->CurrentAnimSet != RequestedAnimSet)
+				return;
+
+			*OutAssetPtr = Cast<T>(Loaded);
+			WeakThis->bHasCombatWinAnim = WeakThis->CombatWinEmote != nullptr;
+		});
+}
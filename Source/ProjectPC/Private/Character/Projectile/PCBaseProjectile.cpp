@@ -13,6 +13,7 @@
 #include "GameFramework/ProjectileMovementComponent.h"
 
 #include "DataAsset/Projectile/PCDataAsset_ProjectileData.h"
+#include "GameFramework/WorldSubsystem/PCBoardRelevancySubsystem.h"
 #include "GameFramework/WorldSubsystem/PCProjectilePoolSubsystem.h"
 #include "Net/UnrealNetwork.h"
 
@@ -131,6 +132,11 @@ void APCBaseProjectile::ActiveProjectile(const FTransform& SpawnTransform, FGame
 		ProjectileDataAttackTypeTag = AttackTypeTag;
 		
 		SetInstigator(SpawnActor->GetInstigator());
+
+		if (const APCBaseUnitCharacter* SpawnUnit = Cast<APCBaseUnitCharacter>(SpawnActor))
+		{
+			RelevancyBoardSeatIndex = SpawnUnit->GetRelevancyBoardSeatIndex();
+		}
 		
 		SetActorHiddenInGame(false);
 		SetActorEnableCollision(true);
@@ -209,6 +215,7 @@ void APCBaseProjectile::ReturnToPool()
 	}
 	
 	SetInstigator(nullptr);
+	RelevancyBoardSeatIndex = INDEX_NONE;
 	SetActorHiddenInGame(true);
 	SetActorEnableCollision(false);
 
@@ -227,9 +234,8 @@ void APCBaseProjectile::ReturnToPool()
 
 void APCBaseProjectile::SetProjectileProperty()
 {
-	if (auto Unit = ProjectileData.Find(ProjectileDataCharacterTag))
+	if (const FPCProjectileData* Projectile = FindProjectileData(ProjectileDataCharacterTag, ProjectileDataAttackTypeTag))
 	{
-		auto Projectile = Unit->Get()->GetProjectileData(ProjectileDataAttackTypeTag);
 		if (Projectile->Mesh && MeshComp)
 		{
 			MeshComp->SetStaticMesh(Projectile->Mesh);
@@ -257,6 +263,12 @@ void APCBaseProjectile::SetProjectileProperty()
 	}
 }
 
+const FPCProjectileData* APCBaseProjectile::FindProjectileData(FGameplayTag CharacterTag, FGameplayTag AttackTypeTag) const
+{
+	const TObjectPtr<UPCDataAsset_ProjectileData>* DataAsset = ProjectileData.Find(CharacterTag);
+	return (DataAsset && *DataAsset) ? (*DataAsset)->GetProjectileData(AttackTypeTag) : nullptr;
+}
+
 void APCBaseProjectile::SetTarget(const AActor* TargetActor)
 {
 	if (ProjectileMovement && TargetActor)
@@ -299,3 +311,16 @@ void APCBaseProjectile::Multicast_Overlap_Implementation(AActor* OtherActor)
 		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), HitEffect, OtherActor->GetActorLocation(), OtherActor->GetActorRotation());
 	}
 }
+
+bool APCBaseProjectile::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+	const FVector& SrcLocation) const
+{
+	bool bRelevant = true;
+	if (!bIsPlayerAttack && UPCBoardRelevancySubsystem::EvaluateRelevancy(this, RealViewer, RelevancyBoardSeatIndex,
+		INDEX_NONE, bRelevant))
+	{
+		return bRelevant;
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Character/Projectile/PCProjectileSimReplicator.h"
+
+#include "GameFramework/WorldSubsystem/PCBoardRelevancySubsystem.h"
+#include "GameFramework/WorldSubsystem/PCProjectileSimSubsystem.h"
+
+
+APCProjectileSimReplicator::APCProjectileSimReplicator()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	bAlwaysRelevant = true;
+
+	// 복제할 프로퍼티가 없으므로 RPC 만 전달
+	NetUpdateFrequency = 1.f;
+}
+
+bool APCProjectileSimReplicator::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+	const FVector& SrcLocation) const
+{
+	bool bRelevant = true;
+	if (UPCBoardRelevancySubsystem::EvaluateRelevancy(this, RealViewer, BoardSeatIndex, INDEX_NONE, bRelevant))
+		return bRelevant;
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
+
+void APCProjectileSimReplicator::Multicast_SpawnProjectiles_Implementation(const TArray<FPCProjectileSpawnEvent>& Events)
+{
+	// 서버는 이미 직접 시뮬레이션 중
+	if (HasAuthority())
+		return;
+
+	if (UPCProjectileSimSubsystem* SimSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UPCProjectileSimSubsystem>() : nullptr)
+	{
+		SimSubsystem->HandleSpawnEvents(Events);
+	}
+}
+
+void APCProjectileSimReplicator::Multicast_ImpactProjectiles_Implementation(const TArray<FPCProjectileImpactEvent>& Events)
+{
+	if (HasAuthority())
+		return;
+
+	if (UPCProjectileSimSubsystem* SimSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UPCProjectileSimSubsystem>() : nullptr)
+	{
+		SimSubsystem->HandleImpactEvents(Events);
+	}
+}
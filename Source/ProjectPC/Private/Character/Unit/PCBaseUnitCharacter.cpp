@@ -14,6 +14,7 @@
 #include "DataAsset/Unit/PCDataAsset_UnitAnimSet.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/GameState/PCCombatGameState.h"
+#include "GameFramework/WorldSubsystem/PCBoardRelevancySubsystem.h"
 #include "GameFramework/WorldSubsystem/PCUnitSpawnSubsystem.h"
 #include "Net/UnrealNetwork.h"
 
@@ -213,6 +214,7 @@ void APCBaseUnitCharacter::GetLifetimeReplicatedProps(TArray<class FLifetimeProp
 	DOREPLIFETIME(APCBaseUnitCharacter, bIsOnField);
 	DOREPLIFETIME(APCBaseUnitCharacter, bIsCombatWin);
 	DOREPLIFETIME(APCBaseUnitCharacter, bIsDead);
+	DOREPLIFETIME(APCBaseUnitCharacter, bIsInUnitPool);
 }
 
 void APCBaseUnitCharacter::ReAttachStatusBarToSocket() const
@@ -326,6 +328,10 @@ void APCBaseUnitCharacter::ChangedOnTile(const bool IsOnField)
 
 void APCBaseUnitCharacter::Die()
 {
+	// 풀 리셋 중 어트리뷰트 초기화로 체력이 0이 되는 경우 무시
+	if (bIsInUnitPool)
+		return;
+	
 	if (HasAuthority())
 	{
 		if (UAbilitySystemComponent* ASC = GetAbilitySystemComponent())
@@ -462,3 +468,136 @@ void APCBaseUnitCharacter::OnUnitStateTagChanged(FGameplayTag Tag, int32 NewCoun
 		}
 	}
 }
+
+void APCBaseUnitCharacter::OnReturnedToPool()
+{
+	// 이후 ASC 리셋 과정의 사망 처리를 막기 위해 가장 먼저 설정
+	bIsInUnitPool = true;
+	
+	ChangedOnTile(false);
+	SetOnCombatBoard(nullptr);
+	bIsCombatWin = false;
+	
+	// 바인딩한 쪽(CombatManager, TileManager 등)이 해제하지 못한 델리게이트 정리
+	OnUnitDied.Clear();
+
+	GetCharacterMovement()->StopMovementImmediately();
+	SetActorHiddenInGame(true);
+	SetActorLocation(DeadZone);
+
+	OnReturnedToPoolLocal();
+}
+
+void APCBaseUnitCharacter::OnAcquiredFromPool()
+{
+	SetActorHiddenInGame(false);
+	PushTeamIndexToController();
+
+	bIsInUnitPool = false;
+
+	OnAcquiredFromPoolLocal();
+}
+
+void APCBaseUnitCharacter::OnReturnedToPoolLocal()
+{
+	// 콜리전은 복제되지 않으므로 클라에서도 직접 끔 (호버 / 드래그 트레이스 대상 제외)
+	SetActorEnableCollision(false);
+	SetOutlineEnabled(false);
+	
+	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
+	{
+		AnimInstance->StopAllMontages(0.f);
+	}
+}
+
+void APCBaseUnitCharacter::OnAcquiredFromPoolLocal()
+{
+	SetActorEnableCollision(true);
+	SetMeshVisibility(true);
+
+	// 이전 사용자 기준으로 잡혀 있던 AnimSet / 상태바 (ASC, 레벨) 를 새 상태로 다시 설정
+	SetAnimSetData();
+	if (UUserWidget* W = StatusBarComp->GetUserWidgetObject())
+	{
+		InitStatusBarWidget(W);
+	}
+
+	if (UPCUnitAnimInstance* UnitAnimInstance = Cast<UPCUnitAnimInstance>(GetMesh()->GetAnimInstance()))
+	{
+		UnitAnimInstance->PlayLevelStartMontage();
+	}
+}
+
+bool APCBaseUnitCharacter::DebugValidatePoolLocalState(FString& OutReport) const
+{
+#if !UE_BUILD_SHIPPING
+	bool bValid = true;
+	auto Check = [&bValid, &OutReport](bool bCondition, const TCHAR* What)
+	{
+		if (!bCondition)
+		{
+			OutReport += FString::Printf(TEXT(" %s"), What);
+			bValid = false;
+		}
+	};
+
+	const UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
+	if (bIsInUnitPool)
+	{
+		Check(IsHidden(), TEXT("Hidden"));
+		Check(!GetActorEnableCollision(), TEXT("Collision"));
+		Check(!AnimInstance || !AnimInstance->IsAnyMontagePlaying(), TEXT("Montage"));
+		return bValid;
+	}
+
+	Check(!IsHidden(), TEXT("Hidden"));
+	Check(GetActorEnableCollision(), TEXT("Collision"));
+
+	if (const UPCUnitAnimInstance* UnitAnimInstance = Cast<UPCUnitAnimInstance>(AnimInstance))
+	{
+		Check(!GetUnitAnimSetDataAsset() || UnitAnimInstance->GetAnimSet() == GetUnitAnimSetDataAsset(), TEXT("AnimSet"));
+	}
+
+	return bValid;
+#else
+	return true;
+#endif
+}
+
+void APCBaseUnitCharacter::OnRep_IsInUnitPool()
+{
+	// 서버는 OnReturnedToPool / OnAcquiredFromPool 에서 직접 호출
+	if (bIsInUnitPool)
+	{
+		OnReturnedToPoolLocal();
+	}
+	else
+	{
+		OnAcquiredFromPoolLocal();
+	}
+}
+
+bool APCBaseUnitCharacter::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+	const FVector& SrcLocation) const
+{
+	// 풀에 보관 중인 유닛은 아무에게도 복제하지 않음
+	if (bIsInUnitPool && UPCBoardRelevancySubsystem::IsPolicyEnabled())
+		return false;
+	
+	bool bRelevant = true;
+	if (UPCBoardRelevancySubsystem::EvaluateRelevancy(this, RealViewer, GetRelevancyBoardSeatIndex(),
+		OwnerPS ? OwnerPS->SeatIndex : INDEX_NONE, bRelevant))
+	{
+		return bRelevant;
+	}
+	
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
+
+int32 APCBaseUnitCharacter::GetRelevancyBoardSeatIndex() const
+{
+	if (const APCCombatBoard* CombatBoard = OnCombatBoard.Get())
+		return CombatBoard->BoardSeatIndex;
+
+	return OwnerPS ? OwnerPS->SeatIndex : INDEX_NONE;
+}
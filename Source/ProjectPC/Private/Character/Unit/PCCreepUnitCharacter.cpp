@@ -10,6 +10,7 @@
 #include "DataAsset/Unit/PCDataAsset_CreepUnitData.h"
 #include "GameFramework/PlayerState/PCPlayerState.h"
 #include "GameFramework/WorldSubsystem/PCItemSpawnSubsystem.h"
+#include "GameFramework/WorldSubsystem/PCUnitSpawnSubsystem.h"
 #include "UI/Unit/PCUnitStatusBarWidget.h"
 
 
@@ -47,6 +48,8 @@ void APCCreepUnitCharacter::InitStatusBarWidget(UUserWidget* StatusBarWidget)
 
 	if (UPCUnitStatusBarWidget* StatusBar = Cast<UPCUnitStatusBarWidget>(StatusBarWidget))
 	{
+		// 풀 재사용 시 다시 호출되므로 이전 바인딩 해제 후 초기화
+		StatusBar->ClearDelegate();
 		StatusBar->InitWithASC(this, GetAbilitySystemComponent(),
 			UPCUnitAttributeSet::GetCurrentHealthAttribute(),
 			UPCUnitAttributeSet::GetMaxHealthAttribute()
@@ -66,16 +69,23 @@ void APCCreepUnitCharacter::OnGameStateChanged(const FGameplayTag& NewStateTag)
 	}
 	else if (NewStateTag == CombatEndTag)
 	{
-		if (HasAuthority())
+		if (HasAuthority() && !bIsInUnitPool)
 		{
-			Destroy();
+			if (UPCUnitSpawnSubsystem* SpawnSubsystem = GetWorld()->GetSubsystem<UPCUnitSpawnSubsystem>())
+			{
+				SpawnSubsystem->ReleaseUnit(this);
+			}
+			else
+			{
+				Destroy();
+			}
 		}
 	}
 }
 
 void APCCreepUnitCharacter::Die()
 {
-	if (!bIsDead)
+	if (!bIsDead && !bIsInUnitPool)
 	{
 		if (auto ItemSpawnSubsystem = GetWorld()->GetSubsystem<UPCItemSpawnSubsystem>())
 		{
@@ -130,22 +130,7 @@ void APCHeroUnitCharacter::BeginPlay()
 			.AddUObject(this, &ThisClass::OnSynergyTagChanged);
 		}
 
-		if (!bDidPlaySpawnSound)
-		{
-			UPCUnitSpawnSubsystem* SpawnSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UPCUnitSpawnSubsystem>() : nullptr;
-			if (SpawnSubsystem && OwnerPS && OwnerPS->GetAbilitySystemComponent())
-			{
-				bDidPlaySpawnSound = true;
-				
-				if (USoundBase* LevelStartSound = SpawnSubsystem->GetLevelStartSoundCueByUnitTag(UnitTag))
-				{
-					FGameplayCueParameters Params;
-					Params.SourceObject = LevelStartSound;
-		
-					OwnerPS->GetAbilitySystemComponent()->ExecuteGameplayCue(GameplayCueTags::GameplayCue_SFX_Unit_LevelStart, Params);
-				}
-			}
-		}
+		PlayLevelStartSound();
 	}
 }
 
@@ -231,6 +216,70 @@ void APCHeroUnitCharacter::ActionDrag(const bool IsStart)
 	bIsDragging = IsStart;
 }
 
+void APCHeroUnitCharacter::OnReturnedToPool()
+{
+	Super::OnReturnedToPool();
+
+	bIsDragging = false;
+}
+
+void APCHeroUnitCharacter::OnAcquiredFromPool()
+{
+	Super::OnAcquiredFromPool();
+
+	bDidCombine = false;
+	bDidPlaySpawnSound = false;
+	PlayLevelStartSound();
+}
+
+bool APCHeroUnitCharacter::DebugValidatePoolLocalState(FString& OutReport) const
+{
+	bool bValid = Super::DebugValidatePoolLocalState(OutReport);
+	
+#if !UE_BUILD_SHIPPING
+	if (bIsInUnitPool)
+		return bValid;
+
+	// 메쉬 크기는 클라에서만 레벨 반영 (UpdateMeshScale)
+	if (!HasAuthority() && GetMesh())
+	{
+		const float ExpectedScale = 1.f + FMath::Max(0.f, 0.12f * (GetUnitLevel() - 1));
+		if (!FMath::IsNearlyEqual(GetMesh()->GetRelativeScale3D().X, ExpectedScale, 0.01f))
+		{
+			OutReport += TEXT(" MeshScale");
+			bValid = false;
+		}
+	}
+
+	if (const UPCHeroStatusBarWidget* StatusBar = Cast<UPCHeroStatusBarWidget>(StatusBarComp->GetUserWidgetObject()))
+	{
+		if (StatusBar->GetActiveLevel() != HeroLevel || StatusBar->GetBoundASC() != GetAbilitySystemComponent())
+		{
+			OutReport += TEXT(" StatusBar");
+			bValid = false;
+		}
+	}
+#endif
+	
+	return bValid;
+}
+
+void APCHeroUnitCharacter::OnReturnedToPoolLocal()
+{
+	Super::OnReturnedToPoolLocal();
+
+	// 시너지 컴포넌트, 호버 패널 등은 풀 반납을 파괴와 동일하게 처리 (클라 호버 패널도 여기서 해제됨)
+	OnHeroDestroyed.Broadcast(this);
+}
+
+void APCHeroUnitCharacter::OnAcquiredFromPoolLocal()
+{
+	Super::OnAcquiredFromPoolLocal();
+
+	// 다른 플레이어가 쓰던 유닛일 수 있으므로 레벨 기준 표시를 다시 맞춤 (같은 레벨이면 OnRep_HeroLevel 이 오지 않음)
+	UpdateMeshScale();
+}
+
 void APCHeroUnitCharacter::OnRep_IsDragging() const
 {
 	SetMeshVisibility(!bIsDragging);
@@ -263,6 +312,26 @@ void APCHeroUnitCharacter::PlayLevelUpParticle() const
 	HeroUnitAbilitySystemComponent->ExecuteGameplayCue(GameplayCueTags::GameplayCue_VFX_Unit_LevelUp, Params);
 }
 
+void APCHeroUnitCharacter::PlayLevelStartSound()
+{
+	if (bDidPlaySpawnSound)
+		return;
+	
+	UPCUnitSpawnSubsystem* SpawnSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UPCUnitSpawnSubsystem>() : nullptr;
+	if (SpawnSubsystem && OwnerPS && OwnerPS->GetAbilitySystemComponent())
+	{
+		bDidPlaySpawnSound = true;
+				
+		if (USoundBase* LevelStartSound = SpawnSubsystem->GetLevelStartSoundCueByUnitTag(UnitTag))
+		{
+			FGameplayCueParameters Params;
+			Params.SourceObject = LevelStartSound;
+		
+			OwnerPS->GetAbilitySystemComponent()->ExecuteGameplayCue(GameplayCueTags::GameplayCue_SFX_Unit_LevelStart, Params);
+		}
+	}
+}
+
 void APCHeroUnitCharacter::OnGameStateChanged(const FGameplayTag& NewStateTag)
 {
 	Super::OnGameStateChanged(NewStateTag);
@@ -317,7 +386,14 @@ void APCHeroUnitCharacter::Combine(const APCHeroUnitCharacter* LevelUpHero)
 	
 	bDidCombine = true;
 	
-	Destroy();
+	if (UPCUnitSpawnSubsystem* SpawnSubsystem = GetWorld()->GetSubsystem<UPCUnitSpawnSubsystem>())
+	{
+		SpawnSubsystem->ReleaseUnit(this);
+	}
+	else
+	{
+		Destroy();
+	}
 }
 
 void APCHeroUnitCharacter::SellHero()
@@ -327,7 +403,14 @@ void APCHeroUnitCharacter::SellHero()
 		EquipmentComp->ReturnAllItemToPlayerInventory(true);
 	}
 
-	Destroy();
+	if (UPCUnitSpawnSubsystem* SpawnSubsystem = GetWorld()->GetSubsystem<UPCUnitSpawnSubsystem>())
+	{
+		SpawnSubsystem->ReleaseUnit(this);
+	}
+	else
+	{
+		Destroy();
+	}
 }
 
 void APCHeroUnitCharacter::SetUnitDataAsset(UPCDataAsset_BaseUnitData* InUnitDataAsset)
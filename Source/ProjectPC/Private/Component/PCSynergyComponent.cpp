@@ -9,6 +9,7 @@
 #include "DataAsset/Synergy/PCDataAsset_SynergyData.h"
 #include "DataAsset/Synergy/PCDataAsset_SynergyDefinitionSet.h"
 #include "GameFramework/GameState/PCCombatGameState.h"
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
 #include "Net/UnrealNetwork.h"
 #include "Synergy/PCSynergyBase.h"
 
@@ -143,6 +144,8 @@ void UPCSynergyComponent::RegisterHero(APCHeroUnitCharacter* Hero)
 	if (!GetOwner() || !GetOwner()->HasAuthority() || !Hero)
 		return;
 
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::SynergyRecompute);
+
 	if (!RegisterHeroSet.Contains(Hero))
 	{
 		RegisterHeroSet.Add(Hero);
@@ -179,6 +182,8 @@ void UPCSynergyComponent::UnRegisterHero(APCHeroUnitCharacter* Hero)
 	if (!GetOwner() || !GetOwner()->HasAuthority() || !Hero)
 		return;
 
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::SynergyRecompute);
+
 	if (RegisterHeroSet.Contains(Hero))
 	{
 		RegisterHeroSet.Remove(Hero);
@@ -396,6 +401,8 @@ void UPCSynergyComponent::OnGameStateTagChanged(const FGameplayTag& NewTag)
 
 void UPCSynergyComponent::OnCombatActiveAction()
 {
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::SynergyRecompute);
+
 	TArray<APCHeroUnitCharacter*> CurrentHeroes;
 	GatherRegisteredHeroes(CurrentHeroes);
 
@@ -442,6 +449,8 @@ void UPCSynergyComponent::OnHeroDestroyed(APCHeroUnitCharacter* DestroyedHero)
 
 void UPCSynergyComponent::OnHeroSynergyTagChanged(const APCHeroUnitCharacter* Hero)
 {
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::SynergyRecompute);
+
 	if (Hero)
 	{
 		const FGameplayTag HeroTag = Hero->GetUnitTag();
@@ -195,6 +195,24 @@ void UPCUnitEquipmentComponent::ReturnItemToPlayerInventory(const FGameplayTag&
 	OwnerPlayerInventory->AddItemToInventory(ItemTag);
 }
 
+void UPCUnitEquipmentComponent::ClearAllSlots()
+{
+	if (!HasAuthority())
+		return;
+
+	// 아이템은 인벤토리로 돌려주지 않고 효과만 제거 (반환 여부는 호출 측에서 결정)
+	for (int32 i = 0; i < MaxSlotSize; ++i)
+	{
+		RemoveItemSlot(i);
+	}
+}
+
+void UPCUnitEquipmentComponent::RefreshOwnerPlayerInventory()
+{
+	APCPlayerState* PS = Owner.IsValid() ? Owner->GetOwnerPlayerState() : nullptr;
+	OwnerPlayerInventory = PS ? PS->GetPlayerInventory() : nullptr;
+}
+
 void UPCUnitEquipmentComponent::ApplyItemEffects(const FGameplayTag& ItemTag, const int32 SlotIndex)
 {
 	if (!HasAuthority() || !ItemTag.IsValid() || !SlotItemTags.IsValidIndex(SlotIndex))
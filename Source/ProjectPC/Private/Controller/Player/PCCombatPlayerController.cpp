@@ -26,6 +26,10 @@
 #include "GameFramework/HelpActor/Component/PCDragComponent.h"
 #include "GameFramework/HelpActor/Component/PCTileManager.h"
 #include "GameFramework/PlayerState/PCPlayerState.h"
+#if !UE_BUILD_SHIPPING
+#include "GameFramework/WorldSubsystem/PCLoadTestSubsystem.h"
+#endif
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
 #include "Shop/PCShopManager.h"
 #include "UI/GameResult/PCGameResultWidget.h"
 #include "UI/Item/PCPlayerInventoryWidget.h"
@@ -36,6 +40,66 @@
 #include "UI/Synerge/PCSynergyPanelWidget.h"
 #include "UI/Unit/PCHeroStatusHoverPanel.h"
 
+#if !UE_BUILD_SHIPPING
+DECLARE_STATS_GROUP(TEXT("PCNetRpc"), STATGROUP_PCNetRpc, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Server RPCs"), STAT_PCNetRpc_ServerRpcs, STATGROUP_PCNetRpc);
+#endif
+
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarPCHoverLocal(
+		TEXT("PC.Hover.Local"),
+		true,
+		TEXT("호버 유닛을 복제된 보드 점유 정보로 클라에서 판정 (0이면 매번 서버 질의)"));
+
+#if !UE_BUILD_SHIPPING
+	// 서버 수신 RPC 카운터 (PC.Net.RpcStats), 이름별 맵 조회가 RPC 마다 일어나므로 개발 빌드에서만
+	TMap<FName, uint64> GServerRpcCounts;
+	double GServerRpcCountStart = 0.0;
+#endif
+
+	void RecordServerRpc(const APlayerController* Controller, const TCHAR* RpcName)
+	{
+#if !UE_BUILD_SHIPPING
+		if (GServerRpcCountStart <= 0.0)
+		{
+			GServerRpcCountStart = FPlatformTime::Seconds();
+		}
+		++GServerRpcCounts.FindOrAdd(FName(RpcName));
+		INC_DWORD_STAT(STAT_PCNetRpc_ServerRpcs);
+#endif
+
+		// 연결별 집계 (PC.Telemetry.Start)
+		if (UPCServerTelemetrySubsystem* Telemetry = UPCServerTelemetrySubsystem::FindActive(Controller))
+		{
+			Telemetry->NoteServerRpc(Controller);
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithArgs GPCRpcStatsCommand(
+		TEXT("PC.Net.RpcStats"),
+		TEXT("Log server RPC counts and per-second rates received by the combat player controllers. Args: [reset]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const double Elapsed = GServerRpcCountStart > 0.0 ? FMath::Max(FPlatformTime::Seconds() - GServerRpcCountStart, UE_KINDA_SMALL_NUMBER) : 0.0;
+			UE_LOG(LogTemp, Log, TEXT("[RpcStats] %.1fs since first RPC"), Elapsed);
+			for (const auto& Pair : GServerRpcCounts)
+			{
+				UE_LOG(LogTemp, Log, TEXT("[RpcStats]   %s : %llu (%.2f/s)"),
+					*Pair.Key.ToString(), Pair.Value, Elapsed > 0.0 ? Pair.Value / Elapsed : 0.0);
+			}
+
+			if (Args.IsValidIndex(0) && Args[0] == TEXT("reset"))
+			{
+				GServerRpcCounts.Reset();
+				GServerRpcCountStart = 0.0;
+			}
+		}));
+#endif
+}
+
 
 APCCombatPlayerController::APCCombatPlayerController()
 {
@@ -60,7 +124,12 @@ void APCCombatPlayerController::Client_RequestIdentity_Implementation()
 	// 플레이어 아이디 셋팅
 	if (UProfileSubsystem* Profile = GetGameInstance()->GetSubsystem<UProfileSubsystem>())
 	{
+#if !UE_BUILD_SHIPPING
+		// 부하 테스트 봇은 로그인 없이 커맨드라인 이름 사용
+		const FString Name = UPCLoadTestSubsystem::IsBotClient() ? UPCLoadTestSubsystem::GetBotName() : Profile->GetUserID();
+#else
 		const FString Name = Profile->GetUserID();
+#endif
 		const FGuid Uuid = Profile->GetSessionID();
 
 		UE_LOG(LogTemp, Warning, TEXT("[Profile] ProfileName : %s " ), *Name)
@@ -77,6 +146,8 @@ void APCCombatPlayerController::Client_RequestIdentity_Implementation()
 
 void APCCombatPlayerController::ServerSubmitIdentity_Implementation(const FString& InDisplayName, const FGuid& InSessionID)
 {
+	RecordServerRpc(this, TEXT("ServerSubmitIdentity"));
+
 	if (APCPlayerState* PCPlayerState = GetPlayerState<APCPlayerState>())
 	{
 		PCPlayerState->SetDisplayName_Server(InDisplayName);
@@ -265,6 +336,8 @@ void APCCombatPlayerController::UpdateMovement()
 
 void APCCombatPlayerController::Server_SetActorRotation_Implementation(FRotator NewRotation)
 {
+	RecordServerRpc(this, TEXT("Server_SetActorRotation"));
+
 	if (APawn* ControlledPawn = GetPawn())
 	{
 		ControlledPawn->SetActorRotation(NewRotation);
@@ -273,12 +346,21 @@ void APCCombatPlayerController::Server_SetActorRotation_Implementation(FRotator
 
 void APCCombatPlayerController::Server_SetActorTransform_Implementation(FTransform NewTransform)
 {
+	RecordServerRpc(this, TEXT("Server_SetActorTransform"));
+
 	if (APawn* ControlledPawn = GetPawn())
 	{
 		ControlledPawn->SetActorTransform(NewTransform);
 	}
 }
 
+void APCCombatPlayerController::Server_SetViewedBoardSeatIndex_Implementation(int32 BoardSeatIndex)
+{
+	RecordServerRpc(this, TEXT("Server_SetViewedBoardSeatIndex"));
+
+	SetViewedBoardSeatIndex(BoardSeatIndex);
+}
+
 void APCCombatPlayerController::Client_StopMoving_Implementation()
 {
 	GetWorld()->GetTimerManager().ClearTimer(MoveTimerHandle);
@@ -324,8 +406,8 @@ TArray<int32> APCCombatPlayerController::GetSameShopSlotIndices(int32 SlotIndex)
 	
 	if (auto PS = GetPlayerState<APCPlayerState>())
 	{
-		auto ShopSlots = PS->GetShopSlots();
-		auto PurchasedSlots = PS->PurchasedSlots;
+		const auto& ShopSlots = PS->GetShopSlots();
+		const auto& PurchasedSlots = PS->GetPurchasedSlots();
 		for (int i = 0; i < ShopSlots.Num(); i++)
 		{
 			if (i == SlotIndex)
@@ -392,6 +474,8 @@ void APCCombatPlayerController::ShopRequest_ShopLock(bool ShopLockState)
 
 void APCCombatPlayerController::Server_ShopRefresh_Implementation(float GoldCost)
 {
+	RecordServerRpc(this, TEXT("Server_ShopRefresh"));
+
 	// GetPlayerState<APCPlayerState>()->GetPlayerInventory()->AddItemToInventory(ItemTags::Item_Type_Base_BFSword);
 	// GetPlayerState<APCPlayerState>()->GetPlayerInventory()->AddItemToInventory(ItemTags::Item_Type_Base_ChainVest);
 	// GetPlayerState<APCPlayerState>()->GetPlayerInventory()->AddItemToInventory(ItemTags::Item_Type_Base_GiantsBelt);
@@ -431,6 +515,8 @@ void APCCombatPlayerController::Server_ShopRefresh_Implementation(float GoldCost
 
 void APCCombatPlayerController::Server_BuyXP_Implementation()
 {
+	RecordServerRpc(this, TEXT("Server_BuyXP"));
+
 	if (auto PS = GetPlayerState<APCPlayerState>())
 	{
 		if (auto ASC = PS->GetAbilitySystemComponent())
@@ -444,6 +530,8 @@ void APCCombatPlayerController::Server_BuyXP_Implementation()
 
 void APCCombatPlayerController::Server_SellUnit_Implementation(APCBaseUnitCharacter* Unit)
 {
+	RecordServerRpc(this, TEXT("Server_SellUnit"));
+
 	auto GS = GetWorld()->GetGameState<APCCombatGameState>();
 	if (!GS)
 	{
@@ -504,6 +592,8 @@ void APCCombatPlayerController::Server_SellUnit_Implementation(APCBaseUnitCharac
 
 void APCCombatPlayerController::Server_BuyUnit_Implementation(int32 SlotIndex)
 {
+	RecordServerRpc(this, TEXT("Server_BuyUnit"));
+
 	auto GS = GetWorld()->GetGameState<APCCombatGameState>();
 	if (!GS)
 	{
@@ -555,7 +645,7 @@ void APCCombatPlayerController::Server_BuyUnit_Implementation(int32 SlotIndex)
 				for (int i = 0; i < RequiredCount - 1; ++i)
 				{
 					Client_SetSlotHidden(SameSlotIndices[i]);
-					PS->PurchasedSlots.Add(SameSlotIndices[i]);
+					PS->MarkShopSlotPurchased(SameSlotIndices[i]);
 				}
 			}
 			else
@@ -588,6 +678,8 @@ void APCCombatPlayerController::Server_BuyUnit_Implementation(int32 SlotIndex)
 
 void APCCombatPlayerController::Server_ShopLock_Implementation(bool ShopLockState)
 {
+	RecordServerRpc(this, TEXT("Server_ShopLock"));
+
 	bIsShopLocked = ShopLockState;
 }
 
@@ -741,6 +833,8 @@ void APCCombatPlayerController::TickClientBootStrap()
 
 void APCCombatPlayerController::Server_ReportBootStrap_Implementation(const FString& LocalUserId, uint8 Mask)
 {
+	RecordServerRpc(this, TEXT("Server_ReportBootStrap"));
+
 	if (APCCombatGameState* GS = GetWorld()->GetGameState<APCCombatGameState>())
 	{
 		GS->Server_UpdateBootstrap(LocalUserId,Mask);
@@ -1109,6 +1203,8 @@ void APCCombatPlayerController::OnMouse_Released()
 
 void APCCombatPlayerController::Server_StartDragFromWorld_Implementation(FVector World, int32 DragId)
 {
+	RecordServerRpc(this, TEXT("Server_StartDragFromWorld"));
+
 	auto* GS = GetWorld()->GetGameState<APCCombatGameState>();
 	const bool bInBattle = GS && IsBattleTag(GS->GetGameStateTag());
 
@@ -1170,6 +1266,8 @@ void APCCombatPlayerController::Server_StartDragFromWorld_Implementation(FVector
 
 void APCCombatPlayerController::Server_EndDrag_Implementation(FVector World, int32 DragId)
 {
+	RecordServerRpc(this, TEXT("Server_EndDrag"));
+
 	APCCombatGameState* GS = GetWorld()->GetGameState<APCCombatGameState>();
     const bool bInBattle = GS && IsBattleTag(GS->GetGameStateTag());
 
@@ -1505,7 +1603,10 @@ void APCCombatPlayerController::PollHover()
 	LastWorld = HitResult.Location;
 	LastTime = Now;
 
-	Server_QueryHoverFromWorld(HitResult.Location);
+	if (!TryResolveHoverLocally(HitResult.Location))
+	{
+		Server_QueryHoverFromWorld(HitResult.Location);
+	}
 
 	FHitResult HitUnit;
 	if (GetHitResultUnderCursorByChannel(UEngineTypes::ConvertToTraceType(ECC_Pawn), false, HitUnit))
@@ -1522,6 +1623,8 @@ void APCCombatPlayerController::PollHover()
 
 void APCCombatPlayerController::Server_QueryHoverFromWorld_Implementation(const FVector& World)
 {
+	RecordServerRpc(this, TEXT("Server_QueryHoverFromWorld"));
+
 	if (World.IsNearlyZero())
 	{
 		Client_TileHoverUnit(nullptr);
@@ -1558,6 +1661,8 @@ void APCCombatPlayerController::Server_QueryHoverFromWorld_Implementation(const
 
 void APCCombatPlayerController::Server_QueryTileUnit_Implementation(bool bIsField, int32 Y, int32 X, int32 BenchIdx)
 {
+	RecordServerRpc(this, TEXT("Server_QueryTileUnit"));
+
 	APCPlayerBoard* PB = GetPlayerBoard();
 	if (!IsValid(PB))
 	{
@@ -1567,7 +1672,50 @@ void APCCombatPlayerController::Server_QueryTileUnit_Implementation(bool bIsFiel
 
 	APCBaseUnitCharacter* Unit = bIsField ? PB->GetFieldUnit(Y, X) : PB->GetBenchUnit(BenchIdx);
 	Client_TileHoverUnit(Unit);
-	
+
+}
+
+bool APCCombatPlayerController::TryResolveHoverLocally(const FVector& World)
+{
+	if (!CVarPCHoverLocal.GetValueOnGameThread() || !IsLocalController())
+		return false;
+
+	if (World.IsNearlyZero())
+	{
+		ApplyTileHoverUnit(nullptr);
+		return true;
+	}
+
+	APCPlayerBoard* PB = GetLocalPlayerBoard();
+	if (!IsValid(PB))
+		return false;
+
+	const APCCombatGameState* GS = GetWorld()->GetGameState<APCCombatGameState>();
+	const bool bInBattle = GS && IsBattleTag(GS->GetGameStateTag());
+
+	// Server_QueryHoverFromWorld 와 같은 판정
+	bool bField=false; int32 Y=-1, X=-1, BenchIdx=-1; FVector Snap=World;
+	if (!PB->WorldAnyTile(World, !bInBattle, bField, Y, X, BenchIdx, Snap) || (bInBattle && bField))
+	{
+		ApplyTileHoverUnit(nullptr);
+		return true;
+	}
+
+	return TryResolveTileUnitLocally(bField, Y, X, BenchIdx);
+}
+
+bool APCCombatPlayerController::TryResolveTileUnitLocally(bool bIsField, int32 Y, int32 X, int32 BenchIdx)
+{
+	if (!CVarPCHoverLocal.GetValueOnGameThread() || !IsLocalController())
+		return false;
+
+	const APCPlayerBoard* PB = GetLocalPlayerBoard();
+	APCBaseUnitCharacter* Unit = nullptr;
+	if (!IsValid(PB) || !PB->ResolveReplicatedOccupant(bIsField, Y, X, BenchIdx, Unit))
+		return false;
+
+	ApplyTileHoverUnit(Unit);
+	return true;
 }
 
 void APCCombatPlayerController::Client_CurrentDragUnit_Implementation(APCBaseUnitCharacter* Unit)
@@ -1605,6 +1753,11 @@ void APCCombatPlayerController::Client_TileHoverUnit_Implementation(APCBaseUnitC
 	if (!IsLocalController())
 		return;
 
+	ApplyTileHoverUnit(Unit);
+}
+
+void APCCombatPlayerController::ApplyTileHoverUnit(APCBaseUnitCharacter* Unit)
+{
 	if (bKeepDragHighlight)
 		return;
 
@@ -1734,6 +1887,7 @@ void APCCombatPlayerController::PatrolTransformChange(APCPlayerState* OnPatrolPl
 	
 	FocusedBoardSeatIndex = BoardSeatIndex;
 	SetViewTarget(CombatBoard);
+	Server_SetViewedBoardSeatIndex(BoardSeatIndex);
 	
 	if (IsPlayerEndPatrol)
 	{
@@ -3,8 +3,53 @@
 
 #include "DataAsset/FrameWork/PCStageData.h"
 
+#include "AssetRegistry/IAssetRegistry.h"
+#include "UObject/Package.h"
+
 #include "BaseGameplayTags.h"
 
+#if !UE_BUILD_SHIPPING
+namespace
+{
+	// 스케줄 검증 허용 오차 (초)
+	constexpr double ScheduleTolerance = 0.01;
+
+	// 콘솔 : PC.Schedule.Validate
+	FAutoConsoleCommand GPCScheduleValidateCommand(
+		TEXT("PC.Schedule.Validate"),
+		TEXT("Compile the round schedule of every UPCStageData asset and the built-in preset, and check the total duration against the stage data"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			TArray<const UPCStageData*> Presets;
+
+			TArray<FAssetData> Assets;
+			IAssetRegistry::GetChecked().GetAssetsByClass(UPCStageData::StaticClass()->GetClassPathName(), Assets, true);
+			for (const FAssetData& Asset : Assets)
+			{
+				if (const UPCStageData* StageData = Cast<UPCStageData>(Asset.GetAsset()))
+				{
+					Presets.AddUnique(StageData);
+				}
+			}
+
+			// Stages 가 비어 있으면 코드 프리셋으로 생성
+			Presets.Add(NewObject<UPCStageData>(GetTransientPackage(), TEXT("PCStageData_DefaultPreset")));
+
+			int32 NumFailed = 0;
+			for (const UPCStageData* StageData : Presets)
+			{
+				FString Report;
+				const bool bOk = StageData->ValidateSchedule(Report);
+				NumFailed += bOk ? 0 : 1;
+
+				UE_LOG(LogTemp, Log, TEXT("[Schedule] %s : %s %s"), *StageData->GetName(), bOk ? TEXT("OK") : TEXT("FAILED"), *Report);
+			}
+
+			UE_LOG(LogTemp, Log, TEXT("[Schedule] Validated %d presets, %d failed"), Presets.Num(), NumFailed);
+		}));
+}
+#endif
+
 static FGameplayTag DetermineMajorFor(const TArray<FRoundStep>& Steps)
 {
 	bool bHasPvE = false, bHasPvP = false, bHasCarousel = false, bHasStart = false;
@@ -292,6 +337,137 @@ void UPCStageData::BuildFlattenedPhase(TArray<FRoundStep>& RoundsStep, TArray<in
 	}
 }
 
+float UPCStageData::CompileSchedule(TArray<FPCScheduledStep>& OutSchedule,
+	TArray<FGameplayTag>* OutRoundMajorFlat, TArray<FGameplayTag>* OutPvESubTagFlat) const
+{
+	TArray<FRoundStep> Steps;
+	TArray<int32> SIdx, RIdx, KIdx;
+	TArray<FGameplayTag> RoundMajorFlat, PvESubTagFlat;
+	BuildFlattenedPhase(Steps, SIdx, RIdx, KIdx,
+		OutRoundMajorFlat ? *OutRoundMajorFlat : RoundMajorFlat, OutPvESubTagFlat ? *OutPvESubTagFlat : PvESubTagFlat);
+
+	OutSchedule.Reset(Steps.Num());
+
+	// 누적은 double 로 (스텝 수백 개에서 float 오차 방지)
+	double Offset = 0.0;
+	for (int32 i = 0; i < Steps.Num(); ++i)
+	{
+		FPCScheduledStep& Entry = OutSchedule.AddDefaulted_GetRef();
+		Entry.StageType = Steps[i].StageType;
+		Entry.StageIdx = SIdx[i];
+		Entry.RoundIdx = RIdx[i];
+		Entry.StepIdxInRound = KIdx[i];
+		Entry.Label = FString::Printf(TEXT("%d-%d"), Entry.StageIdx, Entry.RoundIdx);
+		Entry.Duration = GetRoundDuration(Steps[i]);
+		Entry.StartOffset = static_cast<float>(Offset);
+
+		Offset += Entry.Duration;
+	}
+
+	// 인접 스텝 / 다음 라운드 시작은 뒤에서부터 한 번에
+	int32 NextRoundStart = INDEX_NONE;
+	for (int32 i = OutSchedule.Num() - 1; i >= 0; --i)
+	{
+		FPCScheduledStep& Entry = OutSchedule[i];
+		Entry.PrevStageType = (i > 0) ? OutSchedule[i - 1].StageType : EPCStageType::None;
+		Entry.NextStageType = (i + 1 < OutSchedule.Num()) ? OutSchedule[i + 1].StageType : EPCStageType::None;
+		Entry.NextRoundStepIndex = NextRoundStart;
+
+		if (Entry.StepIdxInRound == 0)
+		{
+			NextRoundStart = i;
+		}
+	}
+
+	return static_cast<float>(Offset);
+}
+
+bool UPCStageData::ValidateSchedule(FString& OutReport) const
+{
+#if !UE_BUILD_SHIPPING
+	TArray<FPCScheduledStep> Schedule;
+	const float Total = CompileSchedule(Schedule);
+
+	// 기대값은 컴파일 경로와 별개로 원본 데이터에서 직접 합산
+	double Expected = 0.0;
+	int32 ExpectedSteps = 0;
+	if (Stages.Num() > 0)
+	{
+		for (const FStageSpec& Stage : Stages)
+		{
+			for (const FRoundSpec& Round : Stage.Rounds)
+			{
+				for (const FRoundStep& Step : Round.Steps)
+				{
+					Expected += GetRoundDuration(Step);
+					++ExpectedSteps;
+				}
+			}
+		}
+	}
+	else
+	{
+		TArray<FRoundStep> Steps;
+		TArray<int32> SIdx, RIdx, KIdx;
+		TArray<FGameplayTag> RoundMajorFlat, PvESubTagFlat;
+		BuildFlattenedPhase(Steps, SIdx, RIdx, KIdx, RoundMajorFlat, PvESubTagFlat);
+
+		for (const FRoundStep& Step : Steps)
+		{
+			Expected += GetRoundDuration(Step);
+		}
+		ExpectedSteps = Steps.Num();
+	}
+
+	TArray<FString> Errors;
+	if (Schedule.Num() != ExpectedSteps)
+	{
+		Errors.Add(FString::Printf(TEXT("step count %d != %d"), Schedule.Num(), ExpectedSteps));
+	}
+
+	if (!FMath::IsNearlyEqual(static_cast<double>(Total), Expected, ScheduleTolerance))
+	{
+		Errors.Add(FString::Printf(TEXT("total %.3f != %.3f"), Total, Expected));
+	}
+
+	for (int32 i = 0; i < Schedule.Num(); ++i)
+	{
+		const FPCScheduledStep& Entry = Schedule[i];
+		const float PrevEnd = (i > 0) ? Schedule[i - 1].GetEndOffset() : 0.f;
+
+		if (Entry.Duration <= 0.f)
+		{
+			Errors.Add(FString::Printf(TEXT("[%d] %s non-positive duration"), i, *Entry.Label));
+		}
+		if (!FMath::IsNearlyEqual(Entry.StartOffset, PrevEnd, static_cast<float>(ScheduleTolerance)))
+		{
+			Errors.Add(FString::Printf(TEXT("[%d] %s start %.3f != previous end %.3f"), i, *Entry.Label, Entry.StartOffset, PrevEnd));
+		}
+		if (Entry.PrevStageType != ((i > 0) ? Schedule[i - 1].StageType : EPCStageType::None)
+			|| Entry.NextStageType != ((i + 1 < Schedule.Num()) ? Schedule[i + 1].StageType : EPCStageType::None))
+		{
+			Errors.Add(FString::Printf(TEXT("[%d] %s neighbour mismatch"), i, *Entry.Label));
+		}
+	}
+
+	if (Schedule.Num() > 0 && !FMath::IsNearlyEqual(Schedule.Last().GetEndOffset(), Total, static_cast<float>(ScheduleTolerance)))
+	{
+		Errors.Add(FString::Printf(TEXT("last end %.3f != total %.3f"), Schedule.Last().GetEndOffset(), Total));
+	}
+
+	OutReport = FString::Printf(TEXT("Steps %d, Total %.2fs (expected %.2fs)"), Schedule.Num(), Total, Expected);
+	for (int32 i = 0; i < FMath::Min(Errors.Num(), 5); ++i)
+	{
+		OutReport += TEXT(" | ") + Errors[i];
+	}
+
+	return Errors.IsEmpty();
+#else
+	OutReport.Reset();
+	return true;
+#endif
+}
+
 FString UPCStageData::MakeStageRoundLabel(int32 FloatIndex, const TArray<int32>& StageIdx,
 	const TArray<int32>& RoundIdx) const
 {
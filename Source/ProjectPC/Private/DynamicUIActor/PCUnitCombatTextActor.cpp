@@ -28,11 +28,11 @@ APCUnitCombatTextActor::APCUnitCombatTextActor()
 	WidgetComponent->SetPivot(FVector2D(0.5f, 0.5f));
 }
 
-void APCUnitCombatTextActor::InitCombatTextActor(const USceneComponent* InAttachComp,
+void APCUnitCombatTextActor::InitCombatTextActor(const FVector& AnchorLocation,
 	const FCombatTextInitParams& InParams)
 {
 	// 위치 계산
-	FVector SpawnLoc = InAttachComp->GetSocketLocation(InParams.AttachSocketName);
+	FVector SpawnLoc = AnchorLocation;
 	SpawnLoc.Z += InParams.VerticalOffset;
 
 	// 흔들림 추가
@@ -86,6 +86,11 @@ void APCUnitCombatTextActor::InitCombatTextActor(const USceneComponent* InAttach
 	}
 }
 
+TSubclassOf<UUserWidget> APCUnitCombatTextActor::GetCombatTextWidgetClass() const
+{
+	return WidgetComponent ? WidgetComponent->GetWidgetClass() : nullptr;
+}
+
 void APCUnitCombatTextActor::ReturnToPool()
 {
 	LiftOwner = nullptr;
@@ -17,6 +17,10 @@
 #include "GameFramework/HelpActor/PCPlayerBoard.h"
 #include "GameFramework/HelpActor/Component/PCTileManager.h"
 #include "GameFramework/PlayerState/PCPlayerState.h"
+#if !UE_BUILD_SHIPPING
+#include "GameFramework/WorldSubsystem/PCLoadTestSubsystem.h"
+#endif
+#include "GameFramework/WorldSubsystem/PCMatchRandomSubsystem.h"
 #include "GameFramework/WorldSubsystem/PCUnitGERegistrySubsystem.h"
 #include "GameFramework/WorldSubsystem/PCUnitSpawnSubsystem.h"
 #include "Shop/PCShopManager.h"
@@ -33,6 +37,13 @@ APCCombatGameMode::APCCombatGameMode()
 void APCCombatGameMode::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// 상점 / 대진 / 전투 난수가 모두 이 시드에서 파생되므로 가장 먼저 초기화
+	if (auto* MatchRandomSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UPCMatchRandomSubsystem>() : nullptr)
+	{
+		MatchRandomSubsystem->InitializeMatchRandom(MatchSeed);
+	}
+	
 	BuildHelperActor();
 	BuildStageData();
 	EnterLoadingPhase();
@@ -139,39 +150,39 @@ void APCCombatGameMode::BuildHelperActor()
 
 void APCCombatGameMode::BuildStageData()
 {
-	FlatRoundSteps.Reset();
-	FlatStageIdx.Reset();
-	FlatRoundIdx.Reset();
-	FlatStepIdxInRound.Reset();
+	Schedule.Reset();
+	ScheduleHandlers.Reset();
+
+	if (!StageData)
+		return;
 
-	TArray<FRoundStep> Steps; TArray<int32> SIdx, RIdx, KIdx;
+	// 시작 시각 / 라벨 / 인접 스텝까지 한 번에 컴파일, 이후 스텝 진행은 조회만
 	TArray<FGameplayTag> RoundMajorFlat;
-	TArray<FGameplayTag>  PvESubTagFlat;
+	TArray<FGameplayTag> PvESubTagFlat;
+	const float TotalSeconds = StageData->CompileSchedule(Schedule, &RoundMajorFlat, &PvESubTagFlat);
 
-	StageData->BuildFlattenedPhase(Steps, SIdx, RIdx, KIdx, RoundMajorFlat, PvESubTagFlat);
+	ScheduleHandlers.Reserve(Schedule.Num());
+	for (const FPCScheduledStep& Step : Schedule)
+	{
+		ScheduleHandlers.Add(ResolveStepHandler(Step.StageType));
+	}
 
-	// 네가 쓰는 플랫 스텝/인덱스 유지
-	FlatRoundSteps     = Steps;
-	FlatStageIdx       = SIdx;
-	FlatRoundIdx       = RIdx;
-	FlatStepIdxInRound = KIdx;
+	UE_LOG(LogTemp, Log, TEXT("[Schedule] Compiled %d steps, %.1fs"), Schedule.Num(), TotalSeconds);
 	
 	TArray<int32> Counts;
 
 	int32 MaxStage = -1;
-	for (int32 v : SIdx)
+	for (const FPCScheduledStep& Step : Schedule)
 	{
-		MaxStage = FMath::Max(MaxStage, v);
+		MaxStage = FMath::Max(MaxStage, Step.StageIdx);
 	}
 	Counts.Init(0, MaxStage + 1);
 
-	for (int32 i = 0; i < SIdx.Num() && i < KIdx.Num(); ++i)
+	for (const FPCScheduledStep& Step : Schedule)
 	{
-		const int32 Stage = SIdx[i];
-		const int32 StepInRound = KIdx[i];
-		if (Stage >= 0 && Stage < Counts.Num() && StepInRound == 0)
+		if (Step.StageIdx >= 0 && Step.StageIdx < Counts.Num() && Step.StepIdxInRound == 0)
 		{
-			++Counts[Stage];
+			++Counts[Step.StageIdx];
 		}
 	}
 	
@@ -183,14 +194,34 @@ void APCCombatGameMode::BuildStageData()
 			GS->SetRoundsPerStage(Counts);
 			GS->SetRoundMajorsFlat(RoundMajorFlat);
 			GS->RoundPvETagFlat = PvESubTagFlat;
+			GS->SetRoundSchedule(Schedule);
 			GS->ForceNetUpdate();
 		}
 	}
 }
 
+APCCombatGameMode::FStepHandler APCCombatGameMode::ResolveStepHandler(EPCStageType StageType)
+{
+	switch (StageType)
+	{
+	case EPCStageType::Start : return &APCCombatGameMode::Step_Start;
+	case EPCStageType::Setup : return &APCCombatGameMode::Step_Setup;
+	case EPCStageType::Travel : return &APCCombatGameMode::Step_Travel;
+	case EPCStageType::Return : return &APCCombatGameMode::Step_Return;
+	case EPCStageType::PvP : return &APCCombatGameMode::Step_PvP;
+	case EPCStageType::PvPResult : return &APCCombatGameMode::Step_PvPResult;
+	case EPCStageType::CreepSpawn : return &APCCombatGameMode::Step_CreepSpawn;
+	case EPCStageType::PvE : return &APCCombatGameMode::Step_PvE;
+	case EPCStageType::Carousel : return &APCCombatGameMode::Step_Carousel;
+		default: return nullptr;
+	}
+}
+
 void APCCombatGameMode::StartFromBeginning()
 {
 	Cursor = 0;
+	ScheduleOriginTime = NowServer();
+	ScheduleShift = 0.f;
 	BeginCurrentStep();
 }
 
@@ -201,46 +232,37 @@ void APCCombatGameMode::AdvanceCursor()
 
 void APCCombatGameMode::BeginCurrentStep()
 {
-	if (!GetCombatGameState() || !FlatRoundSteps.IsValidIndex(Cursor)) return;
+	if (!GetCombatGameState() || !Schedule.IsValidIndex(Cursor)) return;
 
-	const FRoundStep& Step = FlatRoundSteps[Cursor];
-	const float Duration = Step.DurationOverride > 0.f ? Step.DurationOverride
-						: (StageData ? StageData->GetDefaultDuration(Step.StageType) : 30.f);
+	const FPCScheduledStep& Step = Schedule[Cursor];
+
+	// 스케줄 기준 절대 시각 (앞 스텝 타이머가 늦게 끝나도 다음 스텝 종료 시각은 그대로)
+	const float StartTime = ScheduleOriginTime + Step.StartOffset + ScheduleShift;
 
 	// GameState 동기화
 	FStageRuntimeState State;
 	State.FloatIndex = Cursor;
-	State.StageIdx = FlatStageIdx.IsValidIndex(Cursor) ? FlatStageIdx[Cursor] : 0;
-	State.RoundIdx = FlatRoundIdx.IsValidIndex(Cursor) ? FlatRoundIdx[Cursor] : 0;
-	State.StepIdxInRound = FlatStepIdxInRound.IsValidIndex(Cursor) ? FlatStepIdxInRound[Cursor] : 0;
+	State.StageIdx = Step.StageIdx;
+	State.RoundIdx = Step.RoundIdx;
+	State.StepIdxInRound = Step.StepIdxInRound;
 	State.Stage = Step.StageType;
-	State.Duration = Duration;
-	State.ServerStartTime = NowServer();
-	State.ServerEndTime = NowServer() + Duration;
+	State.Duration = Step.Duration;
+	State.ServerStartTime = StartTime;
+	State.ServerEndTime = StartTime + Step.Duration;
+	State.ScheduleOriginTime = ScheduleOriginTime;
+	State.ScheduleShift = ScheduleShift;
 
 	if (APCCombatGameState* PCGameState = GetCombatGameState())
 	{
 		PCGameState->SetStageRunTime(State);
 	}
 
-	const FString StageName = FString::Printf(TEXT("%d-%d"), State.StageIdx+1, State.RoundIdx+1);
-
 	// 타이머
-	GetWorldTimerManager().ClearTimer(RoundTimer);
-	GetWorldTimerManager().SetTimer(RoundTimer, this, &APCCombatGameMode::EndCurrentStep, Duration, false);
+	ArmStepTimer(State.ServerEndTime);
 
-	switch (Step.StageType)
+	if (const FStepHandler Handler = ScheduleHandlers.IsValidIndex(Cursor) ? ScheduleHandlers[Cursor] : nullptr)
 	{
-	case EPCStageType::Start : Step_Start(); break;
-	case EPCStageType::Setup : Step_Setup(); break;
-	case EPCStageType::Travel : Step_Travel(); break;
-	case EPCStageType::Return : Step_Return(); break;
-	case EPCStageType::PvP : Step_PvP(); break;
-	case EPCStageType::PvPResult : Step_PvPResult(); break;
-	case EPCStageType::CreepSpawn : Step_CreepSpawn(); break;
-	case EPCStageType::PvE : Step_PvE(); break;
-	case EPCStageType::Carousel : Step_Carousel(); break;
-		default: break;
+		(this->*Handler)();
 	}
 }
 
@@ -248,11 +270,20 @@ void APCCombatGameMode::EndCurrentStep()
 {
 	AdvanceCursor();
 	
-	if (FlatRoundSteps.IsValidIndex(Cursor))
+	if (Schedule.IsValidIndex(Cursor))
 		BeginCurrentStep();
 	
 }
 
+void APCCombatGameMode::ArmStepTimer(float ServerEndTime)
+{
+	// 0 이하면 SetTimer 가 타이머를 지우므로 최소값 보장
+	const float Delay = FMath::Max(ServerEndTime - NowServer(), 0.01f);
+
+	GetWorldTimerManager().ClearTimer(RoundTimer);
+	GetWorldTimerManager().SetTimer(RoundTimer, this, &APCCombatGameMode::EndCurrentStep, Delay, false);
+}
+
 void APCCombatGameMode::Step_Start()
 {
 	PlaceAllPlayersOnCarousel();
@@ -268,8 +299,9 @@ void APCCombatGameMode::Step_Start()
 
 void APCCombatGameMode::Step_Setup()
 {
-	const int32 Stage = FlatStageIdx.IsValidIndex(Cursor) ? FlatStageIdx[Cursor] : 0;
-	const int32 Round = FlatRoundIdx.IsValidIndex(Cursor) ? FlatRoundIdx[Cursor] : 0;
+	const FPCScheduledStep* Step = GetCurrentStep();
+	const int32 Stage = Step ? Step->StageIdx : 0;
+	const int32 Round = Step ? Step->RoundIdx : 0;
 	const bool NotReward = (Stage == 1.f && Round == 2.f);
 
 	if (APCCombatGameState* PCCombatGameState = GetCombatGameState())
@@ -301,9 +333,9 @@ void APCCombatGameMode::Step_Setup()
 
 void APCCombatGameMode::Step_Travel()
 {
-	const int32 Stage = FlatStageIdx.IsValidIndex(Cursor) ? FlatStageIdx[Cursor] : 0;
-	const FRoundStep* Next = PeekNextStep();
-	if (!Next) return;
+	const FPCScheduledStep* Step = GetCurrentStep();
+	if (!Step || Step->NextStageType == EPCStageType::None) return;
+	const int32 Stage = Step->StageIdx;
 
 	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
 	{
@@ -313,7 +345,7 @@ void APCCombatGameMode::Step_Travel()
 		}
 	}
 
-	switch (Next->StageType)
+	switch (Step->NextStageType)
 	{
 	case EPCStageType::PvP:
 		{
@@ -374,13 +406,14 @@ void APCCombatGameMode::Step_Return()
 		}
 	}
 	
-	const FRoundStep* Prev = PeekPrevStep();
-	if (!Prev)
+	const FPCScheduledStep* Step = GetCurrentStep();
+	const EPCStageType PrevStageType = Step ? Step->PrevStageType : EPCStageType::None;
+	if (PrevStageType == EPCStageType::None)
 	{
 		MovePlayersToBoardsAndCameraSet();
 		return;
 	}
-	if (Prev->StageType == EPCStageType::PvPResult)
+	if (PrevStageType == EPCStageType::PvPResult)
 	{
 
 		if (APCCombatGameState* PCGameState = GetCombatGameState())
@@ -394,17 +427,17 @@ void APCCombatGameMode::Step_Return()
 			PCCombatManager->ReturnPlayersForAllPairs(ReturnCameraBlend);
 		}
 	}
-	else if (Prev->StageType == EPCStageType::Carousel)
+	else if (PrevStageType == EPCStageType::Carousel)
 	{
 		MovePlayersToBoardsAndCameraSet();
 		PlaceAllPlayersPickUpUnit();
 	}
-	else if (Prev->StageType == EPCStageType::Start)
+	else if (PrevStageType == EPCStageType::Start)
 	{
 		MovePlayersToBoardsAndCameraSet();
 		PlayerStartUnitSpawn();
 	}
-	else if (Prev->StageType == EPCStageType::PvE)
+	else if (PrevStageType == EPCStageType::PvE)
 	{
 		if (APCCombatGameState* PCGameState = GetCombatGameState())
 		{
@@ -493,23 +526,19 @@ void APCCombatGameMode::Step_Carousel()
 	const int32 WaveCount = CarouselWaves.Num();
 	const float TotalDuration = (WaveCount > 1) ? (WaveCount-1)*5.f + 8.f : 8.f;
 	
-	if (APCCombatGameState* GS = GetCombatGameState())
-	{
-		FStageRuntimeState S;
-		S.FloatIndex       = Cursor;
-		S.StageIdx         = FlatStageIdx.IsValidIndex(Cursor) ? FlatStageIdx[Cursor] : 0;
-		S.RoundIdx         = FlatRoundIdx.IsValidIndex(Cursor) ? FlatRoundIdx[Cursor] : 0;
-		S.StepIdxInRound   = FlatStepIdxInRound.IsValidIndex(Cursor) ? FlatStepIdxInRound[Cursor] : 0;
-		S.Stage            = EPCStageType::Carousel;
-		S.Duration         = TotalDuration;
-		S.ServerStartTime  = NowServer();
-		S.ServerEndTime    = S.ServerStartTime + TotalDuration;
-		GS->SetStageRunTime(S);
-	}
+	// 웨이브 수로 정해진 길이와 스케줄 길이의 차이만큼 이후 스텝을 밀거나 당김
+	const FPCScheduledStep* Step = GetCurrentStep();
+	ScheduleShift += TotalDuration - (Step ? Step->Duration : TotalDuration);
+
+	FStageRuntimeState S = PCGameState->GetStageRunTime();
+	S.Stage            = EPCStageType::Carousel;
+	S.Duration         = TotalDuration;
+	S.ServerEndTime    = S.ServerStartTime + TotalDuration;
+	S.ScheduleShift    = ScheduleShift;
+	PCGameState->SetStageRunTime(S);
 
 	// 기존 RoundTimer(상위 BeginCurrentStep에서 잡힌 것) 무시하고, 우리 스케줄로 교체
-	GetWorldTimerManager().ClearTimer(RoundTimer);
-	GetWorldTimerManager().SetTimer(RoundTimer, this, &APCCombatGameMode::EndCurrentStep, TotalDuration, false);
+	ArmStepTimer(S.ServerEndTime);
 
 	// 웨이브 진행 시작
 	StartCarouselWaves();
@@ -632,6 +661,7 @@ void APCCombatGameMode::MovePlayersToBoardsAndCameraSet()
 			Pawn->TeleportTo(Seat.GetLocation(), Pawn->GetActorRotation(), false, true);
 		}
 		
+		PlayerController->SetViewedBoardSeatIndex(BoardIdx);
 		PlayerController->ClientFocusBoardBySeatIndex(BoardIdx, 0);
 	}
 }
@@ -647,6 +677,7 @@ void APCCombatGameMode::SetCarouselCameraForAllPlayers()
 		{
 			if (APCPlayerState* PCPlayerState = PCCombatController->GetPlayerState<APCPlayerState>())
 			{
+				PCCombatController->SetViewedBoardSeatIndex(INDEX_NONE);
 				PCCombatController->ClientCameraSetCarousel(CarouselRing,PCPlayerState->SeatIndex, 0);
 			}
 		}
@@ -660,16 +691,9 @@ int32 APCCombatGameMode::ResolveBoardIndex(const APCPlayerState* PlayerState) co
 	return FMath::Clamp(PlayerState->SeatIndex % CombatBoard.Num(), 0, CombatBoard.Num()-1);
 }
 
-const FRoundStep* APCCombatGameMode::PeekPrevStep() const
-{
-	const int32 Prev = Cursor - 1;
-	return FlatRoundSteps.IsValidIndex(Prev) ? &FlatRoundSteps[Prev] : nullptr;
-}
-
-const FRoundStep* APCCombatGameMode::PeekNextStep() const
+const FPCScheduledStep* APCCombatGameMode::GetCurrentStep() const
 {
-	const int32 Next = Cursor + 1;
-	return FlatRoundSteps.IsValidIndex(Next) ? &FlatRoundSteps[Next] : nullptr;
+	return Schedule.IsValidIndex(Cursor) ? &Schedule[Cursor] : nullptr;
 }
 
 APCCombatGameState* APCCombatGameMode::GetCombatGameState() const
@@ -802,7 +826,7 @@ void APCCombatGameMode::FinishPreStartAndSchedule()
 	FStageRuntimeState S;
 	S.Stage = EPCStageType::Start;
 	S.ServerStartTime = TStart;
-	S.ServerEndTime = TStart + (StageData ? StageData->GetDefaultDuration(EPCStageType::Start) : 1.f);
+	S.ServerEndTime = TStart + (Schedule.Num() > 0 ? Schedule[0].Duration : 1.f);
 	GS->SetStageRunTime(S);
 }
 
@@ -817,8 +841,13 @@ void APCCombatGameMode::ForceShortenCurrentStep(float NewRemainingSeconds)
 	FStageRuntimeState S = GetCombatGameState()->GetStageRunTime();
 	const double Now = NowServer();
 	const float Elapsed = FMath::Max(0.f, Now - S.ServerStartTime);
+
+	// 줄어든 만큼 이후 스텝 시작 시각도 당김 (다음 스텝이 원래 종료 시각을 기준으로 다시 계산되지 않게)
+	ScheduleShift += (Now + NewRemainingSeconds) - S.ServerEndTime;
+
 	S.Duration = Elapsed + NewRemainingSeconds;
 	S.ServerEndTime = Now + NewRemainingSeconds;
+	S.ScheduleShift = ScheduleShift;
 	GetCombatGameState()->SetStageRunTime(S);
 }
 
@@ -901,6 +930,14 @@ void APCCombatGameMode::PollLoading()
 	{
 		bSystems = false;
 	}
+	
+	// 유닛 클래스/레지스트리 비동기 로드 배리어
+	UPCUnitSpawnSubsystem* SpawnSubsys = GetWorld()->GetSubsystem<UPCUnitSpawnSubsystem>();
+	const bool bAssetsLoaded = SpawnSubsys && SpawnSubsys->IsSpawnConfigLoaded();
+	if (!bAssetsLoaded)
+	{
+		bSystems = false;
+	}
 
 	const float P4 = bSystems ? 1.f : 0.f;
 
@@ -913,7 +950,7 @@ void APCCombatGameMode::PollLoading()
 		return;
 	}
 
-	if (UPCUnitSpawnSubsystem* SpawnSubsys = GetWorld()->GetSubsystem<UPCUnitSpawnSubsystem>())
+	if (bAssetsLoaded)
 	{
 		FVector Loc = FVector(25000.f, 10000.f,50.f);
 		SpawnSubsys->PreloadAllHeroUnit(Loc);
@@ -929,6 +966,7 @@ void APCCombatGameMode::PollLoading()
 	if (Connected < Expected)       Detail = FString::Printf(TEXT("Players %d/%d connected"), Connected, Expected);
 	else if (Ready < Total)         Detail = FString::Printf(TEXT("Identities %d/%d ready"), Ready, Total);
 	else if (!bBoardsOK)            Detail = TEXT("Boards/TileManagers/PlayerBoards not ready");
+	else if (!bAssetsLoaded)        Detail = TEXT("Streaming unit assets...");
 	else if (!bSystems)             Detail = TEXT("Systems/Stage/Shop not ready");
 	else if (P5 < 1.f)              Detail = TEXT("Clients binding UI…");
 	else                            Detail = TEXT("Ready");
@@ -1080,6 +1118,14 @@ void APCCombatGameMode::InitGame(const FString& MapName, const FString& Options,
 	Super::InitGame(MapName, Options, ErrorMessage);
 	const FString S = UGameplayStatics::ParseOption(Options, TEXT("ExpPlayers"));
 	ExpectedPlayers = S.IsEmpty() ? 0 : FCString::Atoi(*S);
+
+#if !UE_BUILD_SHIPPING
+	// 부하 테스트 서버 (-PCLoadTest=N) : 봇 N 명이 모두 접속할 때까지 로딩 대기
+	if (ExpectedPlayers <= 0)
+	{
+		ExpectedPlayers = UPCLoadTestSubsystem::GetLoadTestPlayerCount();
+	}
+#endif
 }
 
 // Carousel Helper
@@ -5,6 +5,7 @@
 
 #include "EngineUtils.h"
 #include "Net/UnrealNetwork.h"
+#include "Serialization/MemoryWriter.h"
 
 #include "AbilitySystem/Player/AttributeSet/PCPlayerAttributeSet.h"
 #include "GameFramework/HelpActor/PCCombatBoard.h"
@@ -14,15 +15,33 @@
 #include "GameFramework/WorldSubsystem/PCItemManagerSubsystem.h"
 #include "GameFramework/WorldSubsystem/PCItemSpawnSubsystem.h"
 #include "GameFramework/WorldSubsystem/PCProjectilePoolSubsystem.h"
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
 #include "GameFramework/WorldSubsystem/PCUnitCombatTextSpawnSubsystem.h"
 #include "GameFramework/WorldSubsystem/PCUnitSpawnSubsystem.h"
 #include "Item/PCItemCapsule.h"
 #include "Shop/PCShopManager.h"
 
 
+#if !UE_BUILD_SHIPPING
+namespace
+{
+	FAutoConsoleCommandWithWorld GPCMeasureLeaderboardReplicationCommand(
+		TEXT("PC.Leaderboard.MeasureReplication"),
+		TEXT("Change every player's HP once and log leaderboard rows dirtied / row bytes vs. full rewrite (server)"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (APCCombatGameState* CombatGameState = World ? World->GetGameState<APCCombatGameState>() : nullptr)
+			{
+				CombatGameState->DebugMeasureLeaderboardReplication();
+			}
+		}));
+}
+#endif
+
 APCCombatGameState::APCCombatGameState()
 {
 	ShopManager = CreateDefaultSubobject<UPCShopManager>(TEXT("ShopManager"));
+	LeaderboardRows.OwnerGameState = this;
 }
 
 void APCCombatGameState::BeginPlay()
@@ -251,6 +270,11 @@ float APCCombatGameState::GetStageProgress() const
 
 FString APCCombatGameState::GetStageLabelString() const
 {
+	if (const FPCScheduledStep* Step = GetCurrentScheduledStep())
+	{
+		return Step->Label;
+	}
+
 	return FString::Printf(TEXT("%d-%d"), StageRuntimeState.StageIdx, StageRuntimeState.RoundIdx);
 }
 
@@ -276,6 +300,39 @@ void APCCombatGameState::SetRoundMajorsFlat(const TArray<FGameplayTag>& InFlatMa
 	ForceNetUpdate();
 }
 
+void APCCombatGameState::SetRoundSchedule(const TArray<FPCScheduledStep>& InSchedule)
+{
+	if (HasAuthority())
+	{
+		RoundSchedule = InSchedule;
+		OnRep_RoundsLayout();
+		ForceNetUpdate();
+	}
+}
+
+const FPCScheduledStep* APCCombatGameState::GetScheduledStep(int32 FloatIndex) const
+{
+	return RoundSchedule.IsValidIndex(FloatIndex) ? &RoundSchedule[FloatIndex] : nullptr;
+}
+
+float APCCombatGameState::GetScheduledStepStartTime(int32 FloatIndex) const
+{
+	const FPCScheduledStep* Step = GetScheduledStep(FloatIndex);
+	if (!Step)
+		return -1.f;
+
+	return StageRuntimeState.ScheduleOriginTime + Step->StartOffset + StageRuntimeState.ScheduleShift;
+}
+
+float APCCombatGameState::GetSecondsUntilNextRound() const
+{
+	const FPCScheduledStep* Step = GetCurrentScheduledStep();
+	if (!Step || Step->NextRoundStepIndex == INDEX_NONE)
+		return -1.f;
+
+	return FMath::Max(0.f, GetScheduledStepStartTime(Step->NextRoundStepIndex) - GetServerWorldTimeSeconds());
+}
+
 int32 APCCombatGameState::GetNumRoundsInStage(int32 StageIdx) const
 {
 	return RoundsPerStage.IsValidIndex(StageIdx) ? RoundsPerStage[StageIdx] : 0;
@@ -422,11 +479,12 @@ void APCCombatGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 	DOREPLIFETIME(APCCombatGameState, StageRuntimeState);
 	DOREPLIFETIME(APCCombatGameState, SeatToBoard);
 	DOREPLIFETIME(APCCombatGameState, bBoardMappingComplete);
-	DOREPLIFETIME(APCCombatGameState, Leaderboard);
+	DOREPLIFETIME(APCCombatGameState, LeaderboardRows);
 
 	DOREPLIFETIME(APCCombatGameState, RoundsPerStage);
 	DOREPLIFETIME(APCCombatGameState, RoundMajorFlat);
 	DOREPLIFETIME(APCCombatGameState, RoundPvETagFlat);
+	DOREPLIFETIME_CONDITION(APCCombatGameState, RoundSchedule, COND_InitialOnly);
 	DOREPLIFETIME(APCCombatGameState, SeatRoundResult);
 }
 
@@ -642,11 +700,16 @@ void APCCombatGameState::RebuildAndReplicatedLeaderboard()
 	if (!HasAuthority())
 		return;
 
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::LeaderboardRebuild);
+
 	const int32 Total = PlayerArray.Num();
 	if (Total <= 0)
 	{
 		Leaderboard.Reset();
-		ForceNetUpdate();
+		if (LeaderboardRows.ApplyRows(Leaderboard) > 0)
+		{
+			ForceNetUpdate();
+		}
 		return;
 	}
 
@@ -659,8 +722,6 @@ void APCCombatGameState::RebuildAndReplicatedLeaderboard()
 		{
 			const FString& Id = PCS->LocalUserId;
 
-			UE_LOG(LogTemp, Warning, TEXT("[leaderboard] LocalUserId : %s"), *Id)
-
 			FPlayerStandingRow Row;
 			Row.LocalUserId = Id;
 			Row.PlayerSeatIndex = PCS->SeatIndex;
@@ -670,21 +731,29 @@ void APCCombatGameState::RebuildAndReplicatedLeaderboard()
 			Row.StableOrder = StableOrderCache.FindRef(Id);
 			Row.LastChangeTime = LastChangeTimeCache.FindRef(Id);
 			Row.LiveRank = 0;
-			
-			if (auto ASC = PCS->GetAbilitySystemComponent())
-			{
-				FGameplayTagContainer PlayerTags;
-				ASC->GetOwnedGameplayTags(PlayerTags);
 
-				for (const FGameplayTag& Tag : PlayerTags)
+			// 캐릭터 태그는 게임 중 바뀌지 않으므로 찾을 때까지만 ASC 태그 조회
+			FGameplayTag& CharacterTag = CharacterTagCache.FindOrAdd(Id);
+			if (!CharacterTag.IsValid())
+			{
+				if (auto ASC = PCS->GetAbilitySystemComponent())
 				{
-					if (Tag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("Player.Type"))))
+					static const FGameplayTag PlayerTypeTag = FGameplayTag::RequestGameplayTag(FName("Player.Type"));
+
+					FGameplayTagContainer PlayerTags;
+					ASC->GetOwnedGameplayTags(PlayerTags);
+
+					for (const FGameplayTag& Tag : PlayerTags)
 					{
-						Row.CharacterTag = Tag;
-						break;
+						if (Tag.MatchesTag(PlayerTypeTag))
+						{
+							CharacterTag = Tag;
+							break;
+						}
 					}
 				}
 			}
+			Row.CharacterTag = CharacterTag;
 
 			RowById.Add(Id, Row);
 		}
@@ -709,6 +778,7 @@ void APCCombatGameState::RebuildAndReplicatedLeaderboard()
 		if (Row.FinalRank > 0)
 		{
 			const int32 SlotIdx = FMath::Clamp(Row.FinalRank -1, 0, Total -1);
+			Row.SlotIndex = SlotIdx;
 			NewReaderBoard[SlotIdx] = Row;
 			EmptySlots.Remove(SlotIdx);
 		}
@@ -748,6 +818,7 @@ void APCCombatGameState::RebuildAndReplicatedLeaderboard()
 
 		FPlayerStandingRow Placed = Alive;
 		Placed.LiveRank = LiveRankCounter++;
+		Placed.SlotIndex = SlotIdx;
 		NewReaderBoard[SlotIdx] = Placed;
 	}
 
@@ -759,10 +830,16 @@ void APCCombatGameState::RebuildAndReplicatedLeaderboard()
 		NewReaderBoard[SlotIdx] = PlaceHolder;
 	}
 
+	// 값이 바뀐 행만 Dirty 처리해서 복제
+	const int32 DirtyRows = LeaderboardRows.ApplyRows(NewReaderBoard);
+	
 	Leaderboard = MoveTemp(NewReaderBoard);
 	GetPlayerStatesOrdered();
-	
-	ForceNetUpdate();
+
+	if (DirtyRows > 0)
+	{
+		ForceNetUpdate();
+	}
 }
 
 void APCCombatGameState::TryFinalizeLastSurvivor()
@@ -822,18 +899,70 @@ void APCCombatGameState::GetPlayerStatesOrdered()
 	}
 }
 
-void APCCombatGameState::OnRep_Leaderboard()
+void APCCombatGameState::HandleLeaderboardRowChanged(const FPlayerStandingRow& Row)
 {
+	if (Row.LocalUserId.IsEmpty())
+		return;
+
+	FPlayerStandingRow& Cached = CachedLeaderboardMap.FindOrAdd(Row.LocalUserId);
+	if (Cached.SlotIndex != Row.SlotIndex || !Leaderboard.IsValidIndex(Row.SlotIndex))
+	{
+		bLeaderboardOrderDirty = true;
+	}
+	else
+	{
+		Leaderboard[Row.SlotIndex] = Row;
+	}
+	
+	Cached = Row;
+}
+
+void APCCombatGameState::HandleLeaderboardRowRemoved(const FPlayerStandingRow& Row)
+{
+	if (CachedLeaderboardMap.Remove(Row.LocalUserId) > 0)
+	{
+		bLeaderboardOrderDirty = true;
+	}
+}
+
+void APCCombatGameState::HandleLeaderboardRowsReceived()
+{
+	const bool bOrderChanged = bLeaderboardOrderDirty;
+	if (bOrderChanged)
+	{
+		// 칸이 바뀐 행이 있을 때만 칸 배열 / 순위 재구성
+		int32 NumSlots = 0;
+		for (const auto& Pair : CachedLeaderboardMap)
+		{
+			NumSlots = FMath::Max(NumSlots, Pair.Value.SlotIndex + 1);
+		}
+
+		Leaderboard.Reset(NumSlots);
+		Leaderboard.SetNum(NumSlots);
+		for (const auto& Pair : CachedLeaderboardMap)
+		{
+			if (Leaderboard.IsValidIndex(Pair.Value.SlotIndex))
+			{
+				Leaderboard[Pair.Value.SlotIndex] = Pair.Value;
+			}
+		}
+
+		GetPlayerStatesOrdered();
+		bLeaderboardOrderDirty = false;
+	}
+
 	BroadCastLeaderboardMap();
-	GetPlayerStatesOrdered();
 	
 	if (!bLeaderBoardReady)
 	{
 		bLeaderBoardReady = true;
 		OnLeaderBoardReady.Broadcast();
 	}
-	
-	OnPlayerRankingChanged.Broadcast(PlayerRanking);
+
+	if (bOrderChanged)
+	{
+		OnPlayerRankingChanged.Broadcast(PlayerRanking);
+	}
 }
 
 UAbilitySystemComponent* APCCombatGameState::ResolveASC(APCPlayerState* PCPlayerState) const
@@ -846,18 +975,105 @@ UAbilitySystemComponent* APCCombatGameState::ResolveASC(APCPlayerState* PCPlayer
 
 void APCCombatGameState::BroadCastLeaderboardMap()
 {
-	FLeaderBoardMap Map;
-	Map.Reserve(Leaderboard.Num());
-	for (const FPlayerStandingRow& Row : Leaderboard)
+	// CachedLeaderboardMap 은 행 단위 콜백에서 갱신됨
+	OnLeaderboardMapUpdated.Broadcast(CachedLeaderboardMap);
+}
+
+bool FPlayerStandingRow::HasSameStanding(const FPlayerStandingRow& Other) const
+{
+	return FMath::IsNearlyEqual(Hp, Other.Hp)
+		&& bEliminated == Other.bEliminated
+		&& LiveRank == Other.LiveRank
+		&& FinalRank == Other.FinalRank
+		&& SlotIndex == Other.SlotIndex
+		&& PlayerSeatIndex == Other.PlayerSeatIndex
+		&& CharacterTag == Other.CharacterTag
+		&& LocalUserId == Other.LocalUserId;
+}
+
+void FPlayerStandingEntry::PreReplicatedRemove(const FPlayerStandingArray& InArraySerializer)
+{
+	if (InArraySerializer.OwnerGameState)
 	{
-		if (!Row.LocalUserId.IsEmpty())
+		InArraySerializer.OwnerGameState->HandleLeaderboardRowRemoved(Row);
+	}
+}
+
+void FPlayerStandingEntry::PostReplicatedAdd(const FPlayerStandingArray& InArraySerializer)
+{
+	if (InArraySerializer.OwnerGameState)
+	{
+		InArraySerializer.OwnerGameState->HandleLeaderboardRowChanged(Row);
+	}
+}
+
+void FPlayerStandingEntry::PostReplicatedChange(const FPlayerStandingArray& InArraySerializer)
+{
+	if (InArraySerializer.OwnerGameState)
+	{
+		InArraySerializer.OwnerGameState->HandleLeaderboardRowChanged(Row);
+	}
+}
+
+int32 FPlayerStandingArray::ApplyRows(const TArray<FPlayerStandingRow>& Rows)
+{
+	int32 DirtyRows = 0;
+
+	// SeatIndex 가 아직 없으면 LocalUserId 로 매칭
+	auto IsSamePlayer = [](const FPlayerStandingRow& A, const FPlayerStandingRow& B)
+	{
+		return A.PlayerSeatIndex == B.PlayerSeatIndex && (A.PlayerSeatIndex >= 0 || A.LocalUserId == B.LocalUserId);
+	};
+
+	for (const FPlayerStandingRow& Row : Rows)
+	{
+		// 빈 칸은 복제하지 않음
+		if (Row.LocalUserId.IsEmpty())
+			continue;
+
+		if (FPlayerStandingEntry* Found = Entries.FindByPredicate([&](const FPlayerStandingEntry& Entry){ return IsSamePlayer(Entry.Row, Row); }))
 		{
-			Map.Add(Row.LocalUserId, Row);
+			if (!Found->Row.HasSameStanding(Row))
+			{
+				Found->Row = Row;
+				MarkItemDirty(*Found);
+				++DirtyRows;
+			}
+			else
+			{
+				// 정렬용 값만 갱신 (복제는 다음 변경 때 함께)
+				Found->Row.StableOrder = Row.StableOrder;
+				Found->Row.LastChangeTime = Row.LastChangeTime;
+			}
+			continue;
 		}
+
+		FPlayerStandingEntry& Added = Entries.AddDefaulted_GetRef();
+		Added.Row = Row;
+		MarkItemDirty(Added);
+		++DirtyRows;
+	}
+
+	// 나간 플레이어 제거
+	const int32 NumRemoved = Entries.RemoveAllSwap([&](const FPlayerStandingEntry& Entry)
+	{
+		return !Rows.ContainsByPredicate([&](const FPlayerStandingRow& Row){ return !Row.LocalUserId.IsEmpty() && IsSamePlayer(Entry.Row, Row); });
+	});
+	if (NumRemoved > 0)
+	{
+		MarkArrayDirty();
+		DirtyRows += NumRemoved;
+	}
+
+	return DirtyRows;
+}
+
+void FPlayerStandingArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (OwnerGameState)
+	{
+		OwnerGameState->HandleLeaderboardRowsReceived();
 	}
-	
-	CachedLeaderboardMap = Map;
-	OnLeaderboardMapUpdated.Broadcast(Map);
 }
 
 // 한 줄 포맷터 헬퍼
@@ -952,3 +1168,78 @@ void APCCombatGameState::Multicast_DebugPrintToScreen_Implementation(const TArra
 		);
 	}
 }
+
+void APCCombatGameState::DebugMeasureLeaderboardReplication()
+{
+#if !UE_BUILD_SHIPPING
+	if (!HasAuthority())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Leaderboard] Measure must run on the server"));
+		return;
+	}
+
+	auto SerializedSize = [](FPlayerStandingRow& Row)
+	{
+		TArray<uint8> Buffer;
+		FMemoryWriter Writer(Buffer);
+		FPlayerStandingRow::StaticStruct()->SerializeBin(Writer, &Row);
+		return Buffer.Num();
+	};
+
+	const FGameplayAttribute HpAttribute = UPCPlayerAttributeSet::GetPlayerHPAttribute();
+
+	TMap<UAbilitySystemComponent*, float> OriginalHp;
+	int32 NumChanges = 0;
+	int32 DirtyRowsTotal = 0;
+	int64 DeltaBytes = 0;
+	int64 FullRewriteBytes = 0;
+
+	// 한 라운드 : 살아있는 플레이어마다 HP 1 변경
+	for (APlayerState* PlayerState : PlayerArray)
+	{
+		APCPlayerState* PCPlayerState = Cast<APCPlayerState>(PlayerState);
+		UAbilitySystemComponent* ASC = ResolveASC(PCPlayerState);
+		if (!ASC)
+			continue;
+
+		const float Hp = ASC->GetNumericAttribute(HpAttribute);
+		if (Hp <= 1.f)
+			continue;
+
+		TArray<int32> KeysBefore;
+		for (const FPlayerStandingEntry& Entry : LeaderboardRows.Entries)
+		{
+			KeysBefore.Add(Entry.ReplicationKey);
+		}
+
+		OriginalHp.Add(ASC, Hp);
+		ASC->SetNumericAttributeBase(HpAttribute, Hp - 1.f);
+		++NumChanges;
+
+		for (int32 i = 0; i < LeaderboardRows.Entries.Num(); ++i)
+		{
+			FPlayerStandingEntry& Entry = LeaderboardRows.Entries[i];
+			const int32 RowBytes = SerializedSize(Entry.Row);
+
+			// 기존 방식 : 변경마다 모든 행 재작성
+			FullRewriteBytes += RowBytes;
+
+			if (!KeysBefore.IsValidIndex(i) || KeysBefore[i] != Entry.ReplicationKey)
+			{
+				++DirtyRowsTotal;
+				DeltaBytes += RowBytes;
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[Leaderboard] %d HP changes : %d dirty rows, row payload %lld bytes (full rewrite %lld bytes, %.1f%%)"),
+		NumChanges, DirtyRowsTotal, DeltaBytes, FullRewriteBytes,
+		FullRewriteBytes > 0 ? 100.0 * static_cast<double>(DeltaBytes) / static_cast<double>(FullRewriteBytes) : 0.0);
+
+	// HP 원복
+	for (const auto& Pair : OriginalHp)
+	{
+		Pair.Key->SetNumericAttributeBase(HpAttribute, Pair.Value);
+	}
+#endif
+}
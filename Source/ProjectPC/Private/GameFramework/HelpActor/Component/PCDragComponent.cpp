@@ -84,7 +84,10 @@ void UPCDragComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActo
                 LastQuestion_Y = Y;
                 LastQuestion_X = X;
                 LastQuestion_Bench = BenchIdx;
-                PC->Server_QueryTileUnit(bField, Y, X, BenchIdx);
+                if (!PC->TryResolveTileUnitLocally(bField, Y, X, BenchIdx))
+                {
+                    PC->Server_QueryTileUnit(bField, Y, X, BenchIdx);
+                }
             }
             return;
         }
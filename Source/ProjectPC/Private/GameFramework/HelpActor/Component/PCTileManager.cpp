@@ -4,12 +4,23 @@
 #include "GameFramework/HelpActor/Component/PCTileManager.h"
 #include "Character/Unit/PCHeroUnitCharacter.h"
 #include "GameFramework/HelpActor/PCCombatBoard.h"
+#include "GameFramework/WorldSubsystem/PCCombatReplaySubsystem.h"
 
 // Sets default values for this component's properties
 UPCTileManager::UPCTileManager()
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	HexTopology.Build(Cols, Rows);
+}
+
+void UPCTileManager::RebuildHexTopologyIfNeeded()
+{
+	if (!HexTopology.IsBuiltFor(Cols, Rows))
+	{
+		HexTopology.Build(Cols, Rows);
+	}
 }
 
 APCCombatBoard* UPCTileManager::GetCombatBoard() const
@@ -67,7 +78,7 @@ bool UPCTileManager::PlaceUnitOnField(int32 Y, int32 X, APCBaseUnitCharacter* Un
 
 	EnsureExclusive(Unit);
 
-	Field[i].Unit = Unit;
+	SetTileUnit(i, Unit);
 	APCCombatBoard* Board = GetCombatBoard();
 	const FVector Loc = Field[i].Position;
 	const FRotator Rot = CalcUnitRotation(Unit, FacingOverride);
@@ -95,7 +106,7 @@ bool UPCTileManager::RemoveFromField(int32 Y, int32 X, bool bPreserveUnitBoard)
 		}
 	}
 		
-	Field[i].Unit = nullptr;
+	SetTileUnit(i, nullptr);
 	return true;
 }
 
@@ -117,41 +128,14 @@ void UPCTileManager::GetAllFieldUnits(TArray<TWeakObjectPtr<APCBaseUnitCharacter
 
 FVector UPCTileManager::GetFieldUnitLocation(APCBaseUnitCharacter* InUnit) const
 {
-	if (!InUnit)
-		return FVector::ZeroVector;
-
-	for (int32 x = 0; x < Rows; ++x)
-	{
-		for (int32 y = 0; y < Cols; ++y)
-		{
-			const int32 i = y * Rows + x;
-			if (Field.IsValidIndex(i) && Field[i].Unit == InUnit)
-			{
-				return Field[i].Position;
-			}
-		}
-	}
-	return FVector::ZeroVector;
+	const int32 i = FindOccupiedIndex(InUnit);
+	return Field.IsValidIndex(i) ? Field[i].Position : FVector::ZeroVector;
 }
 
 FIntPoint UPCTileManager::GetFieldUnitGridPoint(APCBaseUnitCharacter* InUnit) const
 {
-	if (!InUnit)
-		return FIntPoint::NoneValue;
-	for (int32 x = 0; x < Rows; ++x)
-	{
-		for (int32 y = 0; y < Cols; ++y)
-		{
-			const int32 i = y * Rows + x;
-			if (Field.IsValidIndex(i) && Field[i].Unit == InUnit)
-			{
-				return Field[i].UnitIntPoint;
-			}
-		}
-	}
-	
-	return FIntPoint::NoneValue;
-	
+	const int32 i = FindOccupiedIndex(InUnit);
+	return Field.IsValidIndex(i) ? Field[i].UnitIntPoint : FIntPoint::NoneValue;
 }
 
 FVector UPCTileManager::GetTileWorldPosition(int32 Y, int32 X) const
@@ -170,9 +154,9 @@ FVector UPCTileManager::GetTileLocalPosition(int32 Y, int32 X) const
 
 void UPCTileManager::ClearAll()
 {
-	for (auto& FieldTile : Field)
+	for (int32 i = 0; i < Field.Num(); ++i)
 	{
-		FieldTile.Unit = nullptr;
+		SetTileUnit(i, nullptr);
 	}
 }
 
@@ -211,10 +195,14 @@ bool UPCTileManager::CanUse(int32 Y, int32 X, const APCBaseUnitCharacter* InUnit
 // 어딘가에 예약이 되어있는지
 bool UPCTileManager::HasAnyReservation(const APCBaseUnitCharacter* InUnit) const
 {
-	if (!InUnit) return false;
-	for (const FTile& Tile : Field)
+	if (!IsValid(InUnit)) return false;
+	const FUnitTileSlots* Slots = UnitTileIndex.Find(InUnit);
+	if (!Slots) return false;
+
+	// 인덱스는 파괴 대기 유닛도 키로 들고 있으므로 타일 쪽 약참조(Get)로 한 번 더 확인
+	for (const int32 Index : Slots->Reserved)
 	{
-		if (Tile.IsReservedBy(InUnit))
+		if (Field.IsValidIndex(Index) && Field[Index].IsReservedBy(InUnit))
 		{
 			return true;
 		}
@@ -239,7 +227,7 @@ bool UPCTileManager::SetTileState(int32 Y, int32 X, APCBaseUnitCharacter* InUnit
 		{
 			return false;
 		}
-		Tile.ReservedUnit = InUnit;
+		SetTileReservation(Index, InUnit);
 		return true;
 
 	case ETileAction::Occupy:
@@ -248,8 +236,8 @@ bool UPCTileManager::SetTileState(int32 Y, int32 X, APCBaseUnitCharacter* InUnit
 		{
 			return false;
 		}
-		Tile.Unit = InUnit;
-		Tile.ReservedUnit = nullptr;
+		SetTileUnit(Index, InUnit);
+		SetTileReservation(Index, nullptr);
 		InUnit->SetOnCombatBoard(CachedCombatBoard.Get());
 		//InUnit->SetActorLocation(Tile.Position);
 		return true;
@@ -258,11 +246,11 @@ bool UPCTileManager::SetTileState(int32 Y, int32 X, APCBaseUnitCharacter* InUnit
 		{
 			if (Tile.IsOwnedBy(InUnit))
 			{
-				Tile.Unit = nullptr;
+				SetTileUnit(Index, nullptr);
 			}
 			if (Tile.IsReservedBy(InUnit))
 			{
-				Tile.ReservedUnit = nullptr;
+				SetTileReservation(Index, nullptr);
 			}
 			return true;
 		}
@@ -274,15 +262,17 @@ void UPCTileManager::ClearAllForUnit(APCBaseUnitCharacter* InUnit)
 {
 	if (!InUnit) return;
 
-	for (FTile& Tile : Field)
+	// 역인덱스에서 이 유닛이 잡고 있는 타일만 해제 (Field 전체 스캔 X)
+	if (const FUnitTileSlots* Slots = UnitTileIndex.Find(InUnit))
 	{
-		if (Tile.IsOwnedBy(InUnit))
+		const FUnitTileSlots SlotsCopy = *Slots;
+		for (const int32 Index : SlotsCopy.Occupied)
 		{
-			Tile.Unit = nullptr;
+			SetTileUnit(Index, nullptr);
 		}
-		if (Tile.IsReservedBy(InUnit))
+		for (const int32 Index : SlotsCopy.Reserved)
 		{
-			Tile.ReservedUnit = nullptr;
+			SetTileReservation(Index, nullptr);
 		}
 	}
 
@@ -302,6 +292,84 @@ bool UPCTileManager::IsValidTile(int32 Y, int32 X, int32& OutIndex) const
 	
 }
 
+void UPCTileManager::SetTileUnit(int32 Index, APCBaseUnitCharacter* NewUnit)
+{
+	if (!Field.IsValidIndex(Index))
+		return;
+
+	FTile& Tile = Field[Index];
+	if (Tile.Unit == NewUnit)
+		return;
+
+	if (Tile.Unit)
+	{
+		if (FUnitTileSlots* Slots = UnitTileIndex.Find(Tile.Unit))
+		{
+			Slots->Occupied.RemoveSingle(Index);
+			if (Slots->IsEmpty())
+			{
+				UnitTileIndex.Remove(Tile.Unit);
+			}
+		}
+	}
+
+	Tile.Unit = NewUnit;
+	
+	if (NewUnit)
+	{
+		UnitTileIndex.FindOrAdd(NewUnit).Occupied.AddUnique(Index);
+
+		if (UPCCombatReplaySubsystem* Replay = UPCCombatReplaySubsystem::FindRecorder(this))
+		{
+			Replay->RecordMove(NewUnit, Index);
+		}
+	}
+
+	ValidateUnitIndexIfEnabled();
+}
+
+void UPCTileManager::SetTileReservation(int32 Index, APCBaseUnitCharacter* NewUnit)
+{
+	if (!Field.IsValidIndex(Index))
+		return;
+
+	FTile& Tile = Field[Index];
+	// 파괴 대기 중인 유닛도 인덱스 키로는 찾을 수 있게 EvenIfPendingKill
+	APCBaseUnitCharacter* OldUnit = Tile.ReservedUnit.Get(true);
+	if (OldUnit == NewUnit)
+		return;
+
+	if (OldUnit)
+	{
+		if (FUnitTileSlots* Slots = UnitTileIndex.Find(OldUnit))
+		{
+			Slots->Reserved.RemoveSingle(Index);
+			if (Slots->IsEmpty())
+			{
+				UnitTileIndex.Remove(OldUnit);
+			}
+		}
+	}
+
+	Tile.ReservedUnit = NewUnit;
+
+	if (NewUnit)
+	{
+		UnitTileIndex.FindOrAdd(NewUnit).Reserved.AddUnique(Index);
+	}
+
+	ValidateUnitIndexIfEnabled();
+}
+
+int32 UPCTileManager::FindOccupiedIndex(const APCBaseUnitCharacter* InUnit) const
+{
+	if (!InUnit)
+		return INDEX_NONE;
+
+	const FUnitTileSlots* Slots = UnitTileIndex.Find(InUnit);
+	return (Slots && !Slots->Occupied.IsEmpty()) ? Slots->Occupied[0] : INDEX_NONE;
+}
+
 bool UPCTileManager::EnsureExclusive(APCBaseUnitCharacter* InUnit)
 {
 	if (!InUnit) return false;
@@ -359,39 +427,55 @@ TArray<APCBaseUnitCharacter*> UPCTileManager::GetAllAliveUnit()
 void UPCTileManager::CreateField()
 {
 	Field.SetNum(Rows * Cols);
+	RebuildHexTopologyIfNeeded();
+	UnitTileIndex.Reset();
 
 	const FVector OwnerBoardLocation = GetOwner() ? GetOwner()->GetActorLocation() : FVector::ZeroVector;
 
-	const float Radios = TileWidthX * 0.5;
-	const float Xs = 1.5f * Radios;
-	const float Ys = FMath::Sqrt(3.f) * Radios;
-
-	const FVector Base = OwnerBoardLocation + FVector(FirstFieldLocal.X, FirstFieldLocal.Y, 0);
+	FieldLayout.Cols = Cols;
+	FieldLayout.Rows = Rows;
+	FieldLayout.TileWidthX = TileWidthX;
+	FieldLayout.bRowZeroAtBottom = bRowZeroAtBottom;
+	FieldLayout.OddColumRowShift = OddColumRowShift;
+	FieldLayout.Origin = FVector2D(OwnerBoardLocation) + FirstFieldLocal;
 
 	for (int32 r = 0; r < Rows; ++r)
 	{
-		const int32 rLocal = bRowZeroAtBottom ? r : (Rows - 1 - r);
-
 		for (int32 c = 0; c < Cols; ++c)
 		{
 			const int32 i = c * Rows + r;
-			const float x = c * Xs;
 
-			const float RowShift = ((c&1) ? OddColumRowShift : 0.0f);
-			const float y = (rLocal + RowShift) * Ys;
 			Field[i].UnitIntPoint = FIntPoint(r,c);
-			Field[i].Position = Base + FVector(x, y, 0);
+			Field[i].Position = FVector(FieldLayout.GetTileCenter(c, r), OwnerBoardLocation.Z);
 			Field[i].bIsField = true;
 			Field[i].Unit = nullptr;
+			Field[i].ReservedUnit = nullptr;
 		}
 	}
 	
 }
 
+bool UPCTileManager::WorldToTile(const FVector& World, int32& OutY, int32& OutX, float MaxSnapDist) const
+{
+	OutY = INDEX_NONE;
+	OutX = INDEX_NONE;
+	if (Field.Num() != Rows * Cols) return false;
+
+	const float Snap = (MaxSnapDist > 0.f) ? MaxSnapDist : (TileWidthX > 0.f ? TileWidthX * 0.6f : 120.f);
+
+	// Field 좌표는 월드 기준이고 보드 회전을 반영하지 않으므로 배치 식 그대로 역산
+	int32 Col = INDEX_NONE, Row = INDEX_NONE;
+	if (!FieldLayout.FindNearestTile(FVector2D(World), Snap, Col, Row)) return false;
+
+	OutY = Col; OutX = Row;
+	return true;
+}
+
 void UPCTileManager::BeginPlay()
 {
 	Super::BeginPlay();
 	CachedCombatBoard = Cast<APCCombatBoard>(GetOwner());
+	RebuildHexTopologyIfNeeded();
 }
 
 void UPCTileManager::DebugLogField(bool bAsGrid /*=true*/, bool bShowOccupiedList /*=true*/, const FString& Tag) const
@@ -530,6 +614,216 @@ void UPCTileManager::DebugClearPersistent() const
 	}
 }
 
+bool UPCTileManager::DebugValidateHexTopology() const
+{
+#if !UE_BUILD_SHIPPING
+	const int32 Mismatch = HexTopology.ValidateAgainstBFS();
+	UE_LOG(LogTemp, Log, TEXT("[TileManager] HexTopology Validate Tiles=%d MaxDist=%d Mismatch=%d"),
+		HexTopology.Num(), HexTopology.GetMaxDistance(), Mismatch);
+	return Mismatch == 0;
+#else
+	return true;
+#endif
+}
+
+void UPCTileManager::ValidateUnitIndexIfEnabled() const
+{
+#if !UE_BUILD_SHIPPING
+	if (bDebugValidateUnitIndex)
+	{
+		ensureMsgf(DebugValidateUnitIndex(), TEXT("[TileManager] UnitTileIndex out of sync (Board=%d)"), BoardIndex);
+	}
+#endif
+}
+
+bool UPCTileManager::DebugValidateUnitIndex() const
+{
+#if !UE_BUILD_SHIPPING
+	// Field 전체 스캔으로 기대값 구성
+	TMap<TObjectKey<APCBaseUnitCharacter>, FUnitTileSlots> Expected;
+	for (int32 i = 0; i < Field.Num(); ++i)
+	{
+		if (Field[i].Unit)
+		{
+			Expected.FindOrAdd(Field[i].Unit).Occupied.Add(i);
+		}
+		if (APCBaseUnitCharacter* Reserved = Field[i].ReservedUnit.Get(true))
+		{
+			Expected.FindOrAdd(Reserved).Reserved.Add(i);
+		}
+	}
+
+	auto SameSet = [](const TArray<int32, TInlineAllocator<2>>& A, const TArray<int32, TInlineAllocator<2>>& B)
+	{
+		if (A.Num() != B.Num()) return false;
+		for (const int32 Value : A)
+		{
+			if (!B.Contains(Value)) return false;
+		}
+		return true;
+	};
+
+	int32 Mismatch = 0;
+	for (const auto& KV : Expected)
+	{
+		const FUnitTileSlots* Actual = UnitTileIndex.Find(KV.Key);
+		if (!Actual || !SameSet(Actual->Occupied, KV.Value.Occupied) || !SameSet(Actual->Reserved, KV.Value.Reserved))
+		{
+			++Mismatch;
+			const APCBaseUnitCharacter* Unit = KV.Key.ResolveObjectPtr();
+			UE_LOG(LogTemp, Warning, TEXT("[TileManager] UnitIndex mismatch Unit=%s Occupied=%d/%d Reserved=%d/%d"),
+				Unit ? *Unit->GetName() : TEXT("null"),
+				Actual ? Actual->Occupied.Num() : 0, KV.Value.Occupied.Num(),
+				Actual ? Actual->Reserved.Num() : 0, KV.Value.Reserved.Num());
+		}
+	}
+	
+	for (const auto& KV : UnitTileIndex)
+	{
+		if (!Expected.Contains(KV.Key) && !KV.Value.IsEmpty())
+		{
+			++Mismatch;
+			UE_LOG(LogTemp, Warning, TEXT("[TileManager] UnitIndex has stale entry (Occupied=%d Reserved=%d)"),
+				KV.Value.Occupied.Num(), KV.Value.Reserved.Num());
+		}
+	}
+
+	return Mismatch == 0;
+#else
+	return true;
+#endif
+}
+
+void UPCTileManager::DebugBenchmarkUnitLookup(int32 Iterations) const
+{
+#if !UE_BUILD_SHIPPING
+	TArray<APCBaseUnitCharacter*> Units;
+	for (const FTile& Tile : Field)
+	{
+		if (Tile.Unit)
+		{
+			Units.AddUnique(Tile.Unit);
+		}
+	}
+
+	if (Units.IsEmpty() || Iterations <= 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[TileManager] Benchmark skipped (Units=%d Iterations=%d)"), Units.Num(), Iterations);
+		return;
+	}
+
+	// 역인덱스 도입 전 GetFieldUnitGridPoint 방식 (Field 전체 스캔)
+	auto LegacyScan = [this](const APCBaseUnitCharacter* InUnit)
+	{
+		for (int32 x = 0; x < Rows; ++x)
+		{
+			for (int32 y = 0; y < Cols; ++y)
+			{
+				const int32 i = y * Rows + x;
+				if (Field.IsValidIndex(i) && Field[i].Unit == InUnit)
+				{
+					return Field[i].UnitIntPoint;
+				}
+			}
+		}
+		return FIntPoint::NoneValue;
+	};
+
+	int64 Checksum = 0;
+	
+	const double ScanStart = FPlatformTime::Seconds();
+	for (int32 It = 0; It < Iterations; ++It)
+	{
+		for (const APCBaseUnitCharacter* Unit : Units)
+		{
+			Checksum += LegacyScan(Unit).X;
+		}
+	}
+	const double ScanMs = (FPlatformTime::Seconds() - ScanStart) * 1000.0;
+
+	const double IndexStart = FPlatformTime::Seconds();
+	for (int32 It = 0; It < Iterations; ++It)
+	{
+		for (const APCBaseUnitCharacter* Unit : Units)
+		{
+			const int32 i = FindOccupiedIndex(Unit);
+			Checksum -= Field.IsValidIndex(i) ? Field[i].UnitIntPoint.X : FIntPoint::NoneValue.X;
+		}
+	}
+	const double IndexMs = (FPlatformTime::Seconds() - IndexStart) * 1000.0;
+
+	UE_LOG(LogTemp, Log, TEXT("[TileManager] Lookup Benchmark Units=%d Iterations=%d Scan=%.3fms Index=%.3fms (x%.1f) Checksum=%lld"),
+		Units.Num(), Iterations, ScanMs, IndexMs, IndexMs > 0.0 ? ScanMs / IndexMs : 0.0, Checksum);
+#endif
+}
+
+bool UPCTileManager::DebugValidateWorldToTile(float SampleStep) const
+{
+#if !UE_BUILD_SHIPPING
+	SampleStep = FMath::Max(SampleStep, 1.f);
+	const float Snap = TileWidthX > 0.f ? TileWidthX * 0.6f : 120.f;
+
+	// 기존 방식 : 전체 타일 최근접
+	auto BruteForce = [this, Snap](const FVector& World)
+	{
+		float BestD2 = TNumericLimits<float>::Max();
+		int32 BestIdx = INDEX_NONE;
+		for (int32 i = 0; i < Field.Num(); ++i)
+		{
+			const float d2 = FVector::DistSquared2D(Field[i].Position, World);
+			if (d2 < BestD2) { BestD2 = d2; BestIdx = i; }
+		}
+		return BestD2 <= Snap * Snap ? BestIdx : INDEX_NONE;
+	};
+
+	FBox2D Bounds(ForceInit);
+	for (const FTile& Tile : Field) Bounds += FVector2D(Tile.Position);
+	if (!Bounds.bIsValid)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TileManager] WorldToTile validate skipped (Board=%d, no tiles)"), BoardIndex);
+		return false;
+	}
+	Bounds = Bounds.ExpandBy(TileWidthX);
+
+	int32 NumSamples = 0;
+	int32 Mismatch = 0;
+	double AnalyticSeconds = 0.0;
+	double BruteSeconds = 0.0;
+	for (float WX = Bounds.Min.X; WX <= Bounds.Max.X; WX += SampleStep)
+	{
+		for (float WY = Bounds.Min.Y; WY <= Bounds.Max.Y; WY += SampleStep)
+		{
+			const FVector World(WX, WY, 0.f);
+			++NumSamples;
+
+			double Start = FPlatformTime::Seconds();
+			int32 Y = INDEX_NONE, X = INDEX_NONE;
+			const int32 Actual = WorldToTile(World, Y, X) ? IndexOf(Y, X) : INDEX_NONE;
+			AnalyticSeconds += FPlatformTime::Seconds() - Start;
+
+			Start = FPlatformTime::Seconds();
+			const int32 Expected = BruteForce(World);
+			BruteSeconds += FPlatformTime::Seconds() - Start;
+
+			// 두 타일에서 정확히 같은 거리인 경계 샘플은 어느 쪽이든 허용
+			const bool bSame = Actual == Expected
+				|| (Field.IsValidIndex(Actual) && Field.IsValidIndex(Expected)
+					&& FMath::IsNearlyEqual(FVector::DistSquared2D(Field[Actual].Position, World), FVector::DistSquared2D(Field[Expected].Position, World), 1.f));
+			if (!bSame && ++Mismatch <= 10)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[TileManager] WorldToTile mismatch at %s : %d (expected %d)"), *World.ToCompactString(), Actual, Expected);
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[TileManager] WorldToTile validate %s (Board=%d) Samples=%d Mismatch=%d Analytic=%.3fms BruteForce=%.3fms"),
+		Mismatch == 0 ? TEXT("OK") : TEXT("FAILED"), BoardIndex, NumSamples, Mismatch, AnalyticSeconds * 1000.0, BruteSeconds * 1000.0);
+	return Mismatch == 0;
+#else
+	return true;
+#endif
+}
+
 #if WITH_EDITOR
 void UPCTileManager::Editor_DrawTilesPersistent()
 {
@@ -5,6 +5,7 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "EngineUtils.h"
+#include "Async/ParallelFor.h"
 #include "Abilities/GameplayAbilityTypes.h"
 #include "AbilitySystem/Player/AttributeSet/PCPlayerAttributeSet.h"
 #include "Character/Unit/PCHeroUnitCharacter.h"
@@ -17,6 +18,10 @@
 #include "GameFramework/HelpActor/Component/PCTileManager.h"
 #include "GameFramework/HelpActor/DataTable/StageData.h"
 #include "GameFramework/PlayerState/PCPlayerState.h"
+#include "GameFramework/WorldSubsystem/PCBoardRelevancySubsystem.h"
+#include "GameFramework/WorldSubsystem/PCCombatReplaySubsystem.h"
+#include "GameFramework/WorldSubsystem/PCMatchRandomSubsystem.h"
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
 #include "GameFramework/WorldSubsystem/PCUnitSpawnSubsystem.h"
 
 
@@ -83,8 +88,180 @@ namespace
 		}
 		return false;
 	}
+
+	TAutoConsoleVariable<bool> CVarParallelPairSetup(
+		TEXT("PC.Combat.ParallelPairSetup"),
+		true,
+		TEXT("전투 시작 시 페어별 미러 / 배치 / 클론 계획을 태스크로 병렬 계산 (0 이면 게임 스레드에서 순차 계산)"));
+
+	TAutoConsoleVariable<bool> CVarLogPairSetup(
+		TEXT("PC.Combat.LogPairSetup"),
+		false,
+		TEXT("전투 시작 시 페어별 준비 시간 (복사 / 계획 / 적용 ms) 로그"));
+
+	// 필드 유닛 하나의 목표 타일
+	struct FPlannedPlacement
+	{
+		APCBaseUnitCharacter* Unit = nullptr;
+		int32 Y = 0;
+		int32 X = 0;
+		ETileFacing Facing = ETileFacing::Auto;
+		// INDEX_NONE 이면 팀 유지
+		int32 TeamIndex = INDEX_NONE;
+	};
+
+	// 게임 스레드에서 복사한 PlayerBoard 필드 : 계획 태스크는 이 값만 읽음 (유닛 포인터는 넘기기만 하고 역참조하지 않음)
+	struct FBoardFieldCopy
+	{
+		int32 Rows = 0;
+		int32 Cols = 0;
+		int32 PlayerIndex = INDEX_NONE;
+		// IndexOf(Y,X) = Y*Rows + X 순서, 빈 칸은 nullptr
+		TArray<APCBaseUnitCharacter*> Units;
+	};
+
+	void CopyBoardField(const APCPlayerBoard* PlayerBoard, FBoardFieldCopy& Out)
+	{
+		Out.Rows = PlayerBoard->Rows;
+		Out.Cols = PlayerBoard->Cols;
+		Out.PlayerIndex = PlayerBoard->PlayerIndex;
+		Out.Units.Init(nullptr, Out.Rows * Out.Cols);
+
+		for (int32 y = 0; y < Out.Cols; ++y)
+		{
+			for (int32 x = 0; x < Out.Rows; ++x)
+			{
+				const int32 i = PlayerBoard->IndexOf(y, x);
+				if (PlayerBoard->PlayerField.IsValidIndex(i))
+				{
+					Out.Units[y * Out.Rows + x] = PlayerBoard->PlayerField[i].Unit;
+				}
+			}
+		}
+	}
+
+	// PlayerBoard 필드 -> TM 좌표 (미러 포함), 복사본과 TM 크기만 사용하므로 워커 스레드에서 호출 가능
+	void PlanBoardPlacement(const FBoardFieldCopy& Field, int32 TMRows, int32 TMCols, bool bMirrorRows, bool bMirrorCols,
+		ETileFacing Facing, int32 TeamIndex, TArray<FPlannedPlacement>& Out)
+	{
+		for (int32 y = 0; y < Field.Cols; ++y)
+		{
+			for (int32 x = 0; x < Field.Rows; ++x)
+			{
+				APCBaseUnitCharacter* Unit = Field.Units[y * Field.Rows + x];
+				if (!Unit) continue;
+
+				// TM의 크기를 기준으로 미러링
+				const int32 dstX = bMirrorRows ? (TMRows - 1 - x) : x; // Row
+				const int32 dstY = bMirrorCols ? (TMCols - 1 - y) : y; // Col
+
+				// 범위 체크 (PB/TM 크기 다를 수 있음)
+				if (dstY < 0 || dstY >= TMCols || dstX < 0 || dstX >= TMRows)
+					continue;
+
+				Out.Add({ Unit, dstY, dstX, Facing, TeamIndex });
+			}
+		}
+	}
+
+	// 복사본 -> 복귀용 스냅샷 (CaptureFieldSnapShot 과 같은 순서), 약참조를 만드므로 게임 스레드에서
+	void FieldCopyToSnapShot(APCPlayerBoard* PlayerBoard, const FBoardFieldCopy& Field, FBoardFieldSnapShot& Out)
+	{
+		Out.Reset();
+		Out.PlayerBoard = PlayerBoard;
+
+		for (int32 r = 0; r < Field.Rows; ++r)
+		{
+			for (int32 c = 0; c < Field.Cols; ++c)
+			{
+				if (APCBaseUnitCharacter* Unit = Field.Units[c * Field.Rows + r])
+				{
+					FCombatManager_FieldSlot Slot;
+					Slot.Col = c;
+					Slot.Row = r;
+					Slot.Unit = Unit;
+					Out.Field.Add(Slot);
+				}
+			}
+		}
+	}
+
+	// 게임 스레드 전용 (액터 이동)
+	void CommitPlacements(UPCTileManager* TM, const TArray<FPlannedPlacement>& Placements)
+	{
+		for (const FPlannedPlacement& Placement : Placements)
+		{
+			APCBaseUnitCharacter* Unit = Placement.Unit;
+			if (!IsValid(Unit)) continue;
+
+			const bool ok = TM->PlaceUnitOnField(Placement.Y, Placement.X, Unit, Placement.Facing);
+
+			// 팀 보장
+			if (ok && Placement.TeamIndex != INDEX_NONE && Unit->GetTeamIndex() != Placement.TeamIndex)
+			{
+				Unit->SetTeamIndex(Placement.TeamIndex);
+			}
+		}
+	}
+
+	void CaptureFieldSnapShot(APCPlayerBoard* PlayerBoard, FBoardFieldSnapShot& Out)
+	{
+		Out.Reset();
+		if (!IsValid(PlayerBoard)) return;
+		Out.PlayerBoard = PlayerBoard;
+
+		const int32 Rows = PlayerBoard->Rows;
+		const int32 Cols = PlayerBoard->Cols;
+		for (int32 r = 0; r < Rows; ++r)
+		{
+			for (int32 c = 0; c < Cols; ++c)
+			{
+				const int32 i = PlayerBoard->IndexOf(c,r);
+				if (!PlayerBoard->PlayerField.IsValidIndex(i)) continue;
+				if (APCBaseUnitCharacter* Unit = PlayerBoard->PlayerField[i].Unit)
+				{
+					FCombatManager_FieldSlot Slot;
+					Slot.Col = c;
+					Slot.Row = r;
+					Slot.Unit = Unit;
+					Out.Field.Add(Slot);
+				}
+			}
+		}
+	}
 }
 
+struct APCCombatManager::FPairSetupPlan
+{
+	// 게임 스레드에서 확정
+	int32 PairIndex = INDEX_NONE;
+	APCCombatBoard* Host = nullptr;
+	UPCTileManager* HostTM = nullptr;
+	APCPlayerBoard* HostPB = nullptr;
+	APCPlayerBoard* GuestPB = nullptr;
+	APCPlayerBoard* DonorPB = nullptr;
+	int32 HostSeat = INDEX_NONE;
+	int32 GuestSeat = INDEX_NONE;
+	int32 DonorSeat = INDEX_NONE;
+	bool bClone = false;
+
+	// CopyPairSetup 에서 게임 스레드로 복사 (PlanPairSetup 은 이 값만 읽음)
+	int32 TMRows = 0;
+	int32 TMCols = 0;
+	FBoardFieldCopy HostField;
+	FBoardFieldCopy GuestField;
+	FBoardFieldCopy DonorField;
+
+	// PlanPairSetup 에서 계산
+	TArray<FPlannedPlacement> Placements;
+	// 원본 유닛 + 클론이 놓일 타일
+	TArray<FPlannedPlacement> CloneSources;
+
+	double CopyMs = 0.0;
+	double PlanMs = 0.0;
+	double CommitMs = 0.0;
+};
+
 APCCombatManager::APCCombatManager()
 {
 	PrimaryActorTick.bCanEverTick = false;
@@ -130,8 +307,10 @@ void APCCombatManager::BuildRandomPairs()
 	}
 
 	// 셔플
-	int32 Seed = bReseedEveryRound ? (RandomSeed ^ FMath::Rand()) : RandomSeed;
-	FRandomStream RNG(Seed);
+	// 매 라운드 재시드 시 매치 시드 기반 Pairing 채널을 이어서 사용 (같은 매치 시드면 대진도 동일)
+	const FPCRandomChannel* PairingRandom = bReseedEveryRound ? UPCMatchRandomSubsystem::FindChannel(this, PCRandomChannels::Pairing) : nullptr;
+	const FPCRandomChannel FixedRandom(RandomSeed);
+	const FPCRandomChannel& RNG = PairingRandom ? *PairingRandom : FixedRandom;
 	for (int32 i = Players.Num() - 1; i >0; --i)
 	{
 		Players.Swap(i, RNG.RandRange(0,i));
@@ -159,6 +338,12 @@ void APCCombatManager::StartAllBattle()
 	if (!IsAuthority())
 		return;
 
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::StartAllBattle);
+
+	// 1) 페어별 대상 보드 확정 (게임 스레드, 도너 추첨 순서는 페어 순서 그대로)
+	TArray<FPairSetupPlan> Plans;
+	Plans.Reserve(Pairs.Num());
+
 	for (int32 PairIndex = 0; PairIndex < Pairs.Num(); ++PairIndex)
 	{
 		auto& Pair  = Pairs[PairIndex];
@@ -172,9 +357,16 @@ void APCCombatManager::StartAllBattle()
 		const int32 HostSeat  = Host->BoardSeatIndex;
 		const int32 GuestSeat = Guest ? Guest->BoardSeatIndex : INDEX_NONE;
 
+		FPairSetupPlan Plan;
+		Plan.PairIndex = PairIndex;
+		Plan.Host      = Host;
+		Plan.HostTM    = HostTM;
+		Plan.HostSeat  = HostSeat;
+		Plan.GuestSeat = GuestSeat;
+
 		// === PlayerBoard 찾기
-		APCPlayerBoard* HostPB  = FindPlayerBoardBySeat(HostSeat);
-		APCPlayerBoard* GuestPB = FindPlayerBoardBySeat(GuestSeat);
+		Plan.HostPB  = FindPlayerBoardBySeat(HostSeat);
+		Plan.GuestPB = FindPlayerBoardBySeat(GuestSeat);
 
 		if (!Guest)
 		{
@@ -197,62 +389,190 @@ void APCCombatManager::StartAllBattle()
 				}
 				if (CandidateSeats.Num() > 0)
 				{
-					DonorSeat = CandidateSeats[FMath::RandHelper(CandidateSeats.Num())];
+					const FPCRandomChannel* PairingRandom = UPCMatchRandomSubsystem::FindChannel(this, PCRandomChannels::Pairing);
+					const int32 DonorIndex = PairingRandom ? PairingRandom->RandHelper(CandidateSeats.Num()) : FMath::RandHelper(CandidateSeats.Num());
+					DonorSeat = CandidateSeats[DonorIndex];
 				}
 			}
 			if (DonorSeat != INDEX_NONE)
 			{
-				if (HostPB)
-				{
-					TakeFieldSnapShot(HostPB, Pair.HostSnapShot);
-				}
-				BuildCloneForHost(PairIndex, DonorSeat);
-				CountAliveOnHostBoardForPair(PairIndex);
-				BindUnitOnBoardForPair(PairIndex);
-
-				HostTM->DebugLogField(true,true,FString("Clone PvP"));
-
-				Pair.bRunning = true;
-				Pair.bIsPvE = false;
-				
+				Plan.bClone    = true;
+				Plan.DonorSeat = DonorSeat;
+				Plan.DonorPB   = FindPlayerBoardBySeat(DonorSeat);
+				Plans.Add(MoveTemp(Plan));
 				continue;
 			}
 		}
 		
-		if (!HostPB || !GuestPB) continue;
+		if (!Plan.HostPB || !Plan.GuestPB) continue;
+
+		Plans.Add(MoveTemp(Plan));
+	}
+
+	// 2) 보드 필드를 값으로 복사 (게임 스레드, UObject 읽기는 여기까지)
+	for (FPairSetupPlan& Plan : Plans)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		CopyPairSetup(Plan);
+		Plan.CopyMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	// 3) 미러 / 배치 / 클론 배치 계획 : 복사본만 읽으므로 페어별 태스크로 계산
+	const bool bParallel = CVarParallelPairSetup.GetValueOnGameThread();
+	double PlanWallMs = 0.0;
+	{
+		FPCTelemetryScope PlanScope(this, EPCTelemetryPhase::PairSetupPlan);
+		const uint64 PlanStartCycles = FPlatformTime::Cycles64();
+
+		ParallelFor(Plans.Num(), [this, &Plans](int32 PlanIndex)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			PlanPairSetup(Plans[PlanIndex]);
+			Plans[PlanIndex].PlanMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+		PlanWallMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PlanStartCycles);
+	}
+
+	// 4) 스냅샷 / 보드 부착 / 유닛 이동 / 클론 스폰 / 바인딩은 게임 스레드에서 페어 순서대로
+	double CopyTotalMs = 0.0;
+	double CommitTotalMs = 0.0;
+	for (FPairSetupPlan& Plan : Plans)
+	{
+		FPCTelemetryScope CommitScope(this, EPCTelemetryPhase::PairSetupCommit);
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		CommitPairSetup(Plan);
+		Plan.CommitMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		CopyTotalMs += Plan.CopyMs;
+		CommitTotalMs += Plan.CommitMs;
+	}
+
+	if (CVarLogPairSetup.GetValueOnGameThread() && Plans.Num() > 0)
+	{
+		const FPairSetupPlan* Slowest = nullptr;
+		for (const FPairSetupPlan& Plan : Plans)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[CombatSetup] Pair %d (Seat %d vs %s%d) : Copy %.3fms, Plan %.3fms, Commit %.3fms, Units %d"),
+				Plan.PairIndex, Plan.HostSeat, Plan.bClone ? TEXT("Clone ") : TEXT(""), Plan.bClone ? Plan.DonorSeat : Plan.GuestSeat,
+				Plan.CopyMs, Plan.PlanMs, Plan.CommitMs, Plan.Placements.Num() + Plan.CloneSources.Num());
+
+			if (!Slowest || Plan.CopyMs + Plan.PlanMs + Plan.CommitMs > Slowest->CopyMs + Slowest->PlanMs + Slowest->CommitMs)
+			{
+				Slowest = &Plan;
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[CombatSetup] %d pairs : Copy %.3fms, Plan %.3fms (%s), Commit %.3fms, Slowest pair %d (%.3fms)"),
+			Plans.Num(), CopyTotalMs, PlanWallMs, bParallel ? TEXT("parallel") : TEXT("serial"), CommitTotalMs,
+			Slowest->PairIndex, Slowest->CopyMs + Slowest->PlanMs + Slowest->CommitMs);
+	}
+}
+
+void APCCombatManager::CopyPairSetup(FPairSetupPlan& Plan) const
+{
+	if (Plan.HostTM)
+	{
+		Plan.TMRows = Plan.HostTM->Rows;
+		Plan.TMCols = Plan.HostTM->Cols;
+	}
+
+	if (Plan.HostPB)
+	{
+		CopyBoardField(Plan.HostPB, Plan.HostField);
+	}
+
+	if (Plan.bClone ? Plan.DonorPB != nullptr : Plan.GuestPB != nullptr)
+	{
+		CopyBoardField(Plan.bClone ? Plan.DonorPB : Plan.GuestPB, Plan.bClone ? Plan.DonorField : Plan.GuestField);
+	}
+}
+
+void APCCombatManager::PlanPairSetup(FPairSetupPlan& Plan) const
+{
+	// 워커 스레드에서 호출됨 : CopyPairSetup 의 복사본만 읽고 액터 / 컴포넌트는 건드리지 않음
+	if (!Plan.HostTM || !Plan.HostPB)
+		return;
+
+	// Host 필드(그대로, Friendly)
+	PlanBoardPlacement(Plan.HostField, Plan.TMRows, Plan.TMCols, false, false, ETileFacing::Friendly, Plan.HostField.PlayerIndex, Plan.Placements);
+
+	if (Plan.bClone)
+	{
+		// 클론은 도너 필드를 양축 미러로 적 진영에 (팀은 스폰 후 크립 팀으로)
+		if (Plan.DonorPB)
+		{
+			PlanBoardPlacement(Plan.DonorField, Plan.TMRows, Plan.TMCols, true, true, ETileFacing::Enemy, INDEX_NONE, Plan.CloneSources);
+		}
+		return;
+	}
+
+	// Guest 필드(미러 적용, Enemy)
+	if (Plan.GuestPB)
+	{
+		PlanBoardPlacement(Plan.GuestField, Plan.TMRows, Plan.TMCols, bMirrorRows, bMirrorCols, ETileFacing::Enemy, Plan.GuestField.PlayerIndex, Plan.Placements);
+	}
+}
 
+void APCCombatManager::CommitPairSetup(FPairSetupPlan& Plan)
+{
+	auto& Pair = Pairs[Plan.PairIndex];
+	UPCTileManager* HostTM = Plan.HostTM;
+
+	if (Plan.bClone)
+	{
+		if (Plan.HostPB)
+		{
+			FieldCopyToSnapShot(Plan.HostPB, Plan.HostField, Pair.HostSnapShot);
+		}
+		ApplyClonePlan(Plan);
+		CountAliveOnHostBoardForPair(Plan.PairIndex);
+		BindUnitOnBoardForPair(Plan.PairIndex);
+		BeginPairRandom(Plan.PairIndex);
+		BeginPairReplay(Plan.PairIndex, INDEX_NONE, EPCReplayPairKind::Clone);
+
+		HostTM->DebugLogField(true,true,FString("Clone PvP"));
+	}
+	else
+	{
 		// === PlayerBoard 화면/공간 이동: Host 전장 위로 부착 (둘 다)
-		GuestPB->AttachToCombatBoard(Host, true);
+		Plan.GuestPB->AttachToCombatBoard(Plan.Host, true);
 
-		// === PlayerBoard 필드 스냅샷 (복귀용)
-		TakeFieldSnapShot(HostPB,  Pair.HostSnapShot);
-		TakeFieldSnapShot(GuestPB, Pair.GuestSnapShot);
+		// Guest 보드 소속 액터도 Host 보드를 보는 연결에 복제
+		if (UPCBoardRelevancySubsystem* Relevancy = GetWorld()->GetSubsystem<UPCBoardRelevancySubsystem>())
+		{
+			Relevancy->LinkBoards(Plan.GuestSeat, Plan.HostSeat);
+		}
 
-		// === 전장(TM) 초기화
-		HostTM->ClearAll();
+		// === PlayerBoard 필드 스냅샷 (복귀용, 계획과 같은 복사본에서)
+		FieldCopyToSnapShot(Plan.HostPB, Plan.HostField, Pair.HostSnapShot);
+		FieldCopyToSnapShot(Plan.GuestPB, Plan.GuestField, Pair.GuestSnapShot);
 
-		// === 배치: Host 필드(그대로, Friendly) + Guest 필드(미러 적용, Enemy)
-		PlacePlayerBoardToTM(HostPB,  HostTM, false,false, ETileFacing::Friendly);
-		PlacePlayerBoardToTM(GuestPB, HostTM, bMirrorRows, bMirrorCols, ETileFacing::Enemy);
+		// === 전장(TM) 초기화 후 계획대로 배치
+		HostTM->ClearAll();
+		CommitPlacements(HostTM, Plan.Placements);
 
 		HostTM->DebugLogField(true,true,FString("CombatManager"));
 
 		// 생존 수 카운트 + 바인딩
-		CountAliveOnHostBoardForPair(PairIndex);
-		BindUnitOnBoardForPair(PairIndex);
-
-		Pair.bRunning = true;
-		Pair.bIsPvE   = false;
-		
+		CountAliveOnHostBoardForPair(Plan.PairIndex);
+		BindUnitOnBoardForPair(Plan.PairIndex);
+		BeginPairRandom(Plan.PairIndex);
+		BeginPairReplay(Plan.PairIndex, Plan.GuestSeat, EPCReplayPairKind::PvP);
 	}
-	
+
+	Pair.bRunning = true;
+	Pair.bIsPvE   = false;
 }
 
 void APCCombatManager::FinishAllBattle()
 {
 	if (!IsAuthority())
 		return;
-	
+
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::FinishAllBattle);
+
+	// 아직 판정되지 않은 페어는 결과 단계와 같이 무승부로 판정 (리플레이 결과도 판정 시점에 기록)
+	HandleBattleFinished();
 
 	for (int32 PairIndex = 0; PairIndex < Pairs.Num(); ++PairIndex)
 	{
@@ -261,6 +581,12 @@ void APCCombatManager::FinishAllBattle()
 		APCCombatBoard* Guest = Pair.Guest.Get();
 		if (!Host) continue;
 
+		// 판정 후에도 남은 기록 (판정 중 보드 정보 누락 등) 은 결과 없이 마감
+		if (UPCCombatReplaySubsystem* Replay = UPCCombatReplaySubsystem::FindRecorder(this))
+		{
+			Replay->EndPair(PairIndex, EPCReplayResult::None);
+		}
+
 		// 언바인드
 		UnbindAllForPair(PairIndex);
 
@@ -290,74 +616,69 @@ void APCCombatManager::FinishAllBattle()
 		
 		Pair.bRunning = false;
 	}
+
+	if (UPCBoardRelevancySubsystem* Relevancy = GetWorld()->GetSubsystem<UPCBoardRelevancySubsystem>())
+	{
+		Relevancy->ResetBoardLinks();
+	}
 }
 
 void APCCombatManager::BuildCloneForHost(int32 PairIndex, int32 DonorSeat)
 {
 	if (!Pairs.IsValidIndex(PairIndex)) return;
 
-	auto& Pair = Pairs[PairIndex];
-	APCCombatBoard* Host = Pair.Host.Get();
-	if (!Host || !Host->TileManager) return;
+	FPairSetupPlan Plan;
+	Plan.PairIndex = PairIndex;
+	Plan.bClone    = true;
+	Plan.DonorSeat = DonorSeat;
+	Plan.Host      = Pairs[PairIndex].Host.Get();
+	Plan.HostTM    = Plan.Host ? Plan.Host->TileManager : nullptr;
+	Plan.HostPB    = Plan.Host ? FindPlayerBoardBySeat(Plan.Host->BoardSeatIndex) : nullptr;
+	Plan.DonorPB   = FindPlayerBoardBySeat(DonorSeat);
+
+	CopyPairSetup(Plan);
+	PlanPairSetup(Plan);
+	ApplyClonePlan(Plan);
+}
 
-	APCPlayerBoard* DonorPB = FindPlayerBoardBySeat(DonorSeat);
-	APCPlayerBoard* HostPB = FindPlayerBoardBySeat(Host->BoardSeatIndex);
-	if (!DonorPB || !HostPB) return;
+void APCCombatManager::ApplyClonePlan(FPairSetupPlan& Plan)
+{
+	if (!Pairs.IsValidIndex(Plan.PairIndex)) return;
+	if (!Plan.Host || !Plan.HostTM || !Plan.HostPB || !Plan.DonorPB) return;
 
-	UPCTileManager* TM = Host->TileManager;
+	auto& Pair = Pairs[Plan.PairIndex];
+	UPCTileManager* TM = Plan.HostTM;
 
 	TM->ClearAll();
 
-	PlacePlayerBoardToTM(HostPB,TM,false,false, ETileFacing::Friendly);
+	CommitPlacements(TM, Plan.Placements);
 
 	// 클론팀 인덱스 (크립 팀 사용)
-	const int32 CloneTeamIdx = GetCreepTeamIndexForBoard(Host);
-
-	struct FCaptured { int32 Y; int32 X; TWeakObjectPtr<APCBaseUnitCharacter> CloneUnit;};
-	TArray<FCaptured> CloneUnits;
-
-	for (int32 y = 0; y < DonorPB->Cols; ++y)
-	{
-		for (int32 x = 0; x < DonorPB->Rows; ++x)
-		{
-			const int32 i = DonorPB->IndexOf(y,x);
-			if (!DonorPB->PlayerField.IsValidIndex(i)) continue;
-			if (APCBaseUnitCharacter* InCloneUnit = DonorPB->PlayerField[i].Unit)
-			{
-				CloneUnits.Add({y,x,InCloneUnit});
-			}
-		}
-	}
+	const int32 CloneTeamIdx = GetCreepTeamIndexForBoard(Plan.Host);
 
 	Pair.CloneUnits.Reset();
 	UPCUnitSpawnSubsystem* UnitSpawnSystem = GetWorld()->GetSubsystem<UPCUnitSpawnSubsystem>();
+	if (!UnitSpawnSystem) return;
 
-	for (const auto& Captured : CloneUnits)
+	for (const FPlannedPlacement& Source : Plan.CloneSources)
 	{
-		if (APCBaseUnitCharacter* SourceUnit = Captured.CloneUnit.Get())
-		{
-			APCBaseUnitCharacter* Clone = nullptr;
+		if (!IsValid(Source.Unit)) continue;
 
-			if (UnitSpawnSystem)
-			{
-				Clone = UnitSpawnSystem->SpawnCloneUnitBySourceUnit(SourceUnit);
-				Clone->ChangedOnTile(true);
-				Clone->SetTeamIndex(CloneTeamIdx);
-			}
+		APCBaseUnitCharacter* Clone = UnitSpawnSystem->SpawnCloneUnitBySourceUnit(Source.Unit);
+		if (!Clone) continue;
 
-			const int32 dstX = (TM->Rows - 1 - Captured.X);
-			const int32 dstY = (TM->Cols - 1 - Captured.Y);
+		Clone->ChangedOnTile(true);
+		Clone->SetTeamIndex(CloneTeamIdx);
 
-			TM->PlaceUnitOnField(dstY, dstX, Clone, ETileFacing::Enemy);
+		TM->PlaceUnitOnField(Source.Y, Source.X, Clone, Source.Facing);
 
-			Pair.CloneUnits.Add(Clone);
-			UnitToPairIndex.Add(Clone, PairIndex);
-			Clone->OnUnitDied.AddDynamic(this, &APCCombatManager::OnAnyUnitDied);			
-		}
+		Pair.CloneUnits.Add(Clone);
+		UnitToPairIndex.Add(Clone, Plan.PairIndex);
+		Clone->OnUnitDied.AddDynamic(this, &APCCombatManager::OnAnyUnitDied);
 	}
 
 	Pair.bIsClone = true;
-	Pair.CloneSourceSeat = DonorSeat;
+	Pair.CloneSourceSeat = Plan.DonorSeat;
 }
 
 void APCCombatManager::DestroyCloneForPair(int32 PairIndex, bool bRemoveFromTM)
@@ -377,6 +698,8 @@ void APCCombatManager::DestroyCloneForPair(int32 PairIndex, bool bRemoveFromTM)
 		TM = HostBoard->TileManager;
 	}
 
+	UPCUnitSpawnSubsystem* UnitSpawnSystem = GetWorld()->GetSubsystem<UPCUnitSpawnSubsystem>();
+	
 	for (auto& WU : Pair.CloneUnits)
 	{
 		if (APCBaseUnitCharacter* Unit = WU.Get())
@@ -388,7 +711,12 @@ void APCCombatManager::DestroyCloneForPair(int32 PairIndex, bool bRemoveFromTM)
 
 			Unit->OnUnitDied.RemoveDynamic(this, &APCCombatManager::OnAnyUnitDied);
 			UnitToPairIndex.Remove(Unit);
-			Unit->Destroy();
+
+			// 클론은 매 라운드 생성되므로 파괴하지 않고 풀로 반납
+			if (UnitSpawnSystem)
+				UnitSpawnSystem->ReleaseUnit(Unit);
+			else
+				Unit->Destroy();
 		}
 	}
 
@@ -401,48 +729,15 @@ void APCCombatManager::PlacePlayerBoardToTM(APCPlayerBoard* PlayerBoard, UPCTile
                                             bool MirrorCols, ETileFacing Facing)
 {
 	if (!IsValid(PlayerBoard) || !IsValid(TM)) return;
-	
-	// 1) PB 필드 스냅샷 (Y=Col, X=Row)
-	struct FCaptured { int32 Y; int32 X; TWeakObjectPtr<APCBaseUnitCharacter> Unit; };
-	TArray<FCaptured> Capture;
-	Capture.Reserve(PlayerBoard->Rows * PlayerBoard->Cols);
-
-	for (int32 y = 0; y < PlayerBoard->Cols; ++y)
-	{
-		for (int32 x = 0; x < PlayerBoard->Rows; ++x)
-		{
-			const int32 i = PlayerBoard->IndexOf(y, x); // PB: IndexOf(Y,X) = Y*Rows + X
-			if (!PlayerBoard->PlayerField.IsValidIndex(i)) continue;
-
-			if (APCBaseUnitCharacter* U = PlayerBoard->PlayerField[i].Unit)
-			{
-				Capture.Add({ y, x, U });
-			}
-		}
-	}
 
-	// 2) TM 기준으로 좌표 미러 계산 후 배치
-	for (const auto& E : Capture)
-	{
-		// TM의 크기를 기준으로 미러링
-		const int32 dstX = MirrorRows ? (TM->Rows - 1 - E.X) : E.X; // Row
-		const int32 dstY = MirrorCols ? (TM->Cols - 1 - E.Y) : E.Y; // Col
+	FBoardFieldCopy Field;
+	CopyBoardField(PlayerBoard, Field);
 
-		// 범위 체크 (PB/TM 크기 다를 수 있음)
-		if (dstY < 0 || dstY >= TM->Cols || dstX < 0 || dstX >= TM->Rows)
-			continue;
-
-		if (APCBaseUnitCharacter* Unit = E.Unit.Get())
-		{
-			const bool ok = TM->PlaceUnitOnField(dstY, dstX, Unit, Facing);
+	TArray<FPlannedPlacement> Placements;
+	Placements.Reserve(Field.Rows * Field.Cols);
 
-			// 팀 보장
-			if (ok && Unit->GetTeamIndex() != PlayerBoard->PlayerIndex)
-			{
-				Unit->SetTeamIndex(PlayerBoard->PlayerIndex);
-			}
-		}		
-	}	
+	PlanBoardPlacement(Field, TM->Rows, TM->Cols, MirrorRows, MirrorCols, Facing, Field.PlayerIndex, Placements);
+	CommitPlacements(TM, Placements);
 }
 
 APCCombatBoard* APCCombatManager::FindBoardBySeatIndex(UWorld* World, int32 SeatIndex)
@@ -463,19 +758,8 @@ bool APCCombatManager::RemoveUnitFromAny(UPCTileManager* TileManager, APCBaseUni
 {
 	if (!TileManager || !Unit) return false;
 
-	for (int32 r = 0; r < TileManager->Rows; ++r)
-	{
-		for (int32 c = 0; c < TileManager->Cols; ++c)
-		{
-			if (TileManager->GetFieldUnit(c, r) == Unit)
-			{
-				TileManager->RemoveFromField(c,r,false);
-				return true;
-			}
-		}
-	}
-
-	return false;
+	// 타일매니저 역인덱스로 바로 위치 조회
+	return TileManager->RemoveFromBoard(Unit);
 }
 
 
@@ -527,6 +811,7 @@ void APCCombatManager::FocusCameraToBoard(int32 ViewerSeatIdx, int32 BoardSeatId
 {
 	if (APCCombatPlayerController* CombatController = FindPlayerController(ViewerSeatIdx))
 	{
+		CombatController->SetViewedBoardSeatIndex(BoardSeatIdx);
 		CombatController->ClientFocusBoardBySeatIndex(BoardSeatIdx, Blend);
 	}
 }
@@ -753,6 +1038,8 @@ int32 APCCombatManager::StartPvEBattleForSeat(int32 HostSeatIndex)
 
 	CountAliveOnHostBoardForPair(PairIndex);
 	BindUnitOnBoardForPair(PairIndex);
+	BeginPairRandom(PairIndex);
+	BeginPairReplay(PairIndex, INDEX_NONE, EPCReplayPairKind::PvE);
 	
 	return PairIndex;
 	
@@ -808,6 +1095,10 @@ void APCCombatManager::FinishPvEBattleForSeat(int32 HostSeatIndex)
 	}
 
 	// 4) 언바인드 및 정리
+	if (UPCCombatReplaySubsystem* Replay = UPCCombatReplaySubsystem::FindRecorder(this))
+	{
+		Replay->EndPair(PairIndex, EPCReplayResult::None);
+	}
 	UnbindAllForPair(PairIndex);
 	Pair.PvESnapShot = {};        // 스냅샷 해제
 	Pair.ResetRuntime();
@@ -847,28 +1138,7 @@ APCPlayerBoard* APCCombatManager::FindPlayerBoardBySeat(int32 SeatIndex) const
 
 void APCCombatManager::TakeFieldSnapShot(APCPlayerBoard* PlayerBoard, FBoardFieldSnapShot& Out)
 {
-	Out.Reset();
-	if (!IsValid(PlayerBoard)) return;
-	Out.PlayerBoard = PlayerBoard;
-
-	const int32 Rows = PlayerBoard->Rows;
-	const int32 Cols = PlayerBoard->Cols;
-	for (int32 r = 0; r < Rows; ++r)
-	{
-		for (int32 c = 0; c < Cols; ++c)
-		{
-			const int32 i = PlayerBoard->IndexOf(c,r);
-			if (!PlayerBoard->PlayerField.IsValidIndex(i)) continue;
-			if (APCBaseUnitCharacter* Unit = PlayerBoard->PlayerField[i].Unit)
-			{
-				FCombatManager_FieldSlot Slot;
-				Slot.Col = c;
-				Slot.Row = r;
-				Slot.Unit = Unit;
-				Out.Field.Add(Slot);
-			}
-		}
-	}
+	CaptureFieldSnapShot(PlayerBoard, Out);
 }
 
 void APCCombatManager::RestoreFieldSnapShot(const FBoardFieldSnapShot& Snap)
@@ -876,10 +1146,10 @@ void APCCombatManager::RestoreFieldSnapShot(const FBoardFieldSnapShot& Snap)
 	APCPlayerBoard* PlayerBoard = Snap.PlayerBoard.Get();
 	if (!IsValid(PlayerBoard)) return;
 
-	for (auto& Field : PlayerBoard->PlayerField)
+	for (int32 i = 0; i < PlayerBoard->PlayerField.Num(); ++i)
 	{
-		if (Field.bIsField)
-			Field.Unit = nullptr;
+		if (PlayerBoard->PlayerField[i].bIsField)
+			PlayerBoard->SetFieldTileUnit(i, nullptr);
 	}
 
 	for (const auto& FieldSnap : Snap.Field)
@@ -889,7 +1159,7 @@ void APCCombatManager::RestoreFieldSnapShot(const FBoardFieldSnapShot& Snap)
 
 		if (APCBaseUnitCharacter* Unit = FieldSnap.Unit.Get())
 		{
-			PlayerBoard->PlayerField[i].Unit = Unit;
+			PlayerBoard->SetFieldTileUnit(i, Unit);
 			const FVector Loc = PlayerBoard->GetFieldWorldPos(FieldSnap.Col, FieldSnap.Row);
 			const FVector TLoc = FVector(Loc.X, Loc.Y, 50.f);
 			const FRotator Rot(0.f, PlayerBoard->GetActorRotation().Yaw,0.f);
@@ -898,6 +1168,31 @@ void APCCombatManager::RestoreFieldSnapShot(const FBoardFieldSnapShot& Snap)
 	}
 }
 
+void APCCombatManager::BeginPairRandom(int32 PairIndex)
+{
+	if (!Pairs.IsValidIndex(PairIndex)) return;
+
+	const APCCombatBoard* Host = Pairs[PairIndex].Host.Get();
+	UPCMatchRandomSubsystem* MatchRandom = GetWorld() ? GetWorld()->GetSubsystem<UPCMatchRandomSubsystem>() : nullptr;
+	if (!Host || !MatchRandom) return;
+
+	int32 StageOne = 0, RoundOne = 0;
+	GetCurrentStageRoundOne(StageOne, RoundOne);
+	MatchRandom->BeginBoardRound(Host->BoardSeatIndex, StageOne, RoundOne);
+}
+
+void APCCombatManager::BeginPairReplay(int32 PairIndex, int32 GuestSeat, EPCReplayPairKind PairKind)
+{
+	if (!Pairs.IsValidIndex(PairIndex)) return;
+
+	UPCCombatReplaySubsystem* Replay = GetWorld() ? GetWorld()->GetSubsystem<UPCCombatReplaySubsystem>() : nullptr;
+	if (!Replay) return;
+
+	int32 StageOne = 0, RoundOne = 0;
+	GetCurrentStageRoundOne(StageOne, RoundOne);
+	Replay->BeginPair(PairIndex, Pairs[PairIndex].Host.Get(), GuestSeat, PairKind, StageOne, RoundOne);
+}
+
 bool APCCombatManager::GetCurrentStageRoundOne(int32& OutStageOne, int32& OutRoundOne) const
 {
 	if (APCCombatGameState* PCGS = GetWorld() ? GetWorld()->GetGameState<APCCombatGameState>() : nullptr)
@@ -1022,8 +1317,8 @@ APCBaseUnitCharacter* APCCombatManager::SpawnCreepAt(APCCombatBoard* Board, int3
 	// (Y,X) 자리 또는 주변 빈칸에 배치 (적 방향)
 	if (!PlaceOrNearest(TM, YX.Y, YX.X, Unit))
 	{
-		// 자리가 끝내 없으면 정리
-		Unit->Destroy();
+		// 자리가 끝내 없으면 풀로 반납
+		SpawnSubsystem->ReleaseUnit(Unit);
 		return nullptr;
 	}
 
@@ -1187,6 +1482,11 @@ void APCCombatManager::OnAnyUnitDied(APCBaseUnitCharacter* Unit)
 	if (Pair.DeadUnits.Contains(Unit)) return;
 	Pair.DeadUnits.Add(Unit);
 
+	if (UPCCombatReplaySubsystem* Replay = UPCCombatReplaySubsystem::FindRecorder(this))
+	{
+		Replay->RecordDeath(Unit);
+	}
+
 	APCCombatBoard* Host  = Pair.Host.Get();
 	APCCombatBoard* Guest = Pair.Guest.Get();
 	if (!Host) return;
@@ -1285,6 +1585,11 @@ void APCCombatManager::ResolvePairResult(int32 PairIndex, bool bHostWon)
 	UPCTileManager* HostTM = HostBoard->TileManager;
 	const int32 HostSeat = HostBoard->BoardSeatIndex;
 
+	if (UPCCombatReplaySubsystem* Replay = UPCCombatReplaySubsystem::FindRecorder(this))
+	{
+		Replay->EndPair(PairIndex, bHostWon ? EPCReplayResult::HostWon : EPCReplayResult::GuestWon);
+	}
+
 	// PvE는 데미지 이벤트 생략(필요 시 규칙 추가)
 	if (Pair.bIsPvE)
 	{
@@ -1500,6 +1805,11 @@ void APCCombatManager::ResolvePairDraw(int32 PairIndex)
 	if (!Pair.bRunning) return;
 	Pair.bRunning = false;
 
+	if (UPCCombatReplaySubsystem* Replay = UPCCombatReplaySubsystem::FindRecorder(this))
+	{
+		Replay->EndPair(PairIndex, EPCReplayResult::Draw);
+	}
+
 	APCCombatBoard* HostBoard = Pair.Host.Get();
 	APCCombatBoard* GuestBoard = Pair.Guest.Get();
 	if (!HostBoard || !HostBoard->TileManager) return;
@@ -4,6 +4,8 @@
 #include "GameFramework/HelpActor/PCPlayerBoard.h"
 
 #include "AbilitySystemComponent.h"
+#include "Algo/BinarySearch.h"
+#include "EngineUtils.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Net/UnrealNetwork.h"
 
@@ -13,6 +15,8 @@
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "Components/WidgetComponent.h"
 #include "Controller/Player/PCCombatPlayerController.h"
+#include "GameFramework/HelpActor/PCCombatBoard.h"
+#include "GameFramework/HelpActor/Component/PCTileManager.h"
 #include "GameFramework/GameState/PCCombatGameState.h"
 #include "GameFramework/PlayerState/PCPlayerState.h"
 #include "Kismet/GameplayStatics.h"
@@ -52,6 +56,7 @@ void APCPlayerBoard::QuickSetUp()
 	CreatePlayerField();
 	CreatePlayerBench();
 	BuildHISM();
+	ResetOccupancy();
 }
 
 void APCPlayerBoard::OnHISM(bool bIsOn, bool bIsBattle)
@@ -170,6 +175,8 @@ void APCPlayerBoard::GetLifetimeReplicatedProps(TArray<class FLifetimeProperty>&
 	DOREPLIFETIME(APCPlayerBoard, BenchLocs)
 	DOREPLIFETIME_CONDITION(APCPlayerBoard, CurUnits, COND_OwnerOnly)
 	DOREPLIFETIME_CONDITION(APCPlayerBoard, MaxUnits, COND_OwnerOnly)
+	DOREPLIFETIME_CONDITION(APCPlayerBoard, OccupancyBits, COND_OwnerOnly)
+	DOREPLIFETIME_CONDITION(APCPlayerBoard, OccupantUnits, COND_OwnerOnly)
 }
 
 #if WITH_EDITOR
@@ -185,26 +192,34 @@ void APCPlayerBoard::CreatePlayerField()
 {
 	PlayerField.SetNum(Rows * Cols);
 
-	const float R = FieldTileWidthX * 0.5f;
-	const float Xs = 1.5f * R;
-	const float Ys = FMath::Sqrt(3.f) * R;
-	const FVector BaseLocal(FirstFieldLoc.X, FirstFieldLoc.Y, 0);
+	const FPCHexGridLayout Layout = GetFieldLayout();
 
 	for (int32 r=0; r<Rows; ++r)
 	{
-		const int32 rLocal = bRowZeroAtBottom ? r : (Rows-1-r);
 		for (int32 c=0; c<Cols; ++c)
 		{
 			const int32 i = c*Rows + r;
-			const float x = c * Xs;
-			const float y = (rLocal + ((c&1)? OddColumRowShift : 0.f)) * Ys;
 
 			PlayerField[i].UnitIntPoint = FIntPoint(c,r);
-			PlayerField[i].Position     = BaseLocal + FVector(x,y,0); // ← 로컬 저장
+			PlayerField[i].Position     = FVector(Layout.GetTileCenter(c, r), 0); // ← 로컬 저장
 			PlayerField[i].bIsField     = true;
 			PlayerField[i].Unit         = nullptr;
 		}
 	}
+
+	RebuildTagIndex();
+}
+
+FPCHexGridLayout APCPlayerBoard::GetFieldLayout() const
+{
+	FPCHexGridLayout Layout;
+	Layout.Cols = Cols;
+	Layout.Rows = Rows;
+	Layout.TileWidthX = FieldTileWidthX;
+	Layout.bRowZeroAtBottom = bRowZeroAtBottom;
+	Layout.OddColumRowShift = OddColumRowShift;
+	Layout.Origin = FirstFieldLoc;
+	return Layout;
 }
 
 void APCPlayerBoard::CreatePlayerBench()
@@ -219,6 +234,8 @@ void APCPlayerBoard::CreatePlayerBench()
 		PlayerBench[i].bIsField = false;
 		PlayerBench[i].Unit = nullptr;
 	}
+
+	RebuildTagIndex();
 }
 
 bool APCPlayerBoard::IsInRange(int32 Y, int32 X) const
@@ -297,81 +314,79 @@ int32 APCPlayerBoard::GetFirstEmptyBenchIndex() const
 TArray<APCBaseUnitCharacter*> APCPlayerBoard::GetAllUnitByTag(FGameplayTag UnitTag, int32 TeamSeat)
 {
 	TArray<APCBaseUnitCharacter*> Out;
-	if (!UnitTag.IsValid()) return Out;
-
-	auto AddIf = [&](APCBaseUnitCharacter* Unit)
-	{
-		if (IsValid(Unit) && Unit->GetUnitTag().IsValid() && Unit->GetUnitTag().MatchesTag(UnitTag) && Unit->GetTeamIndex() == TeamSeat)
-		{
-			Out.AddUnique(Unit);
-		}
-	};
-
-	for (const auto& T : PlayerField)
-	{
-		AddIf(T.Unit);
-	}
-
-	for (const auto& T : PlayerBench)
-	{
-		AddIf(T.Unit);
-	}
-
+	CollectUnitsByTag(UnitTag, TeamSeat, true, true, Out);
 	return Out;
 }
 
 TArray<APCBaseUnitCharacter*> APCPlayerBoard::GetFieldUnitByTag(FGameplayTag UnitTag)
 {
 	TArray<APCBaseUnitCharacter*> FieldUnit;
-	if (!UnitTag.IsValid())
-		return FieldUnit;
-
-	auto AddIfField = [&](APCBaseUnitCharacter* Unit)
-	{
-		if (!IsValid(Unit)) return;
-
-		if (Unit->GetUnitTag().IsValid() && Unit->GetUnitTag().MatchesTag(UnitTag) && Unit->GetTeamIndex() == PlayerIndex)
-		{
-			if (!FieldUnit.Contains(Unit))
-			{
-				FieldUnit.Add(Unit);
-			}
-		}
-	};
-	
-	for (const auto& T : PlayerField)
-	{
-		AddIfField(T.Unit);
-	}
-
+	CollectUnitsByTag(UnitTag, PlayerIndex, true, false, FieldUnit);
 	return FieldUnit;
 }
 
 TArray<APCBaseUnitCharacter*> APCPlayerBoard::GetBenchUnitByTag(FGameplayTag UnitTag, int32 TeamSeat)
 {
 	TArray<APCBaseUnitCharacter*> BenchUnit;
+	CollectUnitsByTag(UnitTag, TeamSeat, false, true, BenchUnit);
+	return BenchUnit;
+}
+
+void APCPlayerBoard::CollectUnitsByTag(const FGameplayTag& UnitTag, int32 TeamSeat, bool bIncludeField, bool bIncludeBench, TArray<APCBaseUnitCharacter*>& Out) const
+{
 	if (!UnitTag.IsValid())
-		return BenchUnit;
+		return;
 
-	auto AddIfBench = [&](APCBaseUnitCharacter* Unit)
+	// 보드 위 서로 다른 태그 수만큼만 확인 (MatchesTag 로 상위 태그 조회도 기존과 동일하게 지원)
+	TArray<int32, TInlineAllocator<16>> FieldSlots;
+	TArray<int32, TInlineAllocator<16>> BenchSlots;
+	int32 NumMatchedTags = 0;
+	for (const auto& Pair : UnitTagIndex)
 	{
-		if (!IsValid(Unit)) return;
+		if (!Pair.Key.MatchesTag(UnitTag))
+			continue;
 
-		if (Unit->GetUnitTag().IsValid() && Unit->GetUnitTag().MatchesTag(UnitTag) && Unit->GetTeamIndex() == TeamSeat)
+		++NumMatchedTags;
+		if (bIncludeField)
 		{
-			if (!BenchUnit.Contains(Unit))
-			{
-				BenchUnit.Add(Unit);
-			}
+			FieldSlots.Append(Pair.Value.FieldSlots);
+		}
+		if (bIncludeBench)
+		{
+			BenchSlots.Append(Pair.Value.BenchSlots);
+		}
+	}
+
+	// 여러 태그가 걸렸을 때만 슬롯 순서 정렬 (단일 태그는 이미 오름차순)
+	if (NumMatchedTags > 1)
+	{
+		FieldSlots.Sort();
+		BenchSlots.Sort();
+	}
+
+	auto AddIf = [&](APCBaseUnitCharacter* Unit)
+	{
+		if (IsValid(Unit) && Unit->GetUnitTag().IsValid() && Unit->GetUnitTag().MatchesTag(UnitTag) && Unit->GetTeamIndex() == TeamSeat)
+		{
+			Out.AddUnique(Unit);
 		}
 	};
-	
-	for (const auto& T : PlayerBench)
+
+	for (const int32 Slot : FieldSlots)
 	{
-		AddIfBench(T.Unit);
+		if (PlayerField.IsValidIndex(Slot))
+		{
+			AddIf(PlayerField[Slot].Unit);
+		}
 	}
 
-	return BenchUnit;
+	for (const int32 Slot : BenchSlots)
+	{
+		if (PlayerBench.IsValidIndex(Slot))
+		{
+			AddIf(PlayerBench[Slot].Unit);
+		}
+	}
 }
 
 TArray<FGameplayTag> APCPlayerBoard::GetAllBenchUnitTag()
@@ -395,13 +410,13 @@ bool APCPlayerBoard::EnsureExclusive(APCBaseUnitCharacter* Unit)
 	if (!Unit) return false;
 	if (auto P = GetFieldUnitIndex(Unit); P != INDEX_NONE)
 	{
-		PlayerField[P].Unit = nullptr;
+		SetFieldTileUnit(P, nullptr);
 		return true;
 	}
 	if (auto bi = GetBenchUnitIndex(Unit); bi != INDEX_NONE)
 	{
 		ensure(PlayerBench.IsValidIndex(bi));
-		PlayerBench[bi].Unit = nullptr;
+		SetBenchTileUnit(bi, nullptr);
 		return true;
 	}
 	
@@ -426,7 +441,7 @@ bool APCPlayerBoard::PlaceUnitOnField(int32 Y, int32 X, APCBaseUnitCharacter* Un
 	}
 	
 	EnsureExclusive(Unit);
-	PlayerField[i].Unit = Unit;
+	SetFieldTileUnit(i, Unit);
 	const FVector World = ToWorld(SceneRoot, PlayerField[i].Position);
 	FVector TWorld = FVector(World.X, World.Y, 50.f);
 	Unit->TeleportTo(TWorld, Unit->GetActorRotation(), false, true);
@@ -454,7 +469,7 @@ bool APCPlayerBoard::PlaceUnitOnBench(int32 LocalBenchIndex, APCBaseUnitCharacte
 	if (!PCPlayerState || !Unit || !PlayerBench.IsValidIndex(LocalBenchIndex)) return false;
 	
 	EnsureExclusive(Unit);
-	PlayerBench[LocalBenchIndex].Unit = Unit;
+	SetBenchTileUnit(LocalBenchIndex, Unit);
 	Unit->ChangedOnTile(false);
 	
 	const FVector World = ToWorld(SceneRoot, PlayerBench[LocalBenchIndex].Position);
@@ -477,7 +492,7 @@ bool APCPlayerBoard::PlaceUnitOnBench(int32 LocalBenchIndex, APCBaseUnitCharacte
 bool APCPlayerBoard::RemoveFromField(int32 FieldIndex)
 {
 	if (!PlayerField.IsValidIndex(FieldIndex)) return false;
-	PlayerField[FieldIndex].Unit = nullptr;
+	SetFieldTileUnit(FieldIndex, nullptr);
 	if (HasAuthority())
 	{
 		RecountAndPushToWidget_Server();
@@ -489,7 +504,7 @@ bool APCPlayerBoard::RemoveFromField(int32 FieldIndex)
 bool APCPlayerBoard::RemoveFromBench(int32 LocalBenchIndex)
 {
 	if (!PlayerBench.IsValidIndex(LocalBenchIndex)) return false;
-	PlayerBench[LocalBenchIndex].Unit = nullptr;
+	SetBenchTileUnit(LocalBenchIndex, nullptr);
 	return true;
 }
 
@@ -517,36 +532,36 @@ bool APCPlayerBoard::Swap(APCBaseUnitCharacter* A, APCBaseUnitCharacter* B)
 
 	if (PA != FIntPoint::NoneValue && PB != FIntPoint::NoneValue)
 	{
-		PlayerField[PAIndex].Unit = B;
+		SetFieldTileUnit(PAIndex, B);
 		PlaceUnitOnField(PA.X, PA.Y, B);
-		PlayerField[PBIndex].Unit = A;
+		SetFieldTileUnit(PBIndex, A);
 		PlaceUnitOnField(PB.X, PB.Y, A);
 		return true;
 	}
 
 	if (BA != INDEX_NONE && BB != INDEX_NONE)
 	{
-		PlayerBench[BA].Unit = B;
+		SetBenchTileUnit(BA, B);
 		PlaceUnitOnBench(BA,B);
-		PlayerBench[BB].Unit = A;
+		SetBenchTileUnit(BB, A);
 		PlaceUnitOnBench(BB,A);
 		return true;
 	}
 
 	if (PA != FIntPoint::NoneValue && BB != INDEX_NONE)
 	{
-		PlayerField[PAIndex].Unit = B; // FIX
+		SetFieldTileUnit(PAIndex, B); // FIX
 		PlaceUnitOnField(PA.X, PA.Y, B);
-		PlayerBench[BB].Unit = A;
+		SetBenchTileUnit(BB, A);
 		PlaceUnitOnBench(BB,A);
 		return true;
 	}
 
 	if (PB != FIntPoint::NoneValue && BA != INDEX_NONE)
 	{
-		PlayerField[PBIndex].Unit = A;
+		SetFieldTileUnit(PBIndex, A);
 		PlaceUnitOnField(PB.X, PB.Y, A);
-		PlayerBench[BA].Unit = B;
+		SetBenchTileUnit(BA, B);
 		PlaceUnitOnBench(BA,B);
 		return true;
 	}
@@ -554,6 +569,266 @@ bool APCPlayerBoard::Swap(APCBaseUnitCharacter* A, APCBaseUnitCharacter* B)
 	return false;
 }
 
+void APCPlayerBoard::SetFieldTileUnit(int32 FieldIndex, APCBaseUnitCharacter* Unit)
+{
+	if (!PlayerField.IsValidIndex(FieldIndex)) return;
+	PlayerField[FieldIndex].Unit = Unit;
+	UpdateTagIndex(true, FieldIndex, Unit);
+	UpdateOccupancy(FieldIndex, Unit);
+}
+
+void APCPlayerBoard::SetBenchTileUnit(int32 LocalBenchIndex, APCBaseUnitCharacter* Unit)
+{
+	if (!PlayerBench.IsValidIndex(LocalBenchIndex)) return;
+	PlayerBench[LocalBenchIndex].Unit = Unit;
+	UpdateTagIndex(false, LocalBenchIndex, Unit);
+	UpdateOccupancy(Rows * Cols + LocalBenchIndex, Unit);
+}
+
+void APCPlayerBoard::ResetOccupancy()
+{
+	if (!HasAuthority())
+		return;
+
+	OccupancyBits = 0;
+	OccupantUnits.Reset();
+	OccupantUnits.SetNum(PlayerField.Num() + PlayerBench.Num());
+}
+
+void APCPlayerBoard::UpdateOccupancy(int32 OccupancyIndex, APCBaseUnitCharacter* Unit)
+{
+	if (!HasAuthority() || !OccupantUnits.IsValidIndex(OccupancyIndex))
+		return;
+
+	OccupantUnits[OccupancyIndex] = Unit;
+
+	if (OccupancyIndex < 64)
+	{
+		const uint64 Bit = 1ull << OccupancyIndex;
+		OccupancyBits = Unit ? (OccupancyBits | Bit) : (OccupancyBits & ~Bit);
+	}
+}
+
+bool APCPlayerBoard::ResolveReplicatedOccupant(bool bIsField, int32 Y, int32 X, int32 LocalBenchIndex,
+	APCBaseUnitCharacter*& OutUnit) const
+{
+	OutUnit = nullptr;
+
+	if (bIsField && !IsInRange(Y, X))
+		return false;
+
+	const int32 OccupancyIndex = bIsField ? IndexOf(Y, X) : Rows * Cols + LocalBenchIndex;
+	if (OccupancyIndex < 0 || OccupancyIndex >= 64 || !OccupantUnits.IsValidIndex(OccupancyIndex))
+		return false;
+
+	if ((OccupancyBits & (1ull << OccupancyIndex)) == 0)
+		return true;
+
+	// 점유 비트는 왔지만 유닛 참조가 아직 해석되지 않은 경우
+	OutUnit = OccupantUnits[OccupancyIndex];
+	return OutUnit != nullptr;
+}
+
+bool APCPlayerBoard::GetFieldTileLocation(int32 FieldIndex, FVector& OutLocation) const
+{
+	if (!FieldLocs.IsValidIndex(FieldIndex))
+		return false;
+
+	OutLocation = FieldLocs[FieldIndex];
+	return true;
+}
+
+bool APCPlayerBoard::GetBenchTileLocation(int32 LocalBenchIndex, FVector& OutLocation) const
+{
+	if (!BenchLocs.IsValidIndex(LocalBenchIndex))
+		return false;
+
+	OutLocation = BenchLocs[LocalBenchIndex];
+	return true;
+}
+
+void APCPlayerBoard::RebuildTagIndex()
+{
+	UnitTagIndex.Reset();
+	FieldSlotTags.Reset();
+	BenchSlotTags.Reset();
+	FieldSlotTags.SetNum(PlayerField.Num());
+	BenchSlotTags.SetNum(PlayerBench.Num());
+
+	for (int32 i = 0; i < PlayerField.Num(); ++i)
+	{
+		UpdateTagIndex(true, i, PlayerField[i].Unit);
+	}
+
+	for (int32 i = 0; i < PlayerBench.Num(); ++i)
+	{
+		UpdateTagIndex(false, i, PlayerBench[i].Unit);
+	}
+}
+
+void APCPlayerBoard::UpdateTagIndex(bool bIsField, int32 SlotIndex, APCBaseUnitCharacter* NewUnit)
+{
+	TArray<FGameplayTag>& SlotTags = bIsField ? FieldSlotTags : BenchSlotTags;
+	if (SlotTags.Num() <= SlotIndex)
+	{
+		SlotTags.SetNum(SlotIndex + 1);
+	}
+
+	const FGameplayTag NewTag = NewUnit ? NewUnit->GetUnitTag() : FGameplayTag();
+	const FGameplayTag OldTag = SlotTags[SlotIndex];
+	if (OldTag == NewTag)
+		return;
+
+	if (OldTag.IsValid())
+	{
+		if (FUnitTagSlots* Slots = UnitTagIndex.Find(OldTag))
+		{
+			(bIsField ? Slots->FieldSlots : Slots->BenchSlots).Remove(SlotIndex);
+			if (Slots->IsEmpty())
+			{
+				UnitTagIndex.Remove(OldTag);
+			}
+		}
+	}
+
+	if (NewTag.IsValid())
+	{
+		FUnitTagSlots& Slots = UnitTagIndex.FindOrAdd(NewTag);
+		auto& SlotList = bIsField ? Slots.FieldSlots : Slots.BenchSlots;
+		SlotList.Insert(SlotIndex, Algo::LowerBound(SlotList, SlotIndex));
+	}
+
+	SlotTags[SlotIndex] = NewTag;
+}
+
+bool APCPlayerBoard::DebugValidateTagIndex() const
+{
+#if !UE_BUILD_SHIPPING
+	// 필드 / 벤치 전체 스캔으로 기대값 구성
+	TMap<FGameplayTag, FUnitTagSlots> Expected;
+	for (int32 i = 0; i < PlayerField.Num(); ++i)
+	{
+		if (const APCBaseUnitCharacter* Unit = PlayerField[i].Unit; Unit && Unit->GetUnitTag().IsValid())
+		{
+			Expected.FindOrAdd(Unit->GetUnitTag()).FieldSlots.Add(i);
+		}
+	}
+	for (int32 i = 0; i < PlayerBench.Num(); ++i)
+	{
+		if (const APCBaseUnitCharacter* Unit = PlayerBench[i].Unit; Unit && Unit->GetUnitTag().IsValid())
+		{
+			Expected.FindOrAdd(Unit->GetUnitTag()).BenchSlots.Add(i);
+		}
+	}
+
+	int32 Mismatch = 0;
+	if (Expected.Num() != UnitTagIndex.Num())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[PlayerBoard %d] TagIndex tag count mismatch : Index=%d Scan=%d"), PlayerIndex, UnitTagIndex.Num(), Expected.Num());
+		++Mismatch;
+	}
+
+	for (const auto& Pair : Expected)
+	{
+		const FUnitTagSlots* Indexed = UnitTagIndex.Find(Pair.Key);
+		if (!Indexed || Indexed->FieldSlots != Pair.Value.FieldSlots || Indexed->BenchSlots != Pair.Value.BenchSlots)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[PlayerBoard %d] TagIndex mismatch : %s"), PlayerIndex, *Pair.Key.ToString());
+			++Mismatch;
+		}
+	}
+
+	return Mismatch == 0;
+#else
+	return true;
+#endif
+}
+
+bool APCPlayerBoard::DebugFuzzTagIndex(int32 NumOps, int32 Seed)
+{
+#if !UE_BUILD_SHIPPING
+	TArray<APCBaseUnitCharacter*> SavedField;
+	TArray<APCBaseUnitCharacter*> SavedBench;
+	TArray<APCBaseUnitCharacter*> Units;
+	for (const FPlayerTile& Tile : PlayerField)
+	{
+		SavedField.Add(Tile.Unit);
+		if (Tile.Unit) Units.AddUnique(Tile.Unit);
+	}
+	for (const FPlayerTile& Tile : PlayerBench)
+	{
+		SavedBench.Add(Tile.Unit);
+		if (Tile.Unit) Units.AddUnique(Tile.Unit);
+	}
+
+	if (Units.IsEmpty() || PlayerField.IsEmpty() || PlayerBench.IsEmpty())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[PlayerBoard %d] TagIndex fuzz skipped (Units=%d)"), PlayerIndex, Units.Num());
+		return DebugValidateTagIndex();
+	}
+
+	FRandomStream Random(Seed);
+	auto SetSlot = [this](bool bIsField, int32 Slot, APCBaseUnitCharacter* Unit)
+	{
+		bIsField ? SetFieldTileUnit(Slot, Unit) : SetBenchTileUnit(Slot, Unit);
+	};
+	auto GetSlot = [this](bool bIsField, int32 Slot)
+	{
+		return bIsField ? PlayerField[Slot].Unit : PlayerBench[Slot].Unit;
+	};
+
+	bool bPassed = DebugValidateTagIndex();
+	for (int32 Op = 0; Op < NumOps && bPassed; ++Op)
+	{
+		const bool bFieldA = Random.RandHelper(2) == 0;
+		const int32 SlotA = Random.RandHelper(bFieldA ? PlayerField.Num() : PlayerBench.Num());
+
+		switch (Random.RandHelper(3))
+		{
+		case 0: // 배치 (같은 유닛이 여러 칸에 있는 상태도 인덱스는 슬롯 단위로 따라가야 함)
+			SetSlot(bFieldA, SlotA, Units[Random.RandHelper(Units.Num())]);
+			break;
+		case 1: // 제거 (판매 / 합성)
+			SetSlot(bFieldA, SlotA, nullptr);
+			break;
+		default: // 교체 (필드 <-> 벤치 이동 포함)
+			{
+				const bool bFieldB = Random.RandHelper(2) == 0;
+				const int32 SlotB = Random.RandHelper(bFieldB ? PlayerField.Num() : PlayerBench.Num());
+				APCBaseUnitCharacter* UnitA = GetSlot(bFieldA, SlotA);
+				APCBaseUnitCharacter* UnitB = GetSlot(bFieldB, SlotB);
+				SetSlot(bFieldA, SlotA, UnitB);
+				SetSlot(bFieldB, SlotB, UnitA);
+			}
+			break;
+		}
+
+		if (!DebugValidateTagIndex())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[PlayerBoard %d] TagIndex fuzz failed at op %d"), PlayerIndex, Op);
+			bPassed = false;
+		}
+	}
+
+	// 원래 배치로 복구
+	for (int32 i = 0; i < SavedField.Num(); ++i)
+	{
+		SetFieldTileUnit(i, SavedField[i]);
+	}
+	for (int32 i = 0; i < SavedBench.Num(); ++i)
+	{
+		SetBenchTileUnit(i, SavedBench[i]);
+	}
+
+	bPassed &= DebugValidateTagIndex();
+	UE_LOG(LogTemp, Log, TEXT("[PlayerBoard %d] TagIndex fuzz %s (Ops=%d Units=%d Seed=%d)"),
+		PlayerIndex, bPassed ? TEXT("OK") : TEXT("FAILED"), NumOps, Units.Num(), Seed);
+	return bPassed;
+#else
+	return true;
+#endif
+}
+
 namespace
 {
 	// 제곱거릴 헬퍼
@@ -563,6 +838,33 @@ namespace
 		const float dy = A.Y - B.Y;
 		return dx*dx + dy*dy;
 	}
+
+#if !UE_BUILD_SHIPPING
+	// 콘솔 : PC.Board.ValidateWorldToTile [SampleStep]
+	FAutoConsoleCommandWithWorldAndArgs GPCValidateWorldToTileCommand(
+		TEXT("PC.Board.ValidateWorldToTile"),
+		TEXT("Compare analytic world-to-tile mapping against the brute-force nearest scan on every player / combat board. Args: [SampleStep=10]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World)
+				return;
+
+			const float SampleStep = Args.IsValidIndex(0) ? FCString::Atof(*Args[0]) : 10.f;
+			int32 NumFailed = 0;
+			for (TActorIterator<APCPlayerBoard> It(World); It; ++It)
+			{
+				NumFailed += It->DebugValidateWorldToTile(SampleStep) ? 0 : 1;
+			}
+			for (TActorIterator<APCCombatBoard> It(World); It; ++It)
+			{
+				if (It->TileManager)
+				{
+					NumFailed += It->TileManager->DebugValidateWorldToTile(SampleStep) ? 0 : 1;
+				}
+			}
+			UE_LOG(LogTemp, Log, TEXT("[PlayerBoard] ValidateWorldToTile done, %d board(s) failed"), NumFailed);
+		}));
+#endif
 }
 
 bool APCPlayerBoard::WorldToField(const FVector& World, int32& OutY, int32& OutX, float MaxSnapDist) const
@@ -571,59 +873,139 @@ bool APCPlayerBoard::WorldToField(const FVector& World, int32& OutY, int32& OutX
 	OutX = INDEX_NONE;
 	if (PlayerField.Num() <= 0 || Rows <= 0 || Cols <= 0) return false;
 
-	float BestD2 = TNumericLimits<float>::Max();
-	int32 BestY = INDEX_NONE;
-	int32 BestX = INDEX_NONE;
+	const float Snap = (MaxSnapDist > 0.f) ? MaxSnapDist : GetDefaultSnapDist();
 
-	for (int32 y = 0; y < Cols; ++y)
-	{
-		for (int32 x = 0; x < Rows; ++x)
-		{
-			const int32 i = IndexOf(y, x);
-			if (!PlayerField.IsValidIndex(i)) continue;
+	// 보드 로컬에서 후보 열만 확인 (보드는 Yaw 회전 + 균일 스케일)
+	// 로컬 스냅 거리는 오차 여유를 두고, 최종 판정은 기존과 같은 월드 2D 거리로
+	const float Scale = SceneRoot ? FMath::Max(SceneRoot->GetComponentScale().GetAbsMin(), UE_KINDA_SMALL_NUMBER) : 1.f;
+	const FVector Local = ToLocal(SceneRoot, World);
 
-			const FVector TileW = ToWorld(SceneRoot, PlayerField[i].Position); // 로컬→월드
-			const float d2 = FVector::DistSquared2D(TileW, World);
-			if (d2 < BestD2) { BestD2 = d2; BestY = y; BestX = x; }
-		}
-	}
+	int32 Col = INDEX_NONE, Row = INDEX_NONE;
+	if (!GetFieldLayout().FindNearestTile(FVector2D(Local), Snap / Scale * 1.01f + 1.f, Col, Row)) return false;
 
-	if (BestY == INDEX_NONE) return false;
+	const int32 i = IndexOf(Col, Row);
+	if (!PlayerField.IsValidIndex(i)) return false;
 
-	const float DefSnap = (FieldTileWidthX > 0.f) ? (FieldTileWidthX * 0.6f) : 120.f;
-	const float Snap    = (MaxSnapDist > 0.f) ? MaxSnapDist : DefSnap;
-	if (BestD2 > Snap * Snap) return false;
+	const FVector TileW = ToWorld(SceneRoot, PlayerField[i].Position); // 로컬→월드
+	if (FVector::DistSquared2D(TileW, World) > Snap * Snap) return false;
 
-	OutY = BestY; OutX = BestX;
+	OutY = Col; OutX = Row;
 	return true;
 }
 
 bool APCPlayerBoard::WorldToBench(const FVector& World, int32& OutLocalBenchIndex, float MaxSnapDist) const
 {
 	OutLocalBenchIndex = INDEX_NONE;
-	const int32 N = BenchSize;
+	const int32 N = FMath::Min(BenchSize, PlayerBench.Num());
+	if (N <= 0) return false;
+
+	// 벤치는 로컬 Y 축 일직선 (CreatePlayerBench) → 가장 가까운 칸은 Y 반올림
+	const FVector Local = ToLocal(SceneRoot, World);
+	const int32 Idx = FMath::IsNearlyZero(BenchStepLocalY) ? 0
+		: FMath::Clamp(FMath::RoundToInt((Local.Y - FirstBenchLoc.Y) / BenchStepLocalY), 0, N - 1);
 
-	float BestD2 = TNumericLimits<float>::Max();
-	int32 BestIdx = INDEX_NONE;
+	const float Snap = (MaxSnapDist > 0.f) ? MaxSnapDist : GetDefaultSnapDist();
+	const FVector TileW = ToWorld(SceneRoot, PlayerBench[Idx].Position); // 로컬→월드
+	if (FVector::DistSquared2D(TileW, World) > Snap * Snap) return false;
 
-	auto try_slot = [&](int32 Local, const FPlayerTile& T)
+	OutLocalBenchIndex = Idx;
+	return true;
+}
+
+bool APCPlayerBoard::DebugValidateWorldToTile(float SampleStep) const
+{
+#if !UE_BUILD_SHIPPING
+	SampleStep = FMath::Max(SampleStep, 1.f);
+
+	// 기존 방식 : 전체 타일을 월드로 변환해서 최근접
+	auto BruteForce = [this](const TArray<FPlayerTile>& Tiles, int32 Num, const FVector& World, float Snap)
 	{
-		const FVector TileW = ToWorld(SceneRoot, T.Position); // 로컬→월드
-		const float d2 = FVector::DistSquared2D(TileW, World);
-		if (d2 < BestD2) { BestD2 = d2; BestIdx = Local; }
+		float BestD2 = TNumericLimits<float>::Max();
+		int32 BestIdx = INDEX_NONE;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			if (!Tiles.IsValidIndex(i)) continue;
+			const float d2 = FVector::DistSquared2D(ToWorld(SceneRoot, Tiles[i].Position), World);
+			if (d2 < BestD2) { BestD2 = d2; BestIdx = i; }
+		}
+		return BestD2 <= Snap * Snap ? BestIdx : INDEX_NONE;
 	};
 
-	for (int32 i = 0; i < N; ++i)
-		if (PlayerBench.IsValidIndex(i)) try_slot(i, PlayerBench[i]);
+	// 샘플 범위 : 필드 + 벤치 타일 로컬 좌표의 AABB 에 타일 하나만큼 여유
+	FBox2D Bounds(ForceInit);
+	for (const FPlayerTile& Tile : PlayerField) Bounds += FVector2D(Tile.Position);
+	for (const FPlayerTile& Tile : PlayerBench) Bounds += FVector2D(Tile.Position);
+	if (!Bounds.bIsValid)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[PlayerBoard %d] WorldToTile validate skipped (no tiles)"), PlayerIndex);
+		return false;
+	}
+	Bounds = Bounds.ExpandBy(FieldTileWidthX);
+
+	TArray<FVector> Samples;
+	for (float LX = Bounds.Min.X; LX <= Bounds.Max.X; LX += SampleStep)
+	{
+		for (float LY = Bounds.Min.Y; LY <= Bounds.Max.Y; LY += SampleStep)
+		{
+			Samples.Add(ToWorld(SceneRoot, FVector(LX, LY, 0.f)));
+		}
+	}
+
+	const float Snap = GetDefaultSnapDist();
+	int32 Mismatch = 0;
+	for (const FVector& World : Samples)
+	{
+		int32 Y = INDEX_NONE, X = INDEX_NONE, Bench = INDEX_NONE;
+		const int32 Field = WorldToField(World, Y, X) ? IndexOf(Y, X) : INDEX_NONE;
+		WorldToBench(World, Bench);
 
-	if (BestIdx == INDEX_NONE) return false;
+		const int32 ExpectedField = BruteForce(PlayerField, PlayerField.Num(), World, Snap);
+		const int32 ExpectedBench = BruteForce(PlayerBench, BenchSize, World, Snap);
 
-	const float DefSnap = (FieldTileWidthX > 0.f) ? (FieldTileWidthX * 0.6f) : 120.f;
-	const float Snap    = (MaxSnapDist > 0.f) ? MaxSnapDist : DefSnap;
-	if (BestD2 > Snap * Snap) return false;
+		// 두 타일에서 정확히 같은 거리인 경계 샘플은 어느 쪽이든 허용
+		auto SameResult = [&](const TArray<FPlayerTile>& Tiles, int32 Actual, int32 Expected)
+		{
+			if (Actual == Expected) return true;
+			if (!Tiles.IsValidIndex(Actual) || !Tiles.IsValidIndex(Expected)) return false;
+			return FMath::IsNearlyEqual(
+				FVector::DistSquared2D(ToWorld(SceneRoot, Tiles[Actual].Position), World),
+				FVector::DistSquared2D(ToWorld(SceneRoot, Tiles[Expected].Position), World), 1.f);
+		};
+
+		if (!SameResult(PlayerField, Field, ExpectedField) || !SameResult(PlayerBench, Bench, ExpectedBench))
+		{
+			if (++Mismatch <= 10)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[PlayerBoard %d] WorldToTile mismatch at %s : Field %d (expected %d) Bench %d (expected %d)"),
+					PlayerIndex, *World.ToCompactString(), Field, ExpectedField, Bench, ExpectedBench);
+			}
+		}
+	}
 
-	OutLocalBenchIndex = BestIdx;
+	// 시간 비교
+	int32 Checksum = 0;
+	const double AnalyticStart = FPlatformTime::Seconds();
+	for (const FVector& World : Samples)
+	{
+		bool bField; int32 Y, X, Bench; FVector Snapped;
+		Checksum += WorldAnyTile(World, true, bField, Y, X, Bench, Snapped) ? 1 : 0;
+	}
+	const double AnalyticMs = (FPlatformTime::Seconds() - AnalyticStart) * 1000.0;
+
+	const double BruteStart = FPlatformTime::Seconds();
+	for (const FVector& World : Samples)
+	{
+		Checksum -= (BruteForce(PlayerField, PlayerField.Num(), World, Snap) != INDEX_NONE || BruteForce(PlayerBench, BenchSize, World, Snap) != INDEX_NONE) ? 1 : 0;
+	}
+	const double BruteMs = (FPlatformTime::Seconds() - BruteStart) * 1000.0;
+
+	UE_LOG(LogTemp, Log, TEXT("[PlayerBoard %d] WorldToTile validate %s : Samples=%d Mismatch=%d Analytic=%.3fms BruteForce=%.3fms (x%.1f) Checksum=%d"),
+		PlayerIndex, Mismatch == 0 ? TEXT("OK") : TEXT("FAILED"), Samples.Num(), Mismatch,
+		AnalyticMs, BruteMs, AnalyticMs > 0.0 ? BruteMs / AnalyticMs : 0.0, Checksum);
+	return Mismatch == 0;
+#else
 	return true;
+#endif
 }
 
 bool APCPlayerBoard::WorldAnyTile(const FVector& World, bool bPreferField, bool& bOutIsField, int32& OutY, int32& OutX,
@@ -748,7 +1130,7 @@ void APCPlayerBoard::ApplySnapshot(const FPlayerBoardSnapshot& In)
 {
 	const int32 NField = Rows*Cols;
 	for (int32 i=0;i<NField && i<In.FieldUnits.Num(); ++i)
-		if (PlayerField.IsValidIndex(i)) PlayerField[i].Unit = In.FieldUnits[i];
+		if (PlayerField.IsValidIndex(i)) SetFieldTileUnit(i, In.FieldUnits[i]);
 }
 
 FVector APCPlayerBoard::GetFieldWorldPos(int32 Y, int32 X) 
@@ -897,7 +1279,7 @@ void APCPlayerBoard::TryAutoFillFromBench_Server()
 		APCBaseUnitCharacter* Unit = PlayerBench[BenchIdx].Unit;
 		if (!IsValid(Unit))
 		{
-			PlayerBench[BenchIdx].Unit = nullptr;
+			SetBenchTileUnit(BenchIdx, nullptr);
 			continue;
 		}
 		
@@ -34,6 +34,8 @@ APCPlayerState::APCPlayerState()
 	NetUpdateFrequency = 100.f;
 	MinNetUpdateFrequency = 60.f;
 
+	ShopSlotArray.OwnerPlayerState = this;
+
 	AllStateTags.AddTag(PlayerGameplayTags::Player_State_Normal);
 	AllStateTags.AddTag(PlayerGameplayTags::Player_State_Carousel);
 	AllStateTags.AddTag(PlayerGameplayTags::Player_State_Dead);
@@ -71,7 +73,7 @@ void APCPlayerState::GetLifetimeReplicatedProps(TArray<class FLifetimeProperty>&
 	DOREPLIFETIME(APCPlayerState, bIsLeader);
 	DOREPLIFETIME(APCPlayerState, SeatIndex);
 	DOREPLIFETIME(APCPlayerState, bIdentified);
-	DOREPLIFETIME(APCPlayerState, ShopSlots);
+	DOREPLIFETIME_CONDITION(APCPlayerState, ShopSlotArray, COND_OwnerOnly);
 	DOREPLIFETIME(APCPlayerState, PlayerLevel);
 	DOREPLIFETIME(APCPlayerState, PlayerBoard);
 	DOREPLIFETIME(APCPlayerState, PlayerWinningStreak);
@@ -224,25 +226,104 @@ void APCPlayerState::ApplyRoundReward()
 	}
 }
 
-void APCPlayerState::OnRep_ShopSlots()
+void APCPlayerState::SetShopSlots(const TArray<FPCShopUnitData>& NewSlots)
+{
+	if (!HasAuthority())
+		return;
+
+	// 리롤 : 구매 표시를 초기화하고 유닛 / 구매 여부가 바뀐 칸만 Dirty
+	for (int32 SlotIndex = 0; SlotIndex < NewSlots.Num(); ++SlotIndex)
+	{
+		if (ShopSlotArray.SetSlot(SlotIndex, NewSlots[SlotIndex], false))
+		{
+			ApplyShopSlot(SlotIndex, NewSlots[SlotIndex], false);
+		}
+	}
+
+	if (ShopSlots.Num() > NewSlots.Num())
+	{
+		ShopSlotArray.Trim(NewSlots.Num());
+		ShopSlots.SetNum(NewSlots.Num());
+		PurchasedSlots.Reset();
+		bShopSlotLayoutDirty = true;
+	}
+
+	FlushShopSlotChanges();
+}
+
+void APCPlayerState::MarkShopSlotPurchased(int32 SlotIndex)
 {
-	OnShopSlotsUpdated.Broadcast();
+	if (!HasAuthority() || !ShopSlots.IsValidIndex(SlotIndex))
+		return;
+
+	if (ShopSlotArray.SetPurchased(SlotIndex, true))
+	{
+		ApplyShopSlot(SlotIndex, ShopSlots[SlotIndex], true);
+		FlushShopSlotChanges();
+	}
 }
 
-void APCPlayerState::Client_ForceShopSlotsUpdate_Implementation()
+void APCPlayerState::HandleShopSlotReplicated(const FPCShopSlotEntry& Entry)
 {
-	OnRep_ShopSlots();
+	ApplyShopSlot(Entry.SlotIndex, Entry.UnitData, Entry.bPurchased);
 }
 
-void APCPlayerState::SetShopSlots(const TArray<FPCShopUnitData>& NewSlots)
+void APCPlayerState::HandleShopSlotRemoved(const FPCShopSlotEntry& Entry)
+{
+	if (ShopSlots.IsValidIndex(Entry.SlotIndex))
+	{
+		ShopSlots.SetNum(Entry.SlotIndex);
+		bShopSlotLayoutDirty = true;
+	}
+}
+
+void APCPlayerState::HandleShopSlotsReceived()
+{
+	FlushShopSlotChanges();
+}
+
+void APCPlayerState::ApplyShopSlot(int32 SlotIndex, const FPCShopUnitData& UnitData, bool bPurchased)
 {
-	if (ShopSlots == NewSlots)
-		Client_ForceShopSlotsUpdate();
+	if (SlotIndex < 0)
+		return;
+
+	if (!ShopSlots.IsValidIndex(SlotIndex))
+	{
+		ShopSlots.SetNum(SlotIndex + 1);
+		bShopSlotLayoutDirty = true;
+	}
+
+	const bool bUnitChanged = !(ShopSlots[SlotIndex] == UnitData);
+	ShopSlots[SlotIndex] = UnitData;
+
+	if (bPurchased)
+	{
+		PurchasedSlots.Add(SlotIndex);
+	}
 	else
-		ShopSlots = NewSlots;
+	{
+		PurchasedSlots.Remove(SlotIndex);
+	}
 
-	if (HasAuthority())
-		OnRep_ShopSlots();
+	PendingShopSlotChanges.FindOrAdd(SlotIndex) |= bUnitChanged;
+}
+
+void APCPlayerState::FlushShopSlotChanges()
+{
+	if (bShopSlotLayoutDirty)
+	{
+		// 칸 개수가 바뀌면 위젯 전체 재구성
+		bShopSlotLayoutDirty = false;
+		PendingShopSlotChanges.Reset();
+		OnShopSlotsUpdated.Broadcast();
+		return;
+	}
+
+	for (const auto& Pair : PendingShopSlotChanges)
+	{
+		OnShopSlotChanged.Broadcast(Pair.Key, Pair.Value);
+	}
+	PendingShopSlotChanges.Reset();
 }
 
 const TArray<FPCShopUnitData>& APCPlayerState::GetShopSlots()
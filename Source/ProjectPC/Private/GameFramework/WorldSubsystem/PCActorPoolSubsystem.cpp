@@ -0,0 +1,248 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GameFramework/WorldSubsystem/PCActorPoolSubsystem.h"
+
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+
+namespace
+{
+	// 콘솔 : PC.Pool.Stats
+	FAutoConsoleCommandWithWorld GPCPoolStatsCommand(
+		TEXT("PC.Pool.Stats"),
+		TEXT("Dump actor pool stats (hits / misses / live / peak / pooled) for the current world."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (const UPCActorPoolSubsystem* PoolSubsystem = World ? World->GetSubsystem<UPCActorPoolSubsystem>() : nullptr)
+			{
+				PoolSubsystem->LogPoolStats();
+			}
+		}));
+}
+
+void UPCActorPoolSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(TrimTimerHandle);
+	}
+
+	// 통계는 PC.Pool.Stats 로만 출력 (월드 정리 때마다 로그가 남지 않도록)
+	Pools.Empty();
+	
+	Super::Deinitialize();
+}
+
+void UPCActorPoolSubsystem::RegisterPool(UClass* ActorClass, const FPCActorPoolConfig& Config)
+{
+	if (!ActorClass || !GetWorld())
+		return;
+
+	FPool& Pool = FindOrAddPool(ActorClass);
+	Pool.Config = Config;
+
+	// 부족한 만큼만 미리 생성
+	for (int32 i = Pool.FreeActors.Num(); i < Config.PrewarmCount; ++i)
+	{
+		if (AActor* Actor = SpawnPooledActor(ActorClass, FTransform::Identity))
+		{
+			PushFree(Pool, Actor);
+		}
+	}
+
+	if (Config.IdleTrimSeconds > 0.f)
+	{
+		EnsureTrimTimer();
+	}
+}
+
+AActor* UPCActorPoolSubsystem::Acquire(UClass* ActorClass, const FTransform& SpawnTransform)
+{
+	if (!ActorClass || !GetWorld())
+		return nullptr;
+
+	FPool& Pool = FindOrAddPool(ActorClass);
+	AActor* Actor = nullptr;
+
+	// 파괴된 액터가 섞여 있을 수 있으니 유효한 액터가 나올 때까지 꺼냄
+	while (!Actor && Pool.FreeActors.Num() > 0)
+	{
+		AActor* Candidate = Pool.FreeActors.Pop(EAllowShrinking::No).Get();
+		Pool.FreeSince.Pop(EAllowShrinking::No);
+		if (Candidate)
+		{
+			Pool.FreeSet.Remove(Candidate);
+		}
+		
+		if (IsValid(Candidate))
+		{
+			Actor = Candidate;
+		}
+	}
+
+	if (Actor)
+	{
+		++Pool.Stats.Hits;
+	}
+	else
+	{
+		++Pool.Stats.Misses;
+		Actor = SpawnPooledActor(ActorClass, SpawnTransform);
+		if (!Actor)
+			return nullptr;
+	}
+
+	Pool.LiveSet.Add(Actor);
+	Pool.Stats.PooledCount = Pool.FreeActors.Num();
+	Pool.Stats.LiveCount = Pool.LiveSet.Num();
+	Pool.Stats.PeakCount = FMath::Max(Pool.Stats.PeakCount, Pool.Stats.LiveCount);
+	
+	return Actor;
+}
+
+void UPCActorPoolSubsystem::Release(AActor* Actor)
+{
+	if (!IsValid(Actor))
+		return;
+
+	FPool& Pool = FindOrAddPool(Actor->GetClass());
+	if (Pool.FreeSet.Contains(Actor))
+		return;
+
+	Pool.LiveSet.Remove(Actor);
+	Pool.Stats.LiveCount = Pool.LiveSet.Num();
+
+	if (Pool.Config.MaxPooledCount > 0 && Pool.FreeActors.Num() >= Pool.Config.MaxPooledCount)
+	{
+		++Pool.Stats.Destroyed;
+		Actor->Destroy();
+		return;
+	}
+
+	PushFree(Pool, Actor);
+
+	if (Pool.Config.IdleTrimSeconds > 0.f)
+	{
+		EnsureTrimTimer();
+	}
+}
+
+bool UPCActorPoolSubsystem::GetPoolStats(UClass* ActorClass, FPCActorPoolStats& OutStats) const
+{
+	if (const FPool* Pool = Pools.Find(ActorClass))
+	{
+		OutStats = Pool->Stats;
+		return true;
+	}
+
+	return false;
+}
+
+void UPCActorPoolSubsystem::LogPoolStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("[ActorPool] %d pools"), Pools.Num());
+	
+	for (const auto& Pair : Pools)
+	{
+		const FPool& Pool = Pair.Value;
+		const FPCActorPoolStats& Stats = Pool.Stats;
+		const int64 Requests = Stats.Hits + Stats.Misses;
+		
+		UE_LOG(LogTemp, Log, TEXT("[ActorPool]   %s : Hits=%lld Misses=%lld (HitRate %.1f%%) Live=%d Peak=%d Pooled=%d Destroyed=%lld (Prewarm=%d Max=%d Trim=%.0fs)"),
+			*Pool.Name, Stats.Hits, Stats.Misses, Requests > 0 ? 100.0 * Stats.Hits / Requests : 0.0,
+			Stats.LiveCount, Stats.PeakCount, Stats.PooledCount, Stats.Destroyed,
+			Pool.Config.PrewarmCount, Pool.Config.MaxPooledCount, Pool.Config.IdleTrimSeconds);
+	}
+}
+
+AActor* UPCActorPoolSubsystem::SpawnPooledActor(UClass* ActorClass, const FTransform& SpawnTransform) const
+{
+	UWorld* World = GetWorld();
+	if (!World || !ActorClass)
+		return nullptr;
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Actor = World->SpawnActor<AActor>(ActorClass, SpawnTransform, Params);
+	if (Actor)
+	{
+		// 사용하기 전까지는 숨김, 실제 활성화는 각 액터가 처리
+		Actor->SetActorHiddenInGame(true);
+	}
+	
+	return Actor;
+}
+
+UPCActorPoolSubsystem::FPool& UPCActorPoolSubsystem::FindOrAddPool(UClass* ActorClass)
+{
+	if (FPool* Pool = Pools.Find(ActorClass))
+	{
+		return *Pool;
+	}
+
+	FPool& Pool = Pools.Add(ActorClass);
+	Pool.Name = GetNameSafe(ActorClass);
+	return Pool;
+}
+
+void UPCActorPoolSubsystem::PushFree(FPool& Pool, AActor* Actor)
+{
+	const UWorld* World = GetWorld();
+	
+	Pool.FreeActors.Add(Actor);
+	Pool.FreeSince.Add(World ? World->GetTimeSeconds() : 0.0);
+	Pool.FreeSet.Add(Actor);
+	Pool.Stats.PooledCount = Pool.FreeActors.Num();
+}
+
+void UPCActorPoolSubsystem::TrimIdle()
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	const double Now = World->GetTimeSeconds();
+	for (auto& Pair : Pools)
+	{
+		FPool& Pool = Pair.Value;
+		if (Pool.Config.IdleTrimSeconds <= 0.f)
+			continue;
+
+		// 앞쪽일수록 오래 쉬고 있는 액터 (LIFO 이므로)
+		const int32 KeepCount = FMath::Max(0, Pool.Config.PrewarmCount);
+		int32 NumToTrim = 0;
+		while (NumToTrim < Pool.FreeActors.Num() - KeepCount && Now - Pool.FreeSince[NumToTrim] >= Pool.Config.IdleTrimSeconds)
+		{
+			++NumToTrim;
+		}
+
+		for (int32 i = 0; i < NumToTrim; ++i)
+		{
+			if (AActor* Actor = Pool.FreeActors[i].Get())
+			{
+				Pool.FreeSet.Remove(Actor);
+				Actor->Destroy();
+			}
+			++Pool.Stats.Destroyed;
+		}
+
+		if (NumToTrim > 0)
+		{
+			Pool.FreeActors.RemoveAt(0, NumToTrim, EAllowShrinking::No);
+			Pool.FreeSince.RemoveAt(0, NumToTrim, EAllowShrinking::No);
+			Pool.Stats.PooledCount = Pool.FreeActors.Num();
+		}
+	}
+}
+
+void UPCActorPoolSubsystem::EnsureTrimTimer()
+{
+	UWorld* World = GetWorld();
+	if (!World || World->GetTimerManager().IsTimerActive(TrimTimerHandle))
+		return;
+
+	World->GetTimerManager().SetTimer(TrimTimerHandle, this, &UPCActorPoolSubsystem::TrimIdle, TrimCheckInterval, true);
+}
@@ -0,0 +1,206 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GameFramework/WorldSubsystem/PCBoardRelevancySubsystem.h"
+
+#include "Controller/Player/PCCombatPlayerController.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerState/PCPlayerState.h"
+#include "TimerManager.h"
+
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarPCBoardRelevancy(
+		TEXT("PC.Net.BoardRelevancy"),
+		true,
+		TEXT("유닛 / 발사체를 자기 보드를 보는 연결에만 복제 (0이면 기존 판정)"));
+
+#if !UE_BUILD_SHIPPING
+	// 콘솔 : PC.Net.MeasureBoardRelevancy [SampleSeconds]
+	FAutoConsoleCommandWithWorldAndArgs GPCMeasureBoardRelevancyCommand(
+		TEXT("PC.Net.MeasureBoardRelevancy"),
+		TEXT("Measure bytes sent per client connection with board relevancy off, then on. Args: [SampleSeconds=10]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UPCBoardRelevancySubsystem* Relevancy = World ? World->GetSubsystem<UPCBoardRelevancySubsystem>() : nullptr)
+			{
+				Relevancy->MeasureConnectionBandwidth(Args.IsValidIndex(0) ? FCString::Atof(*Args[0]) : 10.f);
+			}
+		}));
+#endif
+
+	FString GetConnectionName(const UNetConnection* Connection)
+	{
+		const APlayerController* PlayerController = Connection ? Connection->PlayerController.Get() : nullptr;
+		const APlayerState* PlayerState = PlayerController ? PlayerController->PlayerState.Get() : nullptr;
+		return PlayerState ? PlayerState->GetPlayerName() : GetNameSafe(Connection);
+	}
+}
+
+bool UPCBoardRelevancySubsystem::IsPolicyEnabled()
+{
+	return CVarPCBoardRelevancy.GetValueOnGameThread();
+}
+
+bool UPCBoardRelevancySubsystem::EvaluateRelevancy(const AActor* Actor, const AActor* RealViewer, int32 ActorBoardSeat,
+	int32 OwnerSeat, bool& bOutRelevant)
+{
+	bOutRelevant = true;
+
+	if (!IsPolicyEnabled() || !Actor || ActorBoardSeat == INDEX_NONE)
+		return false;
+
+	const APCCombatPlayerController* Viewer = Cast<APCCombatPlayerController>(RealViewer);
+	if (!Viewer)
+		return false;
+
+	// 소유 플레이어는 어느 보드를 보고 있든 자기 유닛을 받아야 함 (벤치 / 시너지 UI)
+	if (OwnerSeat != INDEX_NONE)
+	{
+		if (const APCPlayerState* ViewerPS = Viewer->GetPlayerState<APCPlayerState>())
+		{
+			if (ViewerPS->SeatIndex == OwnerSeat)
+				return true;
+		}
+	}
+
+	const int32 ViewedSeat = Viewer->GetViewedBoardSeatIndex();
+	if (ViewedSeat == INDEX_NONE)
+	{
+		// 캐러셀 등 보드를 보고 있지 않은 상태
+		bOutRelevant = false;
+		return true;
+	}
+
+	const UWorld* World = Actor->GetWorld();
+	const UPCBoardRelevancySubsystem* Relevancy = World ? World->GetSubsystem<UPCBoardRelevancySubsystem>() : nullptr;
+	if (!Relevancy)
+	{
+		bOutRelevant = ViewedSeat == ActorBoardSeat;
+		return true;
+	}
+
+	bOutRelevant = Relevancy->GetBoardGroup(ViewedSeat) == Relevancy->GetBoardGroup(ActorBoardSeat);
+	return true;
+}
+
+void UPCBoardRelevancySubsystem::LinkBoards(int32 GuestSeat, int32 HostSeat)
+{
+	if (GuestSeat < 0 || HostSeat < 0)
+		return;
+
+	const int32 MaxSeat = FMath::Max(GuestSeat, HostSeat);
+	while (BoardGroupBySeat.Num() <= MaxSeat)
+	{
+		BoardGroupBySeat.Add(BoardGroupBySeat.Num());
+	}
+
+	BoardGroupBySeat[GuestSeat] = GetBoardGroup(HostSeat);
+}
+
+void UPCBoardRelevancySubsystem::ResetBoardLinks()
+{
+	for (int32 Seat = 0; Seat < BoardGroupBySeat.Num(); ++Seat)
+	{
+		BoardGroupBySeat[Seat] = Seat;
+	}
+}
+
+int32 UPCBoardRelevancySubsystem::GetBoardGroup(int32 BoardSeat) const
+{
+	return BoardGroupBySeat.IsValidIndex(BoardSeat) ? BoardGroupBySeat[BoardSeat] : BoardSeat;
+}
+
+void UPCBoardRelevancySubsystem::MeasureConnectionBandwidth(float SampleSeconds)
+{
+#if !UE_BUILD_SHIPPING
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client || !World->GetNetDriver())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[BoardRelevancy] Measure must run on a server with client connections"));
+		return;
+	}
+
+	if (World->GetTimerManager().IsTimerActive(MeasureTimerHandle))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[BoardRelevancy] Measure already running"));
+		return;
+	}
+
+	SampleSeconds = FMath::Max(SampleSeconds, 1.f);
+	bPolicyBeforeMeasure = IsPolicyEnabled();
+	MeasuredBytesPerSecondOff.Reset();
+
+	// 1) 정책 Off
+	BeginMeasurePhase(false);
+	World->GetTimerManager().SetTimer(MeasureTimerHandle, FTimerDelegate::CreateWeakLambda(this, [this, SampleSeconds]()
+	{
+		EndMeasurePhase(false);
+
+		// 2) 정책 On
+		BeginMeasurePhase(true);
+		GetWorld()->GetTimerManager().SetTimer(MeasureTimerHandle, FTimerDelegate::CreateWeakLambda(this, [this, SampleSeconds]()
+		{
+			EndMeasurePhase(true);
+			CVarPCBoardRelevancy->Set(bPolicyBeforeMeasure, ECVF_SetByConsole);
+		}), SampleSeconds, false);
+	}), SampleSeconds, false);
+
+	UE_LOG(LogTemp, Log, TEXT("[BoardRelevancy] Measuring %d connections, %.0fs per phase"),
+		World->GetNetDriver()->ClientConnections.Num(), SampleSeconds);
+#endif
+}
+
+void UPCBoardRelevancySubsystem::BeginMeasurePhase(bool bPolicyEnabled)
+{
+	CVarPCBoardRelevancy->Set(bPolicyEnabled, ECVF_SetByConsole);
+
+	MeasureStartBytes.Reset();
+	MeasureStartTime = FPlatformTime::Seconds();
+
+	if (const UNetDriver* NetDriver = GetWorld() ? GetWorld()->GetNetDriver() : nullptr)
+	{
+		for (UNetConnection* Connection : NetDriver->ClientConnections)
+		{
+			if (Connection)
+			{
+				MeasureStartBytes.Add(Connection, Connection->OutTotalBytes);
+			}
+		}
+	}
+}
+
+void UPCBoardRelevancySubsystem::EndMeasurePhase(bool bPolicyEnabled)
+{
+	const double Elapsed = FMath::Max(FPlatformTime::Seconds() - MeasureStartTime, UE_KINDA_SMALL_NUMBER);
+	double TotalBytesPerSecond = 0.0;
+
+	for (const auto& Pair : MeasureStartBytes)
+	{
+		const UNetConnection* Connection = Pair.Key.Get();
+		if (!Connection)
+			continue;
+
+		const double BytesPerSecond = static_cast<double>(Connection->OutTotalBytes - Pair.Value) / Elapsed;
+		TotalBytesPerSecond += BytesPerSecond;
+
+		if (!bPolicyEnabled)
+		{
+			MeasuredBytesPerSecondOff.Add(Pair.Key, BytesPerSecond);
+			UE_LOG(LogTemp, Log, TEXT("[BoardRelevancy]   [Off] %s : %.0f B/s"), *GetConnectionName(Connection), BytesPerSecond);
+		}
+		else
+		{
+			const double* Before = MeasuredBytesPerSecondOff.Find(Pair.Key);
+			UE_LOG(LogTemp, Log, TEXT("[BoardRelevancy]   [On] %s : %.0f B/s (Off %.0f B/s, %+.1f%%)"),
+				*GetConnectionName(Connection), BytesPerSecond, Before ? *Before : 0.0,
+				(Before && *Before > 0.0) ? 100.0 * (BytesPerSecond - *Before) / *Before : 0.0);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[BoardRelevancy] Policy %s : total %.0f B/s over %d connections (%.1fs)"),
+		bPolicyEnabled ? TEXT("On") : TEXT("Off"), TotalBytesPerSecond, MeasureStartBytes.Num(), Elapsed);
+}
@@ -0,0 +1,481 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GameFramework/WorldSubsystem/PCCombatReplaySubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "Async/Async.h"
+#include "DrawDebugHelpers.h"
+#include "EngineUtils.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include "AbilitySystem/Unit/AttributeSet/PCUnitAttributeSet.h"
+#include "Character/Unit/PCBaseUnitCharacter.h"
+#include "GameFramework/HelpActor/PCCombatBoard.h"
+#include "GameFramework/HelpActor/Component/PCTileManager.h"
+#include "GameFramework/WorldSubsystem/PCMatchRandomSubsystem.h"
+
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarPCReplayRecord(
+		TEXT("PC.Replay.Record"),
+		false,
+		TEXT("서버에서 페어별 전투 리플레이를 Saved/CombatReplays 에 기록"));
+
+	TAutoConsoleVariable<int32> CVarPCReplayMaxFiles(
+		TEXT("PC.Replay.MaxFiles"),
+		200,
+		TEXT("Saved/CombatReplays 에 남길 최대 리플레이 파일 수 (초과분은 오래된 파일부터 삭제, 0 이하면 제한 없음)"));
+
+	// 최신 MaxFiles 개만 남기고 오래된 리플레이 파일 삭제
+	void PruneReplayDirectory(const FString& Directory, int32 MaxFiles)
+	{
+		if (MaxFiles <= 0)
+			return;
+
+		IFileManager& FileManager = IFileManager::Get();
+
+		TArray<FString> FileNames;
+		FileManager.FindFiles(FileNames, *FPaths::Combine(Directory, TEXT("*.pcreplay")), true, false);
+		if (FileNames.Num() <= MaxFiles)
+			return;
+
+		TArray<TPair<FDateTime, FString>> Files;
+		Files.Reserve(FileNames.Num());
+		for (const FString& FileName : FileNames)
+		{
+			const FString FullPath = FPaths::Combine(Directory, FileName);
+			Files.Emplace(FileManager.GetTimeStamp(*FullPath), FullPath);
+		}
+
+		Files.Sort([](const TPair<FDateTime, FString>& A, const TPair<FDateTime, FString>& B)
+		{
+			return A.Key < B.Key;
+		});
+
+		const int32 NumToDelete = Files.Num() - MaxFiles;
+		for (int32 i = 0; i < NumToDelete; ++i)
+		{
+			FileManager.Delete(*Files[i].Value, false, false, true);
+		}
+	}
+
+	// 기록 밖 유닛 (공격자를 알 수 없는 데미지 등)
+	constexpr uint16 UnknownUnitId = MAX_uint16;
+
+	FString ResolveReplayPath(const FString& Path)
+	{
+		if (FPaths::FileExists(Path))
+			return Path;
+
+		const FString InReplayDir = FPaths::Combine(UPCCombatReplaySubsystem::GetReplayDirectory(), Path);
+		return FPaths::FileExists(InReplayDir) ? InReplayDir : Path;
+	}
+
+	// 콘솔 : PC.Replay.Play <File> [Speed] [BoardSeat] [log]
+	FAutoConsoleCommandWithWorldAndArgs GPCReplayPlayCommand(
+		TEXT("PC.Replay.Play"),
+		TEXT("Play a combat replay on a combat board with debug drawing. Args: <File> [Speed=1] [BoardSeat=Host] [log]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UPCCombatReplaySubsystem* Replay = World ? World->GetSubsystem<UPCCombatReplaySubsystem>() : nullptr;
+			if (!Replay || !Args.IsValidIndex(0))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[Replay] Usage : PC.Replay.Play <File> [Speed] [BoardSeat] [log]"));
+				return;
+			}
+
+			Replay->PlayReplay(Args[0],
+				Args.IsValidIndex(1) ? FCString::Atof(*Args[1]) : 1.f,
+				Args.IsValidIndex(2) ? FCString::Atoi(*Args[2]) : INDEX_NONE,
+				Args.Contains(TEXT("log")));
+		}));
+
+	FAutoConsoleCommandWithWorld GPCReplayStopCommand(
+		TEXT("PC.Replay.Stop"),
+		TEXT("Stop combat replay playback"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UPCCombatReplaySubsystem* Replay = World ? World->GetSubsystem<UPCCombatReplaySubsystem>() : nullptr)
+			{
+				Replay->StopReplay();
+			}
+		}));
+
+	// 콘솔 : PC.Replay.Dump <File> [events]
+	FAutoConsoleCommandWithArgs GPCReplayDumpCommand(
+		TEXT("PC.Replay.Dump"),
+		TEXT("Rebuild a combat replay to the end and log the final state. Args: <File> [events]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			FPCCombatReplay Replay;
+			if (!Args.IsValidIndex(0) || !Replay.LoadFromFile(ResolveReplayPath(Args[0])))
+				return;
+
+			FPCCombatReplayPlayer Player(Replay);
+			if (Args.Contains(TEXT("events")))
+			{
+				for (const FPCReplayEvent& Event : Replay.Events)
+				{
+					UE_LOG(LogTemp, Log, TEXT("[Replay] %s"), *Player.DescribeEvent(Event));
+				}
+			}
+			Player.AdvanceToEnd();
+			Player.LogState();
+		}));
+}
+
+void UPCCombatReplaySubsystem::Deinitialize()
+{
+	EndAllPairs();
+	StopReplay();
+
+	Super::Deinitialize();
+}
+
+TStatId UPCCombatReplaySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPCCombatReplaySubsystem, STATGROUP_Tickables);
+}
+
+UPCCombatReplaySubsystem* UPCCombatReplaySubsystem::FindRecorder(const UObject* WorldContextObject)
+{
+	if (!CVarPCReplayRecord.GetValueOnGameThread())
+		return nullptr;
+
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World || World->GetNetMode() == NM_Client)
+		return nullptr;
+
+	UPCCombatReplaySubsystem* Recorder = World->GetSubsystem<UPCCombatReplaySubsystem>();
+	return Recorder && !Recorder->Recordings.IsEmpty() ? Recorder : nullptr;
+}
+
+FString UPCCombatReplaySubsystem::GetReplayDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("CombatReplays"));
+}
+
+void UPCCombatReplaySubsystem::BeginPair(int32 PairIndex, const APCCombatBoard* HostBoard, int32 GuestSeat,
+	EPCReplayPairKind PairKind, int32 StageOne, int32 RoundOne)
+{
+	UWorld* World = GetWorld();
+	if (!CVarPCReplayRecord.GetValueOnGameThread() || !World || World->GetNetMode() == NM_Client)
+		return;
+
+	const UPCTileManager* TM = HostBoard ? HostBoard->TileManager : nullptr;
+	if (!TM)
+		return;
+
+	// 같은 인덱스의 이전 기록이 닫히지 않았으면 먼저 저장
+	EndPair(PairIndex, EPCReplayResult::None);
+
+	FRecording& Recording = Recordings.Add(PairIndex);
+	Recording.StartTime = World->GetTimeSeconds();
+
+	FPCCombatReplay& Replay = Recording.Replay;
+	Replay.StageOne = StageOne;
+	Replay.RoundOne = RoundOne;
+	Replay.HostSeat = HostBoard->BoardSeatIndex;
+	Replay.GuestSeat = GuestSeat;
+	Replay.PairKind = PairKind;
+	Replay.Cols = TM->Cols;
+	Replay.Rows = TM->Rows;
+
+	if (UPCMatchRandomSubsystem* MatchRandom = World->GetSubsystem<UPCMatchRandomSubsystem>())
+	{
+		Replay.MatchSeed = MatchRandom->GetMatchSeed();
+	}
+
+	// 전투 중 뽑기가 일어나는 채널 상태 (Damage 는 이 보드의 하위 채널)
+	for (const FName ChannelName : { PCRandomChannels::Damage, PCRandomChannels::Pairing })
+	{
+		const int32 ChannelBoardSeat = ChannelName == PCRandomChannels::Damage ? HostBoard->BoardSeatIndex : INDEX_NONE;
+		if (const FPCRandomChannel* Channel = UPCMatchRandomSubsystem::FindBoardChannel(this, ChannelName, ChannelBoardSeat))
+		{
+			FPCReplaySeed& Seed = Replay.Seeds.AddDefaulted_GetRef();
+			Seed.NameIndex = Replay.FindOrAddName(ChannelName);
+			Seed.Seed = Channel->GetInitialSeed();
+			Seed.DrawCount = Channel->GetDrawCount();
+		}
+	}
+
+	// 초기 스냅샷 : 전장 타일 순서대로
+	for (int32 TileIndex = 0; TileIndex < TM->Field.Num(); ++TileIndex)
+	{
+		APCBaseUnitCharacter* Unit = TM->Field[TileIndex].Unit;
+		if (!IsValid(Unit) || UnitRoutes.Contains(Unit) || Replay.Units.Num() >= UnknownUnitId)
+			continue;
+
+		FPCReplayUnit& ReplayUnit = Replay.Units.AddDefaulted_GetRef();
+		ReplayUnit.TagNameIndex = Replay.FindOrAddName(Unit->GetUnitTag().GetTagName());
+		ReplayUnit.Level = Unit->GetUnitLevel();
+		ReplayUnit.Team = Unit->GetTeamIndex();
+		ReplayUnit.TileIndex = TileIndex;
+
+		FUnitRoute& Route = UnitRoutes.Add(Unit);
+		Route.PairIndex = PairIndex;
+		Route.UnitId = static_cast<uint16>(Replay.Units.Num() - 1);
+
+		if (UAbilitySystemComponent* ASC = Unit->GetAbilitySystemComponent())
+		{
+			ReplayUnit.MaxHealth = ASC->GetNumericAttribute(UPCUnitAttributeSet::GetMaxHealthAttribute());
+			ReplayUnit.Health = ASC->GetNumericAttribute(UPCUnitAttributeSet::GetCurrentHealthAttribute());
+
+			const FDelegateHandle Handle = ASC->AbilityActivatedCallbacks.AddUObject(this, &ThisClass::HandleAbilityActivated);
+			Recording.AbilityBindings.Emplace(ASC, Handle);
+		}
+	}
+}
+
+void UPCCombatReplaySubsystem::EndPair(int32 PairIndex, EPCReplayResult Result)
+{
+	FRecording* Recording = Recordings.Find(PairIndex);
+	if (!Recording)
+		return;
+
+	const UWorld* World = GetWorld();
+	const double Elapsed = World ? World->GetTimeSeconds() - Recording->StartTime : 0.0;
+	Recording->Replay.Result = Result;
+	Recording->Replay.DurationMs = static_cast<uint32>(FMath::Max(0.0, Elapsed) * 1000.0);
+
+	for (const auto& Binding : Recording->AbilityBindings)
+	{
+		if (UAbilitySystemComponent* ASC = Binding.Key.Get())
+		{
+			ASC->AbilityActivatedCallbacks.Remove(Binding.Value);
+		}
+	}
+
+	for (auto It = UnitRoutes.CreateIterator(); It; ++It)
+	{
+		if (It.Value().PairIndex == PairIndex)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	SaveRecording(*Recording);
+	Recordings.Remove(PairIndex);
+}
+
+void UPCCombatReplaySubsystem::EndAllPairs()
+{
+	TArray<int32> PairIndices;
+	Recordings.GetKeys(PairIndices);
+	for (const int32 PairIndex : PairIndices)
+	{
+		EndPair(PairIndex, EPCReplayResult::None);
+	}
+}
+
+UPCCombatReplaySubsystem::FRecording* UPCCombatReplaySubsystem::FindRecording(const AActor* Unit, uint16& OutUnitId)
+{
+	OutUnitId = UnknownUnitId;
+
+	const FUnitRoute* Route = Unit ? UnitRoutes.Find(Unit) : nullptr;
+	if (!Route)
+		return nullptr;
+
+	OutUnitId = Route->UnitId;
+	return Recordings.Find(Route->PairIndex);
+}
+
+void UPCCombatReplaySubsystem::AddEvent(FRecording& Recording, FPCReplayEvent& Event) const
+{
+	const UWorld* World = GetWorld();
+	const double Elapsed = World ? World->GetTimeSeconds() - Recording.StartTime : 0.0;
+	Event.TimeMs = static_cast<uint32>(FMath::Max(0.0, Elapsed) * 1000.0);
+	Recording.Replay.Events.Add(Event);
+}
+
+void UPCCombatReplaySubsystem::RecordMove(const APCBaseUnitCharacter* Unit, int32 TileIndex)
+{
+	uint16 UnitId;
+	if (FRecording* Recording = FindRecording(Unit, UnitId))
+	{
+		FPCReplayEvent Event;
+		Event.Type = EPCReplayEventType::Move;
+		Event.Unit = UnitId;
+		Event.Value = static_cast<uint32>(FMath::Max(0, TileIndex));
+		AddEvent(*Recording, Event);
+	}
+}
+
+void UPCCombatReplaySubsystem::RecordDamage(const AActor* Source, const AActor* Target, float Damage, uint8 DamageFlags)
+{
+	uint16 TargetId;
+	FRecording* Recording = FindRecording(Target, TargetId);
+	if (!Recording)
+		return;
+
+	// 공격자는 같은 페어에 기록된 유닛일 때만 연결
+	uint16 SourceId;
+	if (FindRecording(Source, SourceId) != Recording)
+	{
+		SourceId = UnknownUnitId;
+	}
+
+	FPCReplayEvent Event;
+	Event.Type = EPCReplayEventType::Damage;
+	Event.Flags = DamageFlags;
+	Event.Unit = SourceId;
+	Event.Target = TargetId;
+	Event.Value = static_cast<uint32>(FMath::Max(0, FMath::RoundToInt(Damage * 10.f)));
+	AddEvent(*Recording, Event);
+}
+
+void UPCCombatReplaySubsystem::RecordDeath(const APCBaseUnitCharacter* Unit)
+{
+	uint16 UnitId;
+	if (FRecording* Recording = FindRecording(Unit, UnitId))
+	{
+		FPCReplayEvent Event;
+		Event.Type = EPCReplayEventType::Death;
+		Event.Unit = UnitId;
+		AddEvent(*Recording, Event);
+	}
+}
+
+void UPCCombatReplaySubsystem::HandleAbilityActivated(UGameplayAbility* Ability)
+{
+	if (!Ability)
+		return;
+
+	uint16 UnitId;
+	if (FRecording* Recording = FindRecording(Ability->GetAvatarActorFromActorInfo(), UnitId))
+	{
+		FPCReplayEvent Event;
+		Event.Type = EPCReplayEventType::Ability;
+		Event.Unit = UnitId;
+		Event.Value = static_cast<uint32>(Recording->Replay.FindOrAddName(Ability->GetClass()->GetFName()));
+		AddEvent(*Recording, Event);
+	}
+}
+
+void UPCCombatReplaySubsystem::SaveRecording(FRecording& Recording) const
+{
+	const FPCCombatReplay& Replay = Recording.Replay;
+
+	TArray<uint8> Bytes;
+	if (!Replay.SaveToBytes(Bytes))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Replay] Failed to encode replay (Stage %d-%d Seat %d)"), Replay.StageOne, Replay.RoundOne, Replay.HostSeat);
+		return;
+	}
+
+	const FString Path = FPaths::Combine(GetReplayDirectory(),
+		FString::Printf(TEXT("M%d_S%d-%d_Seat%d.pcreplay"), Replay.MatchSeed, Replay.StageOne, Replay.RoundOne, Replay.HostSeat));
+
+	UE_LOG(LogTemp, Log, TEXT("[Replay] Saved %s : Units=%d Events=%d Duration=%.1fs Bytes=%d"),
+		*FPaths::GetCleanFilename(Path), Replay.Units.Num(), Replay.Events.Num(), Replay.DurationMs / 1000.0, Bytes.Num());
+
+	// 파일 쓰기와 보관 개수 정리는 게임 스레드 밖에서
+	const int32 MaxFiles = CVarPCReplayMaxFiles.GetValueOnGameThread();
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Path, Bytes = MoveTemp(Bytes), MaxFiles]()
+	{
+		if (!FFileHelper::SaveArrayToFile(Bytes, *Path))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[Replay] Failed to write %s"), *Path);
+			return;
+		}
+
+		PruneReplayDirectory(FPaths::GetPath(Path), MaxFiles);
+	});
+}
+
+bool UPCCombatReplaySubsystem::PlayReplay(const FString& Path, float Speed, int32 BoardSeat, bool bLogEvents)
+{
+	TUniquePtr<FPlayback> NewPlayback = MakeUnique<FPlayback>();
+	NewPlayback->Replay = MakeUnique<FPCCombatReplay>();
+	if (!NewPlayback->Replay->LoadFromFile(ResolveReplayPath(Path)))
+		return false;
+
+	NewPlayback->Player = MakeUnique<FPCCombatReplayPlayer>(*NewPlayback->Replay);
+	NewPlayback->Speed = FMath::Max(Speed, 0.01f);
+	NewPlayback->bLogEvents = bLogEvents;
+
+	const int32 Seat = BoardSeat != INDEX_NONE ? BoardSeat : NewPlayback->Replay->HostSeat;
+	for (TActorIterator<APCCombatBoard> It(GetWorld()); It; ++It)
+	{
+		if (It->BoardSeatIndex == Seat)
+		{
+			NewPlayback->Board = *It;
+			break;
+		}
+	}
+
+	if (!NewPlayback->Board.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Replay] No combat board for seat %d, playing without drawing"), Seat);
+	}
+
+	Playback = MoveTemp(NewPlayback);
+	Playback->Player->LogState();
+	return true;
+}
+
+void UPCCombatReplaySubsystem::StopReplay()
+{
+	Playback.Reset();
+}
+
+void UPCCombatReplaySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!Playback)
+		return;
+
+	FPCCombatReplayPlayer& Player = *Playback->Player;
+	const int32 FirstEvent = Player.GetNextEventIndex();
+
+	Playback->TimeMs += DeltaTime * 1000.0 * Playback->Speed;
+	Player.AdvanceTo(static_cast<uint32>(FMath::Min(Playback->TimeMs, static_cast<double>(MAX_uint32))));
+
+	if (Playback->bLogEvents)
+	{
+		const TArray<FPCReplayEvent>& Events = Playback->Replay->Events;
+		for (int32 i = FirstEvent; i < Player.GetNextEventIndex(); ++i)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[Replay] %s"), *Player.DescribeEvent(Events[i]));
+		}
+	}
+
+	DrawPlayback();
+
+	if (Player.IsFinished() && Playback->TimeMs >= Playback->Replay->DurationMs)
+	{
+		Player.LogState();
+		StopReplay();
+	}
+}
+
+void UPCCombatReplaySubsystem::DrawPlayback() const
+{
+	const APCCombatBoard* Board = Playback ? Playback->Board.Get() : nullptr;
+	const UPCTileManager* TM = Board ? Board->TileManager : nullptr;
+	if (!TM)
+		return;
+
+	const FPCCombatReplay& Replay = *Playback->Replay;
+	const TArray<FPCCombatReplayPlayer::FUnitState>& States = Playback->Player->GetUnitStates();
+	for (int32 UnitId = 0; UnitId < States.Num(); ++UnitId)
+	{
+		const FPCCombatReplayPlayer::FUnitState& State = States[UnitId];
+		if (!State.bAlive || State.TileIndex < 0 || Replay.Rows <= 0)
+			continue;
+
+		const FVector Location = TM->GetTileWorldPosition(State.TileIndex / Replay.Rows, State.TileIndex % Replay.Rows) + FVector(0.f, 0.f, 60.f);
+		const FColor Color = Replay.Units[UnitId].Team == Replay.HostSeat ? FColor::Green : FColor::Red;
+		const float HealthRatio = Replay.Units[UnitId].MaxHealth > 0.f ? State.Health / Replay.Units[UnitId].MaxHealth : 0.f;
+
+		DrawDebugSphere(GetWorld(), Location, 40.f, 12, Color, false, 0.f);
+		DrawDebugString(GetWorld(), Location + FVector(0.f, 0.f, 60.f),
+			FString::Printf(TEXT("%s %.0f%%"), *Playback->Player->GetUnitLabel(UnitId), HealthRatio * 100.f), nullptr, Color, 0.f);
+	}
+}
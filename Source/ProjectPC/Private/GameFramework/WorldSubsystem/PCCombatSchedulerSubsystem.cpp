@@ -0,0 +1,185 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GameFramework/WorldSubsystem/PCCombatSchedulerSubsystem.h"
+
+#include "Engine/World.h"
+
+DECLARE_STATS_GROUP(TEXT("PCCombatScheduler"), STATGROUP_PCCombatScheduler, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Scheduler Tick"), STAT_PCCombatScheduler_Tick, STATGROUP_PCCombatScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Jobs Run Per Frame"), STAT_PCCombatScheduler_JobsRun, STATGROUP_PCCombatScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Jobs"), STAT_PCCombatScheduler_ActiveJobs, STATGROUP_PCCombatScheduler);
+
+
+namespace
+{
+	// 콘솔 : PC.Scheduler.Stats
+	FAutoConsoleCommandWithWorld GPCSchedulerStatsCommand(
+		TEXT("PC.Scheduler.Stats"),
+		TEXT("Dump combat scheduler stats (jobs run / time spent per job type) for the current world."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (const UPCCombatSchedulerSubsystem* Scheduler = World ? World->GetSubsystem<UPCCombatSchedulerSubsystem>() : nullptr)
+			{
+				Scheduler->LogSchedulerStats();
+			}
+		}));
+}
+
+void UPCCombatSchedulerSubsystem::Deinitialize()
+{
+	// 통계는 PC.Scheduler.Stats 로만 출력 (에디터 / PIE 월드 정리 때마다 로그가 남지 않도록)
+	Jobs.Empty();
+	Schedule.Empty();
+	StatsByType.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UPCCombatSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPCCombatSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+double UPCCombatSchedulerSubsystem::GetNow() const
+{
+	// 타이머 매니저와 동일하게 일시정지 / 시간 배율이 적용된 월드 시간 기준
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+FPCCombatJobHandle UPCCombatSchedulerSubsystem::RegisterJob(FName JobType, const UObject* Owner, float PeriodSeconds,
+	float PhaseSeconds, TFunction<void()>&& Callback)
+{
+	FPCCombatJobHandle Handle;
+	if (!Owner || !Callback)
+		return Handle;
+
+	Handle.Id = NextJobId++;
+	if (NextJobId == 0)
+		NextJobId = 1;
+
+	FJob& Job = *Jobs.Add(Handle.Id, MakeShared<FJob, ESPMode::NotThreadSafe>());
+	Job.JobType = JobType;
+	Job.Owner = Owner;
+	Job.PeriodSeconds = FMath::Max(static_cast<double>(PeriodSeconds), UE_KINDA_SMALL_NUMBER);
+	Job.NextRunTime = GetNow() + FMath::Max(PhaseSeconds, 0.f);
+	Job.Callback = MoveTemp(Callback);
+
+	Schedule.HeapPush({ Job.NextRunTime, Handle.Id });
+	StatsByType.FindOrAdd(JobType);
+
+	return Handle;
+}
+
+void UPCCombatSchedulerSubsystem::UnregisterJob(FPCCombatJobHandle& Handle)
+{
+	if (Handle.IsValid())
+	{
+		// 힙 항목은 다음에 꺼낼 때 버려짐
+		Jobs.Remove(Handle.Id);
+	}
+
+	Handle.Invalidate();
+}
+
+void UPCCombatSchedulerSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PCCombatScheduler_Tick);
+
+	Super::Tick(DeltaTime);
+
+	const double Now = GetNow();
+
+	// 1) 실행 시점이 된 작업 수집 후 다음 실행 시각 예약
+	DueJobs.Reset();
+	while (Schedule.Num() > 0 && Schedule.HeapTop().RunTime <= Now)
+	{
+		FScheduleEntry Entry;
+		Schedule.HeapPop(Entry, EAllowShrinking::No);
+
+		const TSharedPtr<FJob, ESPMode::NotThreadSafe>* JobPtr = Jobs.Find(Entry.JobId);
+		FJob* Job = JobPtr ? JobPtr->Get() : nullptr;
+		if (!Job || Job->NextRunTime != Entry.RunTime)
+			continue;
+
+		if (!Job->Owner.IsValid())
+		{
+			Jobs.Remove(Entry.JobId);
+			continue;
+		}
+
+		// 주기 누적으로 드리프트 없이 예약, 한 주기 이상 밀렸으면 현재 기준으로 다시 맞춤
+		Job->NextRunTime += Job->PeriodSeconds;
+		if (Job->NextRunTime <= Now)
+		{
+			Job->NextRunTime = Now + Job->PeriodSeconds;
+		}
+		Schedule.HeapPush({ Job->NextRunTime, Entry.JobId });
+
+		DueJobs.Emplace(Job->JobType, Entry.JobId);
+	}
+
+	for (auto& Pair : StatsByType)
+	{
+		Pair.Value.LastFrameRuns = 0;
+	}
+
+	SET_DWORD_STAT(STAT_PCCombatScheduler_JobsRun, DueJobs.Num());
+	SET_DWORD_STAT(STAT_PCCombatScheduler_ActiveJobs, Jobs.Num());
+
+	if (DueJobs.IsEmpty())
+		return;
+
+	PeakJobsPerFrame = FMath::Max(PeakJobsPerFrame, DueJobs.Num());
+
+	// 2) 같은 타입끼리 묶어서 실행 (타입 단위로 시간 측정)
+	DueJobs.StableSort([](const TPair<FName, uint32>& A, const TPair<FName, uint32>& B)
+	{
+		return A.Key.FastLess(B.Key);
+	});
+
+	int32 Index = 0;
+	while (Index < DueJobs.Num())
+	{
+		const FName JobType = DueJobs[Index].Key;
+		const double BatchStart = FPlatformTime::Seconds();
+		int32 NumRun = 0;
+
+		for (; Index < DueJobs.Num() && DueJobs[Index].Key == JobType; ++Index)
+		{
+			// 앞선 작업의 콜백에서 해제됐을 수 있으므로 매번 다시 조회
+			const TSharedPtr<FJob, ESPMode::NotThreadSafe>* JobPtr = Jobs.Find(DueJobs[Index].Value);
+			if (!JobPtr || !(*JobPtr)->Owner.IsValid())
+				continue;
+
+			// 콜백 안에서 자신을 해제해도 실행이 끝날 때까지 유지
+			const TSharedPtr<FJob, ESPMode::NotThreadSafe> Job = *JobPtr;
+			Job->Callback();
+			++NumRun;
+		}
+
+		const double Elapsed = FPlatformTime::Seconds() - BatchStart;
+
+		FJobTypeStats& Stats = StatsByType.FindOrAdd(JobType);
+		Stats.TotalRuns += NumRun;
+		Stats.TotalSeconds += Elapsed;
+		Stats.LastFrameRuns += NumRun;
+		Stats.MaxFrameSeconds = FMath::Max(Stats.MaxFrameSeconds, Elapsed);
+	}
+}
+
+void UPCCombatSchedulerSubsystem::LogSchedulerStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("[CombatScheduler] ActiveJobs=%d PeakJobsPerFrame=%d"), Jobs.Num(), PeakJobsPerFrame);
+
+	for (const auto& Pair : StatsByType)
+	{
+		const FJobTypeStats& Stats = Pair.Value;
+
+		UE_LOG(LogTemp, Log, TEXT("[CombatScheduler]   %s : Runs=%lld Total=%.3f ms Avg=%.4f ms MaxFrame=%.3f ms LastFrameRuns=%d"),
+			*Pair.Key.ToString(), Stats.TotalRuns, Stats.TotalSeconds * 1000.0,
+			Stats.TotalRuns > 0 ? Stats.TotalSeconds * 1000.0 / Stats.TotalRuns : 0.0,
+			Stats.MaxFrameSeconds * 1000.0, Stats.LastFrameRuns);
+	}
+}
@@ -5,6 +5,8 @@
 
 #include "BaseGameplayTags.h"
 #include "DataAsset/Item/PCDataAsset_ItemEffect.h"
+#include "GameFramework/WorldSubsystem/PCMatchRandomSubsystem.h"
+#include "Utility/PCAsyncLoad.h"
 
 
 void UPCItemManagerSubsystem::InitializeItemManager(UDataTable* ItemDataTable, UDataTable* ItemCombineDataTable)
@@ -22,6 +24,9 @@ void UPCItemManagerSubsystem::InitializeItemManager(UDataTable* ItemDataTable, U
 			[](const FPCItemCombineData* Row) { return FBaseItemPair(Row->ItemTag1, Row->ItemTag2); },
 			[](const FPCItemCombineData* Row) { return Row->ResultItemTag; },
 			TEXT("Loading Item Combine Data"));
+
+		// 첫 전투에서 장착 아이콘을 동기 로드하지 않도록 미리 비동기 로드
+		PrefetchItemTextures();
 	}
 }
 
@@ -82,7 +87,8 @@ FGameplayTag UPCItemManagerSubsystem::GetRandomBaseItem() const
 	// 랜덤 인덱스를 뽑아서 해당 인덱스의 제료 아이템이 유효하면 ItemTag return
 	if (AllBaseItemTags.Num() > 0)
 	{
-		int32 RandomIndex = FMath::RandHelper(AllBaseItemTags.Num());
+		const FPCRandomChannel* ItemRandom = UPCMatchRandomSubsystem::FindChannel(this, PCRandomChannels::ItemDrop);
+		int32 RandomIndex = ItemRandom ? ItemRandom->RandHelper(AllBaseItemTags.Num()) : FMath::RandHelper(AllBaseItemTags.Num());
 
 		if (const auto NewItem = GetItemData(AllBaseItemTags.GetByIndex(RandomIndex)))
 		{
@@ -107,7 +113,8 @@ FGameplayTag UPCItemManagerSubsystem::GetRandomAdvancedItem() const
 	// 랜덤 인덱스를 뽑아서 해당 인덱스의 완성 아이템이 유효하면 ItemTag 리턴
 	if (AllAdvancedItemTags.Num() > 0)
 	{
-		int32 RandomIndex = FMath::RandHelper(AllAdvancedItemTags.Num());
+		const FPCRandomChannel* ItemRandom = UPCMatchRandomSubsystem::FindChannel(this, PCRandomChannels::ItemDrop);
+		int32 RandomIndex = ItemRandom ? ItemRandom->RandHelper(AllAdvancedItemTags.Num()) : FMath::RandHelper(AllAdvancedItemTags.Num());
 
 		if (const auto NewItem = GetItemData(AllAdvancedItemTags.GetByIndex(RandomIndex)))
 		{
@@ -145,15 +152,73 @@ UTexture2D* UPCItemManagerSubsystem::GetItemTexture(const FGameplayTag& ItemTag)
 	UTexture2D* ItemTexture = ItemTextureMap.FindRef(ItemTag);
 	if (!ItemTexture)
 	{
-		if (const FPCItemData* ItemData = ItemDataMap.Find(ItemTag))
+		RequestItemTexture(ItemTag, [](UTexture2D*) { });
+		ItemTexture = ItemTextureMap.FindRef(ItemTag);
+	}
+
+	return ItemTexture;
+}
+
+void UPCItemManagerSubsystem::RequestItemTexture(const FGameplayTag& ItemTag, TFunction<void(UTexture2D*)>&& OnLoaded)
+{
+	if (!ItemTag.IsValid() || !ItemTag.MatchesTag(ItemTags::Item))
+	{
+		OnLoaded(nullptr);
+		return;
+	}
+	
+	if (UTexture2D* ItemTexture = ItemTextureMap.FindRef(ItemTag))
+	{
+		OnLoaded(ItemTexture);
+		return;
+	}
+
+	const FPCItemData* ItemData = ItemDataMap.Find(ItemTag);
+	if (!ItemData)
+	{
+		OnLoaded(nullptr);
+		return;
+	}
+
+	// 같은 텍스처를 이미 로드 중이면 콜백만 추가
+	if (TArray<TFunction<void(UTexture2D*)>>* Pending = PendingItemTextureCallbacks.Find(ItemTag))
+	{
+		Pending->Add(MoveTemp(OnLoaded));
+		return;
+	}
+	PendingItemTextureCallbacks.Add(ItemTag).Add(MoveTemp(OnLoaded));
+
+	TWeakObjectPtr<UPCItemManagerSubsystem> WeakThis = this;
+	PCAsyncLoad::RequestAsyncLoad(ItemData->ItemTexture.ToSoftObjectPath(), TEXT("ItemTexture"),
+		[WeakThis, ItemTag](UObject* Loaded)
 		{
-			ItemTexture = ItemData->ItemTexture.LoadSynchronous();
+			UPCItemManagerSubsystem* This = WeakThis.Get();
+			if (!This)
+				return;
+
+			UTexture2D* ItemTexture = Cast<UTexture2D>(Loaded);
 			if (ItemTexture)
 			{
-				ItemTextureMap.Add(ItemTag, ItemTexture);
+				This->ItemTextureMap.Add(ItemTag, ItemTexture);
 			}
-		}
-	}
+			
+			TArray<TFunction<void(UTexture2D*)>> Callbacks;
+			This->PendingItemTextureCallbacks.RemoveAndCopyValue(ItemTag, Callbacks);
+			for (const TFunction<void(UTexture2D*)>& Callback : Callbacks)
+			{
+				Callback(ItemTexture);
+			}
+		});
+}
 
-	return ItemTexture;
+void UPCItemManagerSubsystem::PrefetchItemTextures()
+{
+	// 텍스처는 UI 전용이므로 데디서버는 로드하지 않음
+	if (!GetWorld() || GetWorld()->GetNetMode() == NM_DedicatedServer)
+		return;
+
+	for (const auto& ItemDataPair : ItemDataMap)
+	{
+		RequestItemTexture(ItemDataPair.Key, [](UTexture2D*) { });
+	}
 }
@@ -0,0 +1,526 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GameFramework/WorldSubsystem/PCLoadTestSubsystem.h"
+
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+
+#include "AbilitySystem/Player/AttributeSet/PCPlayerAttributeSet.h"
+#include "BaseGameplayTags.h"
+#include "Character/Player/PCPlayerCharacter.h"
+#include "Character/Unit/PCBaseUnitCharacter.h"
+#include "Controller/Player/PCCombatPlayerController.h"
+#include "GameFramework/GameMode/PCCombatGameMode.h"
+#include "GameFramework/GameState/PCCombatGameState.h"
+#include "GameFramework/HelpActor/PCCarouselRing.h"
+#include "GameFramework/HelpActor/PCPlayerBoard.h"
+#include "GameFramework/PlayerState/PCPlayerState.h"
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
+#include "Item/PCPlayerInventory.h"
+
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+	// 봇 판단 주기 (사람 클릭 간격 정도)
+	constexpr float MinThinkInterval = 0.3f;
+	constexpr float MaxThinkInterval = 0.9f;
+
+	// 회전초밥 링 중심에서 이 거리 안으로 들어가면 픽 요청
+	constexpr float CarouselPickRadius = 400.f;
+
+	// 매치 종료 후 마지막 통계 / 로그를 남기고 종료하기까지 대기
+	constexpr float BotExitDelay = 3.f;
+
+	// 봇 클라는 프로세스당 한 번만 실행
+	bool GBotClientsLaunched = false;
+	bool GBotExitHooksBound = false;
+
+	void RequestBotExit(const TCHAR* Reason)
+	{
+		if (IsEngineExitRequested())
+			return;
+
+		UE_LOG(LogTemp, Log, TEXT("[LoadTest] Bot %s exiting : %s"), *UPCLoadTestSubsystem::GetBotName(), Reason);
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+bool UPCLoadTestSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer);
+}
+
+void UPCLoadTestSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (IsBotClient())
+	{
+		BindBotExitOnNetworkFailure();
+	}
+
+	if (InWorld.GetNetMode() == NM_Client)
+	{
+		bBot = IsBotClient();
+		if (bBot)
+		{
+			Random.Initialize(static_cast<int32>(GetTypeHash(GetBotName())));
+			NextThinkTime = InWorld.GetTimeSeconds() + Random.FRandRange(MinThinkInterval, MaxThinkInterval);
+			UE_LOG(LogTemp, Log, TEXT("[LoadTest] Bot client %s"), *GetBotName());
+		}
+		return;
+	}
+
+	const int32 NumPlayers = GetLoadTestPlayerCount();
+	if (NumPlayers <= 0 || !Cast<APCCombatGameMode>(InWorld.GetAuthGameMode()))
+		return;
+
+	if (UPCServerTelemetrySubsystem* Telemetry = InWorld.GetSubsystem<UPCServerTelemetrySubsystem>())
+	{
+		if (!Telemetry->IsCapturing())
+		{
+			Telemetry->StartCapture(FString::Printf(TEXT("LoadTest%d"), NumPlayers));
+		}
+	}
+
+	int32 NumBots = NumPlayers;
+	FParse::Value(FCommandLine::Get(), TEXT("PCBotCount="), NumBots);
+
+	if (!GBotClientsLaunched && NumBots > 0)
+	{
+		GBotClientsLaunched = true;
+		LaunchBotClients(FMath::Min(NumBots, NumPlayers));
+	}
+}
+
+void UPCLoadTestSubsystem::Deinitialize()
+{
+	if (bBot)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[LoadTest] Bot %s : Buys %d, Rerolls %d, BuyXP %d, Drags %d, Equips %d, CarouselPicks %d"),
+			*GetBotName(), Stats.Buys, Stats.Rerolls, Stats.BuyXPs, Stats.Drags, Stats.Equips, Stats.CarouselPicks);
+	}
+
+	TerminateBotClients();
+
+	Super::Deinitialize();
+}
+
+TStatId UPCLoadTestSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPCLoadTestSubsystem, STATGROUP_Tickables);
+}
+
+int32 UPCLoadTestSubsystem::GetLoadTestPlayerCount()
+{
+	int32 NumPlayers = 0;
+	FParse::Value(FCommandLine::Get(), TEXT("PCLoadTest="), NumPlayers);
+	return FMath::Max(NumPlayers, 0);
+}
+
+bool UPCLoadTestSubsystem::IsBotClient()
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("PCBot"));
+}
+
+FString UPCLoadTestSubsystem::GetBotName()
+{
+	FString Name;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("PCBot="), Name) || Name.IsEmpty())
+	{
+		Name = FString::Printf(TEXT("Bot_%u"), FPlatformProcess::GetCurrentProcessId());
+	}
+	return Name;
+}
+
+void UPCLoadTestSubsystem::BindBotExitOnNetworkFailure()
+{
+	if (GBotExitHooksBound || !GEngine)
+		return;
+
+	GBotExitHooksBound = true;
+
+	GEngine->OnNetworkFailure().AddLambda([](UWorld*, UNetDriver*, ENetworkFailure::Type FailureType, const FString& Error)
+	{
+		RequestBotExit(*FString::Printf(TEXT("network failure %s (%s)"), ENetworkFailure::ToString(FailureType), *Error));
+	});
+
+	GEngine->OnTravelFailure().AddLambda([](UWorld*, ETravelFailure::Type FailureType, const FString& Error)
+	{
+		RequestBotExit(*FString::Printf(TEXT("travel failure %s (%s)"), ETravelFailure::ToString(FailureType), *Error));
+	});
+}
+
+void UPCLoadTestSubsystem::LaunchBotClients(int32 NumBots)
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	FString Executable = FPlatformProcess::ExecutablePath();
+	FParse::Value(FCommandLine::Get(), TEXT("PCBotExe="), Executable);
+
+	FString ProjectArgs;
+#if WITH_EDITOR
+	// 에디터 실행 파일이면 프로젝트 경로와 -game 이 필요
+	ProjectArgs = FString::Printf(TEXT("\"%s\" -game "), *FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()));
+#endif
+
+	// 루프백만 사용, 렌더링 / 사운드 없이
+	const int32 Port = World->URL.Port;
+	for (int32 i = 0; i < NumBots; ++i)
+	{
+		const FString BotName = FString::Printf(TEXT("Bot%02d"), i + 1);
+		const FString Args = ProjectArgs + FString::Printf(
+			TEXT("127.0.0.1:%d -nullrhi -nosound -unattended -nosplash -log=PCLoadTest_%s.log -PCBot=%s"),
+			Port, *BotName, *BotName);
+
+		FProcHandle Handle = FPlatformProcess::CreateProc(*Executable, *Args, true, true, true, nullptr, 0, nullptr, nullptr);
+		if (!Handle.IsValid())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[LoadTest] Failed to launch bot client : %s %s"), *Executable, *Args);
+			continue;
+		}
+
+		// 서버 월드 정리 시 종료할 수 있도록 핸들 유지
+		BotProcesses.Add(Handle);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[LoadTest] Launched %d bot clients -> 127.0.0.1:%d"), BotProcesses.Num(), Port);
+}
+
+void UPCLoadTestSubsystem::TerminateBotClients()
+{
+	int32 NumTerminated = 0;
+	for (FProcHandle& Handle : BotProcesses)
+	{
+		if (FPlatformProcess::IsProcRunning(Handle))
+		{
+			FPlatformProcess::TerminateProc(Handle, true);
+			++NumTerminated;
+		}
+		FPlatformProcess::CloseProc(Handle);
+	}
+
+	if (!BotProcesses.IsEmpty())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[LoadTest] Terminated %d / %d bot clients"), NumTerminated, BotProcesses.Num());
+	}
+	BotProcesses.Reset();
+}
+
+bool UPCLoadTestSubsystem::IsBotMatchOver(const APCCombatGameState* GS, const APCCombatPlayerController* PC) const
+{
+	// 탈락하거나 마지막 생존자가 되면 리더보드 행에 최종 등수가 들어옴
+	const APCPlayerState* PS = PC->GetPlayerState<APCPlayerState>();
+	if (!PS || PS->LocalUserId.IsEmpty())
+		return false;
+
+	const FPlayerStandingRow* Row = GS->Leaderboard.FindByPredicate([PS](const FPlayerStandingRow& InRow)
+	{
+		return InRow.LocalUserId == PS->LocalUserId;
+	});
+	return Row && Row->FinalRank > 0;
+}
+
+void UPCLoadTestSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bBot)
+		return;
+
+	const UWorld* World = GetWorld();
+	const APCCombatGameState* GS = World ? World->GetGameState<APCCombatGameState>() : nullptr;
+	APCCombatPlayerController* PC = World ? Cast<APCCombatPlayerController>(World->GetFirstPlayerController()) : nullptr;
+	if (!GS || !PC)
+		return;
+
+	if (BotExitTime > 0.f)
+	{
+		if (World->GetTimeSeconds() >= BotExitTime)
+		{
+			RequestBotExit(TEXT("match over"));
+		}
+		return;
+	}
+
+	if (IsBotMatchOver(GS, PC))
+	{
+		UE_LOG(LogTemp, Log, TEXT("[LoadTest] Bot %s match over"), *GetBotName());
+		BotExitTime = World->GetTimeSeconds() + BotExitDelay;
+		return;
+	}
+
+	// 회전초밥 중에는 매 프레임 링 쪽으로 이동
+	if (GS->GetGameStateTag() == GameStateTags::Game_State_Carousel)
+	{
+		MoveToCarousel(PC);
+	}
+
+	if (World->GetTimeSeconds() < NextThinkTime)
+		return;
+
+	NextThinkTime = World->GetTimeSeconds() + Random.FRandRange(MinThinkInterval, MaxThinkInterval);
+	ThinkBot();
+}
+
+void UPCLoadTestSubsystem::MoveToCarousel(APCCombatPlayerController* PC)
+{
+	APawn* Pawn = PC->GetPawn();
+	if (!Pawn)
+		return;
+
+	if (!CarouselRing.IsValid())
+	{
+		for (TActorIterator<APCCarouselRing> It(GetWorld()); It; ++It)
+		{
+			CarouselRing = *It;
+			break;
+		}
+	}
+
+	if (!CarouselRing.IsValid())
+		return;
+
+	FVector ToRing = CarouselRing->GetActorLocation() - Pawn->GetActorLocation();
+	ToRing.Z = 0.f;
+	if (ToRing.SizeSquared() > FMath::Square(CarouselPickRadius * 0.5f))
+	{
+		Pawn->AddMovementInput(ToRing.GetSafeNormal());
+	}
+}
+
+void UPCLoadTestSubsystem::ThinkBot()
+{
+	APCCombatPlayerController* PC = Cast<APCCombatPlayerController>(GetWorld()->GetFirstPlayerController());
+	APCPlayerState* PS = PC ? PC->GetPlayerState<APCPlayerState>() : nullptr;
+	const APCCombatGameState* GS = GetWorld()->GetGameState<APCCombatGameState>();
+	if (!PS || !GS || PS->SeatIndex < 0)
+		return;
+
+	const FGameplayTag& StateTag = GS->GetGameStateTag();
+
+	// 회전초밥 : 링 근처에 도착하면 픽 요청 (서버가 각도로 슬롯 결정, 이미 골랐으면 무시)
+	if (StateTag == GameStateTags::Game_State_Carousel)
+	{
+		APCPlayerCharacter* Pawn = PC->GetPawn<APCPlayerCharacter>();
+		if (Pawn && CarouselRing.IsValid()
+			&& FVector::DistSquared2D(Pawn->GetActorLocation(), CarouselRing->GetActorLocation()) <= FMath::Square(CarouselPickRadius))
+		{
+			Pawn->Server_RequestCarouselPick();
+			++Stats.CarouselPicks;
+		}
+		return;
+	}
+
+	// 전투 중에는 관전
+	if (StateTag == GameStateTags::Game_State_Combat_Active)
+		return;
+
+	const UPCPlayerAttributeSet* AttributeSet = PS->GetAttributeSet();
+	if (!AttributeSet)
+		return;
+
+	const int32 Gold = FMath::FloorToInt32(AttributeSet->GetPlayerGold());
+	const int32 PlayerLevel = FMath::FloorToInt32(AttributeSet->GetPlayerLevel());
+
+	// 사람이 하는 순서와 비슷하게 : 배치 -> 장착 -> 구매 -> 레벨업 -> 리롤
+	if (TryPlaceUnit(PC, PlayerLevel))
+	{
+		++Stats.Drags;
+		return;
+	}
+
+	if (Random.FRand() < 0.5f && TryEquipItem(PC))
+	{
+		++Stats.Equips;
+		return;
+	}
+
+	if (TryBuyUnit(PC, Gold))
+	{
+		++Stats.Buys;
+		return;
+	}
+
+	if (Gold >= 4 && Random.FRand() < 0.35f)
+	{
+		PC->ShopRequest_BuyXP();
+		++Stats.BuyXPs;
+		return;
+	}
+
+	if (Gold >= 2)
+	{
+		PC->ShopRequest_ShopRefresh(2);
+		++Stats.Rerolls;
+	}
+}
+
+bool UPCLoadTestSubsystem::TryPlaceUnit(APCCombatPlayerController* PC, int32 PlayerLevel)
+{
+	const APCPlayerBoard* PB = PC->GetLocalPlayerBoard();
+	if (!PB)
+		return false;
+
+	TArray<int32, TInlineAllocator<32>> FreeFieldIndices;
+	int32 NumFieldUnits = 0;
+	for (int32 Y = 0; Y < PB->Cols; ++Y)
+	{
+		for (int32 X = 0; X < PB->Rows; ++X)
+		{
+			APCBaseUnitCharacter* Unit = nullptr;
+			if (!PB->ResolveReplicatedOccupant(true, Y, X, INDEX_NONE, Unit))
+				continue;
+
+			if (Unit)
+			{
+				++NumFieldUnits;
+			}
+			else
+			{
+				FreeFieldIndices.Add(PB->IndexOf(Y, X));
+			}
+		}
+	}
+
+	if (NumFieldUnits >= PlayerLevel || FreeFieldIndices.IsEmpty())
+		return false;
+
+	TArray<int32, TInlineAllocator<16>> BenchIndices;
+	for (int32 BenchIdx = 0; BenchIdx < PB->BenchSize; ++BenchIdx)
+	{
+		APCBaseUnitCharacter* Unit = nullptr;
+		if (PB->ResolveReplicatedOccupant(false, INDEX_NONE, INDEX_NONE, BenchIdx, Unit) && Unit)
+		{
+			BenchIndices.Add(BenchIdx);
+		}
+	}
+
+	if (BenchIndices.IsEmpty())
+		return false;
+
+	FVector From, To;
+	if (!PB->GetBenchTileLocation(BenchIndices[Random.RandHelper(BenchIndices.Num())], From)
+		|| !PB->GetFieldTileLocation(FreeFieldIndices[Random.RandHelper(FreeFieldIndices.Num())], To))
+		return false;
+
+	// 사람 드래그와 같은 RPC 쌍 (신뢰성 RPC 라 순서 보장)
+	const int32 DragId = NextDragId++;
+	PC->Server_StartDragFromWorld(From, DragId);
+	PC->Server_EndDrag(To, DragId);
+	return true;
+}
+
+bool UPCLoadTestSubsystem::TryEquipItem(APCCombatPlayerController* PC)
+{
+	const APCPlayerState* PS = PC->GetPlayerState<APCPlayerState>();
+	UPCPlayerInventory* Inventory = PS ? PS->GetPlayerInventory() : nullptr;
+	const APCPlayerBoard* PB = PC->GetLocalPlayerBoard();
+	if (!Inventory || !PB || Inventory->GetInventorySize() <= 0)
+		return false;
+
+	TArray<APCBaseUnitCharacter*, TInlineAllocator<16>> FieldUnits;
+	for (int32 Y = 0; Y < PB->Cols; ++Y)
+	{
+		for (int32 X = 0; X < PB->Rows; ++X)
+		{
+			APCBaseUnitCharacter* Unit = nullptr;
+			if (PB->ResolveReplicatedOccupant(true, Y, X, INDEX_NONE, Unit) && Unit)
+			{
+				FieldUnits.Add(Unit);
+			}
+		}
+	}
+
+	if (FieldUnits.IsEmpty())
+		return false;
+
+	APCBaseUnitCharacter* Target = FieldUnits[Random.RandHelper(FieldUnits.Num())];
+	Inventory->Server_DropItemAtOutsideInventory(Random.RandHelper(Inventory->GetInventorySize()), Target, Target->GetActorLocation());
+	return true;
+}
+
+bool UPCLoadTestSubsystem::TryBuyUnit(APCCombatPlayerController* PC, int32 Gold)
+{
+	APCPlayerState* PS = PC->GetPlayerState<APCPlayerState>();
+	const APCPlayerBoard* PB = PC->GetLocalPlayerBoard();
+	if (!PS || !PB)
+		return false;
+
+	// 벤치가 꽉 차면 구매 안 함 (서버가 같은 유닛 3개 합성은 처리하지만 봇은 단순하게)
+	bool bHasFreeBench = false;
+	for (int32 BenchIdx = 0; BenchIdx < PB->BenchSize && !bHasFreeBench; ++BenchIdx)
+	{
+		APCBaseUnitCharacter* Unit = nullptr;
+		bHasFreeBench = PB->ResolveReplicatedOccupant(false, INDEX_NONE, INDEX_NONE, BenchIdx, Unit) && !Unit;
+	}
+
+	if (!bHasFreeBench)
+		return false;
+
+	const TArray<FPCShopUnitData>& Slots = PS->GetShopSlots();
+	TArray<int32, TInlineAllocator<8>> Affordable;
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		if (Slots[SlotIndex].UnitTag.IsValid() && Slots[SlotIndex].UnitCost <= Gold && !PS->IsShopSlotPurchased(SlotIndex))
+		{
+			Affordable.Add(SlotIndex);
+		}
+	}
+
+	if (Affordable.IsEmpty())
+		return false;
+
+	PC->ShopRequest_BuyUnit(Affordable[Random.RandHelper(Affordable.Num())]);
+	return true;
+}
+
+#else
+
+bool UPCLoadTestSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return false;
+}
+
+void UPCLoadTestSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+}
+
+void UPCLoadTestSubsystem::Deinitialize()
+{
+	Super::Deinitialize();
+}
+
+void UPCLoadTestSubsystem::Tick(float DeltaTime)
+{
+}
+
+TStatId UPCLoadTestSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPCLoadTestSubsystem, STATGROUP_Tickables);
+}
+
+int32 UPCLoadTestSubsystem::GetLoadTestPlayerCount()
+{
+	return 0;
+}
+
+bool UPCLoadTestSubsystem::IsBotClient()
+{
+	return false;
+}
+
+FString UPCLoadTestSubsystem::GetBotName()
+{
+	return FString();
+}
+
+#endif
@@ -0,0 +1,148 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GameFramework/WorldSubsystem/PCMatchRandomSubsystem.h"
+
+#include "Character/Unit/PCBaseUnitCharacter.h"
+#include "GameFramework/HelpActor/PCCombatBoard.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Crc.h"
+
+
+void UPCMatchRandomSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// GameMode 가 다시 초기화하기 전에 뽑히는 난수도 재현 가능하도록 기본 시드로 먼저 초기화
+	InitializeMatchRandom();
+}
+
+void UPCMatchRandomSubsystem::Deinitialize()
+{
+	LogRandomState();
+	Channels.Empty();
+	BoardChannels.Empty();
+	BoardRoundKeys.Empty();
+	
+	Super::Deinitialize();
+}
+
+void UPCMatchRandomSubsystem::InitializeMatchRandom(int32 InMatchSeed)
+{
+	if (InMatchSeed == 0)
+	{
+		if (!FParse::Value(FCommandLine::Get(), TEXT("PCMatchSeed="), InMatchSeed) || InMatchSeed == 0)
+		{
+			InMatchSeed = static_cast<int32>(FPlatformTime::Cycles64());
+		}
+	}
+
+	MatchSeed = InMatchSeed;
+
+	// 알려진 채널은 미리 만들어 두어 GetChannel 중 맵 재할당이 일어나지 않도록 함
+	for (const FName& ChannelName : { PCRandomChannels::Shop, PCRandomChannels::Damage, PCRandomChannels::Pairing, PCRandomChannels::ItemDrop })
+	{
+		Channels.FindOrAdd(ChannelName);
+	}
+
+	// 이미 만들어진 채널도 새 시드 기준으로 처음부터 다시 시작
+	for (auto& Pair : Channels)
+	{
+		Pair.Value.Initialize(MakeChannelSeed(MatchSeed, Pair.Key));
+	}
+
+	// 보드 하위 채널은 다음 페어 시작 시 새 시드로 다시 생성
+	BoardChannels.Reset();
+	BoardRoundKeys.Reset();
+
+	UE_LOG(LogTemp, Log, TEXT("[MatchRandom] MatchSeed=%d (replay with -PCMatchSeed=%d)"), MatchSeed, MatchSeed);
+}
+
+const FPCRandomChannel& UPCMatchRandomSubsystem::GetChannel(FName ChannelName)
+{
+	if (const FPCRandomChannel* Found = Channels.Find(ChannelName))
+	{
+		return *Found;
+	}
+
+	return Channels.Add(ChannelName, FPCRandomChannel(MakeChannelSeed(MatchSeed, ChannelName)));
+}
+
+const FPCRandomChannel* UPCMatchRandomSubsystem::FindChannel(const UObject* WorldContextObject, FName ChannelName)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World)
+		return nullptr;
+
+	UPCMatchRandomSubsystem* RandomSubsystem = World->GetSubsystem<UPCMatchRandomSubsystem>();
+	return RandomSubsystem ? &RandomSubsystem->GetChannel(ChannelName) : nullptr;
+}
+
+void UPCMatchRandomSubsystem::BeginBoardRound(int32 BoardSeat, int32 StageIdx, int32 RoundIdx)
+{
+	BoardRoundKeys.Add(BoardSeat, static_cast<int32>(HashCombine(GetTypeHash(StageIdx), GetTypeHash(RoundIdx))));
+
+	for (auto It = BoardChannels.CreateIterator(); It; ++It)
+	{
+		if (It->Key.Value == BoardSeat)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+const FPCRandomChannel& UPCMatchRandomSubsystem::GetBoardChannel(FName ChannelName, int32 BoardSeat)
+{
+	const TPair<FName, int32> Key(ChannelName, BoardSeat);
+	if (const FPCRandomChannel* Found = BoardChannels.Find(Key))
+	{
+		return *Found;
+	}
+
+	return BoardChannels.Add(Key, FPCRandomChannel(MakeBoardChannelSeed(ChannelName, BoardSeat)));
+}
+
+const FPCRandomChannel* UPCMatchRandomSubsystem::FindBoardChannel(const UObject* WorldContextObject, FName ChannelName, int32 BoardSeat)
+{
+	if (BoardSeat == INDEX_NONE)
+		return FindChannel(WorldContextObject, ChannelName);
+	
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World)
+		return nullptr;
+
+	UPCMatchRandomSubsystem* RandomSubsystem = World->GetSubsystem<UPCMatchRandomSubsystem>();
+	return RandomSubsystem ? &RandomSubsystem->GetBoardChannel(ChannelName, BoardSeat) : nullptr;
+}
+
+const FPCRandomChannel* UPCMatchRandomSubsystem::FindUnitBoardChannel(const AActor* UnitActor, FName ChannelName)
+{
+	const APCBaseUnitCharacter* Unit = Cast<APCBaseUnitCharacter>(UnitActor);
+	const APCCombatBoard* Board = Unit ? Unit->GetOnCombatBoard() : nullptr;
+	return FindBoardChannel(UnitActor, ChannelName, Board ? Board->BoardSeatIndex : INDEX_NONE);
+}
+
+void UPCMatchRandomSubsystem::LogRandomState() const
+{
+	UE_LOG(LogTemp, Log, TEXT("[MatchRandom] MatchSeed=%d Channels=%d BoardChannels=%d"), MatchSeed, Channels.Num(), BoardChannels.Num());
+	
+	for (const auto& Pair : Channels)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[MatchRandom]   %s : Seed=%d Draws=%lld"),
+			*Pair.Key.ToString(), Pair.Value.GetInitialSeed(), Pair.Value.GetDrawCount());
+	}
+}
+
+int32 UPCMatchRandomSubsystem::MakeChannelSeed(int32 InMatchSeed, FName ChannelName)
+{
+	// FName 해시는 실행마다 달라질 수 있으므로 문자열 CRC 사용
+	const uint32 NameHash = FCrc::StrCrc32(*ChannelName.ToString());
+	return static_cast<int32>(HashCombine(static_cast<uint32>(InMatchSeed), NameHash));
+}
+
+int32 UPCMatchRandomSubsystem::MakeBoardChannelSeed(FName ChannelName, int32 BoardSeat) const
+{
+	const int32* RoundKey = BoardRoundKeys.Find(BoardSeat);
+	const uint32 BoardHash = HashCombine(GetTypeHash(RoundKey ? *RoundKey : 0), GetTypeHash(BoardSeat));
+	return static_cast<int32>(HashCombine(static_cast<uint32>(MakeChannelSeed(MatchSeed, ChannelName)), BoardHash));
+}
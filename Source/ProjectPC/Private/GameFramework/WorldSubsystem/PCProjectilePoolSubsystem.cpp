@@ -5,109 +5,94 @@
 
 
 #include "Character/Projectile/PCBaseProjectile.h"
+#include "GameFramework/WorldSubsystem/PCActorPoolSubsystem.h"
+#include "GameFramework/WorldSubsystem/PCProjectileSimSubsystem.h"
 
 
 void UPCProjectilePoolSubsystem::InitializeProjectilePoolData(const FPCProjectilePoolData& NewProjectilePoolData)
 {
-	if (!GetWorld() || GetWorld()->GetNetMode() == NM_Client) return;
+	if (!GetWorld()) return;
 	
+	// 발사체 데이터는 클라의 경량 발사체 연출에서도 쓰이므로 보관, 풀은 서버만 생성
 	ProjectilePoolData = NewProjectilePoolData;
-	if (!ProjectilePoolData.ProjectileBaseClass) return;
+	if (!ProjectilePoolData.ProjectileBaseClass || GetWorld()->GetNetMode() == NM_Client) return;
 
-	for (int32 i=0; i<ProjectilePoolData.InitialReserveSize; ++i)
+	if (auto* ActorPool = GetWorld()->GetSubsystem<UPCActorPoolSubsystem>())
 	{
-		// InitialReserveSize만큼 발사체 미리 생성하고, Queue에 삽입
- 		if (auto Projectile = GetWorld()->SpawnActor<APCBaseProjectile>(
-			ProjectilePoolData.ProjectileBaseClass, FVector::ZeroVector, FRotator::ZeroRotator))
-		{
-			ProjectilePool.Enqueue(Projectile);
-		}
+		// InitialReserveSize만큼 발사체 미리 생성
+		FPCActorPoolConfig Config;
+		Config.PrewarmCount = ProjectilePoolData.InitialReserveSize;
+		Config.MaxPooledCount = ProjectilePoolData.MaxPooledCount > 0 ? FMath::Max(ProjectilePoolData.MaxPooledCount, ProjectilePoolData.InitialReserveSize) : 0;
+		Config.IdleTrimSeconds = ProjectilePoolData.IdleTrimSeconds;
+		ActorPool->RegisterPool(ProjectilePoolData.ProjectileBaseClass, Config);
 	}
 }
 
+APCBaseProjectile* UPCProjectilePoolSubsystem::AcquireProjectile(const AActor* SpawnActor, const AActor* TargetActor) const
+{
+	if (!GetWorld() || GetWorld()->GetNetMode() == NM_Client)
+		return nullptr;
+
+	if (!SpawnActor || !TargetActor || !ProjectilePoolData.ProjectileBaseClass)
+		return nullptr;
+
+	// 오브젝트 풀에서 꺼내고, 비어 있으면 새로 생성
+	auto* ActorPool = GetWorld()->GetSubsystem<UPCActorPoolSubsystem>();
+	return ActorPool ? ActorPool->Acquire<APCBaseProjectile>(ProjectilePoolData.ProjectileBaseClass) : nullptr;
+}
+
 APCBaseProjectile* UPCProjectilePoolSubsystem::SpawnProjectile(const FTransform& SpawnTransform, FGameplayTag CharacterTag, FGameplayTag AttackTypeTag, const AActor* SpawnActor, const AActor* TargetActor)
 {
-	if (GetWorld() && GetWorld()->GetNetMode() != NM_Client)
+	APCBaseProjectile* SpawnedProjectile = AcquireProjectile(SpawnActor, TargetActor);
+	if (SpawnedProjectile)
 	{
-		if (SpawnActor && TargetActor)
+		SpawnedProjectile->ActiveProjectile(SpawnTransform, CharacterTag, AttackTypeTag, SpawnActor, TargetActor);
+	}
+	
+	return SpawnedProjectile;
+}
+
+APCBaseProjectile* UPCProjectilePoolSubsystem::SpawnUnitProjectile(const FTransform& SpawnTransform,
+	FGameplayTag CharacterTag, FGameplayTag AttackTypeTag, const AActor* SpawnActor, const AActor* TargetActor,
+	uint32& OutSimProjectileId)
+{
+	OutSimProjectileId = 0;
+	
+	if (UPCProjectileSimSubsystem::IsSimulationEnabled())
+	{
+		if (auto* ProjectileSim = GetWorld() ? GetWorld()->GetSubsystem<UPCProjectileSimSubsystem>() : nullptr)
 		{
-			APCBaseProjectile* SpawnedProjectile = nullptr;
-			if (!ProjectilePool.IsEmpty() && ProjectilePool.Dequeue(SpawnedProjectile))
-			{
-				// 오브젝트 풀에서 꺼낼 수 있으면 즉시 활성화
-				SpawnedProjectile->ActiveProjectile(SpawnTransform, CharacterTag, AttackTypeTag, SpawnActor, TargetActor);
-				return SpawnedProjectile;
-			}
-			else
-			{
-				// 오브젝트 풀이 비었거나 꺼낸 발사체가 nullptr일 경우 새로 생성
-				if (SpawnedProjectile = GetWorld()->SpawnActor<APCBaseProjectile>(
-					ProjectilePoolData.ProjectileBaseClass, FVector::ZeroVector, FRotator::ZeroRotator))
-				{
-					SpawnedProjectile->ActiveProjectile(SpawnTransform, CharacterTag, AttackTypeTag, SpawnActor, TargetActor);
-					return SpawnedProjectile;
-				}
-			}
+			OutSimProjectileId = ProjectileSim->SpawnProjectile(SpawnTransform, CharacterTag, AttackTypeTag, SpawnActor, TargetActor);
+			if (OutSimProjectileId != 0)
+				return nullptr;
 		}
 	}
-	
-	return nullptr;
+
+	return SpawnProjectile(SpawnTransform, CharacterTag, AttackTypeTag, SpawnActor, TargetActor);
 }
 
 APCBaseProjectile* UPCProjectilePoolSubsystem::SpawnProjectile(const FTransform& SpawnTransform,
 	const AActor* SpawnActor, const AActor* TargetActor)
 {
-	if (GetWorld() && GetWorld()->GetNetMode() != NM_Client)
+	APCBaseProjectile* SpawnedProjectile = AcquireProjectile(SpawnActor, TargetActor);
+	if (SpawnedProjectile)
 	{
-		if (SpawnActor && TargetActor)
-		{
-			APCBaseProjectile* SpawnedProjectile = nullptr;
-			if (!ProjectilePool.IsEmpty() && ProjectilePool.Dequeue(SpawnedProjectile))
-			{
-				SpawnedProjectile->ActiveProjectile(SpawnTransform, SpawnActor, TargetActor);
-				return SpawnedProjectile;
-			}
-			else
-			{
-				if (SpawnedProjectile = GetWorld()->SpawnActor<APCBaseProjectile>(
-					ProjectilePoolData.ProjectileBaseClass, FVector::ZeroVector, FRotator::ZeroRotator))
-				{
-					SpawnedProjectile->ActiveProjectile(SpawnTransform, SpawnActor, TargetActor);
-					return SpawnedProjectile;
-				}
-			}
-		}
+		SpawnedProjectile->ActiveProjectile(SpawnTransform, SpawnActor, TargetActor);
 	}
 	
-	return nullptr;
+	return SpawnedProjectile;
 }
 
 APCBaseProjectile* UPCProjectilePoolSubsystem::SpawnProjectile(const FTransform& SpawnTransform,
 	FGameplayTag CharacterTag, const AActor* SpawnActor, const AActor* TargetActor)
 {
-	if (GetWorld() && GetWorld()->GetNetMode() != NM_Client)
+	APCBaseProjectile* SpawnedProjectile = AcquireProjectile(SpawnActor, TargetActor);
+	if (SpawnedProjectile)
 	{
-		if (SpawnActor && TargetActor)
-		{
-			APCBaseProjectile* SpawnedProjectile = nullptr;
-			if (!ProjectilePool.IsEmpty() && ProjectilePool.Dequeue(SpawnedProjectile))
-			{
-				SpawnedProjectile->ActiveProjectile(SpawnTransform, CharacterTag, SpawnActor, TargetActor);
-				return SpawnedProjectile;
-			}
-			else
-			{
-				if (SpawnedProjectile = GetWorld()->SpawnActor<APCBaseProjectile>(
-					ProjectilePoolData.ProjectileBaseClass, FVector::ZeroVector, FRotator::ZeroRotator))
-				{
-					SpawnedProjectile->ActiveProjectile(SpawnTransform, CharacterTag, SpawnActor, TargetActor);
-					return SpawnedProjectile;
-				}
-			}
-		}
+		SpawnedProjectile->ActiveProjectile(SpawnTransform, CharacterTag, SpawnActor, TargetActor);
 	}
 	
-	return nullptr;
+	return SpawnedProjectile;
 }
 
 void UPCProjectilePoolSubsystem::ReturnProjectile(APCBaseProjectile* ReturnedProjectile)
@@ -116,7 +101,30 @@ void UPCProjectilePoolSubsystem::ReturnProjectile(APCBaseProjectile* ReturnedPro
 
 	if (ReturnedProjectile)
 	{
-		// 반환된 발사체 오브젝트 풀 Queue에 삽입
-		ProjectilePool.Enqueue(ReturnedProjectile);
+		// 반환된 발사체 오브젝트 풀에 보관 (상한 초과 시 파괴)
+		if (auto* ActorPool = GetWorld()->GetSubsystem<UPCActorPoolSubsystem>())
+		{
+			ActorPool->Release(ReturnedProjectile);
+		}
 	}
-}
\ No newline at end of file
+}
+
+int32 UPCProjectilePoolSubsystem::GetNumActiveProjectiles() const
+{
+	if (!GetWorld() || !ProjectilePoolData.ProjectileBaseClass)
+		return 0;
+
+	FPCActorPoolStats Stats;
+	const auto* ActorPool = GetWorld()->GetSubsystem<UPCActorPoolSubsystem>();
+	return ActorPool && ActorPool->GetPoolStats(ProjectilePoolData.ProjectileBaseClass, Stats) ? Stats.LiveCount : 0;
+}
+
+const FPCProjectileData* UPCProjectilePoolSubsystem::FindProjectileData(FGameplayTag CharacterTag,
+	FGameplayTag AttackTypeTag) const
+{
+	if (!ProjectilePoolData.ProjectileBaseClass)
+		return nullptr;
+
+	const APCBaseProjectile* ProjectileCDO = ProjectilePoolData.ProjectileBaseClass->GetDefaultObject<APCBaseProjectile>();
+	return ProjectileCDO ? ProjectileCDO->FindProjectileData(CharacterTag, AttackTypeTag) : nullptr;
+}
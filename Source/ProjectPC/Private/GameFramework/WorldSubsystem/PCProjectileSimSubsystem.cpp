@@ -0,0 +1,507 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GameFramework/WorldSubsystem/PCProjectileSimSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "AbilitySystem/Unit/EffectSpec/PCEffectSpec.h"
+#include "Character/Projectile/PCProjectileData.h"
+#include "Character/Projectile/PCProjectileSimReplicator.h"
+#include "Character/Unit/PCBaseUnitCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/WorldSubsystem/PCProjectilePoolSubsystem.h"
+#include "Kismet/GameplayStatics.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Utility/PCUnitCombatUtils.h"
+
+DECLARE_STATS_GROUP(TEXT("PCProjectileSim"), STATGROUP_PCProjectileSim, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Projectile Sim Tick"), STAT_PCProjectileSim_Tick, STATGROUP_PCProjectileSim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Projectiles"), STAT_PCProjectileSim_Active, STATGROUP_PCProjectileSim);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Spawn Events Sent"), STAT_PCProjectileSim_SpawnEvents, STATGROUP_PCProjectileSim);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Impact Events Sent"), STAT_PCProjectileSim_ImpactEvents, STATGROUP_PCProjectileSim);
+
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarPCProjectileSimulated(
+		TEXT("PC.Projectile.Simulated"),
+		true,
+		TEXT("유닛 발사체를 경량 시뮬레이션으로 처리 (0이면 기존 APCBaseProjectile 액터 사용)"));
+
+	// 발사체 메시는 진행 방향 기준으로 눕혀져 있음 (APCBaseProjectile MeshComp 상대 회전과 동일)
+	const FQuat MeshRelativeRotation = FRotator(90.f, 0.f, 0.f).Quaternion();
+}
+
+bool UPCProjectileSimSubsystem::IsSimulationEnabled()
+{
+	return CVarPCProjectileSimulated.GetValueOnGameThread();
+}
+
+void UPCProjectileSimSubsystem::Deinitialize()
+{
+	for (const FPCSimProjectileVisual& Visual : Visuals)
+	{
+		if (Visual.Trail)
+		{
+			Visual.Trail->DestroyComponent();
+		}
+		if (Visual.Mesh)
+		{
+			Visual.Mesh->DestroyComponent();
+		}
+	}
+
+	Visuals.Empty();
+	FreeVisualIndices.Empty();
+	Projectiles.Empty();
+	PendingEventsBySeat.Empty();
+	Replicators.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UPCProjectileSimSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPCProjectileSimSubsystem, STATGROUP_Tickables);
+}
+
+bool UPCProjectileSimSubsystem::IsServer() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_Client;
+}
+
+bool UPCProjectileSimSubsystem::ShouldDrawVisuals() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_DedicatedServer;
+}
+
+const FPCProjectileData* UPCProjectileSimSubsystem::FindProjectileData(FGameplayTag CharacterTag, FGameplayTag AttackTypeTag) const
+{
+	const UPCProjectilePoolSubsystem* ProjectilePool = GetWorld() ? GetWorld()->GetSubsystem<UPCProjectilePoolSubsystem>() : nullptr;
+	return ProjectilePool ? ProjectilePool->FindProjectileData(CharacterTag, AttackTypeTag) : nullptr;
+}
+
+uint32 UPCProjectileSimSubsystem::SpawnProjectile(const FTransform& SpawnTransform, FGameplayTag CharacterTag,
+	FGameplayTag AttackTypeTag, const AActor* SpawnActor, const AActor* TargetActor)
+{
+	if (!IsServer() || !SpawnActor || !TargetActor)
+		return 0;
+
+	const FPCProjectileData* Data = FindProjectileData(CharacterTag, AttackTypeTag);
+	if (!Data)
+		return 0;
+
+	const APCBaseUnitCharacter* SpawnUnit = Cast<APCBaseUnitCharacter>(SpawnActor);
+	const int32 BoardSeatIndex = SpawnUnit ? SpawnUnit->GetRelevancyBoardSeatIndex() : INDEX_NONE;
+	if (!GetOrCreateReplicator(BoardSeatIndex))
+		return 0;
+
+	const uint32 Id = NextProjectileId++;
+	if (NextProjectileId == 0)
+		NextProjectileId = 1;
+
+	// 비유도 발사체는 생성 시점의 대상 위치로 직진
+	const FVector Direction = Data->bIsHomingProjectile
+		? SpawnTransform.GetRotation().GetForwardVector()
+		: (TargetActor->GetActorLocation() - SpawnTransform.GetLocation()).GetSafeNormal();
+
+	FSimProjectile& Projectile = AddProjectile(Id, SpawnTransform.GetLocation(), Direction, TargetActor, *Data);
+	Projectile.Source = SpawnActor;
+	Projectile.BoardSeatIndex = BoardSeatIndex;
+
+	FPCProjectileSpawnEvent& Event = PendingEventsBySeat.FindOrAdd(BoardSeatIndex).SpawnEvents.AddDefaulted_GetRef();
+	Event.ProjectileId = Id;
+	Event.Location = SpawnTransform.GetLocation();
+	Event.Direction = Direction;
+	Event.Target = TargetActor;
+	Event.CharacterTag = CharacterTag;
+	Event.AttackTypeTag = AttackTypeTag;
+
+	return Id;
+}
+
+void UPCProjectileSimSubsystem::SetEffectSpecs(uint32 ProjectileId, const TArray<UPCEffectSpec*>& InEffectSpecs)
+{
+	// 방금 생성한 발사체가 대부분이므로 뒤에서부터 탐색
+	for (int32 i = Projectiles.Num() - 1; i >= 0; --i)
+	{
+		if (Projectiles[i].Id == ProjectileId)
+		{
+			Projectiles[i].EffectSpecs.Reset(InEffectSpecs.Num());
+			for (UPCEffectSpec* EffectSpec : InEffectSpecs)
+			{
+				Projectiles[i].EffectSpecs.Add(EffectSpec);
+			}
+			return;
+		}
+	}
+}
+
+UPCProjectileSimSubsystem::FSimProjectile& UPCProjectileSimSubsystem::AddProjectile(uint32 Id, const FVector& Location,
+	const FVector& Direction, const AActor* Target, const FPCProjectileData& Data)
+{
+	FSimProjectile& Projectile = Projectiles.AddDefaulted_GetRef();
+	Projectile.Id = Id;
+	Projectile.Location = Location;
+	Projectile.Speed = Data.Speed;
+	Projectile.Velocity = Direction * Data.Speed;
+	Projectile.RemainingLifeTime = Data.LifeTime > 0.f ? Data.LifeTime : TNumericLimits<float>::Max();
+	Projectile.bIsHoming = Data.bIsHomingProjectile;
+	Projectile.bIsPenetrating = Data.bIsPenetrating;
+	Projectile.Target = Target;
+	Projectile.HitEffect = Data.HitEffect;
+
+	if (ShouldDrawVisuals())
+	{
+		Projectile.VisualIndex = AcquireVisual(Data, Location, Direction);
+	}
+
+	return Projectile;
+}
+
+void UPCProjectileSimSubsystem::RemoveProjectileAt(int32 Index)
+{
+	ReleaseVisual(Projectiles[Index].VisualIndex);
+	Projectiles.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void UPCProjectileSimSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PCProjectileSim_Tick);
+
+	Super::Tick(DeltaTime);
+
+	const bool bIsServer = IsServer();
+
+	for (int32 i = Projectiles.Num() - 1; i >= 0; --i)
+	{
+		FSimProjectile& Projectile = Projectiles[i];
+
+		Projectile.RemainingLifeTime -= DeltaTime;
+		if (Projectile.RemainingLifeTime <= 0.f)
+		{
+			RemoveProjectileAt(i);
+			continue;
+		}
+
+		FVector PrevLocation;
+		StepProjectile(Projectile, DeltaTime, PrevLocation);
+
+		if (bIsServer)
+		{
+			if (ProcessServerHits(Projectile, PrevLocation))
+			{
+				RemoveProjectileAt(i);
+				continue;
+			}
+		}
+		else if (Projectile.bIsHoming && SweepUnit(PrevLocation, Projectile.Location, Projectile.Target.Get()))
+		{
+			// 클라 예측 : 유도 발사체가 대상에 닿으면 서버 이벤트를 기다리지 않고 바로 피격 연출
+			PlayHitEffect(Projectile.HitEffect, Projectile.Target.Get());
+			RemoveProjectileAt(i);
+			continue;
+		}
+
+		UpdateVisual(Projectile);
+	}
+
+	SET_DWORD_STAT(STAT_PCProjectileSim_Active, Projectiles.Num());
+
+	if (bIsServer)
+	{
+		FlushEvents();
+	}
+}
+
+void UPCProjectileSimSubsystem::StepProjectile(FSimProjectile& Projectile, float DeltaTime, FVector& OutPrevLocation) const
+{
+	OutPrevLocation = Projectile.Location;
+
+	// 대상이 사라지면 (사망 / 풀 반환) 현재 방향으로 계속 직진
+	const APCBaseUnitCharacter* TargetUnit = Cast<APCBaseUnitCharacter>(Projectile.Target.Get());
+	const bool bHasTarget = Projectile.Target.IsValid() && !(TargetUnit && TargetUnit->IsInUnitPool());
+
+	if (Projectile.bIsHoming && bHasTarget)
+	{
+		const FVector ToTarget = (Projectile.Target->GetActorLocation() - Projectile.Location).GetSafeNormal();
+		Projectile.Velocity += ToTarget * HomingAcceleration * DeltaTime;
+		Projectile.Velocity = Projectile.Velocity.GetClampedToMaxSize(Projectile.Speed);
+	}
+
+	Projectile.Location += Projectile.Velocity * DeltaTime;
+}
+
+bool UPCProjectileSimSubsystem::SweepUnit(const FVector& Start, const FVector& End, const AActor* Unit) const
+{
+	if (!Unit)
+		return false;
+
+	float Radius = 0.f;
+	float HalfHeight = 0.f;
+	if (const ACharacter* Character = Cast<ACharacter>(Unit))
+	{
+		if (const UCapsuleComponent* Capsule = Character->GetCapsuleComponent())
+		{
+			Capsule->GetScaledCapsuleSize(Radius, HalfHeight);
+		}
+	}
+
+	// 이동 구간(선분)과 캡슐 축(선분) 사이 최단 거리로 판정
+	const FVector Center = Unit->GetActorLocation();
+	const FVector AxisOffset(0.f, 0.f, FMath::Max(HalfHeight - Radius, 0.f));
+
+	FVector ClosestOnPath, ClosestOnAxis;
+	FMath::SegmentDistToSegmentSafe(Start, End, Center - AxisOffset, Center + AxisOffset, ClosestOnPath, ClosestOnAxis);
+
+	const float HitDistance = Radius + CollisionRadius;
+	return FVector::DistSquared(ClosestOnPath, ClosestOnAxis) <= FMath::Square(HitDistance);
+}
+
+bool UPCProjectileSimSubsystem::ProcessServerHits(FSimProjectile& Projectile, const FVector& PrevLocation)
+{
+	const AActor* Source = Projectile.Source.Get();
+	if (!Source)
+		return true;
+
+	// 유도 발사체는 지정 대상만 판정 (APCBaseProjectile 과 동일)
+	if (Projectile.bIsHoming)
+	{
+		const AActor* Target = Projectile.Target.Get();
+		const APCBaseUnitCharacter* TargetUnit = Cast<APCBaseUnitCharacter>(Target);
+		if (!Target || (TargetUnit && TargetUnit->IsInUnitPool()))
+			return false;
+
+		// 관통 유도 발사체는 대상과 겹쳐 있는 동안 매 틱 다시 맞지 않도록 한 번만 적용
+		if (Projectile.HitActors.Contains(Target))
+			return false;
+
+		if (!SweepUnit(PrevLocation, Projectile.Location, Target))
+			return false;
+
+		ApplyHit(Projectile, Target);
+		return !Projectile.bIsPenetrating;
+	}
+
+	// 비유도 발사체는 같은 전투 보드 위의 적 유닛 캡슐과 직접 판정
+	const APCBaseUnitCharacter* SourceUnit = Cast<APCBaseUnitCharacter>(Source);
+	const APCCombatBoard* Board = SourceUnit ? SourceUnit->GetOnCombatBoard() : nullptr;
+	if (!Board)
+		return false;
+
+	CandidateUnits.Reset();
+	Board->GetAllFieldUnits(CandidateUnits);
+
+	for (const TWeakObjectPtr<APCBaseUnitCharacter>& WeakUnit : CandidateUnits)
+	{
+		const APCBaseUnitCharacter* Unit = WeakUnit.Get();
+		if (!Unit || Unit == Source || Unit->IsDead() || Unit->IsInUnitPool())
+			continue;
+
+		if (!PCUnitCombatUtils::IsHostile(Source, Unit) || Projectile.HitActors.Contains(Unit))
+			continue;
+
+		if (!SweepUnit(PrevLocation, Projectile.Location, Unit))
+			continue;
+
+		ApplyHit(Projectile, Unit);
+		if (!Projectile.bIsPenetrating)
+			return true;
+	}
+
+	return false;
+}
+
+void UPCProjectileSimSubsystem::ApplyHit(FSimProjectile& Projectile, const AActor* HitActor)
+{
+	Projectile.HitActors.Add(HitActor);
+
+	if (UAbilitySystemComponent* SourceASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Projectile.Source.Get()))
+	{
+		for (const TWeakObjectPtr<UPCEffectSpec>& EffectSpec : Projectile.EffectSpecs)
+		{
+			if (EffectSpec.IsValid())
+			{
+				EffectSpec->ApplyEffect(SourceASC, HitActor);
+			}
+		}
+	}
+
+	PlayHitEffect(Projectile.HitEffect, HitActor);
+
+	FPCProjectileImpactEvent& Event = PendingEventsBySeat.FindOrAdd(Projectile.BoardSeatIndex).ImpactEvents.AddDefaulted_GetRef();
+	Event.ProjectileId = Projectile.Id;
+	Event.HitActor = HitActor;
+	Event.bDestroyProjectile = !Projectile.bIsPenetrating;
+}
+
+void UPCProjectileSimSubsystem::PlayHitEffect(const UParticleSystem* HitEffect, const AActor* HitActor) const
+{
+	if (!HitEffect || !HitActor || !ShouldDrawVisuals())
+		return;
+
+	UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), const_cast<UParticleSystem*>(HitEffect),
+		HitActor->GetActorLocation(), HitActor->GetActorRotation());
+}
+
+APCProjectileSimReplicator* UPCProjectileSimSubsystem::GetOrCreateReplicator(int32 BoardSeatIndex)
+{
+	TObjectPtr<APCProjectileSimReplicator>& Replicator = Replicators.FindOrAdd(BoardSeatIndex);
+	if (!Replicator)
+	{
+		FActorSpawnParameters Params;
+		Params.ObjectFlags |= RF_Transient;
+		Replicator = GetWorld()->SpawnActor<APCProjectileSimReplicator>(Params);
+		if (Replicator)
+		{
+			Replicator->BoardSeatIndex = BoardSeatIndex;
+		}
+	}
+
+	return Replicator;
+}
+
+void UPCProjectileSimSubsystem::FlushEvents()
+{
+	for (auto& Pair : PendingEventsBySeat)
+	{
+		FPendingEvents& Pending = Pair.Value;
+		if (Pending.SpawnEvents.IsEmpty() && Pending.ImpactEvents.IsEmpty())
+			continue;
+
+		APCProjectileSimReplicator* Replicator = Replicators.FindRef(Pair.Key);
+		if (!Replicator)
+		{
+			Pending.SpawnEvents.Reset();
+			Pending.ImpactEvents.Reset();
+			continue;
+		}
+
+		if (Pending.SpawnEvents.Num() > 0)
+		{
+			INC_DWORD_STAT_BY(STAT_PCProjectileSim_SpawnEvents, Pending.SpawnEvents.Num());
+			Replicator->Multicast_SpawnProjectiles(Pending.SpawnEvents);
+			Pending.SpawnEvents.Reset();
+		}
+
+		if (Pending.ImpactEvents.Num() > 0)
+		{
+			INC_DWORD_STAT_BY(STAT_PCProjectileSim_ImpactEvents, Pending.ImpactEvents.Num());
+			Replicator->Multicast_ImpactProjectiles(Pending.ImpactEvents);
+			Pending.ImpactEvents.Reset();
+		}
+	}
+}
+
+void UPCProjectileSimSubsystem::HandleSpawnEvents(const TArray<FPCProjectileSpawnEvent>& Events)
+{
+	for (const FPCProjectileSpawnEvent& Event : Events)
+	{
+		if (const FPCProjectileData* Data = FindProjectileData(Event.CharacterTag, Event.AttackTypeTag))
+		{
+			AddProjectile(Event.ProjectileId, Event.Location, Event.Direction, Event.Target, *Data);
+		}
+	}
+}
+
+void UPCProjectileSimSubsystem::HandleImpactEvents(const TArray<FPCProjectileImpactEvent>& Events)
+{
+	for (const FPCProjectileImpactEvent& Event : Events)
+	{
+		const int32 Index = Projectiles.IndexOfByPredicate([&Event](const FSimProjectile& Projectile)
+		{
+			return Projectile.Id == Event.ProjectileId;
+		});
+
+		if (Index == INDEX_NONE)
+		{
+			// 이미 예측으로 연출했거나 생성 이벤트가 유실된 발사체 (피격 이펙트 정보가 없으므로 무시)
+			continue;
+		}
+
+		PlayHitEffect(Projectiles[Index].HitEffect, Event.HitActor);
+
+		if (Event.bDestroyProjectile)
+		{
+			RemoveProjectileAt(Index);
+		}
+	}
+}
+
+int32 UPCProjectileSimSubsystem::AcquireVisual(const FPCProjectileData& Data, const FVector& Location, const FVector& Direction)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return INDEX_NONE;
+
+	int32 VisualIndex;
+	if (FreeVisualIndices.Num() > 0)
+	{
+		VisualIndex = FreeVisualIndices.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		FPCSimProjectileVisual& NewVisual = Visuals.AddDefaulted_GetRef();
+		VisualIndex = Visuals.Num() - 1;
+
+		NewVisual.Mesh = NewObject<UStaticMeshComponent>(this);
+		NewVisual.Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		NewVisual.Mesh->SetCastShadow(false);
+		NewVisual.Mesh->SetMobility(EComponentMobility::Movable);
+		NewVisual.Mesh->RegisterComponentWithWorld(World);
+
+		NewVisual.Trail = NewObject<UParticleSystemComponent>(this);
+		NewVisual.Trail->bAutoActivate = false;
+		NewVisual.Trail->SetupAttachment(NewVisual.Mesh);
+		NewVisual.Trail->RegisterComponentWithWorld(World);
+	}
+
+	const FPCSimProjectileVisual& Visual = Visuals[VisualIndex];
+	Visual.Mesh->SetStaticMesh(Data.Mesh);
+	Visual.Mesh->SetWorldLocationAndRotation(Location, Direction.ToOrientationQuat() * MeshRelativeRotation);
+	Visual.Mesh->SetVisibility(true);
+
+	if (Data.TrailEffect)
+	{
+		Visual.Trail->SetTemplate(Data.TrailEffect);
+		Visual.Trail->Activate(true);
+	}
+
+	return VisualIndex;
+}
+
+void UPCProjectileSimSubsystem::ReleaseVisual(int32 VisualIndex)
+{
+	if (!Visuals.IsValidIndex(VisualIndex))
+		return;
+
+	const FPCSimProjectileVisual& Visual = Visuals[VisualIndex];
+	if (Visual.Trail)
+	{
+		Visual.Trail->Deactivate();
+	}
+	if (Visual.Mesh)
+	{
+		Visual.Mesh->SetVisibility(false);
+	}
+
+	FreeVisualIndices.Add(VisualIndex);
+}
+
+void UPCProjectileSimSubsystem::UpdateVisual(const FSimProjectile& Projectile) const
+{
+	if (!Visuals.IsValidIndex(Projectile.VisualIndex))
+		return;
+
+	if (UStaticMeshComponent* Mesh = Visuals[Projectile.VisualIndex].Mesh)
+	{
+		const FQuat Rotation = Projectile.Velocity.IsNearlyZero()
+			? Mesh->GetComponentQuat()
+			: Projectile.Velocity.ToOrientationQuat() * MeshRelativeRotation;
+		Mesh->SetWorldLocationAndRotation(Projectile.Location, Rotation);
+	}
+}
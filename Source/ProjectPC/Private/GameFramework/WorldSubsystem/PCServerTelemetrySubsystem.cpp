@@ -0,0 +1,393 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
+
+#include "EngineUtils.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+
+#include "Character/Unit/PCBaseUnitCharacter.h"
+#include "GameFramework/GameState/PCCombatGameState.h"
+#include "GameFramework/WorldSubsystem/PCProjectilePoolSubsystem.h"
+#include "GameFramework/WorldSubsystem/PCProjectileSimSubsystem.h"
+
+
+namespace
+{
+	// 캡처 중인 월드 수 (0 이면 FindActive 가 바로 null)
+	int32 GNumActiveTelemetryCaptures = 0;
+
+	// 콘솔 : PC.Telemetry.Start [Name]
+	FAutoConsoleCommandWithWorldAndArgs GPCTelemetryStartCommand(
+		TEXT("PC.Telemetry.Start"),
+		TEXT("Start writing server phase timings / live counts to Saved/Profiling/PCTelemetry CSV files. Args: [Name=Server]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UPCServerTelemetrySubsystem* Telemetry = World ? World->GetSubsystem<UPCServerTelemetrySubsystem>() : nullptr)
+			{
+				Telemetry->StartCapture(Args.IsValidIndex(0) ? Args[0] : FString());
+			}
+		}));
+
+	FAutoConsoleCommandWithWorld GPCTelemetryStopCommand(
+		TEXT("PC.Telemetry.Stop"),
+		TEXT("Stop the server telemetry capture and close the CSV files"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UPCServerTelemetrySubsystem* Telemetry = World ? World->GetSubsystem<UPCServerTelemetrySubsystem>() : nullptr)
+			{
+				Telemetry->StopCapture();
+			}
+		}));
+}
+
+void UPCServerTelemetrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 콘솔 입력이 없는 데디 서버용 (-PCTelemetry 또는 -PCTelemetry=Name)
+	FString Name;
+	if (FParse::Value(FCommandLine::Get(), TEXT("PCTelemetry="), Name) || FParse::Param(FCommandLine::Get(), TEXT("PCTelemetry")))
+	{
+		StartCapture(Name);
+	}
+}
+
+void UPCServerTelemetrySubsystem::Deinitialize()
+{
+	StopCapture();
+
+	Super::Deinitialize();
+}
+
+TStatId UPCServerTelemetrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPCServerTelemetrySubsystem, STATGROUP_Tickables);
+}
+
+UPCServerTelemetrySubsystem* UPCServerTelemetrySubsystem::FindActive(const UObject* WorldContextObject)
+{
+	if (GNumActiveTelemetryCaptures <= 0)
+		return nullptr;
+
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UPCServerTelemetrySubsystem* Telemetry = World ? World->GetSubsystem<UPCServerTelemetrySubsystem>() : nullptr;
+	return Telemetry && Telemetry->IsCapturing() ? Telemetry : nullptr;
+}
+
+const TCHAR* UPCServerTelemetrySubsystem::GetPhaseName(EPCTelemetryPhase Phase)
+{
+	switch (Phase)
+	{
+	case EPCTelemetryPhase::StartAllBattle:		return TEXT("StartAllBattle");
+	case EPCTelemetryPhase::PairSetupPlan:		return TEXT("PairSetupPlan");
+	case EPCTelemetryPhase::PairSetupCommit:	return TEXT("PairSetupCommit");
+	case EPCTelemetryPhase::FinishAllBattle:	return TEXT("FinishAllBattle");
+	case EPCTelemetryPhase::BTTask:				return TEXT("BTTask");
+	case EPCTelemetryPhase::ShopRefresh:		return TEXT("ShopRefresh");
+	case EPCTelemetryPhase::SynergyRecompute:	return TEXT("SynergyRecompute");
+	case EPCTelemetryPhase::LeaderboardRebuild:	return TEXT("LeaderboardRebuild");
+	case EPCTelemetryPhase::UnitSpawn:			return TEXT("UnitSpawn");
+	default:									return TEXT("Unknown");
+	}
+}
+
+bool UPCServerTelemetrySubsystem::StartCapture(const FString& Name)
+{
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Telemetry] Capture is server only"));
+		return false;
+	}
+
+	StopCapture();
+
+	CaptureName = Name.IsEmpty() ? TEXT("Server") : Name;
+	const FString BasePath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("PCTelemetry"),
+		FString::Printf(TEXT("%s_%s"), *CaptureName, *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"))));
+
+	FrameWriter.Reset(IFileManager::Get().CreateFileWriter(*(BasePath + TEXT("_Frames.csv"))));
+	RoundWriter.Reset(IFileManager::Get().CreateFileWriter(*(BasePath + TEXT("_Rounds.csv"))));
+	ConnectionWriter.Reset(IFileManager::Get().CreateFileWriter(*(BasePath + TEXT("_Connections.csv"))));
+	if (!FrameWriter || !RoundWriter || !ConnectionWriter)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Telemetry] Failed to open %s_*.csv"), *BasePath);
+		FrameWriter.Reset();
+		RoundWriter.Reset();
+		ConnectionWriter.Reset();
+		return false;
+	}
+
+	// 헤더
+	FString FrameHeader = TEXT("Frame,TimeSec,Stage,Round,FrameMs");
+	FString RoundHeader = TEXT("Stage,Round,DurationSec,Frames,AvgFrameMs,MaxFrameMs,PeakUnits,PeakProjectiles,InKB,OutKB,AvgInKBps,AvgOutKBps,PeakOutKBps");
+	for (int32 i = 0; i < NumPhases; ++i)
+	{
+		const TCHAR* PhaseName = GetPhaseName(static_cast<EPCTelemetryPhase>(i));
+		FrameHeader += FString::Printf(TEXT(",%sMs,%sCalls"), PhaseName, PhaseName);
+		RoundHeader += FString::Printf(TEXT(",%sMs,%sMaxFrameMs,%sCalls"), PhaseName, PhaseName, PhaseName);
+	}
+	FrameHeader += TEXT(",LiveUnits,PooledUnits,Projectiles,Connections,ServerRpcs,MaxConnectionRpcs");
+
+	WriteLine(*FrameWriter, FrameHeader);
+	WriteLine(*RoundWriter, RoundHeader);
+	WriteLine(*ConnectionWriter, TEXT("Stage,Round,Connection,ServerRpcs,RpcsPerSec,PeakFrameRpcs,InBytesPerSec,OutBytesPerSec"));
+
+	for (FPhaseStats& Stats : Phases)
+	{
+		Stats = FPhaseStats();
+	}
+	Connections.Reset();
+	CaptureFrames = 0;
+	LastTickCycles = FPlatformTime::Cycles64();
+
+	const APCCombatGameState* GS = World->GetGameState<APCCombatGameState>();
+	ResetRound(GS ? GS->GetStageIndex() : 0, GS ? GS->GetRoundIndex() : 0);
+
+	++GNumActiveTelemetryCaptures;
+	UE_LOG(LogTemp, Log, TEXT("[Telemetry] Capture started : %s_*.csv"), *BasePath);
+	return true;
+}
+
+void UPCServerTelemetrySubsystem::StopCapture()
+{
+	if (!IsCapturing())
+		return;
+
+	WriteRoundRows();
+
+	FrameWriter->Close();
+	RoundWriter->Close();
+	ConnectionWriter->Close();
+	FrameWriter.Reset();
+	RoundWriter.Reset();
+	ConnectionWriter.Reset();
+
+	--GNumActiveTelemetryCaptures;
+	UE_LOG(LogTemp, Log, TEXT("[Telemetry] Capture stopped : %s, %lld frames"), *CaptureName, CaptureFrames);
+}
+
+void UPCServerTelemetrySubsystem::BeginPhase(EPCTelemetryPhase Phase)
+{
+	FPhaseStats& Stats = Phases[static_cast<int32>(Phase)];
+	if (Stats.Depth++ == 0)
+	{
+		Stats.StartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+void UPCServerTelemetrySubsystem::EndPhase(EPCTelemetryPhase Phase)
+{
+	FPhaseStats& Stats = Phases[static_cast<int32>(Phase)];
+	if (Stats.Depth <= 0)
+		return;
+
+	if (--Stats.Depth == 0)
+	{
+		Stats.FrameCycles += FPlatformTime::Cycles64() - Stats.StartCycles;
+		++Stats.FrameCalls;
+	}
+}
+
+void UPCServerTelemetrySubsystem::NoteServerRpc(const APlayerController* Controller)
+{
+	if (!Controller)
+		return;
+
+	FConnectionStats& Stats = Connections.FindOrAdd(Controller);
+	if (Stats.Label.IsEmpty())
+	{
+		const APlayerState* PS = Controller->GetPlayerState<APlayerState>();
+		Stats.Label = PS ? PS->GetPlayerName() : Controller->GetName();
+	}
+	++Stats.FrameRpcs;
+}
+
+void UPCServerTelemetrySubsystem::CountLiveActors(int32& OutLiveUnits, int32& OutPooledUnits, int32& OutProjectiles) const
+{
+	OutLiveUnits = OutPooledUnits = OutProjectiles = 0;
+
+	UWorld* World = GetWorld();
+	for (TActorIterator<APCBaseUnitCharacter> It(World); It; ++It)
+	{
+		if (It->IsInUnitPool())
+		{
+			++OutPooledUnits;
+		}
+		else if (!It->IsDead() && !It->IsActorBeingDestroyed())
+		{
+			++OutLiveUnits;
+		}
+	}
+
+	// 경량 시뮬레이션 발사체 + 풀 액터 발사체 (PC.Projectile.Simulated 0 이거나 시뮬레이션 실패로 액터로 발사된 경우)
+	if (const UPCProjectileSimSubsystem* ProjectileSim = World ? World->GetSubsystem<UPCProjectileSimSubsystem>() : nullptr)
+	{
+		OutProjectiles += ProjectileSim->GetNumActiveProjectiles();
+	}
+
+	if (const UPCProjectilePoolSubsystem* ProjectilePool = World ? World->GetSubsystem<UPCProjectilePoolSubsystem>() : nullptr)
+	{
+		OutProjectiles += ProjectilePool->GetNumActiveProjectiles();
+	}
+}
+
+void UPCServerTelemetrySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!IsCapturing())
+		return;
+
+	const UWorld* World = GetWorld();
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	const double FrameMs = FPlatformTime::ToMilliseconds64(NowCycles - LastTickCycles);
+	LastTickCycles = NowCycles;
+
+	// 라운드가 바뀌었으면 이전 라운드 요약을 먼저 기록
+	const APCCombatGameState* GS = World ? World->GetGameState<APCCombatGameState>() : nullptr;
+	const int32 Stage = GS ? GS->GetStageIndex() : 0;
+	const int32 Round = GS ? GS->GetRoundIndex() : 0;
+	if (Stage != RoundStage || Round != RoundIndex)
+	{
+		WriteRoundRows();
+		ResetRound(Stage, Round);
+	}
+
+	int32 LiveUnits, PooledUnits, Projectiles;
+	CountLiveActors(LiveUnits, PooledUnits, Projectiles);
+
+	FString Line = FString::Printf(TEXT("%lld,%.3f,%d,%d,%.3f"),
+		CaptureFrames, World ? World->GetTimeSeconds() : 0.0, Stage, Round, FrameMs);
+
+	for (FPhaseStats& Stats : Phases)
+	{
+		const double PhaseMs = FPlatformTime::ToMilliseconds64(Stats.FrameCycles);
+		Line += FString::Printf(TEXT(",%.3f,%d"), PhaseMs, Stats.FrameCalls);
+
+		Stats.RoundMs += PhaseMs;
+		Stats.RoundMaxFrameMs = FMath::Max(Stats.RoundMaxFrameMs, PhaseMs);
+		Stats.RoundCalls += Stats.FrameCalls;
+		Stats.FrameCycles = 0;
+		Stats.FrameCalls = 0;
+	}
+
+	int32 ServerRpcs = 0;
+	int32 MaxConnectionRpcs = 0;
+	for (auto& Pair : Connections)
+	{
+		FConnectionStats& Stats = Pair.Value;
+		ServerRpcs += Stats.FrameRpcs;
+		MaxConnectionRpcs = FMath::Max(MaxConnectionRpcs, Stats.FrameRpcs);
+		Stats.RoundRpcs += Stats.FrameRpcs;
+		Stats.RoundPeakFrameRpcs = FMath::Max(Stats.RoundPeakFrameRpcs, Stats.FrameRpcs);
+		Stats.FrameRpcs = 0;
+	}
+
+	const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	const int32 NumConnections = NetDriver ? NetDriver->ClientConnections.Num() : 0;
+	if (NetDriver)
+	{
+		RoundInBytes += NetDriver->InBytesPerSecond * FrameMs * 0.001;
+		RoundOutBytes += NetDriver->OutBytesPerSecond * FrameMs * 0.001;
+		RoundPeakOutBytesPerSec = FMath::Max(RoundPeakOutBytesPerSec, NetDriver->OutBytesPerSecond);
+	}
+	Line += FString::Printf(TEXT(",%d,%d,%d,%d,%d,%d"), LiveUnits, PooledUnits, Projectiles, NumConnections, ServerRpcs, MaxConnectionRpcs);
+	WriteLine(*FrameWriter, Line);
+
+	++CaptureFrames;
+	++RoundFrames;
+	RoundFrameMsSum += FrameMs;
+	RoundFrameMsMax = FMath::Max(RoundFrameMsMax, FrameMs);
+	RoundPeakUnits = FMath::Max(RoundPeakUnits, LiveUnits);
+	RoundPeakProjectiles = FMath::Max(RoundPeakProjectiles, Projectiles);
+}
+
+void UPCServerTelemetrySubsystem::WriteRoundRows()
+{
+	if (!IsCapturing() || RoundFrames <= 0)
+		return;
+
+	const UWorld* World = GetWorld();
+	const double Duration = World ? FMath::Max(World->GetTimeSeconds() - RoundStartTime, 0.0) : 0.0;
+
+	FString Line = FString::Printf(TEXT("%d,%d,%.3f,%lld,%.3f,%.3f,%d,%d,%.1f,%.1f,%.2f,%.2f,%.2f"),
+		RoundStage, RoundIndex, Duration, RoundFrames, RoundFrameMsSum / RoundFrames, RoundFrameMsMax, RoundPeakUnits, RoundPeakProjectiles,
+		RoundInBytes / 1024.0, RoundOutBytes / 1024.0,
+		Duration > 0.0 ? RoundInBytes / 1024.0 / Duration : 0.0, Duration > 0.0 ? RoundOutBytes / 1024.0 / Duration : 0.0,
+		RoundPeakOutBytesPerSec / 1024.0);
+	for (const FPhaseStats& Stats : Phases)
+	{
+		Line += FString::Printf(TEXT(",%.3f,%.3f,%lld"), Stats.RoundMs, Stats.RoundMaxFrameMs, Stats.RoundCalls);
+	}
+	WriteLine(*RoundWriter, Line);
+
+	for (const auto& Pair : Connections)
+	{
+		const FConnectionStats& Stats = Pair.Value;
+
+		// 바이트 통계는 엔진이 연결마다 1초 단위로 갱신하는 값
+		const APlayerController* Controller = Pair.Key.ResolveObjectPtr();
+		const UNetConnection* NetConnection = Controller ? Controller->GetNetConnection() : nullptr;
+
+		WriteLine(*ConnectionWriter, FString::Printf(TEXT("%d,%d,%s,%lld,%.2f,%d,%d,%d"),
+			RoundStage, RoundIndex, *Stats.Label.Replace(TEXT(","), TEXT("_")), Stats.RoundRpcs,
+			Duration > 0.0 ? Stats.RoundRpcs / Duration : 0.0, Stats.RoundPeakFrameRpcs,
+			NetConnection ? NetConnection->InBytesPerSecond : 0, NetConnection ? NetConnection->OutBytesPerSecond : 0));
+	}
+
+	// 라운드 단위로 디스크에 반영 (서버가 비정상 종료돼도 지난 라운드까지는 남도록)
+	FrameWriter->Flush();
+	RoundWriter->Flush();
+	ConnectionWriter->Flush();
+}
+
+void UPCServerTelemetrySubsystem::ResetRound(int32 Stage, int32 Round)
+{
+	const UWorld* World = GetWorld();
+
+	RoundStage = Stage;
+	RoundIndex = Round;
+	RoundStartTime = World ? World->GetTimeSeconds() : 0.0;
+	RoundFrames = 0;
+	RoundFrameMsSum = 0.0;
+	RoundFrameMsMax = 0.0;
+	RoundPeakUnits = 0;
+	RoundPeakProjectiles = 0;
+	RoundInBytes = 0.0;
+	RoundOutBytes = 0.0;
+	RoundPeakOutBytesPerSec = 0;
+
+	for (FPhaseStats& Stats : Phases)
+	{
+		Stats.RoundMs = 0.0;
+		Stats.RoundMaxFrameMs = 0.0;
+		Stats.RoundCalls = 0;
+	}
+
+	// 나간 연결은 정리
+	for (auto It = Connections.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		It.Value().RoundRpcs = 0;
+		It.Value().RoundPeakFrameRpcs = 0;
+	}
+}
+
+void UPCServerTelemetrySubsystem::WriteLine(FArchive& Writer, const FString& Line)
+{
+	const FTCHARToUTF8 Utf8(*(Line + TEXT("\n")));
+	Writer.Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+}
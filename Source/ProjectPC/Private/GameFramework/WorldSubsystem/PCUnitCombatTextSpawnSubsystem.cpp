@@ -3,6 +3,76 @@
 
 #include "GameFramework/WorldSubsystem/PCUnitCombatTextSpawnSubsystem.h"
 
+#include "BaseGameplayTags.h"
+#include "EngineUtils.h"
+#include "Character/Unit/PCBaseUnitCharacter.h"
+#include "Engine/GameViewportClient.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/WorldSubsystem/PCActorPoolSubsystem.h"
+#include "Styling/CoreStyle.h"
+#include "UI/Unit/PCSUnitCombatTextLayer.h"
+#include "UI/Unit/PCUnitCombatText.h"
+
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarPCCombatTextBatched(
+		TEXT("PC.CombatText.Batched"),
+		true,
+		TEXT("전투 텍스트를 뷰포트 레이어 하나에서 일괄로 그리기 (0이면 숫자마다 풀링된 위젯 액터 사용)"));
+
+	// HUD(UMG) 아래에 깔리도록
+	constexpr int32 CombatTextLayerZOrder = -10;
+
+	// 위젯은 치명타에 이미지를 붙이지만 일괄 렌더러는 글자만 그리므로 대신 크게
+	constexpr float CriticalFontSize = 24.f;
+
+	// 위젯 애니메이션 샘플 수 (사이는 선형 보간)
+	constexpr int32 MotionSampleCount = 32;
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithWorldAndArgs GPCCombatTextStressCommand(
+		TEXT("PC.CombatText.Stress"),
+		TEXT("Emit random combat texts at a fixed rate and log client frame time when done. Args: [PerSecond=500] [Seconds=10] | stop"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UPCUnitCombatTextSpawnSubsystem* Subsystem = World ? World->GetSubsystem<UPCUnitCombatTextSpawnSubsystem>() : nullptr;
+			if (!Subsystem)
+				return;
+
+			if (Args.IsValidIndex(0) && Args[0] == TEXT("stop"))
+			{
+				Subsystem->StopStress();
+				return;
+			}
+
+			Subsystem->StartStress(
+				Args.IsValidIndex(0) ? FCString::Atof(*Args[0]) : 500.f,
+				Args.IsValidIndex(1) ? FCString::Atof(*Args[1]) : 10.f);
+		}));
+#endif
+}
+
+void UPCUnitCombatTextSpawnSubsystem::Deinitialize()
+{
+	if (TextLayer.IsValid())
+	{
+		if (UGameViewportClient* Viewport = GetWorld() ? GetWorld()->GetGameViewport() : nullptr)
+		{
+			Viewport->RemoveViewportWidgetContent(TextLayer.ToSharedRef());
+		}
+		TextLayer.Reset();
+	}
+
+	BatchedTexts.Reset();
+	Super::Deinitialize();
+}
+
+TStatId UPCUnitCombatTextSpawnSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPCUnitCombatTextSpawnSubsystem, STATGROUP_Tickables);
+}
 
 void UPCUnitCombatTextSpawnSubsystem::InitCombatTextSpawnSubsystem(
 	const TSoftClassPtr<APCUnitCombatTextActor>& InCombatTextActorClass)
@@ -11,11 +81,24 @@ void UPCUnitCombatTextSpawnSubsystem::InitCombatTextSpawnSubsystem(
 
 	if (CombatTextActorClass)
 	{
+		// 일괄 렌더러도 위젯 블루프린트에 지정된 색을 그대로 사용
+		if (const UPCUnitCombatText* WidgetCDO = GetCombatTextWidgetCDO())
+		{
+			PhysicalDamageColor = WidgetCDO->GetTypeColor(UnitGameplayTags::Unit_CombatText_Type_Damage_Physical);
+			MagicDamageColor = WidgetCDO->GetTypeColor(UnitGameplayTags::Unit_CombatText_Type_Damage_Magic);
+			TrueDamageColor = WidgetCDO->GetTypeColor(UnitGameplayTags::Unit_CombatText_Type_Damage_TrueDamage);
+			HealColor = WidgetCDO->GetTypeColor(UnitGameplayTags::Unit_CombatText_Type_Heal);
+			MissColor = WidgetCDO->GetTypeColor(UnitGameplayTags::Unit_CombatText_Type_Miss);
+		}
+
 		// 지정한 갯수만큼 미리 생성
-		for (int8 i=0; i<PrewarmCount; ++i)
+		if (auto* ActorPool = GetWorld() ? GetWorld()->GetSubsystem<UPCActorPoolSubsystem>() : nullptr)
 		{
-			if (APCUnitCombatTextActor* CombatTextActor = SpawnNewCombatTextActor())
-				CombatTextActor->ReturnToPool();
+			FPCActorPoolConfig Config;
+			Config.PrewarmCount = PrewarmCount;
+			Config.MaxPooledCount = MaxPooledCount;
+			Config.IdleTrimSeconds = IdleTrimSeconds;
+			ActorPool->RegisterPool(CombatTextActorClass, Config);
 		}
 	}
 	else
@@ -25,12 +108,27 @@ void UPCUnitCombatTextSpawnSubsystem::InitCombatTextSpawnSubsystem(
 void UPCUnitCombatTextSpawnSubsystem::SpawnCombatText(const USceneComponent* AttachToComp,
 	const FCombatTextInitParams& InitParams)
 {
+	if (!AttachToComp)
+		return;
+
+	SpawnCombatTextAt(AttachToComp->GetSocketLocation(InitParams.AttachSocketName), InitParams);
+}
+
+void UPCUnitCombatTextSpawnSubsystem::SpawnCombatTextAt(const FVector& AnchorLocation,
+	const FCombatTextInitParams& InitParams)
+{
+	if (CVarPCCombatTextBatched.GetValueOnGameThread())
+	{
+		AddBatchedText(AnchorLocation, InitParams);
+		return;
+	}
+
 	if (!CombatTextActorClass)
 		return;
 
 	if (APCUnitCombatTextActor* CombatText = GetCombatTextActor())
 	{
-		CombatText->InitCombatTextActor(AttachToComp, InitParams);
+		CombatText->InitCombatTextActor(AnchorLocation, InitParams);
 	}
 }
 
@@ -38,38 +136,274 @@ void UPCUnitCombatTextSpawnSubsystem::ReturnToPool(APCUnitCombatTextActor* Comba
 {
 	if (!CombatTextActor)
 		return;
-	
-	CombatTextPool.Enqueue(CombatTextActor);
+
+	if (auto* ActorPool = GetWorld() ? GetWorld()->GetSubsystem<UPCActorPoolSubsystem>() : nullptr)
+	{
+		ActorPool->Release(CombatTextActor);
+	}
+	else
+	{
+		CombatTextActor->Destroy();
+	}
 }
 
 APCUnitCombatTextActor* UPCUnitCombatTextSpawnSubsystem::GetCombatTextActor()
 {
-	APCUnitCombatTextActor* CombatText = nullptr;
-	// 큐에서 꺼내는데 큐가 비어있을 경우 액터 새로 생성
-	if (!CombatTextPool.Dequeue(CombatText))
+	auto* ActorPool = GetWorld() ? GetWorld()->GetSubsystem<UPCActorPoolSubsystem>() : nullptr;
+	if (!ActorPool)
+		return nullptr;
+
+	// 풀에서 꺼내는데 풀이 비어있을 경우 액터 새로 생성
+	APCUnitCombatTextActor* CombatText = ActorPool->Acquire<APCUnitCombatTextActor>(CombatTextActorClass);
+	if (CombatText)
 	{
-		CombatText = SpawnNewCombatTextActor();
+		CombatText->SetActorHiddenInGame(true);
 	}
 
-	CombatText->SetActorHiddenInGame(true);
 	return CombatText;
 }
 
-APCUnitCombatTextActor* UPCUnitCombatTextSpawnSubsystem::SpawnNewCombatTextActor() const
+const UPCUnitCombatText* UPCUnitCombatTextSpawnSubsystem::GetCombatTextWidgetCDO() const
 {
-	UWorld* World = GetWorld();
-	
-	if (!CombatTextActorClass || !World)
-		return nullptr;
+	const APCUnitCombatTextActor* ActorCDO = CombatTextActorClass ? CombatTextActorClass->GetDefaultObject<APCUnitCombatTextActor>() : nullptr;
+	const TSubclassOf<UUserWidget> WidgetClass = ActorCDO ? ActorCDO->GetCombatTextWidgetClass() : nullptr;
+	return WidgetClass ? Cast<UPCUnitCombatText>(WidgetClass->GetDefaultObject()) : nullptr;
+}
+
+bool UPCUnitCombatTextSpawnSubsystem::EnsureTextLayer()
+{
+	if (TextLayer.IsValid())
+		return true;
+
+	// 데디 서버 / 뷰포트 없는 월드는 그릴 곳이 없음
+	UGameViewportClient* Viewport = GetWorld() ? GetWorld()->GetGameViewport() : nullptr;
+	if (!Viewport || !FSlateApplication::IsInitialized())
+		return false;
+
+	CacheWidgetStyle();
+
+	TextLayer = SNew(PCSUnitCombatTextLayer, this);
+	Viewport->AddViewportWidgetContent(TextLayer.ToSharedRef(), CombatTextLayerZOrder);
+	return true;
+}
+
+void UPCUnitCombatTextSpawnSubsystem::CacheWidgetStyle()
+{
+	// 위젯 블루프린트의 ValueText 폰트에 UPCUnitCombatText 와 같은 타입별 글자 크기만 적용
+	const UPCUnitCombatText* WidgetCDO = GetCombatTextWidgetCDO();
+	FSlateFontInfo BaseFont;
+	if (!WidgetCDO || !WidgetCDO->GetTemplateValueFont(BaseFont))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[CombatText] ValueText template not found, batched texts use the default font"));
+		BaseFont = FCoreStyle::GetDefaultFontStyle("Bold", UPCUnitCombatText::DamageFontSize);
+	}
+
+	const float FontSizes[] = { UPCUnitCombatText::DamageFontSize, CriticalFontSize, UPCUnitCombatText::HealFontSize, UPCUnitCombatText::MissFontSize };
+	static_assert(UE_ARRAY_COUNT(FontSizes) == static_cast<int32>(EPCCombatTextStyle::Num), "Font size per combat text style");
+	for (int32 i = 0; i < UE_ARRAY_COUNT(FontSizes); ++i)
+	{
+		StyleFonts[i] = BaseFont;
+		StyleFonts[i].Size = FontSizes[i];
+	}
+
+	// 움직임 / 수명도 위젯이 재생하는 애니메이션에서 (없으면 FPCCombatTextMotion 기본 움직임)
+	FPCCombatTextMotion DamageMotion;
+	FPCCombatTextMotion HealMotion;
+	if (WidgetCDO)
+	{
+		WidgetCDO->SampleTemplateAnimation(false, MotionSampleCount, DamageMotion);
+		WidgetCDO->SampleTemplateAnimation(true, MotionSampleCount, HealMotion);
+	}
+
+	StyleMotions[static_cast<int32>(EPCCombatTextStyle::Damage)] = DamageMotion;
+	StyleMotions[static_cast<int32>(EPCCombatTextStyle::Critical)] = DamageMotion;
+	StyleMotions[static_cast<int32>(EPCCombatTextStyle::Heal)] = HealMotion;
+	StyleMotions[static_cast<int32>(EPCCombatTextStyle::Miss)] = DamageMotion;
+}
+
+void UPCUnitCombatTextSpawnSubsystem::AddBatchedText(const FVector& AnchorLocation,
+	const FCombatTextInitParams& InitParams)
+{
+	if (BatchedTexts.Num() >= MaxBatchedTexts || !EnsureTextLayer())
+		return;
+
+	FPCCombatTextEntry& Entry = BatchedTexts.AddDefaulted_GetRef();
+
+	// 위치 계산 (APCUnitCombatTextActor::InitCombatTextActor 와 동일)
+	Entry.WorldLocation = AnchorLocation;
+	Entry.WorldLocation.Z += InitParams.VerticalOffset;
 
-	FActorSpawnParameters Params;
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	Params.bNoFail = true;
+	const float J = InitParams.RandomXYJitter;
+	Entry.WorldLocation.X += FMath::FRandRange(-J, J);
+	Entry.WorldLocation.Y += FMath::FRandRange(-J, J);
 
-	APCUnitCombatTextActor* CombatTextActor = World->SpawnActor<APCUnitCombatTextActor>(
-		CombatTextActorClass,
-		FTransform::Identity,
-		Params);
-	
-	return CombatTextActor;
+	const FGameplayTag& TypeTag = InitParams.CombatTextTypeTag;
+	if (TypeTag.MatchesTagExact(UnitGameplayTags::Unit_CombatText_Type_Heal))
+	{
+		Entry.Style = EPCCombatTextStyle::Heal;
+		Entry.Text = FString::Printf(TEXT("+%d"), FMath::RoundToInt(InitParams.Value));
+		Entry.Color = HealColor;
+	}
+	else if (TypeTag.MatchesTagExact(UnitGameplayTags::Unit_CombatText_Type_Miss))
+	{
+		Entry.Style = EPCCombatTextStyle::Miss;
+		Entry.Text = TEXT("빗나감!");
+		Entry.Color = MissColor;
+	}
+	else
+	{
+		Entry.Style = InitParams.bCritical ? EPCCombatTextStyle::Critical : EPCCombatTextStyle::Damage;
+		Entry.Text = FText::AsNumber(FMath::RoundToInt(InitParams.Value)).ToString();
+
+		if (TypeTag.MatchesTagExact(UnitGameplayTags::Unit_CombatText_Type_Damage_Magic))
+			Entry.Color = MagicDamageColor;
+		else if (TypeTag.MatchesTagExact(UnitGameplayTags::Unit_CombatText_Type_Damage_TrueDamage))
+			Entry.Color = TrueDamageColor;
+		else
+			Entry.Color = PhysicalDamageColor;
+	}
+
+	const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	Entry.TextSize = FVector2f(FontMeasure->Measure(Entry.Text, GetStyleFont(Entry.Style)));
+	Entry.Lifetime = GetStyleMotion(Entry.Style).Duration;
+}
+
+void UPCUnitCombatTextSpawnSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bStressActive)
+	{
+		TickStress(DeltaTime);
+	}
+
+	if (BatchedTexts.IsEmpty())
+		return;
+
+	for (FPCCombatTextEntry& Entry : BatchedTexts)
+	{
+		Entry.Age += DeltaTime;
+	}
+
+	BatchedTexts.RemoveAllSwap([](const FPCCombatTextEntry& Entry) { return Entry.Age >= Entry.Lifetime; });
+
+	// 화면 좌표는 여기서 한 번만 계산 (레이어는 그리기만)
+	const APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	for (FPCCombatTextEntry& Entry : BatchedTexts)
+	{
+		FVector2D ScreenPosition;
+		Entry.bOnScreen = PC && PC->ProjectWorldLocationToScreen(Entry.WorldLocation, ScreenPosition, true);
+		Entry.ScreenPosition = FVector2f(ScreenPosition);
+	}
+}
+
+void UPCUnitCombatTextSpawnSubsystem::StartStress(float PerSecond, float Seconds)
+{
+#if !UE_BUILD_SHIPPING
+	Stress = FStressState();
+	Stress.PerSecond = FMath::Max(1.f, PerSecond);
+	Stress.Duration = Stress.Remaining = FMath::Max(0.1f, Seconds);
+	Stress.Random.Initialize(1);
+
+	// 보드 위 유닛 위치를 기준점으로 (없으면 카메라 앞)
+	for (TActorIterator<APCBaseUnitCharacter> It(GetWorld()); It && Stress.Anchors.Num() < 64; ++It)
+	{
+		if (!It->IsHidden())
+		{
+			Stress.Anchors.Add(It->GetActorLocation());
+		}
+	}
+
+	if (Stress.Anchors.IsEmpty())
+	{
+		const APlayerController* PC = GetWorld()->GetFirstPlayerController();
+		if (!PC)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[CombatText] Stress needs a local player"));
+			return;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		Stress.Anchors.Add(ViewLocation + ViewRotation.Vector() * 1500.f);
+	}
+
+	bStressActive = true;
+	UE_LOG(LogTemp, Log, TEXT("[CombatText] Stress start : %.0f/s for %.1fs (%s)"),
+		Stress.PerSecond, Stress.Duration, CVarPCCombatTextBatched.GetValueOnGameThread() ? TEXT("Batched") : TEXT("Actors"));
+#endif
+}
+
+void UPCUnitCombatTextSpawnSubsystem::StopStress()
+{
+	if (!bStressActive)
+		return;
+
+	bStressActive = false;
+
+	const double AvgMs = Stress.Frames > 0 ? Stress.FrameMsSum / Stress.Frames : 0.0;
+	UE_LOG(LogTemp, Log, TEXT("[CombatText] Stress done (%s) : %d texts in %.1fs, %d frames, frame avg %.2f ms / max %.2f ms, peak live %d"),
+		CVarPCCombatTextBatched.GetValueOnGameThread() ? TEXT("Batched") : TEXT("Actors"),
+		Stress.Emitted, Stress.Duration - FMath::Max(0.f, Stress.Remaining), Stress.Frames, AvgMs, Stress.FrameMsMax, Stress.PeakLive);
+}
+
+void UPCUnitCombatTextSpawnSubsystem::TickStress(float DeltaTime)
+{
+	const float FrameMs = DeltaTime * 1000.f;
+	++Stress.Frames;
+	Stress.FrameMsSum += FrameMs;
+	Stress.FrameMsMax = FMath::Max(Stress.FrameMsMax, FrameMs);
+
+	Stress.Remaining -= DeltaTime;
+	if (Stress.Remaining <= 0.f)
+	{
+		StopStress();
+		return;
+	}
+
+	static const FGameplayTag DamageTypes[] =
+	{
+		UnitGameplayTags::Unit_CombatText_Type_Damage_Physical,
+		UnitGameplayTags::Unit_CombatText_Type_Damage_Magic,
+		UnitGameplayTags::Unit_CombatText_Type_Damage_TrueDamage,
+	};
+
+	// 피해 75% (치명타 25%), 회복 15%, 빗나감 10%
+	Stress.Accumulator += Stress.PerSecond * DeltaTime;
+	for (; Stress.Accumulator >= 1.f; Stress.Accumulator -= 1.f)
+	{
+		FCombatTextInitParams Params;
+		const float Roll = Stress.Random.FRand();
+		if (Roll < 0.1f)
+		{
+			Params.CombatTextTypeTag = UnitGameplayTags::Unit_CombatText_Type_Miss;
+		}
+		else if (Roll < 0.25f)
+		{
+			Params.CombatTextTypeTag = UnitGameplayTags::Unit_CombatText_Type_Heal;
+			Params.Value = Stress.Random.FRandRange(20.f, 400.f);
+		}
+		else
+		{
+			Params.CombatTextTypeTag = DamageTypes[Stress.Random.RandHelper(UE_ARRAY_COUNT(DamageTypes))];
+			Params.bCritical = Stress.Random.FRand() < 0.25f;
+			Params.Value = Stress.Random.FRandRange(10.f, 2500.f);
+		}
+
+		const FVector& Anchor = Stress.Anchors[Stress.Random.RandHelper(Stress.Anchors.Num())];
+		SpawnCombatTextAt(Anchor + FVector(Stress.Random.FRandRange(-150.f, 150.f), Stress.Random.FRandRange(-150.f, 150.f), 0.f), Params);
+		++Stress.Emitted;
+	}
+
+	int32 Live = BatchedTexts.Num();
+	if (!CVarPCCombatTextBatched.GetValueOnGameThread())
+	{
+		Live = 0;
+		for (TActorIterator<APCUnitCombatTextActor> It(GetWorld()); It; ++It)
+		{
+			Live += It->IsHidden() ? 0 : 1;
+		}
+	}
+	Stress.PeakLive = FMath::Max(Stress.PeakLive, Live);
 }
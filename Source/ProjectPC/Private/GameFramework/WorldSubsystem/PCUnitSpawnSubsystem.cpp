@@ -11,37 +11,142 @@
 #include "Character/Unit/PCCarouselHeroCharacter.h"
 #include "Character/Unit/PCPreloadHeroActor.h"
 #include "Character/Unit/PCPreviewHeroActor.h"
+#include "AbilitySystem/Unit/PCUnitAbilitySystemComponent.h"
+#include "BaseGameplayTags.h"
+#include "AbilitySystem/Unit/AttributeSet/PCUnitAttributeSet.h"
 #include "Component/PCUnitEquipmentComponent.h"
 #include "UI/Unit/PCHeroStatusBarWidget.h"
 #include "UI/Unit/PCUnitStatusBarWidget.h"
 #include "Controller/Unit/PCUnitAIController.h"
+#include "EngineUtils.h"
 #include "GameFramework/GameState/PCCombatGameState.h"
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
 #include "Kismet/GameplayStatics.h"
+#include "Utility/PCAsyncLoad.h"
 
 void UPCUnitSpawnSubsystem::InitializeUnitSpawnConfig(const FSpawnSubsystemConfig& SpawnConfig)
 {
-	Registry = SpawnConfig.Registry.LoadSynchronous();
-	DefaultCreepClass = SpawnConfig.DefaultCreepClass.LoadSynchronous();
-	DefaultAppearanceChangedHeroClass = SpawnConfig.DefaultAppearanceChangedHeroClass.LoadSynchronous();
-	DefaultAppearanceFixedHeroClass = SpawnConfig.DefaultAppearanceFixedHeroClass.LoadSynchronous();
-	DefaultCreepStatusBarWidgetClass =SpawnConfig.CreepStatusBarWidgetClass.LoadSynchronous();
-	DefaultHeroStatusBarWidgetClass = SpawnConfig.HeroStatusBarWidgetClass.LoadSynchronous();
-	DefaultAIControllerClass = SpawnConfig.DefaultAIControllerClass.LoadSynchronous();
-	DefaultPreviewHeroClass = SpawnConfig.DefaultPreviewHeroClass.LoadSynchronous();
-	DefaultCarouselHeroClass = SpawnConfig.DefaultCarouselHeroClass.LoadSynchronous();
-	DefaultPreloadActorClass = SpawnConfig.DefaultPreloadActorClass.LoadSynchronous();
-	DefaultOutlineMaterial = SpawnConfig.DefaultOutlineMaterial.LoadSynchronous();
+	if (bSpawnConfigRequested)
+		return;
+
+	bSpawnConfigRequested = true;
+	SpawnConfigRequestSeconds = FPlatformTime::Seconds();
+
+	// 요청 도중 이미 로드된 에셋의 즉시 콜백으로 카운트가 0이 되지 않도록 요청 단계 동안 1 유지
+	PendingSpawnConfigLoads = 1;
+
+	// 멤버 할당은 전부 로드된 뒤 ApplyLoadedSpawnConfig에서 한 번에 (Registry만 먼저 잡혀 나머지가 null인 상태로 쓰이지 않도록)
+	RequestSpawnConfigAsset(SpawnConfig.Registry.ToSoftObjectPath(),
+		[this](UObject* Loaded) { Registry = Cast<UPCDataAsset_UnitDefinitionReg>(Loaded); });
+	RequestSpawnConfigAsset(SpawnConfig.DefaultCreepClass.ToSoftObjectPath(),
+		[this](UObject* Loaded) { DefaultCreepClass = Cast<UClass>(Loaded); });
+	RequestSpawnConfigAsset(SpawnConfig.DefaultAppearanceChangedHeroClass.ToSoftObjectPath(),
+		[this](UObject* Loaded) { DefaultAppearanceChangedHeroClass = Cast<UClass>(Loaded); });
+	RequestSpawnConfigAsset(SpawnConfig.DefaultAppearanceFixedHeroClass.ToSoftObjectPath(),
+		[this](UObject* Loaded) { DefaultAppearanceFixedHeroClass = Cast<UClass>(Loaded); });
+	RequestSpawnConfigAsset(SpawnConfig.CreepStatusBarWidgetClass.ToSoftObjectPath(),
+		[this](UObject* Loaded) { DefaultCreepStatusBarWidgetClass = Cast<UClass>(Loaded); });
+	RequestSpawnConfigAsset(SpawnConfig.HeroStatusBarWidgetClass.ToSoftObjectPath(),
+		[this](UObject* Loaded) { DefaultHeroStatusBarWidgetClass = Cast<UClass>(Loaded); });
+	RequestSpawnConfigAsset(SpawnConfig.DefaultAIControllerClass.ToSoftObjectPath(),
+		[this](UObject* Loaded) { DefaultAIControllerClass = Cast<UClass>(Loaded); });
+	RequestSpawnConfigAsset(SpawnConfig.DefaultPreviewHeroClass.ToSoftObjectPath(),
+		[this](UObject* Loaded) { DefaultPreviewHeroClass = Cast<UClass>(Loaded); });
+	RequestSpawnConfigAsset(SpawnConfig.DefaultCarouselHeroClass.ToSoftObjectPath(),
+		[this](UObject* Loaded) { DefaultCarouselHeroClass = Cast<UClass>(Loaded); });
+	RequestSpawnConfigAsset(SpawnConfig.DefaultPreloadActorClass.ToSoftObjectPath(),
+		[this](UObject* Loaded) { DefaultPreloadActorClass = Cast<UClass>(Loaded); });
+	RequestSpawnConfigAsset(SpawnConfig.DefaultOutlineMaterial.ToSoftObjectPath(),
+		[this](UObject* Loaded) { DefaultOutlineMaterial = Cast<UMaterialInterface>(Loaded); });
+
+	if (--PendingSpawnConfigLoads == 0)
+	{
+		ApplyLoadedSpawnConfig();
+	}
+}
+
+void UPCUnitSpawnSubsystem::RequestSpawnConfigAsset(const FSoftObjectPath& Path, TFunction<void(UObject*)>&& Assign)
+{
+	SpawnConfigAssigners.Emplace(Path, MoveTemp(Assign));
+	++PendingSpawnConfigLoads;
+
+	TWeakObjectPtr<UPCUnitSpawnSubsystem> WeakThis = this;
+	TSharedPtr<FStreamableHandle> Handle = PCAsyncLoad::RequestAsyncLoad(Path, TEXT("UnitSpawnConfig"),
+		[WeakThis](UObject* Loaded)
+		{
+			UPCUnitSpawnSubsystem* This = WeakThis.Get();
+			if (!This || This->PendingSpawnConfigLoads <= 0)
+				return;
+			
+			if (--This->PendingSpawnConfigLoads == 0)
+			{
+				This->ApplyLoadedSpawnConfig();
+			}
+		});
+
+	if (Handle.IsValid())
+	{
+		SpawnConfigLoadHandles.Add(Handle);
+	}
+}
+
+void UPCUnitSpawnSubsystem::ApplyLoadedSpawnConfig()
+{
+	for (const auto& Assigner : SpawnConfigAssigners)
+	{
+		Assigner.Value(Assigner.Key.ResolveObject());
+	}
+	
+	PendingSpawnConfigLoads = 0;
+	SpawnConfigAssigners.Reset();
+
+	// 멤버 UPROPERTY가 참조를 잡았으므로 핸들은 해제
+	SpawnConfigLoadHandles.Reset();
+
+	UE_LOG(LogTemp, Log, TEXT("[AsyncLoad] UnitSpawnConfig ready in %.2f ms"),
+		(FPlatformTime::Seconds() - SpawnConfigRequestSeconds) * 1000.0);
+}
+
+void UPCUnitSpawnSubsystem::WaitForSpawnConfig()
+{
+	if (!bSpawnConfigRequested || IsSpawnConfigLoaded())
+		return;
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	
+	for (const TSharedPtr<FStreamableHandle>& Handle : SpawnConfigLoadHandles)
+	{
+		if (Handle.IsValid() && Handle->IsLoadingInProgress())
+		{
+			Handle->WaitUntilComplete();
+		}
+	}
+
+	// WaitUntilComplete의 완료 콜백이 다음 프레임으로 미뤄질 수 있으므로 직접 확정
+	if (!IsSpawnConfigLoaded())
+	{
+		ApplyLoadedSpawnConfig();
+	}
+	
+	UE_LOG(LogTemp, Warning, TEXT("[AsyncLoad] UnitSpawnConfig blocking wait %.2f ms"),
+		(FPlatformTime::Seconds() - StartSeconds) * 1000.0);
 }
 
 void UPCUnitSpawnSubsystem::EnsureConfigFromGameState()
 {
-	if (Registry)
+	// Registry 만으로 판단하지 않고 모든 에셋이 적용되었는지 확인 (아웃라인 머티리얼 / 상태바 클래스 등)
+	if (IsSpawnConfigLoaded())
 		return;
 	
-	if (const auto* GS = GetWorld()->GetGameState<APCCombatGameState>())
+	if (!bSpawnConfigRequested)
 	{
-		InitializeUnitSpawnConfig(GS->GetSpawnConfig());
+		if (const auto* GS = GetWorld()->GetGameState<APCCombatGameState>())
+		{
+			InitializeUnitSpawnConfig(GS->GetSpawnConfig());
+		}
 	}
+
+	WaitForSpawnConfig();
 }
 
 void UPCUnitSpawnSubsystem::PreloadAllHeroUnit(const FVector& SpawnLocation) const
@@ -110,10 +215,34 @@ APCBaseUnitCharacter* UPCUnitSpawnSubsystem::SpawnUnitByTag(const FGameplayTag U
 	if (!GetWorld() || GetWorld()->GetNetMode() == NM_Client)
 		return nullptr;
 
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::UnitSpawn);
+
 	const UPCDataAsset_UnitDefinition* Definition = ResolveDefinition(UnitTag);
 	if (!Definition)
 		return nullptr;
 
+	// 같은 UnitTag의 반납된 유닛이 있으면 재사용, 없으면 새로 스폰
+	APCBaseUnitCharacter* Unit = AcquirePooledUnit(UnitTag, TeamIndex, UnitLevel, InOwnerPS, InOwner, InInstigator);
+	if (!Unit)
+	{
+		Unit = SpawnNewUnit(Definition, UnitTag, TeamIndex, UnitLevel, InOwnerPS, InOwner, InInstigator, HandlingMethod);
+	}
+	
+	if (!Unit)
+		return nullptr;
+	
+	Unit->SetNetDormancy(DORM_Awake);
+	Unit->ForceNetUpdate();
+
+	OnUnitSpawned.Broadcast(Unit, TeamIndex);
+	
+	return Unit;
+}
+
+APCBaseUnitCharacter* UPCUnitSpawnSubsystem::SpawnNewUnit(const UPCDataAsset_UnitDefinition* Definition,
+	const FGameplayTag& UnitTag, const int32 TeamIndex, const int32 UnitLevel, APCPlayerState* InOwnerPS,
+	AActor* InOwner, APawn* InInstigator, ESpawnActorCollisionHandlingMethod HandlingMethod)
+{
 	TSubclassOf<APCBaseUnitCharacter> SpawnClass = ResolveSpawnUnitClass(Definition);
 
 	FTransform SpawnTransform = FTransform::Identity;
@@ -129,6 +258,8 @@ APCBaseUnitCharacter* UPCUnitSpawnSubsystem::SpawnUnitByTag(const FGameplayTag U
 	if (!Unit)
 		return nullptr;
 
+	++UnitPoolMisses;
+	
 	Unit->SetOwnerPlayerState(InOwnerPS);
 	Unit->SetTeamIndex(TeamIndex);
 	Unit->SetUnitTag(UnitTag);
@@ -141,18 +272,126 @@ APCBaseUnitCharacter* UPCUnitSpawnSubsystem::SpawnUnitByTag(const FGameplayTag U
 
 	UGameplayStatics::FinishSpawningActor(Unit, SpawnTransform);
 	
-	Unit->SetNetDormancy(DORM_Awake);
-	Unit->ForceNetUpdate();
+	return Unit;
+}
 
-	OnUnitSpawned.Broadcast(Unit, TeamIndex);
+APCBaseUnitCharacter* UPCUnitSpawnSubsystem::AcquirePooledUnit(const FGameplayTag& UnitTag, const int32 TeamIndex,
+	const int32 UnitLevel, APCPlayerState* InOwnerPS, AActor* InOwner, APawn* InInstigator)
+{
+	FPCPooledUnitList* PooledList = PooledUnitsByTag.Find(UnitTag);
+	if (!PooledList)
+		return nullptr;
+
+	FPCPooledUnitEntry Entry;
+	while (!PooledList->Entries.IsEmpty())
+	{
+		Entry = PooledList->Entries.Pop(EAllowShrinking::No);
+		if (IsValid(Entry.Unit) && !Entry.Unit->IsActorBeingDestroyed())
+			break;
+
+		Entry = FPCPooledUnitEntry();
+	}
+
+	APCBaseUnitCharacter* Unit = Entry.Unit;
+	if (!Unit)
+		return nullptr;
+
+	++UnitPoolHits;
+	
+	// 메쉬/AnimBP/DataAsset은 UnitTag가 같으므로 그대로, 스폰마다 달라지는 값만 다시 세팅
+	Unit->SetActorLocation(FVector({0.f,0.f,9999.f}));
+	Unit->SetOwner(InOwner);
+	Unit->SetInstigator(InInstigator);
+	Unit->SetOwnerPlayerState(InOwnerPS);
+	Unit->SetTeamIndex(TeamIndex);
+	
+	if (Unit->HasLevelSystem())
+	{
+		Unit->SetUnitLevel(UnitLevel);
+	}
+
+	if (UPCUnitAbilitySystemComponent* ASC = Unit->GetUnitAbilitySystemComponent())
+	{
+		ASC->InitGAS();
+	}
+
+	if (UPCUnitEquipmentComponent* EquipmentComp = Unit->GetEquipmentComponent())
+	{
+		EquipmentComp->RefreshOwnerPlayerInventory();
+	}
+
+	if (AController* Controller = Entry.Controller)
+	{
+		Controller->Possess(Unit);
+	}
+	else
+	{
+		Unit->SpawnDefaultController();
+	}
+
+	Unit->OnAcquiredFromPool();
 	
 	return Unit;
 }
 
+void UPCUnitSpawnSubsystem::ReleaseUnit(APCBaseUnitCharacter* Unit)
+{
+	if (!Unit || !GetWorld() || GetWorld()->GetNetMode() == NM_Client)
+		return;
+
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::UnitSpawn);
+
+	if (Unit->IsInUnitPool() || Unit->IsActorBeingDestroyed())
+		return;
+
+	const FGameplayTag& UnitTag = Unit->GetUnitTag();
+	FPCPooledUnitList* PooledList = UnitTag.IsValid() ? &PooledUnitsByTag.FindOrAdd(UnitTag) : nullptr;
+	if (!PooledList || PooledList->Entries.Num() >= MaxPooledUnitsPerTag)
+	{
+		++UnitPoolDestroyed;
+		Unit->Destroy();
+		return;
+	}
+
+	// 순서 중요: 풀 플래그 -> 장비 효과 제거 -> ASC 리셋
+	Unit->OnReturnedToPool();
+
+	if (UPCUnitEquipmentComponent* EquipmentComp = Unit->GetEquipmentComponent())
+	{
+		EquipmentComp->ClearAllSlots();
+	}
+
+	if (UPCUnitAbilitySystemComponent* ASC = Unit->GetUnitAbilitySystemComponent())
+	{
+		ASC->ResetForReuse();
+	}
+
+	AController* Controller = Unit->GetController();
+	if (AAIController* AIC = Cast<AAIController>(Controller))
+	{
+		AIC->StopMovement();
+	}
+	if (Controller)
+	{
+		Controller->UnPossess();
+	}
+	
+	GetWorld()->GetTimerManager().ClearAllTimersForObject(Unit);
+
+	// 숨김/리셋 상태를 한 번 복제한 뒤 휴면
+	Unit->ForceNetUpdate();
+	Unit->SetNetDormancy(DORM_DormantAll);
+
+	PooledList->Entries.Add({ Unit, Controller });
+	++UnitPoolReleased;
+}
+
 APCBaseUnitCharacter* UPCUnitSpawnSubsystem::SpawnCloneUnitBySourceUnit(const APCBaseUnitCharacter* SourceUnit)
 {
 	if (!SourceUnit)
 		return nullptr;
+
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::UnitSpawn);
 	
 	const FGameplayTag& UnitTag = SourceUnit->GetUnitTag();
 	const int32 TeamIndex = SourceUnit->GetTeamIndex();
@@ -415,6 +654,8 @@ APCCarouselHeroCharacter* UPCUnitSpawnSubsystem::SpawnCarouselHeroByTag(const FG
 {
 	if (!GetWorld() || GetWorld()->GetNetMode() == NM_Client)
 		return nullptr;
+
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::UnitSpawn);
 	
 	const UPCDataAsset_UnitDefinition* Definition = ResolveDefinition(UnitTag);
 	if (!Definition)
@@ -437,4 +678,188 @@ APCCarouselHeroCharacter* UPCUnitSpawnSubsystem::SpawnCarouselHeroByTag(const FG
 	UGameplayStatics::FinishSpawningActor(Carousel, SpawnTransform);
 
 	return Carousel;
-}
\ No newline at end of file
+}
+
+void UPCUnitSpawnSubsystem::LogUnitPoolStats() const
+{
+	int32 PooledCount = 0;
+	for (const auto& KV : PooledUnitsByTag)
+	{
+		PooledCount += KV.Value.Entries.Num();
+		if (!KV.Value.Entries.IsEmpty())
+		{
+			UE_LOG(LogTemp, Log, TEXT("[UnitPool] %s : Pooled=%d"), *KV.Key.ToString(), KV.Value.Entries.Num());
+		}
+	}
+	
+	UE_LOG(LogTemp, Log, TEXT("[UnitPool] Hits=%d Misses=%d Released=%d Destroyed=%d Pooled=%d"),
+		UnitPoolHits, UnitPoolMisses, UnitPoolReleased, UnitPoolDestroyed, PooledCount);
+}
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+	// 콘솔 : PC.UnitPool.ValidateLocal (클라에서 실행하면 클라가 보는 풀 반납 / 재사용 유닛 상태 검증)
+	FAutoConsoleCommandWithWorld GPCUnitPoolValidateLocalCommand(
+		TEXT("PC.UnitPool.ValidateLocal"),
+		TEXT("Check that every unit in this world shows the local state its pool flag implies (hidden, collision, montage, anim set, status bar, mesh scale). Run on a client to cover replicated reuse."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UPCUnitSpawnSubsystem* SpawnSubsystem = World ? World->GetSubsystem<UPCUnitSpawnSubsystem>() : nullptr)
+			{
+				SpawnSubsystem->DebugValidatePoolLocalState();
+			}
+		}));
+
+	bool CompareUnitState(const APCBaseUnitCharacter* Fresh, const APCBaseUnitCharacter* Pooled)
+	{
+		bool bSame = true;
+		auto Check = [&bSame](bool bCondition, const TCHAR* What)
+		{
+			if (!bCondition)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[UnitPool] Mismatch: %s"), What);
+				bSame = false;
+			}
+		};
+
+		Check(Fresh->GetTeamIndex() == Pooled->GetTeamIndex(), TEXT("TeamIndex"));
+		Check(Fresh->GetUnitLevel() == Pooled->GetUnitLevel(), TEXT("UnitLevel"));
+		Check(Fresh->IsDead() == Pooled->IsDead(), TEXT("bIsDead"));
+		Check(Fresh->IsStunned() == Pooled->IsStunned(), TEXT("bIsStunned"));
+		Check(Fresh->IsOnField() == Pooled->IsOnField(), TEXT("bIsOnField"));
+		Check(Fresh->IsCombatWin() == Pooled->IsCombatWin(), TEXT("bIsCombatWin"));
+		Check(Fresh->IsHidden() == Pooled->IsHidden(), TEXT("bHidden"));
+		Check(Fresh->GetActorEnableCollision() == Pooled->GetActorEnableCollision(), TEXT("Collision"));
+		Check(Fresh->GetOwnerPlayerState() == Pooled->GetOwnerPlayerState(), TEXT("OwnerPS"));
+		Check(Fresh->GetEquipItemTags() == Pooled->GetEquipItemTags(), TEXT("EquipItemTags"));
+		Check(Fresh->OnUnitDied.IsBound() == Pooled->OnUnitDied.IsBound(), TEXT("OnUnitDied bindings"));
+		Check((Fresh->GetController() != nullptr) == (Pooled->GetController() != nullptr), TEXT("Controller"));
+
+		const UAbilitySystemComponent* FreshASC = Fresh->GetAbilitySystemComponent();
+		const UAbilitySystemComponent* PooledASC = Pooled->GetAbilitySystemComponent();
+		if (!FreshASC || !PooledASC)
+		{
+			Check(FreshASC == PooledASC, TEXT("ASC"));
+			return bSame;
+		}
+
+		const FGameplayTagContainer& FreshTags = FreshASC->GetOwnedGameplayTags();
+		const FGameplayTagContainer& PooledTags = PooledASC->GetOwnedGameplayTags();
+		Check(FreshTags.HasAllExact(PooledTags) && PooledTags.HasAllExact(FreshTags), TEXT("OwnedGameplayTags"));
+		Check(FreshASC->GetNumActiveGameplayEffects() == PooledASC->GetNumActiveGameplayEffects(), TEXT("ActiveGameplayEffects"));
+		Check(FreshASC->GetActivatableAbilities().Num() == PooledASC->GetActivatableAbilities().Num(), TEXT("ActivatableAbilities"));
+
+		TArray<FGameplayAttribute> Attributes;
+		FreshASC->GetAllAttributes(Attributes);
+		for (const FGameplayAttribute& Attribute : Attributes)
+		{
+			const bool bSameBase = FMath::IsNearlyEqual(FreshASC->GetNumericAttributeBase(Attribute), PooledASC->GetNumericAttributeBase(Attribute));
+			const bool bSameCurrent = FMath::IsNearlyEqual(FreshASC->GetNumericAttribute(Attribute), PooledASC->GetNumericAttribute(Attribute));
+			Check(bSameBase && bSameCurrent, *Attribute.GetName());
+		}
+
+		return bSame;
+	}
+}
+#endif
+
+bool UPCUnitSpawnSubsystem::DebugValidatePooledUnitReset(FGameplayTag UnitTag, int32 UnitLevel, FGameplayTag ItemTag)
+{
+#if !UE_BUILD_SHIPPING
+	const UPCDataAsset_UnitDefinition* Definition = ResolveDefinition(UnitTag);
+	if (!Definition || !GetWorld() || GetWorld()->GetNetMode() == NM_Client)
+		return false;
+
+	UnitLevel = FMath::Clamp(UnitLevel, 1, 3);
+	const int32 TestTeamIndex = 1;
+	
+	// 1) 다른 팀/레벨로 스폰 후 전투를 치른 것처럼 상태를 오염시키고 반납
+	APCBaseUnitCharacter* UsedUnit = SpawnUnitByTag(UnitTag, TestTeamIndex + 1, UnitLevel == 1 ? 2 : 1);
+	if (!UsedUnit)
+		return false;
+	
+	UsedUnit->ChangedOnTile(true);
+	if (ItemTag.IsValid())
+	{
+		if (UPCUnitEquipmentComponent* EquipmentComp = UsedUnit->GetEquipmentComponent())
+		{
+			EquipmentComp->TryEquipItem(ItemTag);
+		}
+	}
+	if (UAbilitySystemComponent* ASC = UsedUnit->GetAbilitySystemComponent())
+	{
+		ASC->SetNumericAttributeBase(UPCUnitAttributeSet::GetCurrentHealthAttribute(), 1.f);
+		ASC->AddLooseGameplayTag(UnitGameplayTags::Unit_State_Combat_Stun);
+	}
+	
+	ReleaseUnit(UsedUnit);
+	if (!UsedUnit->IsInUnitPool())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[UnitPool] Validate %s skipped: pool is full"), *UnitTag.ToString());
+		return false;
+	}
+
+	// 2) 같은 조건으로 신규 스폰 / 풀 재사용 유닛 비교
+	APCBaseUnitCharacter* FreshUnit = SpawnNewUnit(Definition, UnitTag, TestTeamIndex, UnitLevel,
+		nullptr, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	APCBaseUnitCharacter* PooledUnit = SpawnUnitByTag(UnitTag, TestTeamIndex, UnitLevel);
+	
+	bool bPassed = FreshUnit && PooledUnit == UsedUnit;
+	if (bPassed)
+	{
+		bPassed = CompareUnitState(FreshUnit, PooledUnit);
+
+		// 서버(리슨 서버 호스트 화면) 쪽 로컬 표시 상태, 클라 쪽은 PC.UnitPool.ValidateLocal
+		FString Report;
+		if (!PooledUnit->DebugValidatePoolLocalState(Report))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[UnitPool] Local state mismatch:%s"), *Report);
+			bPassed = false;
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[UnitPool] Pooled unit was not reused"));
+	}
+	
+	UE_LOG(LogTemp, Log, TEXT("[UnitPool] Validate %s Lv%d : %s"), *UnitTag.ToString(), UnitLevel, bPassed ? TEXT("PASS") : TEXT("FAIL"));
+
+	if (FreshUnit)
+		FreshUnit->Destroy();
+	ReleaseUnit(PooledUnit);
+	
+	return bPassed;
+#else
+	return true;
+#endif
+}
+
+int32 UPCUnitSpawnSubsystem::DebugValidatePoolLocalState() const
+{
+	int32 NumChecked = 0;
+	int32 NumFailed = 0;
+	
+#if !UE_BUILD_SHIPPING
+	for (TActorIterator<APCBaseUnitCharacter> It(GetWorld()); It; ++It)
+	{
+		const APCBaseUnitCharacter* Unit = *It;
+		if (!IsValid(Unit) || Unit->IsActorBeingDestroyed())
+			continue;
+
+		++NumChecked;
+		FString Report;
+		if (!Unit->DebugValidatePoolLocalState(Report))
+		{
+			++NumFailed;
+			UE_LOG(LogTemp, Warning, TEXT("[UnitPool] %s (%s, %s) local state mismatch:%s"),
+				*Unit->GetName(), *Unit->GetUnitTag().ToString(), Unit->IsInUnitPool() ? TEXT("pooled") : TEXT("active"), *Report);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[UnitPool] ValidateLocal (%s) Units=%d Failed=%d"),
+		GetWorld() && GetWorld()->GetNetMode() == NM_Client ? TEXT("client") : TEXT("server"), NumChecked, NumFailed);
+#endif
+	
+	return NumFailed;
+}
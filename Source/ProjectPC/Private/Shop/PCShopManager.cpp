@@ -8,6 +8,8 @@
 #include "BaseGameplayTags.h"
 #include "GameFramework/GameState/PCCombatGameState.h"
 #include "GameFramework/PlayerState/PCPlayerState.h"
+#include "GameFramework/WorldSubsystem/PCMatchRandomSubsystem.h"
+#include "GameFramework/WorldSubsystem/PCServerTelemetrySubsystem.h"
 #include "GameFramework/WorldSubsystem/PCUnitSpawnSubsystem.h"
 #include "AbilitySystem/Player/AttributeSet/PCPlayerAttributeSet.h"
 #include "Character/Unit/PCBaseUnitCharacter.h"
@@ -24,6 +26,23 @@ void UPCShopManager::BeginPlay()
 {
 	Super::BeginPlay();
 	
+	InitializeShopData(ShopUnitDataTable, ShopUnitProbabilityDataTable, ShopUnitSellingPriceDataTable);
+
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		if (auto GS = Cast<APCCombatGameState>(GetOwner()))
+		{
+			GS->OnGameStateTagChanged.AddUObject(this, &UPCShopManager::OnGameStateChanged);
+		}
+	}
+}
+
+void UPCShopManager::InitializeShopData(UDataTable* InUnitDataTable, UDataTable* InProbabilityDataTable, UDataTable* InSellingPriceDataTable)
+{
+	ShopUnitDataTable = InUnitDataTable;
+	ShopUnitProbabilityDataTable = InProbabilityDataTable;
+	ShopUnitSellingPriceDataTable = InSellingPriceDataTable;
+
 	if (ShopUnitDataTable && ShopUnitProbabilityDataTable && ShopUnitSellingPriceDataTable)
 	{
 		LoadDataTable<FPCShopUnitData>(ShopUnitDataTable, ShopUnitDataList, TEXT("Loading Shop Unit Data"));
@@ -31,6 +50,11 @@ void UPCShopManager::BeginPlay()
 		LoadDataTableToMap<FPCShopUnitSellingPriceData>(ShopUnitSellingPriceDataTable, ShopUnitSellingPriceDataMap, TEXT("Loading Shop Unit Selling Price Data"));
 	}
 
+	for (int32 Cost = 1; Cost <= NumUnitCosts; ++Cost)
+	{
+		GetShopUnitDataListByCost(Cost).Reset();
+	}
+
 	for (auto Unit : ShopUnitDataList)
 	{
 		switch (Unit.UnitCost)
@@ -54,13 +78,27 @@ void UPCShopManager::BeginPlay()
 			break;
 		}
 	}
+
+	// 태그 조회용 맵과 코스트별 펜윅 트리 구성
+	ShopUnitCostByTag.Reset();
+	ShopUnitIndexByTag.Reset();
+	for (const auto& Unit : ShopUnitDataList)
+	{
+		if (!ShopUnitCostByTag.Contains(Unit.UnitTag))
+		{
+			ShopUnitCostByTag.Add(Unit.UnitTag, Unit.UnitCost);
+		}
+	}
 	
-	if (GetOwner() && GetOwner()->HasAuthority())
+	for (int32 Cost = 1; Cost <= NumUnitCosts; ++Cost)
 	{
-		if (auto GS = Cast<APCCombatGameState>(GetOwner()))
+		const auto& UnitDataList = GetShopUnitDataListByCost(Cost);
+		for (int32 i = 0; i < UnitDataList.Num(); ++i)
 		{
-			GS->OnGameStateTagChanged.AddUObject(this, &UPCShopManager::OnGameStateChanged);
+			ShopUnitIndexByTag.Add(UnitDataList[i].UnitTag, i);
 		}
+		
+		ShopUnitPools[Cost - 1].Build(UnitDataList);
 	}
 }
 
@@ -109,20 +147,22 @@ void UPCShopManager::UpdateShopSlots(APCPlayerState* TargetPlayer)
 {
 	if (!GetOwner() || !GetOwner()->HasAuthority()) return;
 	if (!TargetPlayer) return;
+
+	FPCTelemetryScope TelemetryScope(this, EPCTelemetryPhase::ShopRefresh);
 	
 	const auto& ShopSlots = TargetPlayer->GetShopSlots();
-	ReturnUnitsToShopBySlotUpdate(ShopSlots, TargetPlayer->PurchasedSlots);
-	TargetPlayer->PurchasedSlots.Empty();
+	ReturnUnitsToShopBySlotUpdate(ShopSlots, TargetPlayer->GetPurchasedSlots());
 
 	TArray<FPCShopUnitData> NewShopSlots;
 	const auto PlayerLevel = static_cast<int32>(TargetPlayer->GetAttributeSet()->GetPlayerLevel());
 	const auto& CostProbabilities = GetCostProbabilities(PlayerLevel);
+	const FPCRandomChannel* ShopRandom = GetShopRandomChannel();
 	
 	for (uint8 i = 0; i < NumSlots; ++i)
 	{
 		// 누적합 범위에 따라 코스트 선택
 		int32 SelectedCost = 1;
-		WeightedRandomSelect<float>(CostProbabilities, 0.f, 1.f, SelectedCost);
+		WeightedRandomSelect<float>(CostProbabilities, 0.f, 1.f, SelectedCost, ShopRandom);
 
 		auto& Candidate =  SelectRandomUnitByCost(SelectedCost);
 
@@ -158,25 +198,19 @@ void UPCShopManager::BuyUnit(APCPlayerState* TargetPlayer, int32 SlotIndex, FGam
 	}
 		
 	UnitLevelUp(TargetPlayer, UnitTag, 0);
-	TargetPlayer->PurchasedSlots.Add(SlotIndex);
+	TargetPlayer->MarkShopSlotPurchased(SlotIndex);
 }
 
 TMap<int32, int32> UPCShopManager::GetLevelUpUnitMap(const APCPlayerState* TargetPlayer, FGameplayTag UnitTag, int32 ShopAddUnitCount) const
 {
-	// 1,2,3성 범위 지정 반복을 위해 미리 Map에 추가
-	TMap<int32, int32> UnitCountByLevelMap;
-	UnitCountByLevelMap.Add({1,0});
-	UnitCountByLevelMap.Add({2,0});
-	UnitCountByLevelMap.Add({3,0});
-
 	if (!GetOwner() || !TargetPlayer)
-		return UnitCountByLevelMap;
+		return BuildLevelUpUnitMap({}, 0);
 
 	auto GS = Cast<APCCombatGameState>(GetOwner());
-	if (!GS) return UnitCountByLevelMap;
+	if (!GS) return BuildLevelUpUnitMap({}, 0);
 
 	auto PlayerBoard = TargetPlayer->PlayerBoard;
-	if (!PlayerBoard) return UnitCountByLevelMap;
+	if (!PlayerBoard) return BuildLevelUpUnitMap({}, 0);
 
 	TArray<APCBaseUnitCharacter*> UnitList;
 	auto CurrentGameStateTag = GS->GetGameStateTag();
@@ -190,6 +224,17 @@ TMap<int32, int32> UPCShopManager::GetLevelUpUnitMap(const APCPlayerState* Targe
 	{
 		UnitList = PlayerBoard->GetBenchUnitByTag(UnitTag, TargetPlayer->SeatIndex);
 	}
+
+	return BuildLevelUpUnitMap(UnitList, ShopAddUnitCount);
+}
+
+TMap<int32, int32> UPCShopManager::BuildLevelUpUnitMap(const TArray<APCBaseUnitCharacter*>& UnitList, int32 ShopAddUnitCount)
+{
+	// 1,2,3성 범위 지정 반복을 위해 미리 Map에 추가
+	TMap<int32, int32> UnitCountByLevelMap;
+	UnitCountByLevelMap.Add({1,0});
+	UnitCountByLevelMap.Add({2,0});
+	UnitCountByLevelMap.Add({3,0});
 	
 	for (auto Unit : UnitList)
 	{
@@ -268,8 +313,8 @@ void UPCShopManager::UnitLevelUp(const APCPlayerState* TargetPlayer, FGameplayTa
 		UnitList = PlayerBoard->GetBenchUnitByTag(UnitTag, TargetPlayer->SeatIndex);
 	}
 
-	// 상점 유닛까지 포함한 Map
-	auto AddShopUnitCountMap = GetLevelUpUnitMap(TargetPlayer, UnitTag, ShopAddUnitCount);
+	// 상점 유닛까지 포함한 Map (이미 구한 유닛 목록 재사용)
+	auto AddShopUnitCountMap = BuildLevelUpUnitMap(UnitList, ShopAddUnitCount);
 	AddShopUnitCountMap.KeySort([](const int32 A, const int32 B){ return A < B; });
 
 	TArray<int32> LevelUp;
@@ -322,58 +367,51 @@ void UPCShopManager::SellUnit(FGameplayTag UnitTag, int32 UnitLevel)
 	auto GS = Cast<APCCombatGameState>(GetOwner());
 	if (!GS) return;
 
-	auto UnitCost = GetUnitCostByTag(UnitTag);
-	for (auto& Unit : GetShopUnitDataListByCost(UnitCost))
-	{
-		if (UnitTag == Unit.UnitTag)
-		{
-			// 1성은 1개, 2성은 3개, 3성은 9개 기물 반환
-				// 4성이 추가되도 그대로 사용 가능
-			Unit.UnitCount += FMath::Pow(3.f, static_cast<float>(UnitLevel) - 1.f);
-		}
-	}
+	// 1성은 1개, 2성은 3개, 3성은 9개 기물 반환
+		// 4성이 추가되도 그대로 사용 가능
+	AddShopUnitCount(UnitTag, FMath::RoundToInt(FMath::Pow(3.f, static_cast<float>(UnitLevel) - 1.f)));
 }
 
 FPCShopUnitData& UPCShopManager::SelectRandomUnitByCost(int32 UnitCost)
 {
-	// 상점에 남은 해당 코스트 모든 유닛 후보로 추가
 	auto& Candidates = GetShopUnitDataListByCost(UnitCost);
-	TArray<int32> UnitCounts;
-	int32 TotalUnitCount = 0;
-	for (auto& Unit : Candidates)
-	{
-		UnitCounts.Add(Unit.UnitCount);
-		TotalUnitCount += Unit.UnitCount;
-	}
+	FPCShopUnitPool* Pool = GetShopUnitPoolByCost(UnitCost);
 	
 	// 해당 코스트에 아무 기물도 존재하지 않을 때
-	if (TotalUnitCount == 0)
+	if (!Pool || Pool->GetTotal() <= 0)
 	{
 		return DummyData;
 	}
 
-	// 누적합 범위에 따라 기물 선택
-	int32 SelectedUnit = 0;
-	WeightedRandomSelect<int32>(UnitCounts, 0, TotalUnitCount - 1, SelectedUnit);
+	// 남은 기물 수를 가중치로 기물 선택
+	const int32 SelectedUnit = DrawFromPool(*Pool, GetShopRandomChannel());
+	if (!Candidates.IsValidIndex(SelectedUnit))
+	{
+		return DummyData;
+	}
+	
 	Candidates[SelectedUnit].UnitCount -= 1;
+	Pool->Add(SelectedUnit, -1);
 	
 	return Candidates[SelectedUnit];
 }
 
-void UPCShopManager::ReturnUnitToShopByTag(FGameplayTag UnitTag)
+int32 UPCShopManager::DrawShopUnitIndex(int32 PlayerLevel, const FPCRandomChannel& Random, int32& OutCost)
 {
-	auto UnitCost = GetUnitCostByTag(UnitTag);
-	if (UnitCost != 0)
+	OutCost = 1;
+	WeightedRandomSelect<float>(GetCostProbabilities(PlayerLevel), 0.f, 1.f, OutCost, &Random);
+	if (OutCost < 1 || OutCost > NumUnitCosts)
 	{
-		auto& UnitDataList = GetShopUnitDataListByCost(UnitCost);
-		for (auto& Unit : UnitDataList)
-		{
-			if (Unit.UnitTag == UnitTag)
-			{
-				Unit.UnitCount += 1;
-			}
-		}
+		OutCost = INDEX_NONE;
+		return INDEX_NONE;
 	}
+
+	return DrawFromPool(ShopUnitPools[OutCost - 1], &Random);
+}
+
+void UPCShopManager::ReturnUnitToShopByTag(FGameplayTag UnitTag)
+{
+	AddShopUnitCount(UnitTag, 1);
 }
 
 void UPCShopManager::ReturnUnitsToShopByCarousel(const TArray<FGameplayTag>& UnitTags)
@@ -463,15 +501,33 @@ const TMap<TPair<int32, int32>, int32>& UPCShopManager::GetShopUnitSellingPriceD
 int32 UPCShopManager::GetUnitCostByTag(FGameplayTag UnitTag)
 {
 	// ShopUnitDataList는 현재 기물 수 상황과 별개
-	for (const FPCShopUnitData& UnitData : ShopUnitDataList)
+	return ShopUnitCostByTag.FindRef(UnitTag);
+}
+
+FPCShopUnitPool* UPCShopManager::GetShopUnitPoolByCost(int32 UnitCost)
+{
+	if (UnitCost >= 1 && UnitCost <= NumUnitCosts)
 	{
-		if (UnitData.UnitTag == UnitTag)
-		{
-			return UnitData.UnitCost;
-		}
+		return &ShopUnitPools[UnitCost - 1];
 	}
 
-	return 0;
+	return nullptr;
+}
+
+void UPCShopManager::AddShopUnitCount(FGameplayTag UnitTag, int32 Delta)
+{
+	const int32* UnitIndex = ShopUnitIndexByTag.Find(UnitTag);
+	if (!UnitIndex || Delta == 0)
+		return;
+
+	const int32 UnitCost = GetUnitCostByTag(UnitTag);
+	auto& UnitDataList = GetShopUnitDataListByCost(UnitCost);
+	FPCShopUnitPool* Pool = GetShopUnitPoolByCost(UnitCost);
+	if (!Pool || !UnitDataList.IsValidIndex(*UnitIndex))
+		return;
+
+	UnitDataList[*UnitIndex].UnitCount += Delta;
+	Pool->Add(*UnitIndex, Delta);
 }
 
 TArray<FPCShopUnitData>& UPCShopManager::GetShopUnitDataListByCost(int32 UnitCost)
@@ -548,3 +604,124 @@ int32 UPCShopManager::GetSellingPrice(int32 UnitCost, int32 UnitLevel)
 
 	return 0;
 }
+
+const FPCRandomChannel* UPCShopManager::GetShopRandomChannel() const
+{
+	return UPCMatchRandomSubsystem::FindChannel(this, PCRandomChannels::Shop);
+}
+
+int32 UPCShopManager::DrawFromPool(const FPCShopUnitPool& Pool, const FPCRandomChannel* Random)
+{
+	const int32 Total = Pool.GetTotal();
+	if (Total <= 0)
+		return INDEX_NONE;
+
+	const int32 Weight = Random ? Random->RandRange(0, Total - 1) : FMath::RandRange(0, Total - 1);
+	return Pool.FindIndexByWeight(Weight);
+}
+
+void UPCShopManager::DebugBenchmarkShopRefresh(int32 PlayerLevel, int32 NumRefreshes)
+{
+#if !UE_BUILD_SHIPPING
+	if (NumRefreshes <= 0)
+		return;
+
+	const TArray<float> CostProbabilities = GetCostProbabilities(PlayerLevel);
+
+	// 실제 재고를 건드리지 않도록 복사본에서 측정
+	TArray<FPCShopUnitData> Lists[NumUnitCosts];
+	FPCShopUnitPool Pools[NumUnitCosts];
+	for (int32 Cost = 1; Cost <= NumUnitCosts; ++Cost)
+	{
+		Lists[Cost - 1] = GetShopUnitDataListByCost(Cost);
+		Pools[Cost - 1] = ShopUnitPools[Cost - 1];
+	}
+
+	int64 Checksum = 0;
+	TArray<TPair<int32, FGameplayTag>> Drawn;
+	Drawn.Reserve(NumSlots);
+
+	// 펜윅 트리 : O(log N) 뽑기 + 태그 맵으로 O(1) 반환
+	const FPCRandomChannel TreeRandom(NumRefreshes);
+	const double TreeStart = FPlatformTime::Seconds();
+	for (int32 Refresh = 0; Refresh < NumRefreshes; ++Refresh)
+	{
+		Drawn.Reset();
+		for (uint8 Slot = 0; Slot < NumSlots; ++Slot)
+		{
+			int32 SelectedCost = 1;
+			WeightedRandomSelect<float>(CostProbabilities, 0.f, 1.f, SelectedCost, &TreeRandom);
+			if (SelectedCost < 1 || SelectedCost > NumUnitCosts)
+				continue;
+			
+			const int32 UnitIndex = DrawFromPool(Pools[SelectedCost - 1], &TreeRandom);
+			if (!Lists[SelectedCost - 1].IsValidIndex(UnitIndex))
+				continue;
+
+			--Lists[SelectedCost - 1][UnitIndex].UnitCount;
+			Pools[SelectedCost - 1].Add(UnitIndex, -1);
+			Drawn.Add({SelectedCost, Lists[SelectedCost - 1][UnitIndex].UnitTag});
+			Checksum += UnitIndex;
+		}
+
+		for (const auto& Pair : Drawn)
+		{
+			const int32 UnitIndex = ShopUnitIndexByTag.FindRef(Pair.Value);
+			++Lists[Pair.Key - 1][UnitIndex].UnitCount;
+			Pools[Pair.Key - 1].Add(UnitIndex, 1);
+		}
+	}
+	const double TreeMs = (FPlatformTime::Seconds() - TreeStart) * 1000.0;
+
+	// 기존 방식 : 매 칸마다 개수 배열 재구성 + 선형 누적합, 반환도 선형 탐색
+	const FPCRandomChannel LegacyRandom(NumRefreshes);
+	TArray<int32> UnitCounts;
+	const double LegacyStart = FPlatformTime::Seconds();
+	for (int32 Refresh = 0; Refresh < NumRefreshes; ++Refresh)
+	{
+		Drawn.Reset();
+		for (uint8 Slot = 0; Slot < NumSlots; ++Slot)
+		{
+			int32 SelectedCost = 1;
+			WeightedRandomSelect<float>(CostProbabilities, 0.f, 1.f, SelectedCost, &LegacyRandom);
+			if (SelectedCost < 1 || SelectedCost > NumUnitCosts)
+				continue;
+
+			auto& Candidates = Lists[SelectedCost - 1];
+			UnitCounts.Reset();
+			int32 TotalUnitCount = 0;
+			for (const auto& Unit : Candidates)
+			{
+				UnitCounts.Add(Unit.UnitCount);
+				TotalUnitCount += Unit.UnitCount;
+			}
+			if (TotalUnitCount == 0)
+				continue;
+
+			int32 UnitIndex = 0;
+			WeightedRandomSelect<int32>(UnitCounts, 0, TotalUnitCount - 1, UnitIndex, &LegacyRandom);
+			if (!Candidates.IsValidIndex(UnitIndex))
+				continue;
+			
+			--Candidates[UnitIndex].UnitCount;
+			Drawn.Add({SelectedCost, Candidates[UnitIndex].UnitTag});
+			Checksum += UnitIndex;
+		}
+
+		for (const auto& Pair : Drawn)
+		{
+			for (auto& Unit : Lists[Pair.Key - 1])
+			{
+				if (Unit.UnitTag == Pair.Value)
+				{
+					++Unit.UnitCount;
+				}
+			}
+		}
+	}
+	const double LegacyMs = (FPlatformTime::Seconds() - LegacyStart) * 1000.0;
+
+	UE_LOG(LogTemp, Log, TEXT("[ShopSampler] %d refreshes : Fenwick=%.2fms (%.3fus/refresh) Legacy=%.2fms (%.3fus/refresh) Checksum=%lld"),
+		NumRefreshes, TreeMs, TreeMs * 1000.0 / NumRefreshes, LegacyMs, LegacyMs * 1000.0 / NumRefreshes, Checksum);
+#endif
+}
@@ -0,0 +1,157 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Shop/PCShopSlotRep.h"
+
+#include "GameFramework/PlayerState/PCPlayerState.h"
+#include "Serialization/MemoryWriter.h"
+
+// 복제 통계는 칸마다 다시 직렬화하므로 개발 빌드에서만 집계
+#if !UE_BUILD_SHIPPING
+DECLARE_STATS_GROUP(TEXT("PCShopRep"), STATGROUP_PCShopRep, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Shop Slots Dirtied"), STAT_PCShopRep_DirtySlots, STATGROUP_PCShopRep);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Shop Slot Bytes Dirtied"), STAT_PCShopRep_DirtyBytes, STATGROUP_PCShopRep);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Shop Slots Received"), STAT_PCShopRep_ReceivedSlots, STATGROUP_PCShopRep);
+
+
+namespace
+{
+	// 누적 카운터 (PC.Shop.RepStats)
+	uint64 GShopDirtySlots = 0;
+	uint64 GShopDirtyBytes = 0;
+	uint64 GShopReceivedSlots = 0;
+	uint64 GShopReceivedBytes = 0;
+
+	FAutoConsoleCommandWithArgs GPCShopRepStatsCommand(
+		TEXT("PC.Shop.RepStats"),
+		TEXT("Log shop slot replication counters (slots / serialized bytes dirtied on server, received on client). Args: [reset]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[ShopRep] Dirtied %llu slots (%llu bytes), received %llu slots (%llu bytes)"),
+				GShopDirtySlots, GShopDirtyBytes, GShopReceivedSlots, GShopReceivedBytes);
+
+			if (Args.IsValidIndex(0) && Args[0] == TEXT("reset"))
+			{
+				GShopDirtySlots = GShopDirtyBytes = GShopReceivedSlots = GShopReceivedBytes = 0;
+			}
+		}));
+
+	// 칸 하나의 직렬화 크기 (실제 전송량의 근사치)
+	int32 GetSerializedSize(const FPCShopSlotEntry& Entry)
+	{
+		TArray<uint8> Buffer;
+		FMemoryWriter Writer(Buffer);
+		FPCShopSlotEntry::StaticStruct()->SerializeBin(Writer, const_cast<FPCShopSlotEntry*>(&Entry));
+		return Buffer.Num();
+	}
+
+	void RecordDirty(const FPCShopSlotEntry& Entry)
+	{
+		const int32 Bytes = GetSerializedSize(Entry);
+		++GShopDirtySlots;
+		GShopDirtyBytes += Bytes;
+		INC_DWORD_STAT(STAT_PCShopRep_DirtySlots);
+		INC_DWORD_STAT_BY(STAT_PCShopRep_DirtyBytes, Bytes);
+	}
+
+	void RecordReceived(const FPCShopSlotEntry& Entry)
+	{
+		++GShopReceivedSlots;
+		GShopReceivedBytes += GetSerializedSize(Entry);
+		INC_DWORD_STAT(STAT_PCShopRep_ReceivedSlots);
+	}
+}
+#endif
+
+void FPCShopSlotEntry::PreReplicatedRemove(const FPCShopSlotArray& InArraySerializer)
+{
+	if (InArraySerializer.OwnerPlayerState)
+	{
+		InArraySerializer.OwnerPlayerState->HandleShopSlotRemoved(*this);
+	}
+}
+
+void FPCShopSlotEntry::PostReplicatedAdd(const FPCShopSlotArray& InArraySerializer)
+{
+#if !UE_BUILD_SHIPPING
+	RecordReceived(*this);
+#endif
+
+	if (InArraySerializer.OwnerPlayerState)
+	{
+		InArraySerializer.OwnerPlayerState->HandleShopSlotReplicated(*this);
+	}
+}
+
+void FPCShopSlotEntry::PostReplicatedChange(const FPCShopSlotArray& InArraySerializer)
+{
+#if !UE_BUILD_SHIPPING
+	RecordReceived(*this);
+#endif
+
+	if (InArraySerializer.OwnerPlayerState)
+	{
+		InArraySerializer.OwnerPlayerState->HandleShopSlotReplicated(*this);
+	}
+}
+
+FPCShopSlotEntry* FPCShopSlotArray::FindSlot(int32 SlotIndex)
+{
+	// 칸은 5개 내외라 선형 탐색
+	return Entries.FindByPredicate([SlotIndex](const FPCShopSlotEntry& Entry){ return Entry.SlotIndex == SlotIndex; });
+}
+
+bool FPCShopSlotArray::SetSlot(int32 SlotIndex, const FPCShopUnitData& UnitData, bool bPurchased)
+{
+	if (SlotIndex < 0)
+		return false;
+
+	FPCShopSlotEntry* Entry = FindSlot(SlotIndex);
+	if (!Entry)
+	{
+		Entry = &Entries.AddDefaulted_GetRef();
+		Entry->SlotIndex = SlotIndex;
+	}
+	else if (Entry->UnitData == UnitData && Entry->bPurchased == bPurchased)
+	{
+		return false;
+	}
+
+	Entry->UnitData = UnitData;
+	Entry->bPurchased = bPurchased;
+	MarkItemDirty(*Entry);
+#if !UE_BUILD_SHIPPING
+	RecordDirty(*Entry);
+#endif
+	return true;
+}
+
+bool FPCShopSlotArray::SetPurchased(int32 SlotIndex, bool bPurchased)
+{
+	FPCShopSlotEntry* Entry = FindSlot(SlotIndex);
+	if (!Entry || Entry->bPurchased == bPurchased)
+		return false;
+
+	Entry->bPurchased = bPurchased;
+	MarkItemDirty(*Entry);
+#if !UE_BUILD_SHIPPING
+	RecordDirty(*Entry);
+#endif
+	return true;
+}
+
+void FPCShopSlotArray::Trim(int32 NumSlots)
+{
+	if (Entries.RemoveAllSwap([NumSlots](const FPCShopSlotEntry& Entry){ return Entry.SlotIndex >= NumSlots; }) > 0)
+	{
+		MarkArrayDirty();
+	}
+}
+
+void FPCShopSlotArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (OwnerPlayerState)
+	{
+		OwnerPlayerState->HandleShopSlotsReceived();
+	}
+}
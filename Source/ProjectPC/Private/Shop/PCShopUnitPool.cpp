@@ -0,0 +1,69 @@
+#include "Shop/PCShopUnitPool.h"
+
+#include "Shop/PCShopUnitData.h"
+
+void FPCShopUnitPool::Build(const TArray<FPCShopUnitData>& Units)
+{
+	const int32 Count = Units.Num();
+	// 같은 크기로 다시 구성해도 이전 노드 값이 남지 않도록 전체를 0 으로
+	Tree.Init(0, Count + 1);
+	Total = 0;
+
+	// O(N) 구성 : 자기 값을 넣고 부모 노드로 한 번만 전파
+	for (int32 i = 1; i <= Count; ++i)
+	{
+		const int32 UnitCount = FMath::Max(0, Units[i - 1].UnitCount);
+		Tree[i] += UnitCount;
+		Total += UnitCount;
+
+		const int32 Parent = i + (i & -i);
+		if (Parent <= Count)
+		{
+			Tree[Parent] += Tree[i];
+		}
+	}
+
+	TopBit = Count > 0 ? 1 << FMath::FloorLog2(static_cast<uint32>(Count)) : 0;
+}
+
+void FPCShopUnitPool::Add(int32 Index, int32 Delta)
+{
+	if (Delta == 0 || Index < 0 || Index >= Num())
+		return;
+
+	Total += Delta;
+	for (int32 i = Index + 1; i < Tree.Num(); i += i & -i)
+	{
+		Tree[i] += Delta;
+	}
+}
+
+int32 FPCShopUnitPool::FindIndexByWeight(int32 Weight) const
+{
+	if (Total <= 0 || Weight < 0 || Weight >= Total)
+		return INDEX_NONE;
+
+	// 누적합이 Weight 이하인 가장 긴 구간을 찾고 그 다음 칸이 정답
+	int32 Pos = 0;
+	for (int32 Step = TopBit; Step > 0; Step >>= 1)
+	{
+		const int32 Next = Pos + Step;
+		if (Next < Tree.Num() && Tree[Next] <= Weight)
+		{
+			Pos = Next;
+			Weight -= Tree[Next];
+		}
+	}
+
+	return Pos;
+}
+
+int32 FPCShopUnitPool::GetPrefixSum(int32 Index) const
+{
+	int32 Sum = 0;
+	for (int32 i = FMath::Min(Index + 1, Num()); i > 0; i -= i & -i)
+	{
+		Sum += Tree[i];
+	}
+	return Sum;
+}
@@ -0,0 +1,523 @@
+#include "Simulation/PCCombatReplay.h"
+
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+
+namespace
+{
+	// 로드 시 비정상 개수로 인한 대량 할당 방지
+	constexpr uint32 MaxReplayElements = 1u << 22;
+
+	void PackUInt(FArchive& Ar, uint32& Value)
+	{
+		Ar.SerializeIntPacked(Value);
+	}
+
+	// 음수 (INDEX_NONE 등) 도 1바이트가 되도록 ZigZag 인코딩
+	void PackInt(FArchive& Ar, int32& Value)
+	{
+		uint32 ZigZag = Ar.IsSaving() ? (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31) : 0;
+		Ar.SerializeIntPacked(ZigZag);
+		if (Ar.IsLoading())
+		{
+			Value = static_cast<int32>(ZigZag >> 1) ^ -static_cast<int32>(ZigZag & 1);
+		}
+	}
+
+	void PackInt64(FArchive& Ar, int64& Value)
+	{
+		uint32 Low = static_cast<uint32>(static_cast<uint64>(Value));
+		uint32 High = static_cast<uint32>(static_cast<uint64>(Value) >> 32);
+		PackUInt(Ar, Low);
+		PackUInt(Ar, High);
+		if (Ar.IsLoading())
+		{
+			Value = static_cast<int64>((static_cast<uint64>(High) << 32) | Low);
+		}
+	}
+
+	// 0.1 단위 고정 소수점
+	void PackTenths(FArchive& Ar, float& Value)
+	{
+		uint32 Tenths = Ar.IsSaving() ? static_cast<uint32>(FMath::Max(0, FMath::RoundToInt(Value * 10.f))) : 0;
+		PackUInt(Ar, Tenths);
+		if (Ar.IsLoading())
+		{
+			Value = Tenths * 0.1f;
+		}
+	}
+
+	// 배열 개수 (로드 시 상한 검사 후 SetNum)
+	template<typename T>
+	void PackNum(FArchive& Ar, TArray<T>& Array)
+	{
+		uint32 Num = Array.Num();
+		PackUInt(Ar, Num);
+		if (Ar.IsLoading())
+		{
+			if (Num > MaxReplayElements)
+			{
+				Ar.SetError();
+				Num = 0;
+			}
+			Array.SetNum(Num);
+		}
+	}
+
+	const TCHAR* LexEventType(EPCReplayEventType Type)
+	{
+		switch (Type)
+		{
+		case EPCReplayEventType::Move:    return TEXT("Move");
+		case EPCReplayEventType::Ability: return TEXT("Ability");
+		case EPCReplayEventType::Damage:  return TEXT("Damage");
+		case EPCReplayEventType::Death:   return TEXT("Death");
+		}
+		return TEXT("?");
+	}
+
+	const TCHAR* LexResult(EPCReplayResult Result)
+	{
+		switch (Result)
+		{
+		case EPCReplayResult::HostWon:  return TEXT("HostWon");
+		case EPCReplayResult::GuestWon: return TEXT("GuestWon");
+		case EPCReplayResult::Draw:     return TEXT("Draw");
+		default:                        return TEXT("None");
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	// 콘솔 : PC.Replay.RoundTripTest [NumUnits] [NumEvents] [Seed]
+	FAutoConsoleCommandWithArgs GPCReplayRoundTripCommand(
+		TEXT("PC.Replay.RoundTripTest"),
+		TEXT("Save / load a random combat replay and compare it with the original, including playback state. Args: [NumUnits=20] [NumEvents=5000] [Seed=1]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			FPCCombatReplay::DebugRoundTrip(
+				Args.IsValidIndex(0) ? FCString::Atoi(*Args[0]) : 20,
+				Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 5000,
+				Args.IsValidIndex(2) ? FCString::Atoi(*Args[2]) : 1);
+		}));
+#endif
+}
+
+bool FPCReplayUnit::operator==(const FPCReplayUnit& Other) const
+{
+	return TagNameIndex == Other.TagNameIndex && Level == Other.Level && Team == Other.Team && TileIndex == Other.TileIndex
+		&& FMath::IsNearlyEqual(MaxHealth, Other.MaxHealth, 0.05f) && FMath::IsNearlyEqual(Health, Other.Health, 0.05f);
+}
+
+int32 FPCCombatReplay::FindOrAddName(FName Name)
+{
+	const int32 Found = Names.IndexOfByKey(Name);
+	return Found != INDEX_NONE ? Found : Names.Add(Name);
+}
+
+void FPCCombatReplay::SerializeBody(FArchive& Ar)
+{
+	PackInt(Ar, MatchSeed);
+	PackInt(Ar, StageOne);
+	PackInt(Ar, RoundOne);
+	PackInt(Ar, HostSeat);
+	PackInt(Ar, GuestSeat);
+
+	uint8 KindAndResult = Ar.IsSaving() ? static_cast<uint8>(PairKind) | (static_cast<uint8>(Result) << 4) : 0;
+	Ar << KindAndResult;
+	if (Ar.IsLoading())
+	{
+		PairKind = static_cast<EPCReplayPairKind>(KindAndResult & 0x0F);
+		Result = static_cast<EPCReplayResult>(KindAndResult >> 4);
+	}
+
+	PackUInt(Ar, DurationMs);
+	PackInt(Ar, Cols);
+	PackInt(Ar, Rows);
+
+	PackNum(Ar, Names);
+	for (FName& Name : Names)
+	{
+		FString NameString = Ar.IsSaving() ? Name.ToString() : FString();
+		Ar << NameString;
+		if (Ar.IsLoading())
+		{
+			Name = FName(*NameString);
+		}
+	}
+
+	PackNum(Ar, Seeds);
+	for (FPCReplaySeed& Seed : Seeds)
+	{
+		PackInt(Ar, Seed.NameIndex);
+		PackInt(Ar, Seed.Seed);
+		PackInt64(Ar, Seed.DrawCount);
+	}
+
+	PackNum(Ar, Units);
+	for (FPCReplayUnit& Unit : Units)
+	{
+		PackInt(Ar, Unit.TagNameIndex);
+		PackInt(Ar, Unit.Level);
+		PackInt(Ar, Unit.Team);
+		PackInt(Ar, Unit.TileIndex);
+		PackTenths(Ar, Unit.MaxHealth);
+		PackTenths(Ar, Unit.Health);
+	}
+
+	// 이벤트 : 종류 + 플래그 1바이트, 시간은 직전 이벤트와의 차이
+	PackNum(Ar, Events);
+	uint32 PrevTimeMs = 0;
+	for (FPCReplayEvent& Event : Events)
+	{
+		uint8 TypeAndFlags = Ar.IsSaving() ? static_cast<uint8>(Event.Type) | (Event.Flags << 2) : 0;
+		Ar << TypeAndFlags;
+
+		uint32 DeltaMs = Ar.IsSaving() ? Event.TimeMs - PrevTimeMs : 0;
+		PackUInt(Ar, DeltaMs);
+
+		uint32 UnitId = Event.Unit;
+		PackUInt(Ar, UnitId);
+
+		if (Ar.IsLoading())
+		{
+			Event.Type = static_cast<EPCReplayEventType>(TypeAndFlags & 0x03);
+			Event.Flags = TypeAndFlags >> 2;
+			Event.TimeMs = PrevTimeMs + DeltaMs;
+			Event.Unit = static_cast<uint16>(UnitId);
+		}
+		PrevTimeMs = Event.TimeMs;
+
+		switch (Event.Type)
+		{
+		case EPCReplayEventType::Damage:
+			{
+				uint32 TargetId = Event.Target;
+				PackUInt(Ar, TargetId);
+				Event.Target = static_cast<uint16>(TargetId);
+				PackUInt(Ar, Event.Value);
+				break;
+			}
+		case EPCReplayEventType::Move:
+		case EPCReplayEventType::Ability:
+			PackUInt(Ar, Event.Value);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+bool FPCCombatReplay::SaveToBytes(TArray<uint8>& OutBytes) const
+{
+	TArray<uint8> Body;
+	FMemoryWriter BodyWriter(Body);
+	const_cast<FPCCombatReplay*>(this)->SerializeBody(BodyWriter);
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Body.Num());
+	TArray<uint8> Compressed;
+	Compressed.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Body.GetData(), Body.Num()))
+		return false;
+	Compressed.SetNum(CompressedSize, EAllowShrinking::No);
+
+	OutBytes.Reset();
+	FMemoryWriter Writer(OutBytes);
+	uint32 FileMagic = Magic;
+	uint16 FileVersion = CurrentVersion;
+	int32 BodySize = Body.Num();
+	Writer << FileMagic << FileVersion << BodySize;
+	Writer.Serialize(Compressed.GetData(), Compressed.Num());
+	return !Writer.IsError();
+}
+
+bool FPCCombatReplay::LoadFromBytes(const TArray<uint8>& Bytes)
+{
+	FMemoryReader Reader(Bytes);
+	uint32 FileMagic = 0;
+	uint16 FileVersion = 0;
+	int32 BodySize = 0;
+	Reader << FileMagic << FileVersion << BodySize;
+
+	if (Reader.IsError() || FileMagic != Magic)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Replay] Not a combat replay"));
+		return false;
+	}
+	if (FileVersion > CurrentVersion || BodySize < 0 || static_cast<uint32>(BodySize) > MaxReplayElements * 16)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Replay] Unsupported replay (Version=%d, Current=%d, Body=%d)"), FileVersion, CurrentVersion, BodySize);
+		return false;
+	}
+
+	const int64 HeaderSize = Reader.Tell();
+	TArray<uint8> Body;
+	Body.SetNumUninitialized(BodySize);
+	if (!FCompression::UncompressMemory(NAME_Zlib, Body.GetData(), BodySize, Bytes.GetData() + HeaderSize, Bytes.Num() - HeaderSize))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Replay] Failed to decompress replay body"));
+		return false;
+	}
+
+	*this = FPCCombatReplay();
+	FMemoryReader BodyReader(Body);
+	SerializeBody(BodyReader);
+	return !BodyReader.IsError();
+}
+
+bool FPCCombatReplay::SaveToFile(const FString& Path) const
+{
+	TArray<uint8> Bytes;
+	return SaveToBytes(Bytes) && FFileHelper::SaveArrayToFile(Bytes, *Path);
+}
+
+bool FPCCombatReplay::LoadFromFile(const FString& Path)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Replay] Failed to read %s"), *Path);
+		return false;
+	}
+	return LoadFromBytes(Bytes);
+}
+
+bool FPCCombatReplay::operator==(const FPCCombatReplay& Other) const
+{
+	return MatchSeed == Other.MatchSeed && StageOne == Other.StageOne && RoundOne == Other.RoundOne
+		&& HostSeat == Other.HostSeat && GuestSeat == Other.GuestSeat && PairKind == Other.PairKind && Result == Other.Result
+		&& DurationMs == Other.DurationMs && Cols == Other.Cols && Rows == Other.Rows
+		&& Names == Other.Names && Seeds == Other.Seeds && Units == Other.Units && Events == Other.Events;
+}
+
+bool FPCCombatReplay::DebugRoundTrip(int32 NumUnits, int32 NumEvents, int32 Seed)
+{
+#if !UE_BUILD_SHIPPING
+	NumUnits = FMath::Clamp(NumUnits, 1, MAX_uint16);
+	NumEvents = FMath::Max(NumEvents, 0);
+	FRandomStream Stream(Seed);
+
+	FPCCombatReplay Source;
+	Source.MatchSeed = static_cast<int32>(Stream.GetUnsignedInt());
+	Source.StageOne = Stream.RandRange(1, 7);
+	Source.RoundOne = Stream.RandRange(1, 7);
+	Source.HostSeat = Stream.RandRange(0, 7);
+	Source.GuestSeat = Stream.RandRange(-1, 7);
+	Source.PairKind = static_cast<EPCReplayPairKind>(Stream.RandRange(0, 2));
+	Source.Result = static_cast<EPCReplayResult>(Stream.RandRange(0, 3));
+	Source.Cols = 8;
+	Source.Rows = 7;
+
+	const int32 DamageName = Source.FindOrAddName(TEXT("Damage"));
+	FPCReplaySeed& DamageSeed = Source.Seeds.AddDefaulted_GetRef();
+	DamageSeed.NameIndex = DamageName;
+	DamageSeed.Seed = static_cast<int32>(Stream.GetUnsignedInt());
+	DamageSeed.DrawCount = static_cast<int64>(Stream.GetUnsignedInt()) * 3;
+
+	for (int32 i = 0; i < NumUnits; ++i)
+	{
+		FPCReplayUnit& Unit = Source.Units.AddDefaulted_GetRef();
+		Unit.TagNameIndex = Source.FindOrAddName(*FString::Printf(TEXT("Unit.Type.Hero.Test%d"), Stream.RandRange(0, 9)));
+		Unit.Level = Stream.RandRange(1, 3);
+		Unit.Team = Stream.RandRange(0, 1) ? Source.HostSeat : Source.GuestSeat;
+		Unit.TileIndex = Stream.RandRange(0, Source.Cols * Source.Rows - 1);
+		Unit.MaxHealth = Stream.RandRange(1, 50000) * 0.1f;
+		Unit.Health = Unit.MaxHealth;
+	}
+
+	uint32 TimeMs = 0;
+	for (int32 i = 0; i < NumEvents; ++i)
+	{
+		FPCReplayEvent& Event = Source.Events.AddDefaulted_GetRef();
+		TimeMs += Stream.RandRange(0, 200);
+		Event.TimeMs = TimeMs;
+		Event.Type = static_cast<EPCReplayEventType>(Stream.RandRange(0, 3));
+		Event.Unit = static_cast<uint16>(Stream.RandRange(0, NumUnits - 1));
+		switch (Event.Type)
+		{
+		case EPCReplayEventType::Move:
+			Event.Value = Stream.RandRange(0, Source.Cols * Source.Rows - 1);
+			break;
+		case EPCReplayEventType::Ability:
+			Event.Value = Source.FindOrAddName(*FString::Printf(TEXT("GA_Test_%d"), Stream.RandRange(0, 15)));
+			break;
+		case EPCReplayEventType::Damage:
+			Event.Target = static_cast<uint16>(Stream.RandRange(0, NumUnits - 1));
+			Event.Value = Stream.RandRange(0, 20000);
+			Event.Flags = static_cast<uint8>(Stream.RandRange(0, 31));
+			break;
+		default:
+			break;
+		}
+	}
+	Source.DurationMs = TimeMs;
+
+	TArray<uint8> Bytes;
+	FPCCombatReplay Loaded;
+	const bool bSaved = Source.SaveToBytes(Bytes);
+	const bool bLoaded = bSaved && Loaded.LoadFromBytes(Bytes);
+	const bool bSameData = bLoaded && Source == Loaded;
+
+	// 재생 결과 비교
+	FPCCombatReplayPlayer SourcePlayer(Source);
+	FPCCombatReplayPlayer LoadedPlayer(Loaded);
+	SourcePlayer.AdvanceToEnd();
+	LoadedPlayer.AdvanceToEnd();
+	const bool bSamePlayback = bLoaded && SourcePlayer.GetUnitStates() == LoadedPlayer.GetUnitStates();
+
+	TArray<uint8> RawBody;
+	FMemoryWriter RawWriter(RawBody);
+	Source.SerializeBody(RawWriter);
+
+	const bool bPassed = bSameData && bSamePlayback;
+	UE_LOG(LogTemp, Log, TEXT("[Replay] RoundTrip %s (Seed=%d) Units=%d Events=%d Bytes=%d (packed %d, %.2f B/event) Data=%s Playback=%s"),
+		bPassed ? TEXT("OK") : TEXT("FAILED"), Seed, NumUnits, NumEvents, Bytes.Num(), RawBody.Num(),
+		NumEvents > 0 ? static_cast<double>(Bytes.Num()) / NumEvents : 0.0,
+		bSameData ? TEXT("Same") : TEXT("Different"), bSamePlayback ? TEXT("Same") : TEXT("Different"));
+	return bPassed;
+#else
+	return true;
+#endif
+}
+
+bool FPCCombatReplayPlayer::FUnitState::operator==(const FUnitState& Other) const
+{
+	return TileIndex == Other.TileIndex && bAlive == Other.bAlive && NumMoves == Other.NumMoves && NumAbilities == Other.NumAbilities
+		&& FMath::IsNearlyEqual(Health, Other.Health, 0.05f)
+		&& FMath::IsNearlyEqual(DamageDealt, Other.DamageDealt, 0.05f)
+		&& FMath::IsNearlyEqual(DamageTaken, Other.DamageTaken, 0.05f);
+}
+
+FPCCombatReplayPlayer::FPCCombatReplayPlayer(const FPCCombatReplay& InReplay)
+	: Replay(InReplay)
+{
+	Reset();
+}
+
+void FPCCombatReplayPlayer::Reset()
+{
+	NextEvent = 0;
+	CurrentTimeMs = 0;
+
+	UnitStates.SetNum(Replay.Units.Num());
+	for (int32 i = 0; i < Replay.Units.Num(); ++i)
+	{
+		FUnitState& State = UnitStates[i];
+		State = FUnitState();
+		State.TileIndex = Replay.Units[i].TileIndex;
+		State.Health = Replay.Units[i].Health;
+	}
+}
+
+int32 FPCCombatReplayPlayer::AdvanceTo(uint32 TimeMs)
+{
+	int32 NumApplied = 0;
+	while (Replay.Events.IsValidIndex(NextEvent) && Replay.Events[NextEvent].TimeMs <= TimeMs)
+	{
+		ApplyEvent(Replay.Events[NextEvent++]);
+		++NumApplied;
+	}
+
+	CurrentTimeMs = FMath::Max(CurrentTimeMs, FMath::Min(TimeMs, Replay.DurationMs));
+	return NumApplied;
+}
+
+void FPCCombatReplayPlayer::ApplyEvent(const FPCReplayEvent& Event)
+{
+	// 데미지는 공격자를 알 수 없어도 (기록 밖 유닛) 피격자에 반영
+	if (Event.Type == EPCReplayEventType::Damage)
+	{
+		if (!(Event.Flags & EPCReplayDamageFlags::Evaded) && UnitStates.IsValidIndex(Event.Target))
+		{
+			const float Damage = Event.Value * 0.1f;
+			FUnitState& Target = UnitStates[Event.Target];
+			Target.Health = FMath::Max(0.f, Target.Health - Damage);
+			Target.DamageTaken += Damage;
+
+			if (UnitStates.IsValidIndex(Event.Unit))
+			{
+				UnitStates[Event.Unit].DamageDealt += Damage;
+			}
+		}
+		return;
+	}
+
+	if (!UnitStates.IsValidIndex(Event.Unit))
+		return;
+
+	FUnitState& Unit = UnitStates[Event.Unit];
+	switch (Event.Type)
+	{
+	case EPCReplayEventType::Move:
+		Unit.TileIndex = static_cast<int32>(Event.Value);
+		++Unit.NumMoves;
+		break;
+
+	case EPCReplayEventType::Ability:
+		++Unit.NumAbilities;
+		break;
+
+	case EPCReplayEventType::Death:
+		Unit.bAlive = false;
+		break;
+
+	default:
+		break;
+	}
+}
+
+FString FPCCombatReplayPlayer::GetUnitLabel(int32 UnitId) const
+{
+	if (!Replay.Units.IsValidIndex(UnitId))
+		return FString::Printf(TEXT("?#%d"), UnitId);
+
+	return FString::Printf(TEXT("%s#%d"), *Replay.GetName(Replay.Units[UnitId].TagNameIndex).ToString(), UnitId);
+}
+
+FString FPCCombatReplayPlayer::DescribeEvent(const FPCReplayEvent& Event) const
+{
+	FString Detail;
+	switch (Event.Type)
+	{
+	case EPCReplayEventType::Move:
+		Detail = Replay.Rows > 0
+			? FString::Printf(TEXT("-> (Y=%u, X=%u)"), Event.Value / Replay.Rows, Event.Value % Replay.Rows)
+			: FString::Printf(TEXT("-> %u"), Event.Value);
+		break;
+	case EPCReplayEventType::Ability:
+		Detail = Replay.GetName(Event.Value).ToString();
+		break;
+	case EPCReplayEventType::Damage:
+		Detail = (Event.Flags & EPCReplayDamageFlags::Evaded)
+			? FString::Printf(TEXT("-> %s evaded"), *GetUnitLabel(Event.Target))
+			: FString::Printf(TEXT("-> %s %.1f%s"), *GetUnitLabel(Event.Target), Event.Value * 0.1f,
+				(Event.Flags & EPCReplayDamageFlags::Critical) ? TEXT(" crit") : TEXT(""));
+		break;
+	default:
+		break;
+	}
+
+	return FString::Printf(TEXT("[%7.3fs] %-7s %s %s"), Event.TimeMs / 1000.0, LexEventType(Event.Type), *GetUnitLabel(Event.Unit), *Detail);
+}
+
+void FPCCombatReplayPlayer::LogState() const
+{
+	UE_LOG(LogTemp, Log, TEXT("[Replay] Match=%d Stage %d-%d Host=%d Guest=%d Result=%s Duration=%.2fs Events=%d/%d Time=%.2fs"),
+		Replay.MatchSeed, Replay.StageOne, Replay.RoundOne, Replay.HostSeat, Replay.GuestSeat, LexResult(Replay.Result),
+		Replay.DurationMs / 1000.0, NextEvent, Replay.Events.Num(), CurrentTimeMs / 1000.0);
+
+	for (const FPCReplaySeed& Seed : Replay.Seeds)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[Replay]   Random %s : Seed=%d Draws=%lld"), *Replay.GetName(Seed.NameIndex).ToString(), Seed.Seed, Seed.DrawCount);
+	}
+
+	for (int32 i = 0; i < UnitStates.Num(); ++i)
+	{
+		const FUnitState& State = UnitStates[i];
+		UE_LOG(LogTemp, Log, TEXT("[Replay]   %-32s Team=%d Lv=%d %s HP=%.1f/%.1f Tile=%d Moves=%d Abilities=%d Dealt=%.1f Taken=%.1f"),
+			*GetUnitLabel(i), Replay.Units[i].Team, Replay.Units[i].Level, State.bAlive ? TEXT("Alive") : TEXT("Dead "),
+			State.Health, Replay.Units[i].MaxHealth, State.TileIndex, State.NumMoves, State.NumAbilities, State.DamageDealt, State.DamageTaken);
+	}
+}
@@ -0,0 +1,176 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Simulation/PCCombatSimCommandlet.h"
+
+#include "DataAsset/Unit/PCDataAsset_BaseUnitData.h"
+#include "DataAsset/Unit/PCDataAsset_UnitDefinition.h"
+#include "DataAsset/Unit/PCDataAsset_UnitDefinitionReg.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Simulation/PCCombatSimulator.h"
+
+UPCCombatSimCommandlet::UPCCombatSimCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UPCCombatSimCommandlet::Main(const FString& Params)
+{
+	FString RegistryPath, MatchupPath, OutputPath;
+	int32 Runs = 100;
+	int32 BaseSeed = 1;
+	float MaxDuration = 0.f;
+	
+	FParse::Value(*Params, TEXT("Registry="), RegistryPath);
+	FParse::Value(*Params, TEXT("Matchups="), MatchupPath);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	FParse::Value(*Params, TEXT("Runs="), Runs);
+	FParse::Value(*Params, TEXT("Seed="), BaseSeed);
+	FParse::Value(*Params, TEXT("MaxDuration="), MaxDuration);
+
+	if (RegistryPath.IsEmpty() || MatchupPath.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CombatSim] Usage : -run=PCCombatSim -Registry=<UnitDefinitionReg> -Matchups=<file> [-Output=<file>] [-Runs=N] [-Seed=N] [-MaxDuration=Sec]"));
+		return 1;
+	}
+
+	const UPCDataAsset_UnitDefinitionReg* Registry = LoadObject<UPCDataAsset_UnitDefinitionReg>(nullptr, *RegistryPath);
+	if (!Registry)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CombatSim] Failed to load registry %s"), *RegistryPath);
+		return 1;
+	}
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *MatchupPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CombatSim] Failed to read matchups %s"), *MatchupPath);
+		return 1;
+	}
+
+	if (OutputPath.IsEmpty())
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("CombatSim") / TEXT("CombatSimResult.csv");
+	}
+
+	FPCSimConfig Config = FPCSimConfig::MakeDefault();
+	if (MaxDuration > 0.f)
+	{
+		Config.MaxDuration = MaxDuration;
+	}
+	const FPCCombatSimulator Simulator(Config);
+	Runs = FMath::Max(1, Runs);
+
+	FString Csv = TEXT("Name,Runs,HostWins,GuestWins,Draws,HostWinRate,GuestWinRate,AvgDuration,AvgHostAlive,AvgGuestAlive\n");
+	
+	int32 TotalFights = 0;
+	const double StartTime = FPlatformTime::Seconds();
+	
+	for (const FString& RawLine : Lines)
+	{
+		const FString Line = RawLine.TrimStartAndEnd();
+		if (Line.IsEmpty() || Line.StartsWith(TEXT("#")))
+			continue;
+
+		TArray<FString> Columns;
+		Line.ParseIntoArray(Columns, TEXT(","), false);
+		if (Columns.Num() < 3)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[CombatSim] Skip malformed line : %s"), *Line);
+			continue;
+		}
+
+		FPCSimBoardDesc Host, Guest;
+		if (!ParseBoard(Columns[1], Registry, Host) || !ParseBoard(Columns[2], Registry, Guest))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[CombatSim] Skip matchup %s (board parse failed)"), *Columns[0]);
+			continue;
+		}
+
+		int32 HostWins = 0, GuestWins = 0, Draws = 0;
+		double DurationSum = 0.0, HostAliveSum = 0.0, GuestAliveSum = 0.0;
+		
+		for (int32 Run = 0; Run < Runs; ++Run)
+		{
+			const FPCSimResult Result = Simulator.Run(Host, Guest, HashCombine(GetTypeHash(BaseSeed), GetTypeHash(Run)));
+			
+			switch (Result.WinnerTeam)
+			{
+			case 0: ++HostWins; break;
+			case 1: ++GuestWins; break;
+			default: ++Draws; break;
+			}
+			
+			DurationSum += Result.Duration;
+			HostAliveSum += Result.HostAlive;
+			GuestAliveSum += Result.GuestAlive;
+		}
+
+		TotalFights += Runs;
+		
+		Csv += FString::Printf(TEXT("%s,%d,%d,%d,%d,%.4f,%.4f,%.3f,%.2f,%.2f\n"),
+			*Columns[0].TrimStartAndEnd(), Runs, HostWins, GuestWins, Draws,
+			static_cast<double>(HostWins) / Runs, static_cast<double>(GuestWins) / Runs,
+			DurationSum / Runs, HostAliveSum / Runs, GuestAliveSum / Runs);
+	}
+
+	const double Elapsed = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogTemp, Display, TEXT("[CombatSim] Fights=%d Elapsed=%.2fs (%.0f fights/min)"),
+		TotalFights, Elapsed, Elapsed > 0.0 ? TotalFights * 60.0 / Elapsed : 0.0);
+
+	if (!FFileHelper::SaveStringToFile(Csv, *OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[CombatSim] Failed to write %s"), *OutputPath);
+		return 1;
+	}
+	
+	UE_LOG(LogTemp, Display, TEXT("[CombatSim] Result written to %s"), *OutputPath);
+	return 0;
+}
+
+bool UPCCombatSimCommandlet::ParseBoard(const FString& BoardString, const UPCDataAsset_UnitDefinitionReg* Registry,
+	FPCSimBoardDesc& OutBoard) const
+{
+	TArray<FString> Entries;
+	BoardString.ParseIntoArray(Entries, TEXT(";"), true);
+
+	for (const FString& RawEntry : Entries)
+	{
+		// UnitTag:Level@Y:X
+		FString UnitPart, PointPart, TagString, LevelString, YString, XString;
+		const FString Entry = RawEntry.TrimStartAndEnd();
+		if (!Entry.Split(TEXT("@"), &UnitPart, &PointPart)
+			|| !UnitPart.Split(TEXT(":"), &TagString, &LevelString)
+			|| !PointPart.Split(TEXT(":"), &YString, &XString))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[CombatSim] Malformed unit entry : %s"), *Entry);
+			return false;
+		}
+
+		const FGameplayTag UnitTag = FGameplayTag::RequestGameplayTag(FName(*TagString), false);
+		const UPCDataAsset_UnitDefinition* Definition = UnitTag.IsValid() ? Registry->FindUnitDefinition(UnitTag) : nullptr;
+		const UPCDataAsset_BaseUnitData* UnitData = Definition ? Definition->UnitDataAsset.Get() : nullptr;
+		if (!UnitData)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[CombatSim] Unknown unit tag : %s"), *TagString);
+			return false;
+		}
+
+		FPCSimUnitDesc& Desc = OutBoard.Units.AddDefaulted_GetRef();
+		Desc.UnitTag = UnitTag;
+		Desc.UnitLevel = FMath::Clamp(FCString::Atoi(*LevelString), 1, 3);
+		Desc.GridPoint = FIntPoint(FCString::Atoi(*XString), FCString::Atoi(*YString));
+		Desc.Stats.bIsHero = Definition->ClassType != EUnitClassType::Creep;
+
+		TMap<FGameplayAttribute, float> StatMap;
+		UnitData->FillInitStatMap(Desc.UnitLevel, StatMap);
+		Desc.Stats.ApplyStatMap(StatMap);
+	}
+
+	return true;
+}
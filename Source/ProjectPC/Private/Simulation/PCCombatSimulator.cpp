@@ -0,0 +1,423 @@
+#include "Simulation/PCCombatSimulator.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystem/Unit/AttributeSet/PCHeroUnitAttributeSet.h"
+#include "AbilitySystem/Unit/AttributeSet/PCUnitAttributeSet.h"
+#include "AbilitySystem/Unit/ExecutionCalculation/PCUnitDamageFormula.h"
+#include "Character/Unit/PCBaseUnitCharacter.h"
+#include "GameFramework/HelpActor/PCCombatManager.h"
+#include "GameFramework/HelpActor/Component/PCTileManager.h"
+
+namespace
+{
+	struct FSimStatBinding
+	{
+		FGameplayAttribute Attribute;
+		float FPCSimUnitStats::* Member;
+	};
+
+	// AttributeSet 속성 <-> 시뮬레이터 스탯 매핑
+	const TArray<FSimStatBinding>& GetStatBindings()
+	{
+		static const TArray<FSimStatBinding> Bindings = {
+			{ UPCUnitAttributeSet::GetMaxHealthAttribute(), &FPCSimUnitStats::MaxHealth },
+			{ UPCUnitAttributeSet::GetBaseDamageAttribute(), &FPCSimUnitStats::BaseDamage },
+			{ UPCUnitAttributeSet::GetAttackRangeAttribute(), &FPCSimUnitStats::AttackRange },
+			{ UPCUnitAttributeSet::GetAttackSpeedAttribute(), &FPCSimUnitStats::AttackSpeed },
+			{ UPCUnitAttributeSet::GetAttackSpeedIncreaseMultiplierAttribute(), &FPCSimUnitStats::AttackSpeedIncreaseMultiplier },
+			{ UPCUnitAttributeSet::GetAttackSpeedDecreaseMultiplierAttribute(), &FPCSimUnitStats::AttackSpeedDecreaseMultiplier },
+			{ UPCUnitAttributeSet::GetPhysicalDefenseAttribute(), &FPCSimUnitStats::PhysicalDefense },
+			{ UPCUnitAttributeSet::GetMagicDefenseAttribute(), &FPCSimUnitStats::MagicDefense },
+			{ UPCUnitAttributeSet::GetFlatDamageBlockAttribute(), &FPCSimUnitStats::FlatDamageBlock },
+			{ UPCUnitAttributeSet::GetEvasionChanceAttribute(), &FPCSimUnitStats::EvasionChance },
+			{ UPCHeroUnitAttributeSet::GetMaxManaAttribute(), &FPCSimUnitStats::MaxMana },
+			{ UPCHeroUnitAttributeSet::GetCombatStartManaAttribute(), &FPCSimUnitStats::CombatStartMana },
+			{ UPCHeroUnitAttributeSet::GetManaRegenAttribute(), &FPCSimUnitStats::ManaRegen },
+			{ UPCHeroUnitAttributeSet::GetUltimateDamageAttribute(), &FPCSimUnitStats::UltimateDamage },
+			{ UPCHeroUnitAttributeSet::GetUltimateCostAttribute(), &FPCSimUnitStats::UltimateCost },
+			{ UPCHeroUnitAttributeSet::GetPhysicalDamageMultiplierAttribute(), &FPCSimUnitStats::PhysicalDamageMultiplier },
+			{ UPCHeroUnitAttributeSet::GetMagicDamageMultiplierAttribute(), &FPCSimUnitStats::MagicDamageMultiplier },
+			{ UPCHeroUnitAttributeSet::GetDamageMultiplierAttribute(), &FPCSimUnitStats::DamageMultiplier },
+			{ UPCHeroUnitAttributeSet::GetCritChanceAttribute(), &FPCSimUnitStats::CritChance },
+			{ UPCHeroUnitAttributeSet::GetCritMultiplierAttribute(), &FPCSimUnitStats::CritMultiplier },
+			{ UPCHeroUnitAttributeSet::GetLifeStealAttribute(), &FPCSimUnitStats::LifeSteal },
+		};
+		return Bindings;
+	}
+}
+
+void FPCSimUnitStats::ApplyStatMap(const TMap<FGameplayAttribute, float>& StatMap)
+{
+	for (const FSimStatBinding& Binding : GetStatBindings())
+	{
+		if (const float* Value = StatMap.Find(Binding.Attribute))
+		{
+			this->*Binding.Member = *Value;
+		}
+	}
+}
+
+void FPCSimUnitStats::ReadFromAbilitySystem(const UAbilitySystemComponent* ASC)
+{
+	if (!ASC)
+		return;
+
+	bIsHero = ASC->GetAttributeSet(UPCHeroUnitAttributeSet::StaticClass()) != nullptr;
+	
+	for (const FSimStatBinding& Binding : GetStatBindings())
+	{
+		if (ASC->HasAttributeSetForAttribute(Binding.Attribute))
+		{
+			this->*Binding.Member = ASC->GetNumericAttribute(Binding.Attribute);
+		}
+	}
+}
+
+float FPCSimUnitStats::GetEffectiveAttackSpeed() const
+{
+	return UPCUnitAttributeSet::CalcEffectiveAttackSpeed(AttackSpeed, AttackSpeedIncreaseMultiplier, AttackSpeedDecreaseMultiplier);
+}
+
+float FPCSimUnitStats::GetUltimateManaCost() const
+{
+	return UltimateCost > 0.f ? UltimateCost : MaxMana;
+}
+
+FPCSimBoardDesc FPCSimBoardDesc::FromSnapShot(const FBoardFieldSnapShot& SnapShot)
+{
+	FPCSimBoardDesc Out;
+	
+	for (const FCombatManager_FieldSlot& Slot : SnapShot.Field)
+	{
+		const APCBaseUnitCharacter* Unit = Slot.Unit.Get();
+		if (!IsValid(Unit))
+			continue;
+
+		FPCSimUnitDesc& Desc = Out.Units.AddDefaulted_GetRef();
+		Desc.UnitTag = Unit->GetUnitTag();
+		Desc.UnitLevel = Unit->GetUnitLevel();
+		Desc.GridPoint = FIntPoint(Slot.Row, Slot.Col);
+		Desc.Stats.ReadFromAbilitySystem(Unit->GetAbilitySystemComponent());
+	}
+	
+	return Out;
+}
+
+FPCSimConfig FPCSimConfig::MakeDefault()
+{
+	FPCSimConfig Out;
+	if (const UPCTileManager* TileManagerCDO = GetDefault<UPCTileManager>())
+	{
+		Out.Cols = TileManagerCDO->Cols;
+		Out.Rows = TileManagerCDO->Rows;
+	}
+	return Out;
+}
+
+FPCCombatSimulator::FPCCombatSimulator(const FPCSimConfig& InConfig)
+	: Config(InConfig)
+{
+	Topology.Build(Config.Cols, Config.Rows);
+}
+
+FPCSimResult FPCCombatSimulator::Run(const FPCSimBoardDesc& Host, const FPCSimBoardDesc& Guest, int32 Seed) const
+{
+	FSimState State;
+	State.Stream.Initialize(Seed);
+	State.TileOwner.Init(INDEX_NONE, Topology.Num());
+	State.Units.Reserve(Host.Units.Num() + Guest.Units.Num());
+
+	PlaceBoard(State, Host, 0);
+	PlaceBoard(State, Guest, 1);
+
+	TArray<int32> Order;
+	Order.Reserve(State.Units.Num());
+	
+	const float Dt = FMath::Max(Config.TickInterval, KINDA_SMALL_NUMBER);
+	int32 HostAlive = 0, GuestAlive = 0;
+	CountAlive(State, HostAlive, GuestAlive);
+
+	while (HostAlive > 0 && GuestAlive > 0 && State.Result.Duration < Config.MaxDuration)
+	{
+		// 매 틱 행동 순서를 섞어서 선공 편향 제거 (Stream 기반이라 재현 가능)
+		Order.Reset();
+		for (int32 i = 0; i < State.Units.Num(); ++i)
+		{
+			if (State.Units[i].bAlive)
+			{
+				Order.Add(i);
+			}
+		}
+		for (int32 i = Order.Num() - 1; i > 0; --i)
+		{
+			Order.Swap(i, State.Stream.RandRange(0, i));
+		}
+
+		for (const int32 UnitIndex : Order)
+		{
+			TickUnit(State, UnitIndex);
+		}
+
+		State.Result.Duration += Dt;
+		++State.Result.Ticks;
+		CountAlive(State, HostAlive, GuestAlive);
+	}
+
+	State.Result.HostAlive = HostAlive;
+	State.Result.GuestAlive = GuestAlive;
+	if (HostAlive > 0 && GuestAlive == 0)
+	{
+		State.Result.WinnerTeam = 0;
+	}
+	else if (GuestAlive > 0 && HostAlive == 0)
+	{
+		State.Result.WinnerTeam = 1;
+	}
+	
+	return State.Result;
+}
+
+void FPCCombatSimulator::PlaceBoard(FSimState& State, const FPCSimBoardDesc& Board, int32 Team) const
+{
+	for (const FPCSimUnitDesc& Desc : Board.Units)
+	{
+		// 게스트는 CombatManager 와 동일하게 좌표 미러링
+		FIntPoint Point = Desc.GridPoint;
+		if (Team == 1)
+		{
+			Point = FIntPoint(Config.Rows - 1 - Point.X, Config.Cols - 1 - Point.Y);
+		}
+
+		const int32 TileIndex = Topology.ToIndex(Point);
+		if (TileIndex == INDEX_NONE || State.TileOwner[TileIndex] != INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[CombatSim] Skip unit %s at %s (Team=%d)"),
+				*Desc.UnitTag.ToString(), *Point.ToString(), Team);
+			continue;
+		}
+
+		FSimUnit& Unit = State.Units.AddDefaulted_GetRef();
+		Unit.Desc = &Desc;
+		Unit.Team = Team;
+		Unit.TileIndex = TileIndex;
+		Unit.Health = Desc.Stats.MaxHealth;
+		Unit.Mana = Desc.Stats.bIsHero ? Desc.Stats.CombatStartMana : 0.f;
+		Unit.bAlive = Unit.Health > 0.f;
+
+		if (Unit.bAlive)
+		{
+			State.TileOwner[TileIndex] = State.Units.Num() - 1;
+		}
+	}
+}
+
+void FPCCombatSimulator::TickUnit(FSimState& State, int32 UnitIndex) const
+{
+	FSimUnit& Unit = State.Units[UnitIndex];
+	if (!Unit.bAlive)
+		return;
+
+	const float Dt = Config.TickInterval;
+	const FPCSimUnitStats& Stats = Unit.Desc->Stats;
+
+	if (Stats.bIsHero && Stats.ManaRegen > 0.f)
+	{
+		Unit.Mana += Stats.ManaRegen * Dt;
+	}
+	
+	Unit.AttackTimer = FMath::Max(0.f, Unit.AttackTimer - Dt);
+	
+	// 이동 중이면 도착할 때까지 대기 (타일은 출발 시점에 이미 점유)
+	if (Unit.MoveTimer > 0.f)
+	{
+		Unit.MoveTimer -= Dt;
+		return;
+	}
+
+	const int32 TargetIndex = FindTargetInRange(State, Unit);
+	if (TargetIndex != INDEX_NONE)
+	{
+		if (Unit.AttackTimer <= 0.f)
+		{
+			Attack(State, Unit, State.Units[TargetIndex]);
+			Unit.AttackTimer = 1.f / FMath::Max(Stats.GetEffectiveAttackSpeed(), 0.0001f);
+		}
+		return;
+	}
+
+	TryApproach(State, Unit);
+}
+
+int32 FPCCombatSimulator::FindTargetInRange(const FSimState& State, const FSimUnit& Unit) const
+{
+	// BTTask_FindTarget (NearestInRange) 와 동일 : 가까운 링부터, 같은 거리면 랜덤
+	const int32 Range = FMath::Min<int32>(static_cast<int32>(Unit.Desc->Stats.AttackRange), Topology.GetMaxDistance());
+	TArray<int32, TInlineAllocator<8>> Candidates;
+	
+	for (int32 Radius = 1; Radius <= Range; ++Radius)
+	{
+		Candidates.Reset();
+		for (const int32 TileIndex : Topology.GetRing(Unit.TileIndex, Radius))
+		{
+			const int32 Other = State.TileOwner[TileIndex];
+			if (Other != INDEX_NONE && State.Units[Other].bAlive && State.Units[Other].Team != Unit.Team)
+			{
+				Candidates.Add(Other);
+			}
+		}
+
+		if (!Candidates.IsEmpty())
+		{
+			return Candidates[State.Stream.RandHelper(Candidates.Num())];
+		}
+	}
+	
+	return INDEX_NONE;
+}
+
+bool FPCCombatSimulator::TryApproach(FSimState& State, FSimUnit& Unit) const
+{
+	// BTTask_FindApproachLocation 과 동일 : 빈 타일로만 BFS, 적이 보이는 첫 경로의 첫 칸으로 이동
+	struct FBfsData
+	{
+		int32 TileIndex;
+		int32 FirstMoveIndex;
+	};
+
+	auto GetShuffledNeighbors = [this, &State](int32 TileIndex)
+	{
+		TArray<int32, TInlineAllocator<6>> Out(Topology.GetNeighbors(TileIndex));
+		for (int32 i = Out.Num() - 1; i > 0; --i)
+		{
+			Out.Swap(i, State.Stream.RandRange(0, i));
+		}
+		return Out;
+	};
+
+	TArray<FBfsData, TInlineAllocator<64>> Q;
+	TBitArray<TInlineAllocator<2>> Visited(false, Topology.Num());
+	Visited[Unit.TileIndex] = true;
+
+	for (const int32 NextIndex : GetShuffledNeighbors(Unit.TileIndex))
+	{
+		if (State.TileOwner[NextIndex] == INDEX_NONE)
+		{
+			Q.Add(FBfsData(NextIndex, NextIndex));
+			Visited[NextIndex] = true;
+		}
+	}
+
+	for (int32 Head = 0; Head < Q.Num(); ++Head)
+	{
+		const FBfsData HereData = Q[Head];
+		
+		for (const int32 NextIndex : GetShuffledNeighbors(HereData.TileIndex))
+		{
+			if (Visited[NextIndex])
+				continue;
+
+			const int32 Other = State.TileOwner[NextIndex];
+			if (Other != INDEX_NONE && State.Units[Other].Team != Unit.Team)
+			{
+				const int32 MyIndex = State.TileOwner[Unit.TileIndex];
+				State.TileOwner[Unit.TileIndex] = INDEX_NONE;
+				State.TileOwner[HereData.FirstMoveIndex] = MyIndex;
+				Unit.TileIndex = HereData.FirstMoveIndex;
+				Unit.MoveTimer = Config.MoveTimePerTile;
+				return true;
+			}
+
+			if (Other == INDEX_NONE)
+			{
+				Q.Add(FBfsData(NextIndex, HereData.FirstMoveIndex));
+				Visited[NextIndex] = true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void FPCCombatSimulator::Attack(FSimState& State, FSimUnit& Attacker, FSimUnit& Target) const
+{
+	const FPCSimUnitStats& Stats = Attacker.Desc->Stats;
+	const float UltimateCost = Stats.GetUltimateManaCost();
+
+	// 마나가 가득 차면 궁극기 (마법 피해), 아니면 기본 공격 (물리 피해)
+	if (Stats.bIsHero && UltimateCost > 0.f && Attacker.Mana >= UltimateCost)
+	{
+		Attacker.Mana -= UltimateCost;
+		ApplyDamage(State, Attacker, Target, Stats.UltimateDamage, false, false);
+		return;
+	}
+
+	ApplyDamage(State, Attacker, Target, Stats.BaseDamage, true, true);
+
+	if (Stats.bIsHero)
+	{
+		Attacker.Mana += (Attacker.Desc->UnitLevel <= 1)
+			? static_cast<float>(State.Stream.RandRange(Config.LevelOneManaGainMin, Config.LevelOneManaGainMax))
+			: Config.ManaGainPerBasicAttack;
+	}
+}
+
+void FPCCombatSimulator::ApplyDamage(FSimState& State, FSimUnit& Attacker, FSimUnit& Target, float BaseDamage,
+	bool bIsBasic, bool bIsPhysical) const
+{
+	if (!Target.bAlive || BaseDamage <= 0.f)
+		return;
+
+	const FPCSimUnitStats& Src = Attacker.Desc->Stats;
+	const FPCSimUnitStats& Dst = Target.Desc->Stats;
+	
+	if (bIsBasic && PCUnitDamageFormula::RollEvasion(Dst.EvasionChance, &State.Stream))
+		return;
+
+	FPCDamageFormulaParams Params;
+	Params.BaseDamage = BaseDamage;
+	Params.bIsPhysical = bIsPhysical;
+	Params.bIsMagic = !bIsPhysical;
+	Params.TypeDamageMultiplierPct = bIsPhysical ? Src.PhysicalDamageMultiplier : Src.MagicDamageMultiplier;
+	Params.CritChancePct = Src.CritChance;
+	Params.CritMultiplierPct = Src.CritMultiplier;
+	Params.DamageMultiplierPct = Src.DamageMultiplier;
+	Params.Defense = bIsPhysical ? Dst.PhysicalDefense : Dst.MagicDefense;
+	Params.FlatDamageBlock = Dst.FlatDamageBlock;
+
+	const FPCDamageFormulaResult DamageResult = PCUnitDamageFormula::Resolve(Params, &State.Stream);
+	if (!DamageResult.IsApplied())
+		return;
+
+	Target.Health = FMath::Clamp(Target.Health - DamageResult.FinalDamage, 0.f, Dst.MaxHealth);
+	(Attacker.Team == 0 ? State.Result.HostDamageDealt : State.Result.GuestDamageDealt) += DamageResult.FinalDamage;
+
+	if (Dst.bIsHero)
+	{
+		Target.Mana += PCUnitDamageFormula::CalcManaGainOnHit(DamageResult);
+	}
+
+	const float Heal = PCUnitDamageFormula::CalcLifeStealHeal(DamageResult, Src.LifeSteal);
+	if (Heal > KINDA_SMALL_NUMBER)
+	{
+		Attacker.Health = FMath::Min(Src.MaxHealth, Attacker.Health + Heal);
+	}
+
+	if (Target.Health <= 0.f)
+	{
+		Target.bAlive = false;
+		State.TileOwner[Target.TileIndex] = INDEX_NONE;
+	}
+}
+
+void FPCCombatSimulator::CountAlive(const FSimState& State, int32& OutHost, int32& OutGuest) const
+{
+	OutHost = 0;
+	OutGuest = 0;
+	for (const FSimUnit& Unit : State.Units)
+	{
+		if (Unit.bAlive)
+		{
+			(Unit.Team == 0 ? OutHost : OutGuest)++;
+		}
+	}
+}
@@ -0,0 +1,48 @@
+#include "Misc/AutomationTest.h"
+#include "Simulation/PCCombatReplay.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCCombatReplayRoundTripTest, "ProjectPC.Combat.Replay.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCCombatReplayRoundTripTest::RunTest(const FString& Parameters)
+{
+	// 저장 / 로드 후 데이터와 재생 결과가 원본과 같아야 함 (이벤트 없음, 유닛 1개, 일반 라운드 규모)
+	TestTrue(TEXT("No events"), FPCCombatReplay::DebugRoundTrip(4, 0, 1));
+	TestTrue(TEXT("Single unit"), FPCCombatReplay::DebugRoundTrip(1, 200, 2));
+
+	for (int32 Seed = 1; Seed <= 8; ++Seed)
+	{
+		TestTrue(FString::Printf(TEXT("Random replay (Seed=%d)"), Seed), FPCCombatReplay::DebugRoundTrip(20, 3000, Seed));
+	}
+
+	// 헤더가 깨진 데이터는 로드 실패 (매직 불일치, 빈 데이터)
+	AddExpectedError(TEXT("Not a combat replay"), EAutomationExpectedErrorFlags::Contains, 2);
+
+	FPCCombatReplay Replay;
+	Replay.StageOne = 2;
+	Replay.RoundOne = 3;
+	Replay.Cols = 8;
+	Replay.Rows = 7;
+
+	TArray<uint8> Bytes;
+	TestTrue(TEXT("Save empty replay"), Replay.SaveToBytes(Bytes));
+
+	FPCCombatReplay Loaded;
+	TestTrue(TEXT("Load empty replay"), Loaded.LoadFromBytes(Bytes));
+	TestTrue(TEXT("Empty replay matches"), Loaded == Replay);
+
+	if (Bytes.Num() > 0)
+	{
+		Bytes[0] ^= 0xFF;
+		FPCCombatReplay Corrupted;
+		TestFalse(TEXT("Load with bad magic"), Corrupted.LoadFromBytes(Bytes));
+	}
+
+	TestFalse(TEXT("Load empty bytes"), FPCCombatReplay().LoadFromBytes(TArray<uint8>()));
+
+	return true;
+}
+
+#endif
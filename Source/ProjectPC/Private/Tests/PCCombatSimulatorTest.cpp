@@ -0,0 +1,84 @@
+#include "Misc/AutomationTest.h"
+#include "Simulation/PCCombatSimulator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	FPCSimUnitDesc MakeSimUnit(const FIntPoint& GridPoint, float MaxHealth, float BaseDamage, float AttackRange)
+	{
+		FPCSimUnitDesc Desc;
+		Desc.GridPoint = GridPoint;
+		Desc.Stats.MaxHealth = MaxHealth;
+		Desc.Stats.BaseDamage = BaseDamage;
+		Desc.Stats.AttackRange = AttackRange;
+		Desc.Stats.AttackSpeed = 0.8f;
+		Desc.Stats.EvasionChance = 20.f;
+		Desc.Stats.bIsHero = true;
+		Desc.Stats.MaxMana = 60.f;
+		Desc.Stats.UltimateDamage = 150.f;
+		Desc.Stats.CritChance = 25.f;
+		Desc.Stats.CritMultiplier = 50.f;
+		return Desc;
+	}
+
+	FPCSimBoardDesc MakeSimBoard(float MaxHealth, float BaseDamage)
+	{
+		FPCSimBoardDesc Board;
+		Board.Units.Add(MakeSimUnit(FIntPoint(0, 0), MaxHealth, BaseDamage, 1.f));
+		Board.Units.Add(MakeSimUnit(FIntPoint(3, 1), MaxHealth, BaseDamage, 1.f));
+		Board.Units.Add(MakeSimUnit(FIntPoint(5, 3), MaxHealth * 0.6f, BaseDamage, 4.f));
+		return Board;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCCombatSimDeterminismTest, "ProjectPC.Combat.Simulator.SameSeedSameResult",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCCombatSimDeterminismTest::RunTest(const FString& Parameters)
+{
+	const FPCCombatSimulator Simulator;
+	const FPCSimBoardDesc Host = MakeSimBoard(700.f, 55.f);
+	const FPCSimBoardDesc Guest = MakeSimBoard(700.f, 55.f);
+
+	for (int32 Seed = 1; Seed <= 16; ++Seed)
+	{
+		const FPCSimResult A = Simulator.Run(Host, Guest, Seed);
+		const FPCSimResult B = Simulator.Run(Host, Guest, Seed);
+
+		const FString What = FString::Printf(TEXT("Seed %d"), Seed);
+		TestEqual(What + TEXT(" winner"), A.WinnerTeam, B.WinnerTeam);
+		TestEqual(What + TEXT(" ticks"), A.Ticks, B.Ticks);
+		TestEqual(What + TEXT(" host alive"), A.HostAlive, B.HostAlive);
+		TestEqual(What + TEXT(" guest alive"), A.GuestAlive, B.GuestAlive);
+		TestEqual(What + TEXT(" host damage"), A.HostDamageDealt, B.HostDamageDealt);
+		TestEqual(What + TEXT(" guest damage"), A.GuestDamageDealt, B.GuestDamageDealt);
+		TestTrue(What + TEXT(" fight ran"), A.Ticks > 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCCombatSimOutcomeTest, "ProjectPC.Combat.Simulator.StrongerBoardWins",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCCombatSimOutcomeTest::RunTest(const FString& Parameters)
+{
+	const FPCCombatSimulator Simulator;
+	const FPCSimBoardDesc Strong = MakeSimBoard(3000.f, 200.f);
+	const FPCSimBoardDesc Weak = MakeSimBoard(300.f, 10.f);
+
+	for (int32 Seed = 1; Seed <= 8; ++Seed)
+	{
+		TestEqual(FString::Printf(TEXT("Host strong, seed %d"), Seed), Simulator.Run(Strong, Weak, Seed).WinnerTeam, 0);
+		TestEqual(FString::Printf(TEXT("Guest strong, seed %d"), Seed), Simulator.Run(Weak, Strong, Seed).WinnerTeam, 1);
+	}
+
+	FPCSimBoardDesc Empty;
+	TestEqual(TEXT("Empty guest loses immediately"), Simulator.Run(Strong, Empty, 1).WinnerTeam, 0);
+	TestEqual(TEXT("Empty guest takes no ticks"), Simulator.Run(Strong, Empty, 1).Ticks, 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,111 @@
+#include "Misc/AutomationTest.h"
+#include "Utility/PCHexGridLayout.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCHexGridLayoutNearestTest, "ProjectPC.Board.HexLayout.MatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCHexGridLayoutNearestTest::RunTest(const FString& Parameters)
+{
+	struct FCase
+	{
+		int32 Cols;
+		int32 Rows;
+		bool bRowZeroAtBottom;
+		float OddColumRowShift;
+	};
+
+	// 플레이어 보드 필드 (4 x 7), 전투 필드 (8 x 7), 반대 행 방향 / 음수 시프트
+	const FCase Cases[] = {
+		{ 4, 7, true, 0.5f },
+		{ 8, 7, true, 0.5f },
+		{ 8, 7, false, 0.5f },
+		{ 5, 3, true, -0.5f },
+		{ 1, 1, true, 0.f },
+	};
+
+	const float SampleStep = 7.f;
+
+	for (const FCase& Case : Cases)
+	{
+		FPCHexGridLayout Layout;
+		Layout.Cols = Case.Cols;
+		Layout.Rows = Case.Rows;
+		Layout.TileWidthX = 200.f;
+		Layout.bRowZeroAtBottom = Case.bRowZeroAtBottom;
+		Layout.OddColumRowShift = Case.OddColumRowShift;
+		Layout.Origin = FVector2D(-350.f, 120.f);
+
+		const float MaxDist = Layout.TileWidthX * 0.6f;
+		const FString CaseName = FString::Printf(TEXT("%dx%d Bottom=%d Shift=%.1f"),
+			Case.Cols, Case.Rows, Case.bRowZeroAtBottom ? 1 : 0, Case.OddColumRowShift);
+
+		// 각 타일 중심은 자기 자신으로 변환
+		for (int32 Col = 0; Col < Case.Cols; ++Col)
+		{
+			for (int32 Row = 0; Row < Case.Rows; ++Row)
+			{
+				int32 OutCol, OutRow;
+				const bool bFound = Layout.FindNearestTile(Layout.GetTileCenter(Col, Row), MaxDist, OutCol, OutRow);
+				if (!bFound || OutCol != Col || OutRow != Row)
+				{
+					AddError(FString::Printf(TEXT("%s : center (%d, %d) mapped to (%d, %d)"), *CaseName, Col, Row, OutCol, OutRow));
+				}
+			}
+		}
+
+		// 보드 주변 전체를 샘플링해서 전체 타일 순회 최근접과 거리 비교 (동거리 타일은 어느 쪽이든 허용)
+		const FVector2D Min = Layout.Origin - FVector2D(MaxDist * 2.f);
+		const FVector2D Max = Layout.Origin + FVector2D(Case.Cols * Layout.GetColumnStep(), (Case.Rows + 1) * Layout.GetRowStep()) + FVector2D(MaxDist * 2.f);
+
+		int32 Mismatch = 0;
+		for (float X = Min.X; X <= Max.X; X += SampleStep)
+		{
+			for (float Y = Min.Y; Y <= Max.Y; Y += SampleStep)
+			{
+				const FVector2D Point(X, Y);
+
+				float BruteD2 = FMath::Square(MaxDist);
+				bool bBruteFound = false;
+				for (int32 Col = 0; Col < Case.Cols; ++Col)
+				{
+					for (int32 Row = 0; Row < Case.Rows; ++Row)
+					{
+						const float D2 = FVector2D::DistSquared(Point, Layout.GetTileCenter(Col, Row));
+						if (D2 <= BruteD2)
+						{
+							BruteD2 = D2;
+							bBruteFound = true;
+						}
+					}
+				}
+
+				int32 OutCol, OutRow;
+				const bool bFound = Layout.FindNearestTile(Point, MaxDist, OutCol, OutRow);
+				if (bFound != bBruteFound)
+				{
+					++Mismatch;
+					continue;
+				}
+
+				if (bFound && !FMath::IsNearlyEqual(FVector2D::DistSquared(Point, Layout.GetTileCenter(OutCol, OutRow)), BruteD2, 1.f))
+				{
+					++Mismatch;
+				}
+			}
+		}
+
+		TestEqual(FString::Printf(TEXT("%s : mismatch against brute force"), *CaseName), Mismatch, 0);
+	}
+
+	// 잘못된 레이아웃은 항상 실패
+	FPCHexGridLayout Empty;
+	int32 OutCol, OutRow;
+	TestFalse(TEXT("Empty layout"), Empty.FindNearestTile(FVector2D::ZeroVector, 100.f, OutCol, OutRow));
+	TestEqual(TEXT("Empty layout col"), OutCol, static_cast<int32>(INDEX_NONE));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,37 @@
+#include "Misc/AutomationTest.h"
+#include "Utility/PCHexGridTopology.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCHexGridTopologyBFSTest, "ProjectPC.Board.HexTopology.MatchesBFS",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCHexGridTopologyBFSTest::RunTest(const FString& Parameters)
+{
+	// 전투 필드 (8 x 7), 플레이어 보드 필드 (4 x 7), 홀수 크기 보드
+	const FIntPoint Sizes[] = { { 8, 7 }, { 4, 7 }, { 5, 3 }, { 1, 1 } };
+
+	for (const FIntPoint& Size : Sizes)
+	{
+		FPCHexGridTopology Topology;
+		Topology.Build(Size.X, Size.Y);
+
+		TestEqual(FString::Printf(TEXT("Tile count %dx%d"), Size.X, Size.Y), Topology.Num(), Size.X * Size.Y);
+		TestEqual(FString::Printf(TEXT("BFS mismatch %dx%d"), Size.X, Size.Y), Topology.ValidateAgainstBFS(), 0);
+
+		for (int32 i = 0; i < Topology.Num(); ++i)
+		{
+			TestEqual(TEXT("Distance to self"), Topology.GetDistance(i, i), 0);
+			TestEqual(TEXT("Ring 0 is self"), Topology.GetRing(i, 0).Num(), 1);
+		}
+	}
+
+	FPCHexGridTopology Empty;
+	Empty.Build(0, 7);
+	TestEqual(TEXT("Empty board"), Empty.Num(), 0);
+	TestEqual(TEXT("Empty board neighbors"), Empty.GetNeighbors(0).Num(), 0);
+
+	return true;
+}
+
+#endif
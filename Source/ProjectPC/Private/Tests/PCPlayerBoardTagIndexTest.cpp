@@ -0,0 +1,80 @@
+#include "Misc/AutomationTest.h"
+#include "BaseGameplayTags.h"
+#include "Character/Unit/PCHeroUnitCharacter.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/HelpActor/PCPlayerBoard.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCPlayerBoardTagIndexFuzzTest, "ProjectPC.Board.TagIndex.FuzzMatchesScan",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCPlayerBoardTagIndexFuzzTest::RunTest(const FString& Parameters)
+{
+	// 서버 권한으로 보드 / 유닛을 띄울 임시 게임 월드 (BeginPlay 없이 슬롯 데이터만 사용)
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	APCPlayerBoard* Board = World->SpawnActor<APCPlayerBoard>();
+	if (TestNotNull(TEXT("Spawned player board"), Board))
+	{
+		Board->QuickSetUp();
+		TestTrue(TEXT("Empty board index"), Board->DebugValidateTagIndex());
+
+		// 같은 태그 여러 개 + 서로 다른 태그, 필드 / 벤치에 나눠서 배치
+		const FGameplayTag UnitTags[] = {
+			UnitGameplayTags::Unit_Type_Hero_Sparrow,
+			UnitGameplayTags::Unit_Type_Hero_Sparrow,
+			UnitGameplayTags::Unit_Type_Hero_Sparrow,
+			UnitGameplayTags::Unit_Type_Hero_Raven,
+			UnitGameplayTags::Unit_Type_Hero_Drongo,
+			UnitGameplayTags::Unit_Type_Hero_Drongo,
+			UnitGameplayTags::Unit_Type_Hero_Greystone,
+		};
+
+		TArray<APCHeroUnitCharacter*> PlacedUnits;
+		int32 NumPlaced = 0;
+		for (const FGameplayTag& UnitTag : UnitTags)
+		{
+			APCHeroUnitCharacter* Unit = World->SpawnActor<APCHeroUnitCharacter>();
+			if (!TestNotNull(TEXT("Spawned unit"), Unit))
+				continue;
+
+			Unit->SetUnitTag(UnitTag);
+			PlacedUnits.Add(Unit);
+			if (NumPlaced % 2 == 0)
+			{
+				Board->SetFieldTileUnit(NumPlaced, Unit);
+			}
+			else
+			{
+				Board->SetBenchTileUnit(NumPlaced, Unit);
+			}
+			++NumPlaced;
+		}
+
+		TestTrue(TEXT("Placed board index"), Board->DebugValidateTagIndex());
+
+		// 시드를 고정해서 실패하면 같은 순서로 재현 가능
+		for (const int32 Seed : { 1, 7, 20251017 })
+		{
+			TestTrue(FString::Printf(TEXT("Tag index fuzz (Seed=%d)"), Seed), Board->DebugFuzzTagIndex(2000, Seed));
+		}
+
+		// 퍼즈 후에는 원래 배치로 복구되어 있어야 함
+		for (int32 i = 0; i < PlacedUnits.Num(); ++i)
+		{
+			const int32 Slot = i % 2 == 0 ? Board->GetFieldUnitIndex(PlacedUnits[i]) : Board->GetBenchUnitIndex(PlacedUnits[i]);
+			TestEqual(FString::Printf(TEXT("Unit %d restored"), i), Slot, i);
+		}
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif
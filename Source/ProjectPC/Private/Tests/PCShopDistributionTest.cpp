@@ -0,0 +1,189 @@
+#include "Misc/AutomationTest.h"
+#include "Engine/DataTable.h"
+#include "Shop/PCShopManager.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const TCHAR* ShopUnitDataTablePath = TEXT("/Game/DataAssets/ShopData/DT_ShopUnitDataTable.DT_ShopUnitDataTable");
+	const TCHAR* ShopUnitProbabilityDataTablePath = TEXT("/Game/DataAssets/ShopData/DT_ShopUnitProbabilityData.DT_ShopUnitProbabilityData");
+	const TCHAR* ShopUnitSellingPriceDataTablePath = TEXT("/Game/DataAssets/ShopData/DT_ShopUnitSellingPriceData.DT_ShopUnitSellingPriceData");
+
+	constexpr int32 NumUnitCosts = 5;
+
+	// 카이제곱 임계값 근사 (Wilson-Hilferty, 유의수준 0.001)
+	double ChiSquareCritical(int32 DegreesOfFreedom)
+	{
+		const double K = FMath::Max(1, DegreesOfFreedom);
+		const double Term = 2.0 / (9.0 * K);
+		return K * FMath::Pow(1.0 - Term + 3.09 * FMath::Sqrt(Term), 3.0);
+	}
+
+	// 현재 재고 기준으로 뽑기를 반복해서 코스트 분포는 ProbabilityTable, 기물 분포는 남은 수 비율과 비교
+	void CheckShopDistribution(FAutomationTestBase& Test, UPCShopManager* ShopManager, int32 PlayerLevel, int32 NumDraws, const TCHAR* Step)
+	{
+		const FString Prefix = FString::Printf(TEXT("%s Level %d"), Step, PlayerLevel);
+		const FPCRandomChannel Random(PlayerLevel * 7919 + NumDraws);
+		const TArray<float> CostProbabilities = ShopManager->GetCostProbabilities(PlayerLevel);
+
+		int32 CostHits[NumUnitCosts] = {};
+		TArray<int32> UnitHits[NumUnitCosts];
+		for (int32 Cost = 1; Cost <= NumUnitCosts; ++Cost)
+		{
+			UnitHits[Cost - 1].SetNumZeroed(ShopManager->GetShopUnitDataListByCost(Cost).Num());
+		}
+
+		for (int32 Draw = 0; Draw < NumDraws; ++Draw)
+		{
+			int32 Cost = INDEX_NONE;
+			const int32 UnitIndex = ShopManager->DrawShopUnitIndex(PlayerLevel, Random, Cost);
+			if (Cost == INDEX_NONE)
+				continue;
+
+			++CostHits[Cost - 1];
+			if (UnitHits[Cost - 1].IsValidIndex(UnitIndex))
+			{
+				++UnitHits[Cost - 1][UnitIndex];
+			}
+		}
+
+		// 코스트 분포 vs ProbabilityTable
+		{
+			double ProbabilitySum = 0.0;
+			for (const float Probability : CostProbabilities)
+			{
+				ProbabilitySum += FMath::Max(0.f, Probability);
+			}
+
+			double ChiSquare = 0.0;
+			int32 Categories = 0;
+			for (int32 i = 0; i < CostProbabilities.Num() && i < NumUnitCosts; ++i)
+			{
+				const double Expected = ProbabilitySum > 0.0 ? NumDraws * FMath::Max(0.f, CostProbabilities[i]) / ProbabilitySum : 0.0;
+				if (Expected <= 0.0)
+				{
+					// 확률 0 인 코스트는 한 번도 나오면 안 됨
+					Test.TestEqual(FString::Printf(TEXT("%s : cost %d with zero probability"), *Prefix, i + 1), CostHits[i], 0);
+					continue;
+				}
+
+				ChiSquare += FMath::Square(CostHits[i] - Expected) / Expected;
+				++Categories;
+			}
+
+			const double Critical = ChiSquareCritical(Categories - 1);
+			Test.TestTrue(FString::Printf(TEXT("%s : cost ChiSquare=%.2f Critical=%.2f"), *Prefix, ChiSquare, Critical),
+				Categories <= 1 || ChiSquare <= Critical);
+		}
+
+		// 코스트별 기물 분포 vs 남은 기물 수 비율
+		for (int32 Cost = 1; Cost <= NumUnitCosts; ++Cost)
+		{
+			const auto& UnitDataList = ShopManager->GetShopUnitDataListByCost(Cost);
+			const int32 Hits = CostHits[Cost - 1];
+
+			int32 Remaining = 0;
+			for (const auto& Unit : UnitDataList)
+			{
+				Remaining += FMath::Max(0, Unit.UnitCount);
+			}
+
+			if (Remaining <= 0 || Hits <= 0)
+				continue;
+
+			double ChiSquare = 0.0;
+			int32 Categories = 0;
+			for (int32 i = 0; i < UnitDataList.Num(); ++i)
+			{
+				const double Expected = static_cast<double>(Hits) * FMath::Max(0, UnitDataList[i].UnitCount) / Remaining;
+				if (Expected <= 0.0)
+				{
+					Test.TestEqual(FString::Printf(TEXT("%s : sold out unit %d of cost %d"), *Prefix, i, Cost), UnitHits[Cost - 1][i], 0);
+					continue;
+				}
+
+				ChiSquare += FMath::Square(UnitHits[Cost - 1][i] - Expected) / Expected;
+				++Categories;
+			}
+
+			const double Critical = ChiSquareCritical(Categories - 1);
+			Test.TestTrue(FString::Printf(TEXT("%s : cost %d units ChiSquare=%.2f Critical=%.2f"), *Prefix, Cost, ChiSquare, Critical),
+				Categories <= 1 || ChiSquare <= Critical);
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCShopDistributionTest, "ProjectPC.Shop.Distribution.MatchesDataTables",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCShopDistributionTest::RunTest(const FString& Parameters)
+{
+	UDataTable* UnitDataTable = LoadObject<UDataTable>(nullptr, ShopUnitDataTablePath);
+	UDataTable* ProbabilityDataTable = LoadObject<UDataTable>(nullptr, ShopUnitProbabilityDataTablePath);
+	UDataTable* SellingPriceDataTable = LoadObject<UDataTable>(nullptr, ShopUnitSellingPriceDataTablePath);
+	if (!TestNotNull(TEXT("Shop unit DataTable"), UnitDataTable)
+		|| !TestNotNull(TEXT("Shop probability DataTable"), ProbabilityDataTable)
+		|| !TestNotNull(TEXT("Shop selling price DataTable"), SellingPriceDataTable))
+	{
+		return false;
+	}
+
+	UPCShopManager* ShopManager = NewObject<UPCShopManager>(GetTransientPackage());
+	ShopManager->InitializeShopData(UnitDataTable, ProbabilityDataTable, SellingPriceDataTable);
+
+	const TArray<FPCShopUnitProbabilityData> ProbabilityDataList = ShopManager->GetShopUnitProbabilityDataList();
+	TestTrue(TEXT("Probability table has levels"), ProbabilityDataList.Num() > 0);
+
+	constexpr int32 NumDraws = 100000;
+	for (const auto& ProbabilityData : ProbabilityDataList)
+	{
+		CheckShopDistribution(*this, ShopManager, ProbabilityData.PlayerLevel, NumDraws, TEXT("Build"));
+	}
+
+	// 재고를 일부 소진한 상태에서도 남은 수 비율을 따라야 함
+	for (int32 Cost = 1; Cost <= NumUnitCosts; ++Cost)
+	{
+		for (int32 Buy = 0; Buy < 10; ++Buy)
+		{
+			ShopManager->SelectRandomUnitByCost(Cost);
+		}
+	}
+
+	for (const auto& ProbabilityData : ProbabilityDataList)
+	{
+		CheckShopDistribution(*this, ShopManager, ProbabilityData.PlayerLevel, NumDraws, TEXT("After buys"));
+	}
+
+	// 같은 크기로 다시 구성하면 이전 재고가 남지 않고 DataTable 값으로 돌아가야 함
+	ShopManager->InitializeShopData(UnitDataTable, ProbabilityDataTable, SellingPriceDataTable);
+
+	int32 SourceTotals[NumUnitCosts] = {};
+	for (const auto& SourceUnit : ShopManager->GetShopUnitDataList())
+	{
+		if (SourceUnit.UnitCost >= 1 && SourceUnit.UnitCost <= NumUnitCosts)
+		{
+			SourceTotals[SourceUnit.UnitCost - 1] += SourceUnit.UnitCount;
+		}
+	}
+
+	for (int32 Cost = 1; Cost <= NumUnitCosts; ++Cost)
+	{
+		int32 Remaining = 0;
+		for (const auto& Unit : ShopManager->GetShopUnitDataListByCost(Cost))
+		{
+			Remaining += Unit.UnitCount;
+		}
+		TestEqual(FString::Printf(TEXT("Rebuild : cost %d stock"), Cost), Remaining, SourceTotals[Cost - 1]);
+	}
+
+	for (const auto& ProbabilityData : ProbabilityDataList)
+	{
+		CheckShopDistribution(*this, ShopManager, ProbabilityData.PlayerLevel, NumDraws, TEXT("Rebuild"));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,102 @@
+#include "Misc/AutomationTest.h"
+#include "Shop/PCShopUnitData.h"
+#include "Shop/PCShopUnitPool.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// 기존 선형 누적합 방식 (Fenwick 도입 전 뽑기)
+	int32 LinearFindIndexByWeight(const TArray<int32>& Counts, int32 Weight)
+	{
+		for (int32 i = 0; i < Counts.Num(); ++i)
+		{
+			if (Weight < Counts[i])
+				return i;
+			Weight -= Counts[i];
+		}
+		return INDEX_NONE;
+	}
+
+	bool CheckPoolMatchesCounts(FAutomationTestBase& Test, const FPCShopUnitPool& Pool, const TArray<int32>& Counts, const TCHAR* Step)
+	{
+		int32 Total = 0;
+		bool bOk = true;
+		for (int32 i = 0; i < Counts.Num(); ++i)
+		{
+			Total += Counts[i];
+			bOk &= Pool.GetPrefixSum(i) == Total;
+		}
+		bOk &= Pool.GetTotal() == Total;
+
+		// 모든 가중치가 선형 방식과 같은 인덱스로 가야 분포가 동일
+		for (int32 Weight = 0; Weight < Total; ++Weight)
+		{
+			bOk &= Pool.FindIndexByWeight(Weight) == LinearFindIndexByWeight(Counts, Weight);
+		}
+		bOk &= Pool.FindIndexByWeight(Total) == INDEX_NONE;
+
+		Test.TestTrue(FString::Printf(TEXT("%s : pool matches linear walk (Total=%d)"), Step, Total), bOk);
+		return bOk;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCShopUnitPoolTest, "ProjectPC.Shop.UnitPool.MatchesLinearSampling",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCShopUnitPoolTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(20251017);
+
+	// 코스트별 기물 종류 수와 비슷한 크기 + 2의 거듭제곱 경계
+	for (const int32 NumUnits : { 1, 7, 8, 13, 16, 17 })
+	{
+		TArray<FPCShopUnitData> Units;
+		TArray<int32> Counts;
+		Units.SetNum(NumUnits);
+		for (FPCShopUnitData& Unit : Units)
+		{
+			Unit.UnitCount = Random.RandRange(0, 22);
+			Counts.Add(Unit.UnitCount);
+		}
+
+		FPCShopUnitPool Pool;
+		Pool.Build(Units);
+		TestEqual(TEXT("Pool size"), Pool.Num(), NumUnits);
+		if (!CheckPoolMatchesCounts(*this, Pool, Counts, TEXT("Build")))
+			continue;
+
+		// 구매 / 판매 / 반환
+		for (int32 Op = 0; Op < 200; ++Op)
+		{
+			const int32 Index = Random.RandHelper(NumUnits);
+			const int32 Delta = Counts[Index] > 0 && Random.FRand() < 0.6f ? -1 : 1;
+			Counts[Index] += Delta;
+			Pool.Add(Index, Delta);
+		}
+		CheckPoolMatchesCounts(*this, Pool, Counts, TEXT("After buy/sell"));
+
+		// 같은 객체를 같은 크기로 다시 구성 (이전 노드 값이 남으면 합이 어긋남)
+		for (int32 i = 0; i < NumUnits; ++i)
+		{
+			Units[i].UnitCount = Random.RandRange(0, 22);
+			Counts[i] = Units[i].UnitCount;
+		}
+		Pool.Build(Units);
+		TestEqual(TEXT("Rebuilt pool size"), Pool.Num(), NumUnits);
+		CheckPoolMatchesCounts(*this, Pool, Counts, TEXT("Rebuild"));
+
+		// 모두 소진
+		for (int32 i = 0; i < NumUnits; ++i)
+		{
+			Pool.Add(i, -Counts[i]);
+			Counts[i] = 0;
+		}
+		TestEqual(TEXT("Empty pool total"), Pool.GetTotal(), 0);
+		TestEqual(TEXT("Empty pool draw"), Pool.FindIndexByWeight(0), INDEX_NONE);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,90 @@
+#include "Misc/AutomationTest.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "DataAsset/FrameWork/PCStageData.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCStageScheduleCompileTest, "ProjectPC.Stage.Schedule.MatchesStageData",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCStageScheduleCompileTest::RunTest(const FString& Parameters)
+{
+	// 1) 제작된 UPCStageData 에셋 전부 (에셋 레지스트리)
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		AssetRegistry.SearchAllAssets(true);
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByClass(UPCStageData::StaticClass()->GetClassPathName(), Assets, true);
+
+	TSet<FName> AssetNames;
+	FString Report;
+	for (const FAssetData& Asset : Assets)
+	{
+		AssetNames.Add(Asset.AssetName);
+
+		const UPCStageData* StageData = Cast<UPCStageData>(Asset.GetAsset());
+		if (!TestNotNull(*FString::Printf(TEXT("Load %s"), *Asset.GetObjectPathString()), StageData))
+			continue;
+
+		const bool bValid = StageData->ValidateSchedule(Report);
+		TestTrue(FString::Printf(TEXT("%s : %s"), *Asset.AssetName.ToString(), *Report), bValid);
+	}
+
+	TestTrue(TEXT("DA_StageData_Default found"), AssetNames.Contains(TEXT("DA_StageData_Default")));
+	TestTrue(TEXT("DA_StageData_Test found"), AssetNames.Contains(TEXT("DA_StageData_Test")));
+
+	// 2) Stages 가 비어 있으면 코드 프리셋으로 컴파일, 기대값은 BuildFlattenedPhase 프리셋의 초를 손으로 합산
+	//    입장 (1-1)             : Start 5 + Return 3                                    =    8s,   2 steps
+	//    1-2 / 1-3 / 1-4 (PvE)  : 28 + 50 + 55                                          =  133s,  12 steps
+	//    2 ~ 8 스테이지 x 7      : PvP 70 x 5 (Travel = DefaultTravelSeconds 5)
+	//                             + 캐러셀 46 (Travel 3 + 8명 x 5 + Return 3) + 크립 58 = 3178s, 231 steps
+	constexpr float ExpectedPresetTotal = 3319.f;
+	constexpr int32 ExpectedPresetSteps = 245;
+	constexpr int32 ExpectedPresetRounds = 1 + 3 + 7 * 7;
+
+	UPCStageData* Preset = NewObject<UPCStageData>(GetTransientPackage());
+	bool bValid = Preset->ValidateSchedule(Report);
+	TestTrue(FString::Printf(TEXT("Built-in preset : %s"), *Report), bValid);
+
+	TArray<FPCScheduledStep> Schedule;
+	TArray<FGameplayTag> RoundMajorFlat;
+	const float PresetTotal = Preset->CompileSchedule(Schedule, &RoundMajorFlat);
+	TestEqual(TEXT("Built-in preset total"), PresetTotal, ExpectedPresetTotal, 0.01f);
+	TestEqual(TEXT("Built-in preset step count"), Schedule.Num(), ExpectedPresetSteps);
+	TestEqual(TEXT("Built-in preset round count"), RoundMajorFlat.Num(), ExpectedPresetRounds);
+
+	// 에셋처럼 Stages 를 직접 채운 경우 (오버라이드 포함)
+	UPCStageData* Custom = NewObject<UPCStageData>(GetTransientPackage());
+	const EPCStageType RoundTypes[] = { EPCStageType::Setup, EPCStageType::Travel, EPCStageType::PvP, EPCStageType::PvPResult, EPCStageType::Return };
+	for (int32 StageIndex = 0; StageIndex < 2; ++StageIndex)
+	{
+		FStageSpec& Stage = Custom->Stages.AddDefaulted_GetRef();
+		for (int32 RoundIndex = 0; RoundIndex < 3; ++RoundIndex)
+		{
+			FRoundSpec& Round = Stage.Rounds.AddDefaulted_GetRef();
+			for (const EPCStageType Type : RoundTypes)
+			{
+				FRoundStep& Step = Round.Steps.AddDefaulted_GetRef();
+				Step.StageType = Type;
+				Step.DurationOverride = (Type == EPCStageType::PvP && RoundIndex == 1) ? 45.f : -1.f;
+			}
+		}
+	}
+
+	bValid = Custom->ValidateSchedule(Report);
+	TestTrue(FString::Printf(TEXT("Custom stages : %s"), *Report), bValid);
+
+	// 라운드당 Setup 30 + Travel 5 + PvP 30 + PvPResult 30 (기본값 없음 -> Setup) + Return 3 = 98s, 2라운드째는 PvP 45 로 113s
+	Schedule.Reset();
+	const float CustomTotal = Custom->CompileSchedule(Schedule);
+	TestEqual(TEXT("Custom stages total"), CustomTotal, 2.f * (98.f + 113.f + 98.f), 0.01f);
+	TestEqual(TEXT("Custom stages step count"), Schedule.Num(), 2 * 3 * static_cast<int32>(UE_ARRAY_COUNT(RoundTypes)));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,96 @@
+#include "Misc/AutomationTest.h"
+#include "BaseGameplayTags.h"
+#include "Character/Unit/PCBaseUnitCharacter.h"
+#include "Component/PCUnitEquipmentComponent.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/GameState/PCCombatGameState.h"
+#include "GameFramework/WorldSettings.h"
+#include "GameFramework/WorldSubsystem/PCItemManagerSubsystem.h"
+#include "GameFramework/WorldSubsystem/PCUnitSpawnSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const TCHAR* CombatGameStateClassPath = TEXT("/Game/GameFramework/CombatLevel/BP_CombatGameState.BP_CombatGameState_C");
+	const TCHAR* ItemDataTablePath = TEXT("/Game/DataAssets/ItemData/DT_ItemData.DT_ItemData");
+	const TCHAR* ItemCombineDataTablePath = TEXT("/Game/DataAssets/ItemData/DT_ItemCombineData.DT_ItemCombineData");
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCUnitPoolResetTest, "ProjectPC.Unit.Pool.ReusedUnitMatchesFreshSpawn",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCUnitPoolResetTest::RunTest(const FString& Parameters)
+{
+	const UClass* GameStateClass = LoadClass<APCCombatGameState>(nullptr, CombatGameStateClassPath);
+	UDataTable* ItemDataTable = LoadObject<UDataTable>(nullptr, ItemDataTablePath);
+	UDataTable* ItemCombineDataTable = LoadObject<UDataTable>(nullptr, ItemCombineDataTablePath);
+	if (!TestNotNull(TEXT("Combat game state class"), GameStateClass)
+		|| !TestNotNull(TEXT("Item DataTable"), ItemDataTable)
+		|| !TestNotNull(TEXT("Item combine DataTable"), ItemCombineDataTable))
+	{
+		return false;
+	}
+
+	// 서버 권한 임시 게임 월드, 장비 컴포넌트가 BeginPlay 에서 아이템 서브시스템을 잡도록 BeginPlay 까지 진행
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->GetWorldSettings()->NotifyBeginPlay();
+
+	World->GetSubsystem<UPCItemManagerSubsystem>()->InitializeItemManager(ItemDataTable, ItemCombineDataTable);
+
+	UPCUnitSpawnSubsystem* SpawnSubsystem = World->GetSubsystem<UPCUnitSpawnSubsystem>();
+	SpawnSubsystem->InitializeUnitSpawnConfig(GameStateClass->GetDefaultObject<APCCombatGameState>()->GetSpawnConfig());
+	SpawnSubsystem->WaitForSpawnConfig();
+	TestTrue(TEXT("Spawn config loaded"), SpawnSubsystem->IsSpawnConfigLoaded());
+
+	const FGameplayTag UnitTag = UnitGameplayTags::Unit_Type_Hero_Sparrow;
+	const FGameplayTag ItemTag = ItemTags::Item_Type_Base_BFSword;
+
+	if (TestNotNull(TEXT("Unit definition"), SpawnSubsystem->ResolveDefinition(UnitTag)))
+	{
+		// 신규 스폰 유닛과 상태 비교 (레벨별, 아이템 장착 후 반납 포함)
+		for (int32 UnitLevel = 1; UnitLevel <= 3; ++UnitLevel)
+		{
+			TestTrue(FString::Printf(TEXT("Reset Lv%d without item"), UnitLevel),
+				SpawnSubsystem->DebugValidatePooledUnitReset(UnitTag, UnitLevel, FGameplayTag()));
+			TestTrue(FString::Printf(TEXT("Reset Lv%d with item"), UnitLevel),
+				SpawnSubsystem->DebugValidatePooledUnitReset(UnitTag, UnitLevel, ItemTag));
+		}
+
+		// 태그 / 레벨 / 아이템을 직접 확인
+		APCBaseUnitCharacter* UsedUnit = SpawnSubsystem->SpawnUnitByTag(UnitTag, 2, 3);
+		if (TestNotNull(TEXT("Spawned unit"), UsedUnit))
+		{
+			UPCUnitEquipmentComponent* EquipmentComp = UsedUnit->GetEquipmentComponent();
+			TestTrue(TEXT("Item equipped before release"), EquipmentComp && EquipmentComp->TryEquipItem(ItemTag));
+			TestEqual(TEXT("Item count before release"), UsedUnit->GetEquipItemTags().Num(), 1);
+
+			SpawnSubsystem->ReleaseUnit(UsedUnit);
+			TestTrue(TEXT("Released into pool"), UsedUnit->IsInUnitPool());
+
+			APCBaseUnitCharacter* ReusedUnit = SpawnSubsystem->SpawnUnitByTag(UnitTag, 1, 1);
+			TestTrue(TEXT("Pooled unit reused"), ReusedUnit == UsedUnit);
+			if (ReusedUnit)
+			{
+				TestFalse(TEXT("Reused unit left the pool"), ReusedUnit->IsInUnitPool());
+				TestEqual(TEXT("Reused unit tag"), ReusedUnit->GetUnitTag(), UnitTag);
+				TestEqual(TEXT("Reused unit level"), ReusedUnit->GetUnitLevel(), 1);
+				TestEqual(TEXT("Reused unit team"), ReusedUnit->GetTeamIndex(), 1);
+				TestEqual(TEXT("Reused unit items"), ReusedUnit->GetEquipItemTags().Num(), 0);
+				SpawnSubsystem->ReleaseUnit(ReusedUnit);
+			}
+		}
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif
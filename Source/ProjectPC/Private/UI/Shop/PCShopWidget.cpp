@@ -62,6 +62,7 @@ void UPCShopWidget::NativeDestruct()
 		}
 
 		CachedPlayerState->OnShopSlotsUpdated.RemoveAll(this);
+		CachedPlayerState->OnShopSlotChanged.RemoveAll(this);
 		CachedPlayerState->OnWinningStreakUpdated.RemoveAll(this);
 	}
 
@@ -75,6 +76,7 @@ void UPCShopWidget::BindToPlayerState(APCPlayerState* NewPlayerState)
 
 	// 플레이어 상점 슬롯 변화, 연승 기록 구독
 	CachedPlayerState->OnShopSlotsUpdated.AddUObject(this, &UPCShopWidget::SetupShopSlots);
+	CachedPlayerState->OnShopSlotChanged.AddUObject(this, &UPCShopWidget::RefreshShopSlot);
 	CachedPlayerState->OnWinningStreakUpdated.AddUObject(this, &UPCShopWidget::OnPlayerWinningStreakChanged);
 	
 	SetupShopSlots();
@@ -116,13 +118,36 @@ void UPCShopWidget::SetupShopSlots()
 		if (UnitSlotWidgets.IsValidIndex(Index) && UnitSlotWidgets[Index])
 		{
 			UnitSlotWidgets[Index]->Setup(UnitData, true, Index);
-			UnitSlotWidgets[Index]->SetSlotHidden(false);
+			UnitSlotWidgets[Index]->SetSlotHidden(CachedPlayerState->IsShopSlotPurchased(Index));
 			ShopBox->AddChild(UnitSlotWidgets[Index]);
 			++Index;
 		}
 	}
 }
 
+void UPCShopWidget::RefreshShopSlot(int32 SlotIndex, bool bUnitChanged)
+{
+	if (!ShopBox || !CachedPlayerState)
+		return;
+
+	const auto& ShopSlots = CachedPlayerState->GetShopSlots();
+	if (!ShopSlots.IsValidIndex(SlotIndex) || !UnitSlotWidgets.IsValidIndex(SlotIndex) || !UnitSlotWidgets[SlotIndex])
+		return;
+
+	// 아직 ShopBox 에 붙지 않은 칸이면 전체 구성
+	if (SlotIndex >= ShopBox->GetChildrenCount())
+	{
+		SetupShopSlots();
+		return;
+	}
+
+	if (bUnitChanged)
+	{
+		UnitSlotWidgets[SlotIndex]->Setup(ShopSlots[SlotIndex], true, SlotIndex);
+	}
+	UnitSlotWidgets[SlotIndex]->SetSlotHidden(CachedPlayerState->IsShopSlotPurchased(SlotIndex));
+}
+
 void UPCShopWidget::SetupPlayerInfo()
 {
 	if (!GoldBalance || !Level || !XP || !XPBar) return;
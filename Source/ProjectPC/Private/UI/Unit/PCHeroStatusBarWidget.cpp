@@ -18,6 +18,16 @@ void UPCHeroStatusBarWidget::InitWithASC(APCBaseUnitCharacter* InUnit, UAbilityS
 	ManaAttr = InManaAttr;
 	MaxManaAttr = InMaxManaAttr;
 
+	// 풀에서 재사용된 유닛은 이전 레벨 변형들이 이미 초기화(또는 델리게이트 해제)된 상태이므로 처음부터 다시 초기화
+	for (const TWeakObjectPtr<UPCUnitStatusBarWidget>& Initialized : InitializedStatusBarSet)
+	{
+		if (UPCUnitStatusBarWidget* StatusBar = Initialized.Get())
+		{
+			StatusBar->ClearDelegate();
+		}
+	}
+	InitializedStatusBarSet.Reset();
+
 	SetVariantByLevel(InLevel);
 }
 
@@ -63,6 +73,11 @@ void UPCHeroStatusBarWidget::CopyVariantBySourceStatusBar(const UPCHeroStatusBar
 	}
 }
 
+int32 UPCHeroStatusBarWidget::GetActiveLevel() const
+{
+	return StatusSwitcher ? StatusSwitcher->GetActiveWidgetIndex() + 1 : 0;
+}
+
 void UPCHeroStatusBarWidget::EnsureActiveVariantInitialized()
 {
 	if (!StatusSwitcher)
@@ -0,0 +1,48 @@
+#include "UI/Unit/PCSUnitCombatTextLayer.h"
+
+#include "GameFramework/WorldSubsystem/PCUnitCombatTextSpawnSubsystem.h"
+#include "Rendering/DrawElements.h"
+
+void PCSUnitCombatTextLayer::Construct(const FArguments& InArgs, UPCUnitCombatTextSpawnSubsystem* InOwner)
+{
+	Owner = InOwner;
+	SetCanTick(false);
+	SetVisibility(EVisibility::HitTestInvisible);
+}
+
+int32 PCSUnitCombatTextLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
+	const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
+	const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const UPCUnitCombatTextSpawnSubsystem* Subsystem = Owner.Get();
+	if (!Subsystem)
+		return LayerId;
+
+	// 뷰포트 픽셀 -> 로컬 (DPI 배율)
+	const float InvScale = AllottedGeometry.Scale > 0.f ? 1.f / AllottedGeometry.Scale : 1.f;
+	const FLinearColor ParentTint = InWidgetStyle.GetColorAndOpacityTint();
+
+	// 전부 같은 레이어에 그려야 Slate 배처가 한 배치로 합침
+	for (const FPCCombatTextEntry& Entry : Subsystem->GetBatchedTexts())
+	{
+		if (!Entry.bOnScreen)
+			continue;
+
+		// 위젯 애니메이션과 같은 렌더 트랜스폼 (가운데 피벗) / 투명도
+		const FPCCombatTextMotionSample Motion = Subsystem->GetStyleMotion(Entry.Style).Evaluate(Entry.Age);
+		const FVector2f Center = Entry.ScreenPosition * InvScale + Motion.Translation;
+
+		FLinearColor Color = Entry.Color * ParentTint;
+		Color.A *= Motion.Opacity;
+
+		FSlateDrawElement::MakeText(
+			OutDrawElements, LayerId,
+			AllottedGeometry.ToPaintGeometry(Entry.TextSize, FSlateLayoutTransform(Center - Entry.TextSize * 0.5f),
+				FSlateRenderTransform(FScale2f(Motion.Scale)), FVector2f(0.5f, 0.5f)),
+			Entry.Text,
+			Subsystem->GetStyleFont(Entry.Style),
+			ESlateDrawEffect::None, Color);
+	}
+
+	return LayerId + 1;
+}
@@ -1,16 +1,59 @@
 #include "UI/Unit/PCSUnitHealthProgressBar.h"
 
+#include "Framework/Application/SlateApplication.h"
+#include "Input/HittestGrid.h"
+#include "Rendering/DrawElements.h"
+#include "Rendering/SlateRenderer.h"
+#include "Styling/CoreStyle.h"
+#include "Widgets/SWindow.h"
+
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarPCHealthBarBatchedTicks(
+		TEXT("PC.UI.HealthBarBatchedTicks"),
+		true,
+		TEXT("체력바 눈금을 캐시된 지오메트리로 한 번에 그리기 (0이면 눈금마다 MakeLines)"));
+
+	// 눈금 그리기 요소 수 (벤치마크용)
+	int32 GTickDrawElements = 0;
+
+	const FSlateResourceHandle& GetWhiteBrushHandle()
+	{
+		static FSlateResourceHandle Handle;
+		if (!Handle.IsValid() && FSlateApplication::IsInitialized() && FSlateApplication::Get().GetRenderer())
+		{
+			Handle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*FCoreStyle::Get().GetBrush("WhiteBrush"));
+		}
+		return Handle;
+	}
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithArgs GPCHealthBarBenchmarkCommand(
+		TEXT("PC.UI.BenchmarkHealthBars"),
+		TEXT("Paint segmented unit health bars off-screen with per-line and batched ticks, and log draw elements / time per frame. Args: [NumBars=60] [Frames=120]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			PCSUnitHealthProgressBar::DebugBenchmark(
+				Args.IsValidIndex(0) ? FCString::Atoi(*Args[0]) : 60,
+				Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 120);
+		}));
+#endif
+}
+
 void PCSUnitHealthProgressBar::Construct(const FArguments& InArgs)
 {
 	PercentAttr = InArgs._Percent;
 	MaxValueAttr = InArgs._MaxValue;
 	TickStyle = InArgs._TickStyle;
+	++TickStyleVersion;
 	SProgressBar::Construct(SProgressBar::FArguments().Percent(InArgs._Percent));
 }
 
 void PCSUnitHealthProgressBar::SetTickStyle(const FUnitTickStyle& In)
 {
 	TickStyle = In;
+	++TickStyleVersion;
 }
 
 int32 PCSUnitHealthProgressBar::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
@@ -18,7 +61,113 @@ int32 PCSUnitHealthProgressBar::OnPaint(const FPaintArgs& Args, const FGeometry&
                                   const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
 	const int32 AfterBar = SProgressBar::OnPaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
-	
+
+	// 최대값/세그 계산
+	const float MaxV = FMath::Max(1.f, MaxValueAttr.Get());
+	const float SegV = FMath::Max(1.f, TickStyle.SegmentSize);
+
+	// 현재 퍼센트
+	const float Pct = FMath::Clamp(PercentAttr.Get().Get(0.f),0.f,1.f);
+
+	// 현재 채워진 값(= 현재 체력)과 그 안에서 필요한 선 개수
+	const int32 NumLines = FMath::FloorToInt((MaxV * Pct) / SegV);	// 1000, 2000, MaxV 미만
+
+	if (NumLines > 0)
+	{
+		const FLinearColor ParentTint = InWidgetStyle.GetColorAndOpacityTint();
+
+		if (CVarPCHealthBarBatchedTicks.GetValueOnGameThread())
+		{
+			PaintTicksBatched(AllottedGeometry, OutDrawElements, AfterBar + 1, ParentTint, NumLines);
+		}
+		else
+		{
+			PaintTicksPerLine(AllottedGeometry, OutDrawElements, AfterBar + 1, ParentTint, MaxV, NumLines);
+		}
+	}
+
+	return AfterBar + 2;
+}
+
+void PCSUnitHealthProgressBar::UpdateTickCache(float MaxV, const FVector2f& Size) const
+{
+	if (TickCache.MaxValue == MaxV && TickCache.Size == Size && TickCache.StyleVersion == TickStyleVersion)
+		return;
+
+	TickCache.MaxValue = MaxV;
+	TickCache.Size = Size;
+	TickCache.StyleVersion = TickStyleVersion;
+
+	const FMargin& P = TickStyle.Pad;
+	const float InnerX = Size.X - P.GetTotalSpaceAlong<Orient_Horizontal>();
+	const float InnerY = Size.Y - P.GetTotalSpaceAlong<Orient_Vertical>();
+	const float SegV = FMath::Max(1.f, TickStyle.SegmentSize);
+
+	TickCache.Top = P.Top;
+	TickCache.Bottom = P.Top + InnerY;
+
+	// 체력이 가득 찼을 때의 눈금 수 (OnPaint 의 NumLines 최대값)
+	const int32 MaxLines = FMath::Max(0, FMath::FloorToInt(MaxV / SegV));
+	TickCache.Ticks.Reset(MaxLines);
+
+	for (int32 i=1; i<=MaxLines; ++i)
+	{
+		const float Alpha = (i * SegV) / MaxV;
+		const float X = FMath::RoundToFloat(Alpha * InnerX);
+
+		const bool bMajor = (TickStyle.MajorEvery > 0) && (i % TickStyle.MajorEvery == 0);
+		const float HalfTh = (bMajor ? TickStyle.MajorThickness : TickStyle.MinorThickness) * 0.5f;
+
+		FCachedTick& Tick = TickCache.Ticks.AddDefaulted_GetRef();
+		Tick.Left = P.Left + X - HalfTh;
+		Tick.Right = P.Left + X + HalfTh;
+		Tick.bMajor = bMajor;
+	}
+}
+
+void PCSUnitHealthProgressBar::PaintTicksBatched(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 Layer, const FLinearColor& ParentTint, int32 NumLines) const
+{
+	UpdateTickCache(FMath::Max(1.f, MaxValueAttr.Get()), FVector2f(AllottedGeometry.GetLocalSize()));
+
+	const int32 NumTicks = FMath::Min(NumLines, TickCache.Ticks.Num());
+	if (NumTicks <= 0)
+		return;
+
+	// 두께만큼의 사각형 = 안티앨리어싱 없는 MakeLines 와 같은 모양
+	const FSlateRenderTransform& RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
+	const FColor MinorColor = (TickStyle.MinorColor * ParentTint).ToFColorSRGB();
+	const FColor MajorColor = (TickStyle.MajorColor * ParentTint).ToFColorSRGB();
+	const float Top = TickCache.Top;
+	const float Bottom = TickCache.Bottom;
+
+	TickVertices.Reset(NumTicks * 4);
+	TickIndices.Reset(NumTicks * 6);
+
+	for (int32 i = 0; i < NumTicks; ++i)
+	{
+		const FCachedTick& Tick = TickCache.Ticks[i];
+		const FColor& Color = Tick.bMajor ? MajorColor : MinorColor;
+		const SlateIndex Base = (SlateIndex)TickVertices.Num();
+
+		TickVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, FVector2f(Tick.Left, Top), FVector2f(0.f, 0.f), Color));
+		TickVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, FVector2f(Tick.Right, Top), FVector2f(1.f, 0.f), Color));
+		TickVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, FVector2f(Tick.Left, Bottom), FVector2f(0.f, 1.f), Color));
+		TickVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, FVector2f(Tick.Right, Bottom), FVector2f(1.f, 1.f), Color));
+
+		TickIndices.Add(Base);
+		TickIndices.Add(Base + 1);
+		TickIndices.Add(Base + 2);
+		TickIndices.Add(Base + 2);
+		TickIndices.Add(Base + 1);
+		TickIndices.Add(Base + 3);
+	}
+
+	FSlateDrawElement::MakeCustomVerts(OutDrawElements, Layer, GetWhiteBrushHandle(), TickVertices, TickIndices, nullptr, 0, 0);
+	++GTickDrawElements;
+}
+
+void PCSUnitHealthProgressBar::PaintTicksPerLine(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 Layer, const FLinearColor& ParentTint, float MaxV, int32 NumLines) const
+{
 	const FVector2D Size = AllottedGeometry.GetLocalSize();
 	const FMargin& P = TickStyle.Pad;
 	const FVector2D TL(P.Left, P.Top);
@@ -30,21 +179,9 @@ int32 PCSUnitHealthProgressBar::OnPaint(const FPaintArgs& Args, const FGeometry&
 	const FPaintGeometry BarGeo = AllottedGeometry.ToPaintGeometry(
 		FVector2f((float)Inner.X, (float)Inner.Y),
 		FSlateLayoutTransform(FVector2f((float)TL.X, (float)TL.Y)));
-	
-	// 최대값/세그 계산
-	const float MaxV = FMath::Max(1.f, MaxValueAttr.Get());
-	const float SegV = FMath::Max(1.f, TickStyle.SegmentSize);
-	
-	// 현재 퍼센트 / 채워진 픽셀폭
-	const float Pct = FMath::Clamp(PercentAttr.Get().Get(0.f),0.f,1.f);
-	//const float FillW = Inner.X * Pct;
 
-	// 현재 채워진 값(= 현재 체력)과 그 안에서 필요한 선 개수
-	const int32 NumLines = FMath::FloorToInt((MaxV * Pct) / SegV);	// 1000, 2000, MaxV 미만
-	//const int32 NumFilled = FMath::FloorToInt((MaxV * Pct) / SegV);	// 현재 체력 이하까지만
+	const float SegV = FMath::Max(1.f, TickStyle.SegmentSize);
 
-	const FLinearColor ParentTint = InWidgetStyle.GetColorAndOpacityTint();
-	
 	for (int32 i=1; i<=NumLines; ++i)
 	{
 		const float Alpha = (i * SegV) / MaxV;
@@ -55,16 +192,81 @@ int32 PCSUnitHealthProgressBar::OnPaint(const FPaintArgs& Args, const FGeometry&
 		const FLinearColor LinearColor = bMajor ? TickStyle.MajorColor : TickStyle.MinorColor;
 
 		const FLinearColor DrawColor = LinearColor * ParentTint;
-		
+
 		X = FMath::RoundToFloat(X);
-		
+
 		FSlateDrawElement::MakeLines(
-			OutDrawElements, AfterBar + 1,
+			OutDrawElements, Layer,
 			BarGeo,
 			{ FVector2f(X, 0.f), FVector2f(X, (float)Inner.Y) },
 			ESlateDrawEffect::None, DrawColor,false, Th
 			);
+		++GTickDrawElements;
 	}
-	
-	return AfterBar + 2;
+}
+
+void PCSUnitHealthProgressBar::DebugBenchmark(int32 NumBars, int32 NumFrames)
+{
+#if !UE_BUILD_SHIPPING
+	if (!FSlateApplication::IsInitialized())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[HealthBar] Slate is not initialized"));
+		return;
+	}
+
+	NumBars = FMath::Max(1, NumBars);
+	NumFrames = FMath::Max(1, NumFrames);
+
+	// 후반 탱커 기준 : 최대 체력 3000 ~ 30000, 눈금 1000 마다
+	FUnitTickStyle Style;
+	Style.MajorThickness = 2.f;
+
+	FRandomStream Stream(1);
+	TArray<TSharedRef<PCSUnitHealthProgressBar>> Bars;
+	for (int32 i = 0; i < NumBars; ++i)
+	{
+		Bars.Add(SNew(PCSUnitHealthProgressBar)
+			.Percent(TOptional<float>(Stream.FRandRange(0.3f, 1.f)))
+			.MaxValue(Stream.FRandRange(3000.f, 30000.f))
+			.TickStyle(Style));
+	}
+
+	const TSharedRef<SWindow> Window = SNew(SWindow).ClientSize(FVector2f(1920.f, 1080.f));
+	FHittestGrid HittestGrid;
+	const FPaintArgs PaintArgs(&Window.Get(), HittestGrid, FVector2f::ZeroVector, FPlatformTime::Seconds(), 1.f / 60.f);
+	const FSlateRect CullingRect(0.f, 0.f, 1920.f, 1080.f);
+	const FWidgetStyle WidgetStyle;
+
+	const bool bWasBatched = CVarPCHealthBarBatchedTicks.GetValueOnGameThread();
+
+	for (const bool bBatched : { false, true })
+	{
+		CVarPCHealthBarBatchedTicks->Set(bBatched, ECVF_SetByConsole);
+
+		int64 TotalElements = 0;
+		const double Start = FPlatformTime::Seconds();
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			FSlateWindowElementList ElementList(Window);
+			GTickDrawElements = 0;
+
+			for (int32 i = 0; i < Bars.Num(); ++i)
+			{
+				// 유닛을 따라 매 프레임 위치가 바뀌는 상황
+				const FGeometry Geometry = FGeometry::MakeRoot(FVector2f(120.f, 10.f),
+					FSlateLayoutTransform(FVector2f((i % 10) * 150.f + Frame % 7, (i / 10) * 40.f)));
+				Bars[i]->OnPaint(PaintArgs, Geometry, CullingRect, ElementList, 0, WidgetStyle, true);
+			}
+
+			TotalElements += GTickDrawElements;
+		}
+
+		const double Ms = (FPlatformTime::Seconds() - Start) * 1000.0;
+		UE_LOG(LogTemp, Log, TEXT("[HealthBar] %s : %d bars, %.1f tick draw elements/frame, %.3f ms/frame (%d frames)"),
+			bBatched ? TEXT("Batched") : TEXT("PerLine"), NumBars, (double)TotalElements / NumFrames, Ms / NumFrames, NumFrames);
+	}
+
+	CVarPCHealthBarBatchedTicks->Set(bWasBatched, ECVF_SetByConsole);
+#endif
 }
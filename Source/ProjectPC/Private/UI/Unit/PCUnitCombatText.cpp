@@ -4,8 +4,93 @@
 #include "UI/Unit/PCUnitCombatText.h"
 
 #include "BaseGameplayTags.h"
+#include "MovieScene.h"
+#include "Animation/MovieScene2DTransformSection.h"
+#include "Animation/WidgetAnimation.h"
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "Blueprint/WidgetTree.h"
 #include "Components/Image.h"
+#include "Components/PanelWidget.h"
 #include "Components/TextBlock.h"
+#include "Sections/MovieSceneFloatSection.h"
+#include "Tracks/MovieScenePropertyTrack.h"
+
+namespace
+{
+	// 애니메이션이 없을 때의 기본 움직임 : 떠오르는 거리 (Slate 단위) / 사라지기 시작하는 비율
+	constexpr float FallbackRiseDistance = 50.f;
+	constexpr float FallbackFadeStart = 0.65f;
+
+	const FName ValueTextName(TEXT("ValueText"));
+	const FName RenderOpacityName(TEXT("RenderOpacity"));
+
+	const UWidgetAnimation* FindTemplateAnimation(const UClass* Class, FName AnimName)
+	{
+		// 부모 위젯 블루프린트에 만든 애니메이션도 찾도록 상위 클래스까지
+		for (; Class; Class = Class->GetSuperClass())
+		{
+			const UWidgetBlueprintGeneratedClass* WidgetClass = Cast<UWidgetBlueprintGeneratedClass>(Class);
+			if (!WidgetClass)
+				continue;
+
+			for (const UWidgetAnimation* Anim : WidgetClass->Animations)
+			{
+				if (Anim && Anim->GetMovieScene() && Anim->GetMovieScene()->GetFName() == AnimName)
+					return Anim;
+			}
+		}
+		return nullptr;
+	}
+
+	void ApplySection(const UMovieSceneTrack* Track, const UMovieSceneSection* Section, FFrameTime Time, FPCCombatTextMotionSample& InOutSample)
+	{
+		if (!Section->IsActive() || !Section->GetRange().Contains(Time.FrameNumber))
+			return;
+
+		if (const UMovieScene2DTransformSection* Transform = Cast<UMovieScene2DTransformSection>(Section))
+		{
+			float Value = 0.f;
+			if (Transform->Translation[0].Evaluate(Time, Value)) InOutSample.Translation.X += Value;
+			if (Transform->Translation[1].Evaluate(Time, Value)) InOutSample.Translation.Y += Value;
+			if (Transform->Scale[0].Evaluate(Time, Value)) InOutSample.Scale.X *= Value;
+			if (Transform->Scale[1].Evaluate(Time, Value)) InOutSample.Scale.Y *= Value;
+		}
+		else if (const UMovieSceneFloatSection* Float = Cast<UMovieSceneFloatSection>(Section))
+		{
+			const UMovieScenePropertyTrack* PropertyTrack = Cast<UMovieScenePropertyTrack>(Track);
+			float Value = 1.f;
+			if (PropertyTrack && PropertyTrack->GetPropertyName() == RenderOpacityName && Float->GetChannel().Evaluate(Time, Value))
+				InOutSample.Opacity *= Value;
+		}
+	}
+}
+
+FPCCombatTextMotionSample FPCCombatTextMotion::Evaluate(float Time) const
+{
+	const float T = Duration > 0.f ? FMath::Clamp(Time / Duration, 0.f, 1.f) : 1.f;
+
+	if (Samples.IsEmpty())
+	{
+		FPCCombatTextMotionSample Sample;
+		Sample.Translation.Y = -FallbackRiseDistance * (1.f - FMath::Square(1.f - T));
+		Sample.Opacity = T < FallbackFadeStart ? 1.f : 1.f - (T - FallbackFadeStart) / (1.f - FallbackFadeStart);
+		return Sample;
+	}
+
+	const float Position = T * (Samples.Num() - 1);
+	const int32 Index = FMath::Min(FMath::FloorToInt32(Position), Samples.Num() - 1);
+	const int32 Next = FMath::Min(Index + 1, Samples.Num() - 1);
+	const float Alpha = Position - Index;
+
+	const FPCCombatTextMotionSample& A = Samples[Index];
+	const FPCCombatTextMotionSample& B = Samples[Next];
+
+	FPCCombatTextMotionSample Sample;
+	Sample.Translation = FMath::Lerp(A.Translation, B.Translation, Alpha);
+	Sample.Scale = FMath::Lerp(A.Scale, B.Scale, Alpha);
+	Sample.Opacity = FMath::Lerp(A.Opacity, B.Opacity, Alpha);
+	return Sample;
+}
 
 void UPCUnitCombatText::InitializeDamageText(const float DamageValue, const bool bIsCritical,
                                                   const FGameplayTag& DamageTypeTag)
@@ -13,7 +98,7 @@ void UPCUnitCombatText::InitializeDamageText(const float DamageValue, const bool
 	if (ValueText)
 	{
 		FSlateFontInfo FontInfo = ValueText->GetFont();
-		FontInfo.Size = 19.f;
+		FontInfo.Size = DamageFontSize;
 		ValueText->SetFont(FontInfo);
 		
 		ValueText->SetText(FText::AsNumber(FMath::RoundToInt(DamageValue)));
@@ -61,7 +146,7 @@ void UPCUnitCombatText::InitializeHealText(const float HealValue)
 	if (ValueText)
 	{
 		FSlateFontInfo FontInfo = ValueText->GetFont();
-		FontInfo.Size = 13.f;
+		FontInfo.Size = HealFontSize;
 		ValueText->SetFont(FontInfo);
 
 		const FString HealString = FString::Printf(TEXT("+%d"), FMath::RoundToInt(HealValue));
@@ -81,7 +166,7 @@ void UPCUnitCombatText::InitializeMissText()
 	if (ValueText)
 	{
 		FSlateFontInfo FontInfo = ValueText->GetFont();
-		FontInfo.Size = 15.f;
+		FontInfo.Size = MissFontSize;
 		ValueText->SetFont(FontInfo);
 
 		ValueText->SetText(FText::FromString(TEXT("빗나감!")));
@@ -94,3 +179,88 @@ void UPCUnitCombatText::InitializeMissText()
 	if (DamageAnim)
 		PlayAnimation(DamageAnim);
 }
+
+FLinearColor UPCUnitCombatText::GetTypeColor(const FGameplayTag& CombatTextTypeTag) const
+{
+	if (CombatTextTypeTag.MatchesTagExact(UnitGameplayTags::Unit_CombatText_Type_Damage_Magic))
+		return MagicDamageColor;
+	if (CombatTextTypeTag.MatchesTagExact(UnitGameplayTags::Unit_CombatText_Type_Damage_TrueDamage))
+		return TrueDamageColor;
+	if (CombatTextTypeTag.MatchesTagExact(UnitGameplayTags::Unit_CombatText_Type_Heal))
+		return HealColor;
+	if (CombatTextTypeTag.MatchesTagExact(UnitGameplayTags::Unit_CombatText_Type_Miss))
+		return MissColor;
+	
+	return PhysicalDamageColor;
+}
+
+bool UPCUnitCombatText::GetTemplateValueFont(FSlateFontInfo& OutFont) const
+{
+	UWidgetBlueprintGeneratedClass* WidgetClass = Cast<UWidgetBlueprintGeneratedClass>(GetClass());
+	WidgetClass = WidgetClass ? UWidgetBlueprintGeneratedClass::FindWidgetTreeOwningClass(WidgetClass) : nullptr;
+	const UWidgetTree* Archetype = WidgetClass ? WidgetClass->GetWidgetTreeArchetype() : nullptr;
+
+	if (const UTextBlock* TemplateText = Archetype ? Cast<UTextBlock>(Archetype->FindWidget(ValueTextName)) : nullptr)
+	{
+		OutFont = TemplateText->GetFont();
+		return true;
+	}
+	return false;
+}
+
+bool UPCUnitCombatText::SampleTemplateAnimation(bool bHeal, int32 NumSamples, FPCCombatTextMotion& OutMotion) const
+{
+	// 인스턴스와 같은 선택 : 회복만 HealAnim, 나머지 (피해 / 치명타 / 빗나감) 는 DamageAnim
+	const UWidgetAnimation* Anim = FindTemplateAnimation(GetClass(), bHeal ? GET_MEMBER_NAME_CHECKED(UPCUnitCombatText, HealAnim) : GET_MEMBER_NAME_CHECKED(UPCUnitCombatText, DamageAnim));
+	const UMovieScene* MovieScene = Anim ? Anim->GetMovieScene() : nullptr;
+	if (!MovieScene || NumSamples < 2)
+		return false;
+
+	const float StartTime = Anim->GetStartTime();
+	const float Duration = Anim->GetEndTime() - StartTime;
+	if (Duration <= 0.f)
+		return false;
+
+	// ValueText 에 보이는 움직임 = ValueText 와 그 부모 위젯 (루트 포함) 트랙의 합
+	TSet<FName> AffectingWidgets;
+	UWidgetBlueprintGeneratedClass* WidgetClass = Cast<UWidgetBlueprintGeneratedClass>(GetClass());
+	WidgetClass = WidgetClass ? UWidgetBlueprintGeneratedClass::FindWidgetTreeOwningClass(WidgetClass) : nullptr;
+	if (const UWidgetTree* Archetype = WidgetClass ? WidgetClass->GetWidgetTreeArchetype() : nullptr)
+	{
+		for (const UWidget* Widget = Archetype->FindWidget(ValueTextName); Widget; Widget = Widget->GetParent())
+		{
+			AffectingWidgets.Add(Widget->GetFName());
+		}
+	}
+
+	const FFrameRate TickResolution = MovieScene->GetTickResolution();
+
+	OutMotion.Duration = Duration;
+	OutMotion.Samples.SetNum(NumSamples);
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		const FFrameTime Time = TickResolution.AsFrameTime(StartTime + Duration * i / (NumSamples - 1));
+		FPCCombatTextMotionSample& Sample = OutMotion.Samples[i];
+
+		for (const FWidgetAnimationBinding& Binding : Anim->GetBindings())
+		{
+			// 슬롯 (레이아웃) 바인딩과 치명타 이미지 등 다른 위젯은 제외
+			if (Binding.SlotWidgetName != NAME_None || (!Binding.bIsRootWidget && !AffectingWidgets.Contains(Binding.WidgetName)))
+				continue;
+
+			const FMovieSceneBinding* MovieSceneBinding = MovieScene->FindBinding(Binding.AnimationGuid);
+			if (!MovieSceneBinding)
+				continue;
+
+			for (const UMovieSceneTrack* Track : MovieSceneBinding->GetTracks())
+			{
+				for (const UMovieSceneSection* Section : Track->GetAllSections())
+				{
+					ApplySection(Track, Section, Time, Sample);
+				}
+			}
+		}
+	}
+
+	return true;
+}
@@ -217,6 +217,8 @@ void UPCUnitStatusBarWidget::UpdateEquipItemImages(const TArray<FGameplayTag>& I
 	UPCItemManagerSubsystem* ItemManagerSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UPCItemManagerSubsystem>() : nullptr;
 	if (!ItemManagerSubsystem)
 		return;
+
+	const int32 Revision = ++EquipItemImagesRevision;
 	
 	for (int32 i=0; i<EquipItemImages.Num(); ++i)
 	{
@@ -231,6 +233,16 @@ void UPCUnitStatusBarWidget::UpdateEquipItemImages(const TArray<FGameplayTag>& I
 					EquipItemImages[i]->SetVisibility(ESlateVisibility::Visible);
 					continue;
 				}
+
+				// 텍스처 로드 완료 후 그 사이 장착 아이템이 바뀌지 않았으면 다시 갱신
+				TWeakObjectPtr<const UPCUnitStatusBarWidget> WeakThis = this;
+				ItemManagerSubsystem->RequestItemTexture(ItemTag, [WeakThis, Revision, ItemTags](UTexture2D* LoadedTexture)
+				{
+					if (LoadedTexture && WeakThis.IsValid() && WeakThis->EquipItemImagesRevision == Revision)
+					{
+						WeakThis->UpdateEquipItemImages(ItemTags);
+					}
+				});
 			}
 		}
 
@@ -0,0 +1,208 @@
+#include "Utility/PCHexGridTopology.h"
+
+#include "Containers/Queue.h"
+#include "Utility/PCUnitCombatUtils.h"
+
+namespace
+{
+	// 기존 BT Task 들과 동일한 방향 규칙으로 Start 로부터 모든 타일까지의 거리 계산
+	void ComputeDistancesFrom(const FPCHexGridTopology& Topology, int32 StartIndex, TArray<uint8>& OutDist)
+	{
+		OutDist.Init(MAX_uint8, Topology.Num());
+		
+		TArray<int32, TInlineAllocator<64>> Queue;
+		Queue.Add(StartIndex);
+		OutDist[StartIndex] = 0;
+
+		for (int32 Head = 0; Head < Queue.Num(); ++Head)
+		{
+			const int32 HereIndex = Queue[Head];
+			const FIntPoint HerePoint = Topology.ToPoint(HereIndex);
+			
+			for (const FIntPoint& Dir : PCUnitCombatUtils::GetDirections(HerePoint.Y % 2 == 0))
+			{
+				const int32 NextIndex = Topology.ToIndex(HerePoint + Dir);
+				if (NextIndex != INDEX_NONE && OutDist[NextIndex] == MAX_uint8)
+				{
+					OutDist[NextIndex] = OutDist[HereIndex] + 1;
+					Queue.Add(NextIndex);
+				}
+			}
+		}
+	}
+}
+
+void FPCHexGridTopology::Build(int32 InCols, int32 InRows)
+{
+	Cols = FMath::Max(0, InCols);
+	Rows = FMath::Max(0, InRows);
+	NumTiles = Cols * Rows;
+	MaxDistance = 0;
+
+	Distances.Reset();
+	NeighborIndices.Reset();
+	NeighborStart.Reset();
+	RingIndices.Reset();
+	RingStart.Reset();
+	
+	if (NumTiles <= 0)
+		return;
+
+	// 이웃 목록
+	NeighborStart.Reserve(NumTiles + 1);
+	NeighborIndices.Reserve(NumTiles * 6);
+	for (int32 i = 0; i < NumTiles; ++i)
+	{
+		NeighborStart.Add(NeighborIndices.Num());
+		
+		const FIntPoint Point = ToPoint(i);
+		for (const FIntPoint& Dir : PCUnitCombatUtils::GetDirections(Point.Y % 2 == 0))
+		{
+			const int32 NextIndex = ToIndex(Point + Dir);
+			if (NextIndex != INDEX_NONE)
+			{
+				NeighborIndices.Add(NextIndex);
+			}
+		}
+	}
+	NeighborStart.Add(NeighborIndices.Num());
+
+	// 거리 행렬 (타일 56개 기준 56번의 BFS, 생성 시 1회)
+	Distances.SetNumUninitialized(NumTiles * NumTiles);
+	TArray<uint8> Row;
+	for (int32 i = 0; i < NumTiles; ++i)
+	{
+		ComputeDistancesFrom(*this, i, Row);
+		FMemory::Memcpy(&Distances[i * NumTiles], Row.GetData(), NumTiles);
+		
+		for (const uint8 Dist : Row)
+		{
+			if (Dist != MAX_uint8)
+			{
+				MaxDistance = FMath::Max<int32>(MaxDistance, Dist);
+			}
+		}
+	}
+
+	// 반경별 링 (카운팅 정렬)
+	const int32 Stride = MaxDistance + 2;
+	RingStart.SetNumZeroed(NumTiles * Stride);
+	RingIndices.SetNumUninitialized(NumTiles * NumTiles);
+	
+	TArray<int32> Cursor;
+	for (int32 i = 0; i < NumTiles; ++i)
+	{
+		int32* Start = &RingStart[i * Stride];
+		for (int32 j = 0; j < NumTiles; ++j)
+		{
+			const uint8 Dist = Distances[i * NumTiles + j];
+			if (Dist != MAX_uint8)
+			{
+				++Start[Dist + 1];
+			}
+		}
+
+		Start[0] = i * NumTiles;
+		for (int32 r = 1; r < Stride; ++r)
+		{
+			Start[r] += Start[r - 1];
+		}
+
+		Cursor.Reset();
+		Cursor.Append(Start, Stride);
+		for (int32 j = 0; j < NumTiles; ++j)
+		{
+			const uint8 Dist = Distances[i * NumTiles + j];
+			if (Dist != MAX_uint8)
+			{
+				RingIndices[Cursor[Dist]++] = j;
+			}
+		}
+	}
+}
+
+int32 FPCHexGridTopology::GetDistance(const FIntPoint& A, const FIntPoint& B) const
+{
+	const int32 IndexA = ToIndex(A);
+	const int32 IndexB = ToIndex(B);
+	if (IndexA == INDEX_NONE || IndexB == INDEX_NONE)
+		return MAX_uint8;
+	
+	return GetDistance(IndexA, IndexB);
+}
+
+TConstArrayView<int32> FPCHexGridTopology::GetNeighbors(int32 Index) const
+{
+	if (!IsValidIndex(Index))
+		return TConstArrayView<int32>();
+
+	const int32 Start = NeighborStart[Index];
+	return TConstArrayView<int32>(NeighborIndices.GetData() + Start, NeighborStart[Index + 1] - Start);
+}
+
+TConstArrayView<int32> FPCHexGridTopology::GetRing(int32 Index, int32 Radius) const
+{
+	if (!IsValidIndex(Index) || Radius < 0 || Radius > MaxDistance)
+		return TConstArrayView<int32>();
+
+	const int32 Base = Index * (MaxDistance + 2);
+	const int32 Start = RingStart[Base + Radius];
+	return TConstArrayView<int32>(RingIndices.GetData() + Start, RingStart[Base + Radius + 1] - Start);
+}
+
+#if !UE_BUILD_SHIPPING
+int32 FPCHexGridTopology::ValidateAgainstBFS() const
+{
+	int32 Mismatch = 0;
+	
+	for (int32 A = 0; A < NumTiles; ++A)
+	{
+		// 테이블과 독립적으로, BT Task 와 같은 TQueue + TSet BFS 로 다시 계산
+		TMap<FIntPoint, int32> BfsDist;
+		TQueue<FIntPoint> Q;
+		Q.Enqueue(ToPoint(A));
+		BfsDist.Add(ToPoint(A), 0);
+
+		FIntPoint Here;
+		while (Q.Dequeue(Here))
+		{
+			const int32 HereDist = BfsDist.FindChecked(Here);
+			for (const FIntPoint& Dir : PCUnitCombatUtils::GetDirections(Here.Y % 2 == 0))
+			{
+				const FIntPoint Next = Here + Dir;
+				if (IsInRange(Next) && !BfsDist.Contains(Next))
+				{
+					BfsDist.Add(Next, HereDist + 1);
+					Q.Enqueue(Next);
+				}
+			}
+		}
+
+		for (int32 B = 0; B < NumTiles; ++B)
+		{
+			const int32* Expected = BfsDist.Find(ToPoint(B));
+			const int32 TableDist = GetDistance(A, B);
+			const bool bInRing = Expected && GetRing(A, *Expected).Contains(B);
+			
+			if (!Expected || *Expected != TableDist || !bInRing)
+			{
+				++Mismatch;
+				UE_LOG(LogTemp, Warning, TEXT("[HexTopology] Mismatch A=%s B=%s Table=%d BFS=%d InRing=%d"),
+					*ToPoint(A).ToString(), *ToPoint(B).ToString(), TableDist, Expected ? *Expected : -1, bInRing);
+			}
+		}
+
+		// 이웃 목록은 거리 1 링과 같아야 함
+		const TConstArrayView<int32> Neighbors = GetNeighbors(A);
+		const TConstArrayView<int32> Ring1 = GetRing(A, 1);
+		if (Neighbors.Num() != Ring1.Num())
+		{
+			++Mismatch;
+			UE_LOG(LogTemp, Warning, TEXT("[HexTopology] Neighbor count mismatch at %s (%d != %d)"),
+				*ToPoint(A).ToString(), Neighbors.Num(), Ring1.Num());
+		}
+	}
+
+	return Mismatch;
+}
+#endif
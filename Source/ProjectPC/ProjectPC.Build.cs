@@ -18,7 +18,7 @@ public class ProjectPC : ModuleRules
 			"NetCore"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { "UMG", "Slate", "SlateCore", "MoviePlayer" });
+		PrivateDependencyModuleNames.AddRange(new string[] { "UMG", "Slate", "SlateCore", "MoviePlayer", "MovieScene", "MovieSceneTracks" });
 
 		// Uncomment if you are using Slate UI
 		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
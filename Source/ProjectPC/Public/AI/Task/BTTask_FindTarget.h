@@ -43,5 +43,4 @@ protected:
 private:
 	void SetTargetActorKey(APCBaseUnitCharacter* Target, UBlackboardComponent* BB) const;
 	void ClearTargetActorKey(UBlackboardComponent* BB) const;
-	bool IsTargetInRange(const int8 Range, const int8 TargetDist) const;
 };
@@ -42,6 +42,7 @@ public:
 	ATTRIBUTE_ACCESSORS(ThisClass, EvasionChance);
 	
 	float GetEffectiveAttackSpeed() const;
+	static float CalcEffectiveAttackSpeed(float BaseAttackSpeed, float IncreasePercent, float DecreasePercent);
 	
 protected:
 	UPROPERTY(BlueprintReadOnly, Category="Unit Attributes",  ReplicatedUsing=OnRep_MaxHealth)
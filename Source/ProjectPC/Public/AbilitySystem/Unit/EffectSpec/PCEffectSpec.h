@@ -54,4 +54,40 @@ protected:
 	bool IsTargetEligibleByGroup(const AActor* Source, const AActor* Target) const;
 
 	void ApplyDurationOptions(FGameplayEffectSpec& Spec) const;
+
+	// Outgoing Spec 캐시 (EffectSpec 인스턴스는 AbilityConfig 에셋에서 여러 유닛이 공유하므로 SourceASC 별로 보관)
+	// 캐시 미스로 새로 만든 경우 bOutCreated = true -> 호출 측에서 고정 설정(동적 태그, Duration 등)을 1회만 적용
+	// 캐시 히트 시에는 SetByCaller 값과 대상만 바꿔서 재사용
+	FGameplayEffectSpec* GetOutgoingSpec(UAbilitySystemComponent* SourceASC, const TSubclassOf<UGameplayEffect>& GEClass,
+		int32 Level, uint32 Variant, bool& bOutCreated);
+
+private:
+	struct FOutgoingSpecKey
+	{
+		TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+		int32 Level = 1;
+		uint32 Variant = 0;
+
+		bool operator==(const FOutgoingSpecKey& Other) const
+		{
+			return SourceASC == Other.SourceASC && Level == Other.Level && Variant == Other.Variant;
+		}
+
+		friend uint32 GetTypeHash(const FOutgoingSpecKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.SourceASC), GetTypeHash(Key.Level)), GetTypeHash(Key.Variant));
+		}
+	};
+
+	static constexpr int32 MaxCachedOutgoingSpecs = 256;
+	
+	TMap<FOutgoingSpecKey, FGameplayEffectSpecHandle> CachedOutgoingSpecs;
+
+	// 캐시 비활성(PC.GE.SpecCache 0) 시 적용 중인 Spec을 유지하기 위한 핸들
+	FGameplayEffectSpecHandle UncachedOutgoingSpec;
+
+public:
+	// 기존 방식(대상마다 MakeOutgoingSpec)과 캐시 방식의 Spec 준비 비용 비교
+	static void DebugBenchmarkOutgoingSpecCache(UAbilitySystemComponent* SourceASC, TSubclassOf<UGameplayEffect> GEClass,
+		FGameplayTag CallerTag, int32 NumTargets = 28, int32 NumCasts = 1000);
 };
@@ -26,4 +26,7 @@ protected:
 	TSubclassOf<UGameplayEffect> CachedGEClass;
 
 	TSubclassOf<UGameplayEffect> ResolveGEClass(const UWorld* World);
+
+	// 적용마다 호출되는 경로용, 한 번 찾은 뒤로는 월드 / 레지스트리 조회 없이 캐시만 반환
+	TSubclassOf<UGameplayEffect> GetResolvedGEClass(const UAbilitySystemComponent* SourceASC);
 };
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utility/PCRandomChannel.h"
+
+// UPCUnitDamageExec 의 순수 계산 부분
+// GAS 없이도 같은 공식을 쓸 수 있도록 분리 (헤드리스 전투 시뮬레이터 등)
+// 모든 Pct 값은 AttributeSet 과 동일하게 퍼센트 단위 (30 = 30%)
+
+struct FPCDamageFormulaParams
+{
+	float BaseDamage = 0.f;
+	
+	bool bIsPhysical = false;
+	bool bIsMagic = false;
+	bool bIsTrueDamage = false;
+	bool bNoCrit = false;
+
+	// Source
+	float TypeDamageMultiplierPct = 0.f;	// 물리 / 마법 데미지 배율
+	float CritChancePct = 0.f;
+	float CritMultiplierPct = 0.f;
+	float DamageMultiplierPct = 0.f;		// 최종 데미지 배율
+
+	// Target
+	float Defense = 0.f;					// 데미지 타입에 맞는 방어력
+	float FlatDamageBlock = 0.f;
+};
+
+struct FPCDamageFormulaResult
+{
+	// 치명타까지 적용된 경감 전 데미지 (마나 회복 계산용)
+	float PreMitigationDamage = 0.f;
+	float FinalDamage = 0.f;
+	bool bIsCritical = false;
+
+	bool IsApplied() const { return FinalDamage > KINDA_SMALL_NUMBER; }
+};
+
+namespace PCUnitDamageFormula
+{
+	// Stream(매치 난수 채널) 이 없으면 FMath::FRand 사용
+	PROJECTPC_API float Roll(const FPCRandomChannel* Stream);
+	
+	// 기본 공격 회피 판정
+	PROJECTPC_API bool RollEvasion(float EvasionChancePct, const FPCRandomChannel* Stream = nullptr);
+
+	// 타입 배율 -> 치명타 -> 방어 경감 -> 고정 피해 감소 -> 최종 배율 순서로 계산
+	PROJECTPC_API FPCDamageFormulaResult Resolve(const FPCDamageFormulaParams& Params, const FPCRandomChannel* Stream = nullptr);
+
+	// 피격 시 마나 회복 (영웅 전용)
+	PROJECTPC_API float CalcManaGainOnHit(const FPCDamageFormulaResult& Result);
+
+	// 공격자 피흡 회복량
+	PROJECTPC_API float CalcLifeStealHeal(const FPCDamageFormulaResult& Result, float LifeStealPct);
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "AbilitySystem/Unit/GA/PCUnitPassiveGameplayAbility.h"
+#include "GameFramework/WorldSubsystem/PCCombatSchedulerSubsystem.h"
 #include "PCUnitPeriodPulseGameplayAbility.generated.h"
 
 class UGameplayTask_WaitDelay;
@@ -45,5 +46,6 @@ protected:
 	FName AttachedSocketName = TEXT("Impact");
 	
 private:
-	FTimerHandle PulseTimer;
+	// 유닛마다 타이머를 두지 않고 전투 스케줄러에 주기 작업으로 등록
+	FPCCombatJobHandle PulseJob;
 };
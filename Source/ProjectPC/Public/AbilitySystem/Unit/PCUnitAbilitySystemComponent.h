@@ -22,6 +22,9 @@ protected:
 	
 public:
 	virtual void InitGAS();
+
+	// 유닛 풀 반납 시 GA/GE/루즈 태그/어트리뷰트를 스폰 직후 상태로 되돌림 (재사용 시 InitGAS로 다시 초기화)
+	void ResetForReuse();
 	
 protected:
 	virtual void ApplyInitBaseStat(const APCBaseUnitCharacter* Unit, const UPCDataAsset_BaseUnitData* UnitData);
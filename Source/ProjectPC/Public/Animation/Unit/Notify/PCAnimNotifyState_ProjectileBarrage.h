@@ -6,6 +6,7 @@
 #include "BaseGameplayTags.h"
 #include "GameplayTagContainer.h"
 #include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "GameFramework/WorldSubsystem/PCCombatSchedulerSubsystem.h"
 #include "PCAnimNotifyState_ProjectileBarrage.generated.h"
 
 UENUM(BlueprintType)
@@ -65,6 +66,6 @@ public:
 	FGameplayTag EventTag = UnitGameplayTags::Unit_Event_SpawnProjectileSucceed;
 
 private:
-	TMap<TWeakObjectPtr<USkeletalMeshComponent>, FTimerHandle> TimerMap;
+	TMap<TWeakObjectPtr<USkeletalMeshComponent>, FPCCombatJobHandle> JobMap;
 	TMap<TWeakObjectPtr<USkeletalMeshComponent>, bool> UseLeftMap;
 };
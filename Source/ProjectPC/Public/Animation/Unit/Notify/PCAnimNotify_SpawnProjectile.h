@@ -22,6 +22,10 @@ struct FTargetData_Projectile : public FGameplayAbilityTargetData
 	UPROPERTY()
 	TWeakObjectPtr<APCBaseProjectile> Projectile;
 
+	// 경량 발사체로 생성된 경우 (Projectile 은 nullptr)
+	UPROPERTY()
+	uint32 SimProjectileId = 0;
+
 	virtual UScriptStruct* GetScriptStruct() const override { return StaticStruct(); }
 };
 
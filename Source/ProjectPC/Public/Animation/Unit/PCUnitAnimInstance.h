@@ -28,6 +28,8 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category="AnimSet")
 	void SetAnimSet(UPCDataAsset_UnitAnimSet* NewSet);
+
+	FORCEINLINE UPCDataAsset_UnitAnimSet* GetAnimSet() const { return CurrentAnimSet; }
 	
 	UPROPERTY(BlueprintReadOnly, Category="Movement")
 	float Speed = 0.f;
@@ -112,5 +114,9 @@ private:
 	
 	void ResolveAssets(const UPCDataAsset_UnitAnimSet* AnimSet);
 
+	// 이미 로드된 에셋은 즉시 할당, 아니면 비동기 로드 후 할당
+	template<typename T>
+	void ResolveAsset(const TSoftObjectPtr<T>& SoftAsset, TObjectPtr<T>& OutAsset);
+
 	bool bDidPlayLevelStartMontage = false;
 };
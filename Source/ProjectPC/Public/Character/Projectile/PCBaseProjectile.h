@@ -24,6 +24,10 @@ protected:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void NotifyActorBeginOverlap(AActor* OtherActor) override;
 
+public:
+	// 유닛 to 유닛 발사체는 발사한 유닛의 보드를 보는 연결에만 복제
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+
 private:
 	FTimerHandle LifeTimer;
 
@@ -38,6 +42,8 @@ public:
 	void ReturnToPool();
 	
 	void SetProjectileProperty();
+	// 캐릭터 / 공격타입 Tag 에 해당하는 발사체 데이터 (경량 발사체 시뮬레이션에서는 CDO 로 조회)
+	const FPCProjectileData* FindProjectileData(FGameplayTag CharacterTag, FGameplayTag AttackTypeTag) const;
 	void SetTarget(const AActor* TargetActor);
 	void SetEffectSpecs(const TArray<UPCEffectSpec*>& InEffectSpecs);
 	void SetDamage(float InDamage);
@@ -92,5 +98,8 @@ private:
 	bool bIsPenetrating = false;
 	bool bIsPlayerAttack = false;
 
+	// 유닛 to 유닛 발사체의 보드 Seat (그 외 INDEX_NONE -> 항상 복제)
+	int32 RelevancyBoardSeatIndex = INDEX_NONE;
+
 #pragma endregion ProjectileData
 };
@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "GameFramework/Info.h"
+#include "PCProjectileSimReplicator.generated.h"
+
+// 경량 발사체 생성 이벤트, 클라는 이 정보로 궤적을 직접 예측해서 그림
+USTRUCT()
+struct FPCProjectileSpawnEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint32 ProjectileId = 0;
+
+	UPROPERTY()
+	FVector_NetQuantize Location;
+
+	UPROPERTY()
+	FVector_NetQuantizeNormal Direction;
+
+	UPROPERTY()
+	TObjectPtr<const AActor> Target = nullptr;
+
+	UPROPERTY()
+	FGameplayTag CharacterTag;
+
+	UPROPERTY()
+	FGameplayTag AttackTypeTag;
+};
+
+// 경량 발사체 피격 이벤트
+USTRUCT()
+struct FPCProjectileImpactEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint32 ProjectileId = 0;
+
+	UPROPERTY()
+	TObjectPtr<const AActor> HitActor = nullptr;
+
+	// 관통 발사체는 피격 후에도 계속 날아감
+	UPROPERTY()
+	bool bDestroyProjectile = true;
+};
+
+/**
+ * 경량 발사체 이벤트 전달용 액터 (서버에서 보드마다 1개 생성)
+ * 위치 / 이동은 복제하지 않고, 한 프레임 동안 모인 생성 / 피격 이벤트만 묶어서 멀티캐스트
+ * 자기 보드를 보는 연결에만 Relevant (UPCBoardRelevancySubsystem)
+ */
+UCLASS(NotPlaceable)
+class PROJECTPC_API APCProjectileSimReplicator : public AInfo
+{
+	GENERATED_BODY()
+
+public:
+	APCProjectileSimReplicator();
+
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+
+	// 담당 보드 Seat (INDEX_NONE 이면 모든 연결에 전달)
+	int32 BoardSeatIndex = INDEX_NONE;
+
+	UFUNCTION(NetMulticast, Unreliable)
+	void Multicast_SpawnProjectiles(const TArray<FPCProjectileSpawnEvent>& Events);
+
+	UFUNCTION(NetMulticast, Unreliable)
+	void Multicast_ImpactProjectiles(const TArray<FPCProjectileImpactEvent>& Events);
+};
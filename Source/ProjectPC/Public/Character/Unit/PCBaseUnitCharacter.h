@@ -48,6 +48,11 @@ public:
 	APCPlayerState* GetOwnerPlayerState() const { return OwnerPS; }
 
 	virtual TArray<FGameplayTag> GetEquipItemTags() const override;
+
+	// 자기 보드를 보는 연결과 소유 플레이어에게만 복제 (UPCBoardRelevancySubsystem)
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+	// 전투 보드 위면 그 보드, 아니면 소유 플레이어 보드 Seat (알 수 없으면 INDEX_NONE)
+	int32 GetRelevancyBoardSeatIndex() const;
 	
 	FORCEINLINE UPCUnitEquipmentComponent* GetEquipmentComponent() const { return EquipmentComp; }
 	FORCEINLINE const UWidgetComponent* GetStatusBarComponent() const { return StatusBarComp; }
@@ -173,4 +178,28 @@ protected:
 public:
 	UPROPERTY()
 	FOnUnitDied OnUnitDied;
+
+	// 유닛 풀링 관련 //
+public:
+	// UPCUnitSpawnSubsystem에서 풀 반납/재사용 시 호출 (서버)
+	// 풀은 UnitTag 단위로 모든 플레이어가 공유하므로 클라는 bIsInUnitPool 복제로 같은 로컬 처리를 실행
+	virtual void OnReturnedToPool();
+	virtual void OnAcquiredFromPool();
+
+	FORCEINLINE bool IsInUnitPool() const { return bIsInUnitPool; }
+
+	// 이 머신(서버 / 클라)에서 보이는 상태가 풀 상태와 맞는지 검증 (숨김, 콜리전, 몽타주, AnimSet, 상태바)
+	// 불일치 항목은 OutReport 에 추가, Shipping 에서는 항상 true
+	virtual bool DebugValidatePoolLocalState(FString& OutReport) const;
+
+protected:
+	// 서버 / 클라 공통 : 표시 상태 정리 (숨김, 몽타주, 외곽선, UI 바인딩) 와 재사용 시 상태바 / AnimSet 재설정
+	virtual void OnReturnedToPoolLocal();
+	virtual void OnAcquiredFromPoolLocal();
+	
+	UPROPERTY(ReplicatedUsing=OnRep_IsInUnitPool)
+	bool bIsInUnitPool = false;
+
+	UFUNCTION()
+	void OnRep_IsInUnitPool();
 };
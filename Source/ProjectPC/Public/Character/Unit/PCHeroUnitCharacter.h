@@ -69,6 +69,7 @@ protected:
 	
 private:
 	void PlayLevelUpParticle() const;
+	void PlayLevelStartSound();
 	
 	UPROPERTY(ReplicatedUsing=OnRep_IsDragging)
 	bool bIsDragging;
@@ -88,6 +89,14 @@ public:
 	
 	UFUNCTION(BlueprintCallable, Category="DragAndDrop")
 	void ActionDrag(const bool IsStart);
+
+	virtual void OnReturnedToPool() override;
+	virtual void OnAcquiredFromPool() override;
+	virtual bool DebugValidatePoolLocalState(FString& OutReport) const override;
+
+protected:
+	virtual void OnReturnedToPoolLocal() override;
+	virtual void OnAcquiredFromPoolLocal() override;
 	
 	// 시너지, UI 관련 //
 public:
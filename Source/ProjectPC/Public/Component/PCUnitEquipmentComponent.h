@@ -36,6 +36,10 @@ public:
 	void UnionEquipmentComponent(UPCUnitEquipmentComponent* InEquipmentComp);
 	void ReturnAllItemToPlayerInventory(const bool bIsDestroyedHero = false);
 	void ReturnItemToPlayerInventory(const FGameplayTag& ItemTag) const;
+
+	// 유닛 풀링용: 슬롯/아이템 효과 비우기, 재사용 시 소유 플레이어 인벤토리 갱신
+	void ClearAllSlots();
+	void RefreshOwnerPlayerInventory();
 	
 	FORCEINLINE const TArray<FGameplayTag>& GetSlotItemTags() const { return SlotItemTags; }
 
@@ -192,6 +192,19 @@ public:
 
 	APCCombatBoard* FindBoardBySeatIndex(int32 BoardSeatIndex) const;
 
+	// 서버 : 이 연결이 보고 있는 보드 (보드 단위 Net Relevancy 기준, 보드가 아니면 INDEX_NONE)
+	void SetViewedBoardSeatIndex(int32 BoardSeatIndex) { ViewedBoardSeatIndex = BoardSeatIndex; }
+	int32 GetViewedBoardSeatIndex() const { return ViewedBoardSeatIndex; }
+
+	// 정찰처럼 클라에서 보드를 바꾸는 경우
+	UFUNCTION(Server, Reliable)
+	void Server_SetViewedBoardSeatIndex(int32 BoardSeatIndex);
+
+private:
+	int32 ViewedBoardSeatIndex = INDEX_NONE;
+
+public:
+
 	// UI 가리기용 위젯
 	UPROPERTY(EditDefaultsOnly)
 	TSubclassOf<UUserWidget> ScreenFadeClass;
@@ -328,6 +341,14 @@ public:
 	UFUNCTION(Client, Reliable)
 	void Client_TileHoverUnit(APCBaseUnitCharacter* Unit);
 
+	// 소유 클라 : 복제된 보드 점유 정보로 호버 유닛 판정 (PC.Hover.Local)
+	// 판정했으면 true, false 면 호출부에서 서버 질의로 대체
+	bool TryResolveHoverLocally(const FVector& World);
+	bool TryResolveTileUnitLocally(bool bIsField, int32 Y, int32 X, int32 BenchIdx);
+
+	// 호버 유닛 적용 (Client_TileHoverUnit / 로컬 판정 공용)
+	void ApplyTileHoverUnit(APCBaseUnitCharacter* Unit);
+
 	UFUNCTION(Client, Reliable)
 	void Client_CheckHeroStatus(APCBaseUnitCharacter* Unit);
 
@@ -41,6 +41,50 @@ struct FRoundStep
 	
 };
 
+// 매치 시작 시 한 번 컴파일되는 평탄 스케줄 항목 (이후 불변, 클라에도 한 번만 복제)
+USTRUCT(BlueprintType)
+struct FPCScheduledStep
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Schedule")
+	EPCStageType StageType = EPCStageType::None;
+
+	// 1부터 시작 (FStageRuntimeState 와 동일)
+	UPROPERTY(BlueprintReadOnly, Category = "Schedule")
+	int32 StageIdx = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Schedule")
+	int32 RoundIdx = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Schedule")
+	int32 StepIdxInRound = 0;
+
+	// "Stage-Round"
+	UPROPERTY(BlueprintReadOnly, Category = "Schedule")
+	FString Label;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Schedule")
+	float Duration = 0.f;
+
+	// 매치 시작 기준 시작 시각 (초), 앞 스텝 길이의 누적
+	UPROPERTY(BlueprintReadOnly, Category = "Schedule")
+	float StartOffset = 0.f;
+
+	// 인접 스텝 (없으면 None)
+	UPROPERTY(BlueprintReadOnly, Category = "Schedule")
+	EPCStageType PrevStageType = EPCStageType::None;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Schedule")
+	EPCStageType NextStageType = EPCStageType::None;
+
+	// 다음 라운드 첫 스텝 인덱스 (마지막 라운드면 INDEX_NONE)
+	UPROPERTY(BlueprintReadOnly, Category = "Schedule")
+	int32 NextRoundStepIndex = INDEX_NONE;
+
+	float GetEndOffset() const { return StartOffset + Duration; }
+};
+
 USTRUCT(BlueprintType)
 struct FRoundSpec
 {
@@ -119,6 +163,16 @@ public:
 	void BuildFlattenedPhase(TArray<FRoundStep>& RoundsStep, TArray<int32>& StageIdx, TArray<int32>& RoundIdx, TArray<int32>& StepIdxInRound,
 		TArray<FGameplayTag>& OutRoundMajorFlat, TArray<FGameplayTag>& OutPvESubTagFlat) const;
 	
+	// BuildFlattenedPhase 결과를 시작 시각 / 라벨 / 인접 스텝이 미리 계산된 스케줄로 컴파일, 총 길이 (초) 반환
+	// 라운드별 Major / PvE 서브태그가 필요하면 같이 받음
+	float CompileSchedule(TArray<FPCScheduledStep>& OutSchedule,
+		TArray<FGameplayTag>* OutRoundMajorFlat = nullptr, TArray<FGameplayTag>* OutPvESubTagFlat = nullptr) const;
+
+	// 컴파일한 스케줄의 총 길이를 스테이지 데이터 (프리셋이면 평탄화 결과) 의 스텝 길이 합과 비교하고
+	// 시작 시각 연속성 / 인접 스텝 정보도 검사, 문제가 없으면 true
+	// 콘솔 : PC.Schedule.Validate (로드 가능한 모든 UPCStageData 에셋 + 기본 프리셋)
+	bool ValidateSchedule(FString& OutReport) const;
+
 	UFUNCTION(BlueprintPure, Category = "UI")
 	FString MakeStageRoundLabel(int32 FloatIndex, const TArray<int32>& StageIdx, const TArray<int32>& RoundIdx) const;
 	
@@ -33,7 +33,10 @@ class PROJECTPC_API APCUnitCombatTextActor : public AActor
 public:	
 	APCUnitCombatTextActor();
 
-	void InitCombatTextActor(const USceneComponent* InAttachComp, const FCombatTextInitParams& InParams);
+	// AnchorLocation = 부착 컴포넌트의 소켓 위치 (오프셋 / 흔들림은 여기서 적용)
+	void InitCombatTextActor(const FVector& AnchorLocation, const FCombatTextInitParams& InParams);
+
+	TSubclassOf<UUserWidget> GetCombatTextWidgetClass() const;
 
 	void ReturnToPool();
 
@@ -10,7 +10,6 @@
 enum class EPCStageType : uint8;
 
 struct FGameplayTag;
-struct FRoundStep;
 
 class APCPlayerBoard;
 class APCBaseUnitCharacter;
@@ -75,13 +74,18 @@ protected:
 	void BindPlayerMainHuD();
 
 private:
-	// 데이터 평탄화
-	TArray<FRoundStep> FlatRoundSteps;
-	TArray<int32> FlatStageIdx;
-	TArray<int32> FlatRoundIdx;
-	TArray<int32> FlatStepIdxInRound;
+	using FStepHandler = void (APCCombatGameMode::*)();
+
+	// 매치 시작 시 컴파일한 스케줄 (불변) / 스텝별 처리 함수
+	TArray<FPCScheduledStep> Schedule;
+	TArray<FStepHandler> ScheduleHandlers;
 	int32 Cursor = -1;
 
+	// 스텝 시작 / 종료를 스케줄 기준 절대 시각으로 잡아 타이머 오차가 라운드마다 쌓이지 않게 함
+	float ScheduleOriginTime = 0.f;
+	// ForceShortenCurrentStep / 캐러셀 길이 변경으로 생긴 누적 차이
+	float ScheduleShift = 0.f;
+
 	FTimerHandle StartTimer;
 	FTimerHandle RoundTimer;
 	FTimerHandle CameraSetupTimer;
@@ -94,6 +98,8 @@ private:
 	void AdvanceCursor();
 	void BeginCurrentStep();
 	void EndCurrentStep();
+	void ArmStepTimer(float ServerEndTime);
+	static FStepHandler ResolveStepHandler(EPCStageType StageType);
 	
 	// Start 헬퍼 함수
 	void PlayerStartUnitSpawn();
@@ -117,9 +123,8 @@ private:
 	void SetCarouselCameraForAllPlayers();
 	int32 ResolveBoardIndex(const APCPlayerState* PlayerState) const;
 
-	// 인접 스텝 조회
-	const FRoundStep* PeekPrevStep() const;
-	const FRoundStep* PeekNextStep() const;
+	// 현재 스텝 조회 (인접 스텝은 항목의 Prev/NextStageType)
+	const FPCScheduledStep* GetCurrentStep() const;
 	
 	// CombatManager / GameState 핸들러
 	UPROPERTY(VisibleInstanceOnly, Category = "Ref")
@@ -150,6 +155,10 @@ private:
 protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Data")
 	TObjectPtr<UPCDataAsset_UnitGEDictionary> UnitGEDictionary;
+
+	// 매치 난수 시드 (0 이면 -PCMatchSeed= 또는 무작위), 로그에 남은 시드로 매치 재현
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Match")
+	int32 MatchSeed = 0;
 	
 	// 데이터 로딩
 
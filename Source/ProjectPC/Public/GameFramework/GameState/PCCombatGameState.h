@@ -9,9 +9,11 @@
 #include "DataAsset/FrameWork/PCStageData.h"
 #include "DataAsset/Projectile/PCDataAsset_ProjectilePoolData.h"
 #include "GameFramework/PlayerState/PCLevelMaxXPData.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "PCCombatGameState.generated.h"
 
 class APCCombatBoard;
+class APCCombatGameState;
 class APCItemCapsule;
 class APCPlayerState;
 class APCUnitCombatTextActor;
@@ -117,6 +119,14 @@ struct FStageRuntimeState
 
 	UPROPERTY(BlueprintReadOnly)
 	float ServerEndTime = 0.f;
+
+	// 스케줄 기준 시각 : 스텝 i 의 예상 시작 = ScheduleOriginTime + RoundSchedule[i].StartOffset + ScheduleShift
+	UPROPERTY(BlueprintReadOnly)
+	float ScheduleOriginTime = 0.f;
+
+	// 스텝 단축 / 캐러셀 길이 변경으로 밀리거나 당겨진 누적 시간
+	UPROPERTY(BlueprintReadOnly)
+	float ScheduleShift = 0.f;
 };
 
 /** 메인 위젯에 그대로 나열할 행(1등=Index 0, N등=Index N-1) */
@@ -159,6 +169,58 @@ struct FPlayerStandingRow
 
 	UPROPERTY(BlueprintReadOnly)
 	FGameplayTag CharacterTag;
+
+	/** 리더보드 칸 (0 = 1등 칸), 클라에서 순서 복원용 */
+	UPROPERTY(BlueprintReadOnly)
+	int32 SlotIndex = INDEX_NONE;
+
+	/** 화면에 보이는 값(HP / 랭크 / 칸 등)이 같은지, 정렬용 시간 값은 비교하지 않음 */
+	bool HasSameStanding(const FPlayerStandingRow& Other) const;
+};
+
+struct FPlayerStandingArray;
+
+/** 리더보드 FastArray 항목 (키 = Row.PlayerSeatIndex) */
+USTRUCT()
+struct FPlayerStandingEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FPlayerStandingRow Row;
+
+	void PreReplicatedRemove(const FPlayerStandingArray& InArraySerializer);
+	void PostReplicatedAdd(const FPlayerStandingArray& InArraySerializer);
+	void PostReplicatedChange(const FPlayerStandingArray& InArraySerializer);
+};
+
+/** 리더보드 복제용 배열, 값이 바뀐 행만 전송 */
+USTRUCT()
+struct FPlayerStandingArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FPlayerStandingEntry> Entries;
+
+	// 클라 콜백 전달 대상
+	APCCombatGameState* OwnerGameState = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
+	{
+		return FastArrayDeltaSerialize<FPlayerStandingEntry, FPlayerStandingArray>(Entries, DeltaParams, *this);
+	}
+
+	// 서버 : 칸 순서로 정렬된 행과 비교해서 바뀐 행만 Dirty, Dirty 처리한 행 수 리턴
+	int32 ApplyRows(const TArray<FPlayerStandingRow>& Rows);
+
+	// 클라 : 한 번의 수신에서 바뀐 행을 모두 적용한 뒤 호출
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+};
+
+template<> struct TStructOpsTypeTraits<FPlayerStandingArray> : public TStructOpsTypeTraitsBase2<FPlayerStandingArray>
+{
+	enum { WithNetDeltaSerializer = true };
 };
 
 UENUM(BlueprintType)
@@ -335,6 +397,21 @@ public:
 	
 	UPROPERTY(ReplicatedUsing=OnRep_RoundsLayout, BlueprintReadOnly, Category = "Stage|Layout")
 	TArray<FGameplayTag> RoundPvETagFlat;
+
+	// Round Schedule (매치 시작 시 GameMode 가 한 번 설정, 이후 불변)
+	void SetRoundSchedule(const TArray<FPCScheduledStep>& InSchedule);
+
+	const TArray<FPCScheduledStep>& GetRoundSchedule() const { return RoundSchedule; }
+	const FPCScheduledStep* GetScheduledStep(int32 FloatIndex) const;
+	const FPCScheduledStep* GetCurrentScheduledStep() const { return GetScheduledStep(StageRuntimeState.FloatIndex); }
+
+	// 현재 시프트 기준 스텝 예상 시작 서버 시각 (스케줄 밖이면 -1)
+	UFUNCTION(BlueprintPure, Category = "Stage|Schedule")
+	float GetScheduledStepStartTime(int32 FloatIndex) const;
+
+	// 다음 라운드 시작까지 남은 시간 (마지막 라운드면 -1)
+	UFUNCTION(BlueprintPure, Category = "Stage|Schedule")
+	float GetSecondsUntilNextRound() const;
 	
 	FOnStageRuntimeChanged OnStageRuntimeChanged;
 	FOnGameStateTagChanged OnGameStateTagChanged;
@@ -379,6 +456,10 @@ protected:
 	UPROPERTY(ReplicatedUsing=OnRep_RoundsLayout, BlueprintReadOnly, Category = "Stage|Layout")
 	TArray<FGameplayTag> RoundMajorFlat;
 
+	// 접속 시 초기 번들로 한 번만 복제
+	UPROPERTY(ReplicatedUsing=OnRep_RoundsLayout, BlueprintReadOnly, Category = "Stage|Schedule")
+	TArray<FPCScheduledStep> RoundSchedule;
+
 	UFUNCTION()
 	void OnRep_RoundsLayout();
 
@@ -437,10 +518,14 @@ public:
 	FOnLeaderBoardReadyNative OnLeaderBoardReady;
 	FOnLeaderboardPlayerRankingChanged OnPlayerRankingChanged;
 	
-	// UI에 뿌릴 최종 배열
-	UPROPERTY(ReplicatedUsing=OnRep_LeaderBoard, BlueprintReadOnly, Category = "Ranking")
+	// UI에 뿌릴 최종 배열 (칸 순서), 클라는 LeaderboardRows 콜백으로 갱신
+	UPROPERTY(BlueprintReadOnly, Category = "Ranking")
 	TArray<FPlayerStandingRow> Leaderboard;
 
+	// 복제용 행 (키 = SeatIndex)
+	UPROPERTY(Replicated)
+	FPlayerStandingArray LeaderboardRows;
+
 	// LocalUserId -> 확정 최종 등수
 	UPROPERTY(BlueprintReadOnly, Category = "Ranking")
 	TMap<FString, int32> FinalRanks;
@@ -472,6 +557,11 @@ public:
 
 	void RebuildAndReplicatedLeaderboard();
 
+	// 클라 : FPlayerStandingArray 행 단위 콜백
+	void HandleLeaderboardRowChanged(const FPlayerStandingRow& Row);
+	void HandleLeaderboardRowRemoved(const FPlayerStandingRow& Row);
+	void HandleLeaderboardRowsReceived();
+
 protected:
 
 	virtual void RemovePlayerState(APlayerState* PlayerState) override;
@@ -491,10 +581,6 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Leaderboard")
 	void GetPlayerStatesOrdered();
 
-	// 위젯 갱신
-	UFUNCTION()
-	void OnRep_Leaderboard();
-	
 	FLeaderBoardMap CachedLeaderBoardMap;
 
 	UPROPERTY()
@@ -518,6 +604,10 @@ private:
 	TMap<FString, float> LastChangeTimeCache; // 마지막 HP 변경시간(서버)
 	TMap<FString, int32> StableOrderCache;    // 최초 관측 순서
 	TSet<FString>        EliminatedSet;       // 사망자 집합
+	TMap<FString, FGameplayTag> CharacterTagCache; // Player.Type 태그 (한 번만 조회)
+
+	/** 클라 : 이번 수신에서 칸이 바뀐 행이 있는지 */
+	bool bLeaderboardOrderDirty = false;
 	
 	int32 AliveCount = 0;
 	int32 StableOrderCounter = 0;
@@ -536,6 +626,10 @@ public:
 
 	UFUNCTION(NetMulticast, Unreliable)
 	void Multicast_DebugPrintToScreen(const TArray<FString>& Lines, float ScreenSeconds);
+
+	// 모든 플레이어 HP 를 1씩 바꾼 한 라운드 동안 리더보드 복제 바이트 측정 (전체 재작성 대비)
+	UFUNCTION(BlueprintCallable, Category="Rank|Debug")
+	void DebugMeasureLeaderboardReplication();
 	
 #pragma endregion Ranking
 
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "GameFramework/HelpActor/PCTileType.h"
+#include "Utility/PCHexGridLayout.h"
+#include "Utility/PCHexGridTopology.h"
 #include "PCTileManager.generated.h"
 
 struct FGameplayTag;
@@ -23,7 +25,8 @@ struct FTile
 	UPROPERTY(BlueprintReadWrite)
 	FVector Position = FVector::ZeroVector;
 	
-	UPROPERTY(BlueprintReadWrite)
+	// UPCTileManager 의 유닛 -> 타일 역인덱스와 같이 갱신되어야 하므로 쓰기는 PlaceUnitOnField / RemoveFromField 로만
+	UPROPERTY(BlueprintReadOnly)
 	APCBaseUnitCharacter* Unit = nullptr;
 
 	UPROPERTY(BlueprintReadWrite)
@@ -146,6 +149,10 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = "Field")
 	FVector GetTilePosition(int32 Y, int32 X) const { return GetTileWorldPosition(Y, X);}
+
+	// 월드 좌표 -> 가장 가까운 필드 타일 (MaxSnapDist 밖이면 false, 0 이하면 타일 폭의 0.6)
+	UFUNCTION(BlueprintCallable, Category = "Field")
+	bool WorldToTile(const FVector& World, int32& OutY, int32& OutX, float MaxSnapDist = 0.f) const;
 	
 	UFUNCTION(BlueprintPure, Category = "Bench")
 	int32 GetBenchIndex(bool bEnemySide, int32 LocalIndex) const;
@@ -186,6 +193,9 @@ public:
 	
 	UFUNCTION(BlueprintCallable, Category = "Util")
 	void ClearAll();
+
+	// 헥스 거리 / 이웃 / 링 테이블 (생성 시 1회 계산)
+	const FPCHexGridTopology& GetHexTopology() const { return HexTopology; }
 	
 	bool EnsureExclusive(APCBaseUnitCharacter* InUnit);
 	
@@ -201,6 +211,30 @@ public:
 private:
 	void CreateField(); // 필드 좌표 생성 (월드기준)
 
+	// Cols / Rows 가 에디터에서 바뀐 경우에만 다시 계산
+	void RebuildHexTopologyIfNeeded();
+
+	FPCHexGridTopology HexTopology;
+
+	// CreateField 시점의 필드 배치 (월드 기준, WorldToTile 용)
+	FPCHexGridLayout FieldLayout;
+
+	// 유닛 -> 타일 역인덱스 (Field 의 Unit / ReservedUnit 변경은 전부 아래 Set 함수를 거쳐야 동기화 유지)
+	struct FUnitTileSlots
+	{
+		TArray<int32, TInlineAllocator<2>> Occupied;
+		TArray<int32, TInlineAllocator<2>> Reserved;
+
+		bool IsEmpty() const { return Occupied.IsEmpty() && Reserved.IsEmpty(); }
+	};
+	
+	TMap<TObjectKey<APCBaseUnitCharacter>, FUnitTileSlots> UnitTileIndex;
+
+	void SetTileUnit(int32 Index, APCBaseUnitCharacter* NewUnit);
+	void SetTileReservation(int32 Index, APCBaseUnitCharacter* NewUnit);
+	int32 FindOccupiedIndex(const APCBaseUnitCharacter* InUnit) const;
+	void ValidateUnitIndexIfEnabled() const;
+
 	UPROPERTY()
 	TObjectPtr<APCCombatBoard> CachedCombatBoard;
 
@@ -239,6 +273,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Debug")
 	void DebugClearPersistent() const;
 
+	// 헥스 테이블을 BFS 결과와 전 타일 쌍 비교 (불일치 0 이면 true)
+	UFUNCTION(BlueprintCallable, Category="Debug")
+	bool DebugValidateHexTopology() const;
+
+	// 켜두면 타일 상태가 바뀔 때마다 유닛 역인덱스를 Field 전체 스캔 결과와 비교 (테스트용, Shipping 제외)
+	UPROPERTY(EditAnywhere, Category="Debug")
+	bool bDebugValidateUnitIndex = false;
+
+	// 유닛 역인덱스와 Field 전체 스캔 결과 비교 (일치하면 true)
+	UFUNCTION(BlueprintCallable, Category="Debug")
+	bool DebugValidateUnitIndex() const;
+
+	// 현재 필드 유닛 기준으로 역인덱스 조회와 기존 전체 스캔 조회 시간 비교 로그
+	UFUNCTION(BlueprintCallable, Category="Debug")
+	void DebugBenchmarkUnitLookup(int32 Iterations = 10000) const;
+
+	// 필드 범위를 SampleStep 간격으로 훑으며 WorldToTile 결과를 전체 타일 순회 결과와 비교 (불일치 0 이면 true)
+	UFUNCTION(BlueprintCallable, Category="Debug")
+	bool DebugValidateWorldToTile(float SampleStep = 10.f) const;
+
 #if WITH_EDITOR
 	// 디테일 패널에서 바로 실행(에디터/비PIE)
 	UFUNCTION(CallInEditor, Category="Debug")
@@ -10,6 +10,7 @@
 
 struct FPlayerBoardSnapshot;
 enum class ETileFacing : uint8;
+enum class EPCReplayPairKind : uint8;
 class APCPlayerBoard;
 class APCPlayerCharacter;
 class APCCombatPlayerController;
@@ -236,6 +237,14 @@ private:
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void BuildCloneForHost(int32 PairIndex, int32 DonorSeat);
 
+	// StartAllBattle 페어 준비 : 게임 스레드에서 보드 필드를 값으로 복사하고, 미러 / 배치 / 클론 배치 계획은 복사본만으로 페어별 태스크에서 계산
+	// 스냅샷 / 액터 이동 / 스폰 / 바인딩은 그 다음 게임 스레드에서 페어 순서대로 적용
+	struct FPairSetupPlan;
+	void CopyPairSetup(FPairSetupPlan& Plan) const;
+	void PlanPairSetup(FPairSetupPlan& Plan) const;
+	void CommitPairSetup(FPairSetupPlan& Plan);
+	void ApplyClonePlan(FPairSetupPlan& Plan);
+
 	// Clone 파괴 헬퍼
 	void DestroyCloneForPair(int32 PairIndex, bool bRemoveFromTM = true);
 
@@ -284,6 +293,12 @@ protected:
 	// StageOne/RoundOne(1-기준) 조회
 	bool GetCurrentStageRoundOne(int32& OutStageOne, int32& OutRoundOne) const;
 
+	// 페어 전투 보드의 난수 하위 채널을 (매치 시드, 라운드, 호스트 보드) 시드로 다시 시작
+	void BeginPairRandom(int32 PairIndex);
+
+	// 배치 + 바인딩이 끝난 페어의 리플레이 기록 시작 (서버, PC.Replay.Record)
+	void BeginPairReplay(int32 PairIndex, int32 GuestSeat, EPCReplayPairKind PairKind);
+
 	// ===== PvE 유틸 =====
 	static constexpr int32 CREEP_TEAM_BASE = 50;
 	static int32 GetCreepTeamIndexForBoard(const APCCombatBoard* Board) { return Board ? (Board->BoardSeatIndex + CREEP_TEAM_BASE) : CREEP_TEAM_BASE; }
@@ -6,6 +6,7 @@
 #include "GameFramework/Actor.h"
 #include "GameplayEffectTypes.h"        // FOnAttributeChangeData 선언
 #include "AbilitySystemComponent.h" 
+#include "Utility/PCHexGridLayout.h"
 #include "PCPlayerBoard.generated.h"
 
 class UNiagaraSystem;
@@ -157,6 +158,17 @@ protected:
 	UPROPERTY(ReplicatedUsing=OnRep_BenchLocs)
 	TArray<FVector_NetQuantize10> BenchLocs;
 
+	// 클라 호버용 점유 비트맵 (bit i = 필드 i, bit Rows*Cols + j = 벤치 j), 소유 클라에만 복제
+	UPROPERTY(Replicated)
+	uint64 OccupancyBits = 0;
+
+	// 같은 인덱스의 유닛 테이블
+	UPROPERTY(Replicated)
+	TArray<TObjectPtr<APCBaseUnitCharacter>> OccupantUnits;
+
+	void ResetOccupancy();
+	void UpdateOccupancy(int32 OccupancyIndex, APCBaseUnitCharacter* Unit);
+
 	UFUNCTION()
 	void OnRep_FieldLocs();
 
@@ -212,6 +224,15 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "LevelUp")
 	TArray<FGameplayTag> GetAllBenchUnitTag();
+
+	// 태그 인덱스와 필드/벤치 전체 스캔 결과 비교 (일치하면 true)
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	bool DebugValidateTagIndex() const;
+
+	// 현재 보드 유닛으로 무작위 배치/제거/교체를 NumOps 번 반복하며 매번 태그 인덱스 검증 후 원래 배치로 복구
+	// 슬롯 데이터만 바꾸고 액터는 움직이지 않음, 모두 일치하면 true
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	bool DebugFuzzTagIndex(int32 NumOps = 1000, int32 Seed = 0);
     // ─────────────────────────────────────────────────────────────
     // 2) 배치/이동 (플레이 중)
     UFUNCTION(BlueprintCallable, Category="PlayerBoard|Placement")
@@ -232,6 +253,18 @@ public:
     UFUNCTION(BlueprintCallable, Category="PlayerBoard|Placement")
     bool Swap(APCBaseUnitCharacter* A, APCBaseUnitCharacter* B);
 
+	// 슬롯의 유닛 교체는 반드시 이 함수로 (태그 인덱스 / 점유 비트맵 갱신)
+	void SetFieldTileUnit(int32 FieldIndex, APCBaseUnitCharacter* Unit);
+	void SetBenchTileUnit(int32 LocalBenchIndex, APCBaseUnitCharacter* Unit);
+
+	// 소유 클라 : 복제된 점유 정보로 타일 유닛 조회 (빈 타일이면 OutUnit = nullptr)
+	// 점유됐는데 유닛이 아직 복제되지 않았거나 비트맵 범위 밖이면 false -> 서버 질의로 대체
+	bool ResolveReplicatedOccupant(bool bIsField, int32 Y, int32 X, int32 LocalBenchIndex, APCBaseUnitCharacter*& OutUnit) const;
+
+	// 복제된 타일 월드 위치 (클라에서도 사용 가능, FieldIndex = IndexOf(Y, X))
+	bool GetFieldTileLocation(int32 FieldIndex, FVector& OutLocation) const;
+	bool GetBenchTileLocation(int32 LocalBenchIndex, FVector& OutLocation) const;
+
     // ─────────────────────────────────────────────────────────────
     // 3) 월드좌표 → 보드 타일/벤치 히트 (드래그&드랍 대체)
     UFUNCTION(BlueprintCallable, Category="PlayerBoard|HitTest")
@@ -245,6 +278,11 @@ public:
                       bool& bOutIsField, int32& OutY, int32& OutX, int32& OutLocalBenchIndex,
                       FVector& OutSnapPos, float MaxSnapField=0.f, float MaxSnapBench=0.f,
                       bool bRequireUnit=false) const;
+
+	// 필드 / 벤치 범위를 SampleStep 간격으로 훑으며 WorldToField / WorldToBench 결과를 전체 타일 순회 결과와 비교
+	// 불일치 0 이면 true, 두 방식의 소요 시간도 로그
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	bool DebugValidateWorldToTile(float SampleStep = 10.f) const;
 	
     // ─────────────────────────────────────────────────────────────
     // 4) 전투 연계: CombatBoard/TileManager와 동기화(필드만!)
@@ -358,6 +396,36 @@ protected:
 
 	// 가장 낮은 인덱스의 유닛이 들어있는 벤치 슬롯 찾기
 	int32 GetFirstOccupiedBenchIndex() const;
+
+private:
+	// 유닛 태그 -> 해당 유닛이 있는 필드 / 벤치 슬롯 (오름차순 유지, 결과 순서를 기존 스캔과 동일하게)
+	// 레벨은 보드 밖(LevelUp)에서 바뀌므로 조회 시 유닛에서 직접 읽음
+	struct FUnitTagSlots
+	{
+		TArray<int32, TInlineAllocator<4>> FieldSlots;
+		TArray<int32, TInlineAllocator<4>> BenchSlots;
+
+		bool IsEmpty() const { return FieldSlots.IsEmpty() && BenchSlots.IsEmpty(); }
+	};
+
+	TMap<FGameplayTag, FUnitTagSlots> UnitTagIndex;
+
+	// CreatePlayerField 와 WorldToField 가 공유하는 필드 배치 (보드 로컬 기준)
+	FPCHexGridLayout GetFieldLayout() const;
+
+	// 기본 스냅 거리 (MaxSnapDist 가 0 이하일 때)
+	float GetDefaultSnapDist() const { return (FieldTileWidthX > 0.f) ? (FieldTileWidthX * 0.6f) : 120.f; }
+
+	// 슬롯이 어떤 태그로 인덱싱 되어있는지 (유닛이 GC 된 뒤에도 정확히 빼기 위함)
+	TArray<FGameplayTag> FieldSlotTags;
+	TArray<FGameplayTag> BenchSlotTags;
+
+	// 필드 / 벤치 배열 전체 스캔으로 인덱스 재구성 (보드 생성 시)
+	void RebuildTagIndex();
+	void UpdateTagIndex(bool bIsField, int32 SlotIndex, APCBaseUnitCharacter* NewUnit);
+
+	// bIncludeField / bIncludeBench 범위에서 태그가 맞는 유닛 수집 (필드 -> 벤치, 슬롯 오름차순)
+	void CollectUnitsByTag(const FGameplayTag& UnitTag, int32 TeamSeat, bool bIncludeField, bool bIncludeBench, TArray<APCBaseUnitCharacter*>& Out) const;
 	
 	// //보드 사운드 관련
 	//
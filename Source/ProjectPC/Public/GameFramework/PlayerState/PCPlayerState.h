@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerState.h"
 #include "AbilitySystemInterface.h"
+#include "Shop/PCShopSlotRep.h"
 #include "Shop/PCShopUnitData.h"
 #include "GameplayTagContainer.h"
 #include "PCPlayerState.generated.h"
@@ -12,6 +13,7 @@
 struct FOnAttributeChangeData;
 DECLARE_MULTICAST_DELEGATE(FUnitDataInBoardUpdated);
 DECLARE_MULTICAST_DELEGATE(FOnShopSlotsUpdated);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnShopSlotChanged, int32 /*SlotIndex*/, bool /*bUnitChanged*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnWinningStreakUpdated, int32);
 
 class APCPlayerBoard;
@@ -124,24 +126,44 @@ public:
 #pragma region Shop
 
 private:
-	UPROPERTY(ReplicatedUsing = OnRep_ShopSlots)
-	TArray<FPCShopUnitData> ShopSlots;
+	// 복제용 칸 (소유 클라에만, 바뀐 칸만 전송)
+	UPROPERTY(Replicated)
+	FPCShopSlotArray ShopSlotArray;
 
-	UFUNCTION()
-	void OnRep_ShopSlots();
-	
-	UFUNCTION(Client, Reliable)
-	void Client_ForceShopSlotsUpdate();
+	// 칸 순서 캐시 (서버 / 소유 클라 모두 ShopSlotArray 기준으로 유지)
+	UPROPERTY()
+	TArray<FPCShopUnitData> ShopSlots;
 
-public:
 	UPROPERTY()
 	TSet<int32> PurchasedSlots;
-	
+
+	// 이번 갱신에서 바뀐 칸 (SlotIndex -> 유닛이 바뀌었는지)
+	TMap<int32, bool> PendingShopSlotChanges;
+	// 칸 개수가 바뀌어 전체 갱신이 필요한지
+	bool bShopSlotLayoutDirty = false;
+
+	void ApplyShopSlot(int32 SlotIndex, const FPCShopUnitData& UnitData, bool bPurchased);
+	void FlushShopSlotChanges();
+
+public:
+	// 전체 갱신 (칸 개수 변경 / 최초 수신)
 	FOnShopSlotsUpdated OnShopSlotsUpdated;
+	// 칸 단위 갱신
+	FOnShopSlotChanged OnShopSlotChanged;
 	
 	void SetShopSlots(const TArray<FPCShopUnitData>& NewSlots);
 	const TArray<FPCShopUnitData>& GetShopSlots();
 
+	// 서버 : 구매한 칸 표시 (리롤 시 초기화)
+	void MarkShopSlotPurchased(int32 SlotIndex);
+	bool IsShopSlotPurchased(int32 SlotIndex) const { return PurchasedSlots.Contains(SlotIndex); }
+	const TSet<int32>& GetPurchasedSlots() const { return PurchasedSlots; }
+
+	// 클라 : FPCShopSlotArray 콜백
+	void HandleShopSlotReplicated(const FPCShopSlotEntry& Entry);
+	void HandleShopSlotRemoved(const FPCShopSlotEntry& Entry);
+	void HandleShopSlotsReceived();
+
 	void ReturnAllUnitToShop();
 
 #pragma endregion Shop
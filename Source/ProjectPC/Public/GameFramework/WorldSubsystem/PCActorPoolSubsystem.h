@@ -0,0 +1,117 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PCActorPoolSubsystem.generated.h"
+
+USTRUCT(BlueprintType)
+struct FPCActorPoolConfig
+{
+	GENERATED_BODY()
+
+	// 등록 시 미리 생성해 둘 개수, 유휴 정리 시에도 이 개수까지는 남겨둠
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool")
+	int32 PrewarmCount = 0;
+
+	// 풀에 보관할 수 있는 최대 유휴 액터 수, 넘치게 반환되면 파괴 (0 이면 제한 없음)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool")
+	int32 MaxPooledCount = 0;
+
+	// 이 시간 이상 사용되지 않은 유휴 액터는 PrewarmCount 까지 정리 (0 이면 정리 안 함)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool")
+	float IdleTrimSeconds = 0.f;
+};
+
+USTRUCT(BlueprintType)
+struct FPCActorPoolStats
+{
+	GENERATED_BODY()
+
+	// 풀에서 꺼내 쓴 횟수
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool")
+	int64 Hits = 0;
+
+	// 풀이 비어서 새로 생성한 횟수
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool")
+	int64 Misses = 0;
+
+	// 상한 초과 / 유휴 정리로 파괴한 수
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool")
+	int64 Destroyed = 0;
+
+	// 현재 꺼내져서 사용 중인 수
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool")
+	int32 LiveCount = 0;
+
+	// LiveCount 최대치
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool")
+	int32 PeakCount = 0;
+
+	// 현재 풀에 보관 중인 유휴 액터 수
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool")
+	int32 PooledCount = 0;
+};
+
+/**
+ * 액터 클래스별 오브젝트 풀
+ * 활성화 / 비활성화 (보이기, 충돌, 타이머 등) 는 각 액터가 직접 처리하고, 여기서는 보관 / 생성 / 정리만 담당
+ */
+UCLASS()
+class PROJECTPC_API UPCActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// 풀 등록 (이미 있으면 설정만 갱신) 후 PrewarmCount 까지 미리 생성
+	void RegisterPool(UClass* ActorClass, const FPCActorPoolConfig& Config);
+
+	// 풀에서 꺼내거나 비어 있으면 새로 생성, 반환된 액터는 숨김 상태
+	// SpawnTransform 은 새로 생성할 때만 쓰이고, 재사용 액터의 위치는 호출부에서 설정
+	AActor* Acquire(UClass* ActorClass, const FTransform& SpawnTransform = FTransform::Identity);
+
+	template<typename T>
+	T* Acquire(TSubclassOf<T> ActorClass, const FTransform& SpawnTransform = FTransform::Identity)
+	{
+		return Cast<T>(Acquire(*ActorClass, SpawnTransform));
+	}
+
+	// 풀에 반환, 상한을 넘으면 파괴 (이미 반환된 액터는 무시)
+	void Release(AActor* Actor);
+
+	bool GetPoolStats(UClass* ActorClass, FPCActorPoolStats& OutStats) const;
+	
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	void LogPoolStats() const;
+
+private:
+	struct FPool
+	{
+		FString Name;
+		FPCActorPoolConfig Config;
+		FPCActorPoolStats Stats;
+
+		// 마지막에 반환된 액터부터 재사용 (LIFO)
+		TArray<TWeakObjectPtr<AActor>> FreeActors;
+		TArray<double> FreeSince;
+		
+		TSet<TObjectKey<AActor>> FreeSet;
+		TSet<TObjectKey<AActor>> LiveSet;
+	};
+
+	TMap<TObjectKey<UClass>, FPool> Pools;
+
+	FTimerHandle TrimTimerHandle;
+	
+	// 유휴 정리 주기 (초)
+	float TrimCheckInterval = 5.f;
+
+	AActor* SpawnPooledActor(UClass* ActorClass, const FTransform& SpawnTransform) const;
+	FPool& FindOrAddPool(UClass* ActorClass);
+	void PushFree(FPool& Pool, AActor* Actor);
+	void TrimIdle();
+	void EnsureTrimTimer();
+};
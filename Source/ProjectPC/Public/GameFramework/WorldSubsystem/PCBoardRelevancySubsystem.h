@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PCBoardRelevancySubsystem.generated.h"
+
+class UNetConnection;
+
+/**
+ * 보드 단위 Net Relevancy 정책 (서버)
+ * 유닛 / 발사체는 자기가 속한 보드를 보고 있는 연결과 소유 플레이어 연결에만 복제
+ * 전투 중에는 CombatManager 페어의 Guest 보드를 Host 보드 그룹으로 묶음
+ * PC.Net.BoardRelevancy 0 이면 기존 판정 사용
+ */
+UCLASS()
+class PROJECTPC_API UPCBoardRelevancySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static bool IsPolicyEnabled();
+
+	// 보드 단위로 판정했으면 true (결과는 bOutRelevant), 판정할 수 없으면 false -> 호출부에서 기본 판정 사용
+	// ActorBoardSeat : 액터가 속한 보드, OwnerSeat : 항상 복제할 소유 플레이어 Seat (없으면 INDEX_NONE)
+	static bool EvaluateRelevancy(const AActor* Actor, const AActor* RealViewer, int32 ActorBoardSeat, int32 OwnerSeat, bool& bOutRelevant);
+
+	// 전투 페어 연결 : Guest 보드에 속한 액터도 Host 보드를 보는 연결에 복제
+	void LinkBoards(int32 GuestSeat, int32 HostSeat);
+	void ResetBoardLinks();
+	int32 GetBoardGroup(int32 BoardSeat) const;
+
+	// 멀티 클라 PIE 에서 정책 Off / On 각각 SampleSeconds 동안 연결별 송신 바이트 측정 후 로그
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	void MeasureConnectionBandwidth(float SampleSeconds = 10.f);
+
+private:
+	// Seat -> 그룹 Seat (연결되지 않은 보드는 자기 자신)
+	TArray<int32> BoardGroupBySeat;
+
+	// 측정용
+	FTimerHandle MeasureTimerHandle;
+	TMap<TWeakObjectPtr<UNetConnection>, int64> MeasureStartBytes;
+	TMap<TWeakObjectPtr<UNetConnection>, double> MeasuredBytesPerSecondOff;
+	double MeasureStartTime = 0.0;
+	bool bPolicyBeforeMeasure = true;
+
+	void BeginMeasurePhase(bool bPolicyEnabled);
+	void EndMeasurePhase(bool bPolicyEnabled);
+};
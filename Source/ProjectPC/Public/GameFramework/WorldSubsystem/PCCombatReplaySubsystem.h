@@ -0,0 +1,88 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Simulation/PCCombatReplay.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "PCCombatReplaySubsystem.generated.h"
+
+class APCBaseUnitCharacter;
+class APCCombatBoard;
+class UAbilitySystemComponent;
+class UGameplayAbility;
+
+/**
+ * 전투 리플레이 기록 / 재생
+ * 서버 : CombatManager 가 페어 전투 시작 / 종료를 알리면 그 사이의 이동 / 어빌리티 / 데미지 / 사망을 기록,
+ *        종료 시 Saved/CombatReplays 에 라운드 + 페어 단위 파일로 저장 (PC.Replay.Record 1 일 때만, 최대 PC.Replay.MaxFiles 개 보관)
+ * 로컬 : PC.Replay.Play 로 파일을 읽어 전투 보드 위에 디버그 드로잉으로 재생 (유닛 액터 없이)
+ */
+UCLASS()
+class PROJECTPC_API UPCCombatReplaySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 기록 중인 서버 월드에서만 반환 (호출부는 null 이면 무시)
+	static UPCCombatReplaySubsystem* FindRecorder(const UObject* WorldContextObject);
+
+	// === 기록 (서버) ===
+	// 전투 보드에 배치가 끝난 뒤 호출, 보드 위 유닛이 스냅샷이 됨
+	void BeginPair(int32 PairIndex, const APCCombatBoard* HostBoard, int32 GuestSeat, EPCReplayPairKind PairKind, int32 StageOne, int32 RoundOne);
+	// 기록 중이 아니면 무시
+	void EndPair(int32 PairIndex, EPCReplayResult Result);
+	void EndAllPairs();
+
+	void RecordMove(const APCBaseUnitCharacter* Unit, int32 TileIndex);
+	void RecordDamage(const AActor* Source, const AActor* Target, float Damage, uint8 DamageFlags);
+	void RecordDeath(const APCBaseUnitCharacter* Unit);
+
+	// === 재생 (로컬) ===
+	// BoardSeat 가 INDEX_NONE 이면 리플레이의 Host 보드 위에 그림
+	bool PlayReplay(const FString& Path, float Speed = 1.f, int32 BoardSeat = INDEX_NONE, bool bLogEvents = false);
+	void StopReplay();
+
+	static FString GetReplayDirectory();
+
+private:
+	struct FRecording
+	{
+		FPCCombatReplay Replay;
+		double StartTime = 0.0;
+		TArray<TPair<TWeakObjectPtr<UAbilitySystemComponent>, FDelegateHandle>> AbilityBindings;
+	};
+
+	struct FUnitRoute
+	{
+		int32 PairIndex = INDEX_NONE;
+		uint16 UnitId = 0;
+	};
+
+	TMap<int32, FRecording> Recordings;
+	TMap<TObjectKey<AActor>, FUnitRoute> UnitRoutes;
+
+	FRecording* FindRecording(const AActor* Unit, uint16& OutUnitId);
+	void AddEvent(FRecording& Recording, FPCReplayEvent& Event) const;
+	void HandleAbilityActivated(UGameplayAbility* Ability);
+	void SaveRecording(FRecording& Recording) const;
+
+	struct FPlayback
+	{
+		TUniquePtr<FPCCombatReplay> Replay;
+		TUniquePtr<FPCCombatReplayPlayer> Player;
+		TWeakObjectPtr<const APCCombatBoard> Board;
+		float Speed = 1.f;
+		double TimeMs = 0.0;
+		bool bLogEvents = false;
+	};
+
+	TUniquePtr<FPlayback> Playback;
+
+	void DrawPlayback() const;
+};
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PCCombatSchedulerSubsystem.generated.h"
+
+// 등록한 주기 작업 식별용 핸들 (0 이면 무효)
+struct FPCCombatJobHandle
+{
+	uint32 Id = 0;
+
+	bool IsValid() const { return Id != 0; }
+	void Invalidate() { Id = 0; }
+};
+
+/**
+ * 유닛 주기 작업(패시브 펄스, 연사 등) 통합 스케줄러
+ * 작업마다 FTimerHandle 을 만드는 대신 월드 틱 한 번에 실행 시점이 된 작업들을 타입별로 모아 실행
+ * Owner 가 사라진 작업은 자동으로 정리
+ */
+UCLASS()
+class PROJECTPC_API UPCCombatSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// PhaseSeconds 후 첫 실행, 이후 PeriodSeconds 마다 반복 (JobType 은 통계 구분용)
+	FPCCombatJobHandle RegisterJob(FName JobType, const UObject* Owner, float PeriodSeconds, float PhaseSeconds,
+		TFunction<void()>&& Callback);
+
+	// 등록 해제 후 핸들 무효화 (실행 중인 작업 안에서 호출해도 안전)
+	void UnregisterJob(FPCCombatJobHandle& Handle);
+
+	bool IsJobActive(const FPCCombatJobHandle& Handle) const { return Handle.IsValid() && Jobs.Contains(Handle.Id); }
+	int32 GetNumActiveJobs() const { return Jobs.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	void LogSchedulerStats() const;
+
+private:
+	struct FJob
+	{
+		FName JobType;
+		TWeakObjectPtr<const UObject> Owner;
+		double PeriodSeconds = 0.0;
+		double NextRunTime = 0.0;
+		TFunction<void()> Callback;
+	};
+
+	// 실행 예정 시각 최소 힙 항목, 해제된 작업의 항목은 꺼낼 때 버림
+	struct FScheduleEntry
+	{
+		double RunTime = 0.0;
+		uint32 JobId = 0;
+
+		bool operator<(const FScheduleEntry& Other) const { return RunTime < Other.RunTime; }
+	};
+
+	struct FJobTypeStats
+	{
+		int64 TotalRuns = 0;
+		double TotalSeconds = 0.0;
+		double MaxFrameSeconds = 0.0;
+		int32 LastFrameRuns = 0;
+	};
+
+	// 콜백 실행 중 등록 / 해제로 맵이 재배치돼도 실행 중인 작업이 유지되도록 공유 포인터로 보관
+	TMap<uint32, TSharedPtr<FJob, ESPMode::NotThreadSafe>> Jobs;
+	TArray<FScheduleEntry> Schedule;
+	TMap<FName, FJobTypeStats> StatsByType;
+
+	// 이번 틱에 실행할 작업 (재할당 방지용 멤버)
+	TArray<TPair<FName, uint32>> DueJobs;
+
+	uint32 NextJobId = 1;
+	int32 PeakJobsPerFrame = 0;
+
+	double GetNow() const;
+};
@@ -58,8 +58,15 @@ protected:
 	UPROPERTY()
 	TMap<FGameplayTag, TObjectPtr<UTexture2D>> ItemTextureMap;
 
+	// 로드 중인 아이템 텍스처와 완료 시 호출할 콜백
+	TMap<FGameplayTag, TArray<TFunction<void(UTexture2D*)>>> PendingItemTextureCallbacks;
+
+	void PrefetchItemTextures();
+
 public:
+	// 로드된 텍스처만 리턴, 아직 로드 전이면 비동기 로드를 시작하고 nullptr
 	UTexture2D* GetItemTexture(const FGameplayTag& ItemTag);
+	void RequestItemTexture(const FGameplayTag& ItemTag, TFunction<void(UTexture2D*)>&& OnLoaded);
 
 #pragma region TemplateFunc
 
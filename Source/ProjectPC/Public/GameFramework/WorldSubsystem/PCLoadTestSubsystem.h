@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PCLoadTestSubsystem.generated.h"
+
+class APCCarouselRing;
+class APCCombatGameState;
+class APCCombatPlayerController;
+
+/**
+ * 봇 부하 테스트
+ * 서버 (-PCLoadTest=N) : N 명 접속을 기다려 매치 시작, 텔레메트리 캡처 (라운드별 서버 시간 / 송수신량 CSV), 루프백 봇 클라 N 개 실행
+ * 봇 클라 (-PCBot[=Name]) : 로컬 컨트롤러가 사람과 같은 서버 RPC 로 구매 / 리롤 / 레벨업 / 드래그 배치 / 아이템 장착 / 회전초밥 픽
+ * 예) 서버 : <Server> CombatMap -log -nullrhi -PCLoadTest=8
+ *     봇 실행 파일이 다르면 -PCBotExe=<경로>, 봇을 직접 띄우려면 -PCBotCount=0
+ * 서버가 띄운 봇 프로세스는 서버 월드 정리 시 종료, 봇은 접속이 끊기거나 자기 최종 등수가 정해지면 스스로 종료
+ * 개발 빌드 전용 (Shipping 에서는 생성되지 않고 커맨드라인도 읽지 않음)
+ */
+UCLASS()
+class PROJECTPC_API UPCLoadTestSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// -PCLoadTest=N (없으면 0)
+	static int32 GetLoadTestPlayerCount();
+
+	static bool IsBotClient();
+	// -PCBot=Name (이름이 없으면 Bot_<PID>)
+	static FString GetBotName();
+
+private:
+	void LaunchBotClients(int32 NumBots);
+	void TerminateBotClients();
+
+	// 봇 : 접속 실패 / 끊김 / 이동 실패 시 프로세스 종료 (프로세스당 한 번 바인딩)
+	static void BindBotExitOnNetworkFailure();
+	bool IsBotMatchOver(const APCCombatGameState* GS, const APCCombatPlayerController* PC) const;
+
+	void ThinkBot();
+	void MoveToCarousel(APCCombatPlayerController* PC);
+
+	bool TryPlaceUnit(APCCombatPlayerController* PC, int32 PlayerLevel);
+	bool TryEquipItem(APCCombatPlayerController* PC);
+	bool TryBuyUnit(APCCombatPlayerController* PC, int32 Gold);
+
+	// 서버가 실행한 봇 클라 프로세스
+	TArray<FProcHandle> BotProcesses;
+
+	bool bBot = false;
+	float NextThinkTime = 0.f;
+	// 매치 종료 후 프로세스 종료 시각 (0 이면 아직 진행 중)
+	float BotExitTime = 0.f;
+	int32 NextDragId = 1;
+	FRandomStream Random;
+
+	TWeakObjectPtr<APCCarouselRing> CarouselRing;
+
+	struct FBotStats
+	{
+		int32 Buys = 0;
+		int32 Rerolls = 0;
+		int32 BuyXPs = 0;
+		int32 Drags = 0;
+		int32 Equips = 0;
+		int32 CarouselPicks = 0;
+	};
+
+	FBotStats Stats;
+};
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Utility/PCRandomChannel.h"
+#include "PCMatchRandomSubsystem.generated.h"
+
+// 매치 난수 채널 이름
+// 채널마다 시드가 분리되어 있어서, 한 채널의 뽑기 횟수가 달라져도 다른 채널 결과에 영향 없음
+namespace PCRandomChannels
+{
+	inline const FName Shop(TEXT("Shop"));					// 상점 코스트 / 기물 뽑기
+	inline const FName Damage(TEXT("Damage"));				// 치명타, 회피, 평타 마나 회복 (전투 보드별 하위 채널)
+	inline const FName Pairing(TEXT("Pairing"));			// 대진 셔플, 클론 상대 선택
+	inline const FName ItemDrop(TEXT("ItemDrop"));			// 회전초밥 / 캡슐 아이템
+}
+
+/**
+ * 매치 단위 시드 고정 난수 서비스
+ * 매치 시드 하나로 모든 채널 시드를 결정 (-PCMatchSeed=N 으로 지정 가능)
+ * 시드 + 채널별 뽑기 횟수를 로그로 남겨두면 같은 매치를 그대로 재현할 수 있음
+ */
+UCLASS()
+class PROJECTPC_API UPCMatchRandomSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// 0 이면 커맨드라인 -> 무작위 순으로 시드 결정, 기존 채널은 모두 초기화
+	void InitializeMatchRandom(int32 InMatchSeed = 0);
+
+	int32 GetMatchSeed() const { return MatchSeed; }
+
+	// 채널이 없으면 매치 시드로부터 파생된 시드로 생성
+	// 새 채널이 추가되면 참조가 무효화될 수 있으니 보관하지 말고 바로 사용
+	const FPCRandomChannel& GetChannel(FName ChannelName);
+
+	// 서브시스템이 없는 월드 (에디터 프리뷰 등) 에서는 nullptr, 호출부는 FMath 로 대체
+	static const FPCRandomChannel* FindChannel(const UObject* WorldContextObject, FName ChannelName);
+
+	// 전투 보드(페어) 별 하위 채널
+	// 동시에 진행되는 페어끼리 뽑기 순서가 섞여도, 각 페어 결과는 매치 시드 + 라운드 + 보드만으로 재현 가능
+	// 페어 전투 시작 시 호출, 해당 보드의 하위 채널을 이번 라운드 시드로 다시 시작
+	void BeginBoardRound(int32 BoardSeat, int32 StageIdx, int32 RoundIdx);
+
+	const FPCRandomChannel& GetBoardChannel(FName ChannelName, int32 BoardSeat);
+
+	// BoardSeat 가 없으면 (INDEX_NONE) 매치 공용 채널
+	static const FPCRandomChannel* FindBoardChannel(const UObject* WorldContextObject, FName ChannelName, int32 BoardSeat);
+
+	// 유닛이 서 있는 전투 보드의 하위 채널
+	static const FPCRandomChannel* FindUnitBoardChannel(const AActor* UnitActor, FName ChannelName);
+
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	void LogRandomState() const;
+
+private:
+	static int32 MakeChannelSeed(int32 InMatchSeed, FName ChannelName);
+	int32 MakeBoardChannelSeed(FName ChannelName, int32 BoardSeat) const;
+
+	int32 MatchSeed = 0;
+	TMap<FName, FPCRandomChannel> Channels;
+
+	// (채널, 보드 시트) -> 하위 채널, 보드 시트 -> 라운드 키
+	TMap<TPair<FName, int32>, FPCRandomChannel> BoardChannels;
+	TMap<int32, int32> BoardRoundKeys;
+};
@@ -20,4 +20,12 @@ public:
 
 	UPROPERTY(EditAnywhere, Category = "ObjectPool")
 	int32 InitialReserveSize = 500;
+
+	// 풀에 보관할 최대 유휴 발사체 수 (0 이면 제한 없음)
+	UPROPERTY(EditAnywhere, Category = "ObjectPool")
+	int32 MaxPooledCount = 1000;
+
+	// 이 시간 이상 쓰이지 않은 발사체는 InitialReserveSize 까지 정리 (0 이면 정리 안 함)
+	UPROPERTY(EditAnywhere, Category = "ObjectPool")
+	float IdleTrimSeconds = 60.f;
 };
@@ -23,7 +23,8 @@ protected:
 	UPROPERTY()
 	FPCProjectilePoolData ProjectilePoolData;
 
-	TQueue<APCBaseProjectile*> ProjectilePool;
+	// 풀에서 꺼내기 (서버 전용), 활성화는 호출부에서 ActiveProjectile 로 처리
+	APCBaseProjectile* AcquireProjectile(const AActor* SpawnActor, const AActor* TargetActor) const;
 	
 public:
 	UFUNCTION()
@@ -31,10 +32,18 @@ public:
 
 	// 유닛 to 유닛
 	APCBaseProjectile* SpawnProjectile(const FTransform& SpawnTransform, FGameplayTag CharacterTag, FGameplayTag AttackTypeTag, const AActor* SpawnActor, const AActor* TargetActor);
+	// 유닛 to 유닛 (경량 시뮬레이션이 켜져 있으면 OutSimProjectileId 로 반환, 꺼져 있거나 실패하면 액터 발사체)
+	APCBaseProjectile* SpawnUnitProjectile(const FTransform& SpawnTransform, FGameplayTag CharacterTag, FGameplayTag AttackTypeTag, const AActor* SpawnActor, const AActor* TargetActor, uint32& OutSimProjectileId);
 	// 유닛 to 플레이어
 	APCBaseProjectile* SpawnProjectile(const FTransform& SpawnTransform, const AActor* SpawnActor, const AActor* TargetActor);
 	// 플레이어 to 플레이어
 	APCBaseProjectile* SpawnProjectile(const FTransform& SpawnTransform, FGameplayTag CharacterTag, const AActor* SpawnActor, const AActor* TargetActor);
 	// 발사체 오브젝트 풀에 반환
 	void ReturnProjectile(APCBaseProjectile* ReturnedProjectile);
+
+	// 풀에서 꺼내져 날아가는 중인 액터 발사체 수 (서버, 경량 시뮬레이션 발사체는 제외)
+	int32 GetNumActiveProjectiles() const;
+
+	// 발사체 클래스 CDO 기준 데이터 조회 (클라에서도 사용)
+	const FPCProjectileData* FindProjectileData(FGameplayTag CharacterTag, FGameplayTag AttackTypeTag) const;
 };
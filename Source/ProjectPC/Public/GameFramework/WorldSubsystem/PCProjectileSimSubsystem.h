@@ -0,0 +1,137 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Character/Projectile/PCProjectileSimReplicator.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PCProjectileSimSubsystem.generated.h"
+
+class UPCEffectSpec;
+class UParticleSystem;
+class UParticleSystemComponent;
+class UStaticMeshComponent;
+struct FPCProjectileData;
+
+// 경량 발사체 시각 효과 슬롯 (메시 + 트레일), 재사용
+USTRUCT()
+struct FPCSimProjectileVisual
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UStaticMeshComponent> Mesh = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UParticleSystemComponent> Trail = nullptr;
+};
+
+/**
+ * 액터 없이 구조체로 시뮬레이션하는 유닛 to 유닛 발사체
+ * 서버는 이동 / 유닛 캡슐 판정 / 이펙트 적용을 직접 처리하고 생성 / 피격 이벤트만 복제
+ * 클라는 생성 이벤트로 같은 궤적을 예측해서 그림
+ * 이벤트는 발사한 유닛의 보드별 Replicator 로 보내서 그 보드를 보는 연결에만 전달 (PC.Net.BoardRelevancy)
+ * PC.Projectile.Simulated 0 이면 기존 APCBaseProjectile 액터 경로 사용 (A/B 프로파일링용)
+ */
+UCLASS()
+class PROJECTPC_API UPCProjectileSimSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static bool IsSimulationEnabled();
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 서버 전용, 발사체 데이터가 없으면 0 리턴 (호출부에서 액터 경로로 대체)
+	uint32 SpawnProjectile(const FTransform& SpawnTransform, FGameplayTag CharacterTag, FGameplayTag AttackTypeTag,
+		const AActor* SpawnActor, const AActor* TargetActor);
+
+	// 피격 시 적용할 이펙트 (APCBaseProjectile::SetEffectSpecs 와 동일)
+	void SetEffectSpecs(uint32 ProjectileId, const TArray<UPCEffectSpec*>& InEffectSpecs);
+
+	int32 GetNumActiveProjectiles() const { return Projectiles.Num(); }
+
+	// 클라 : 서버 이벤트 수신
+	void HandleSpawnEvents(const TArray<FPCProjectileSpawnEvent>& Events);
+	void HandleImpactEvents(const TArray<FPCProjectileImpactEvent>& Events);
+
+private:
+	struct FSimProjectile
+	{
+		uint32 Id = 0;
+		FVector Location = FVector::ZeroVector;
+		FVector Velocity = FVector::ZeroVector;
+		float Speed = 0.f;
+		float RemainingLifeTime = 0.f;
+		bool bIsHoming = true;
+		bool bIsPenetrating = false;
+
+		TWeakObjectPtr<const AActor> Source;
+		TWeakObjectPtr<const AActor> Target;
+		TArray<TWeakObjectPtr<UPCEffectSpec>> EffectSpecs;
+
+		// 관통 발사체 중복 피격 방지
+		TArray<TWeakObjectPtr<const AActor>, TInlineAllocator<4>> HitActors;
+
+		UParticleSystem* HitEffect = nullptr;
+		int32 VisualIndex = INDEX_NONE;
+
+		// 이벤트를 보낼 보드 Seat (INDEX_NONE 이면 전체)
+		int32 BoardSeatIndex = INDEX_NONE;
+	};
+
+	struct FPendingEvents
+	{
+		TArray<FPCProjectileSpawnEvent> SpawnEvents;
+		TArray<FPCProjectileImpactEvent> ImpactEvents;
+	};
+
+	TArray<FSimProjectile> Projectiles;
+	uint32 NextProjectileId = 1;
+
+	UPROPERTY()
+	TArray<FPCSimProjectileVisual> Visuals;
+	TArray<int32> FreeVisualIndices;
+
+	// 보드 Seat -> Replicator
+	UPROPERTY()
+	TMap<int32, TObjectPtr<APCProjectileSimReplicator>> Replicators;
+
+	TMap<int32, FPendingEvents> PendingEventsBySeat;
+
+	// 비유도 발사체 판정 후보 (재할당 방지용 멤버)
+	TArray<TWeakObjectPtr<class APCBaseUnitCharacter>> CandidateUnits;
+
+	// 발사체 판정 반경 (유닛 캡슐 반경에 더해짐)
+	float CollisionRadius = 10.f;
+	// 유도 가속도 (UProjectileMovementComponent 설정과 동일)
+	float HomingAcceleration = 15000.f;
+
+	bool IsServer() const;
+	bool ShouldDrawVisuals() const;
+	const FPCProjectileData* FindProjectileData(FGameplayTag CharacterTag, FGameplayTag AttackTypeTag) const;
+
+	FSimProjectile& AddProjectile(uint32 Id, const FVector& Location, const FVector& Direction, const AActor* Target,
+		const FPCProjectileData& Data);
+	void RemoveProjectileAt(int32 Index);
+
+	void StepProjectile(FSimProjectile& Projectile, float DeltaTime, FVector& OutPrevLocation) const;
+	bool SweepUnit(const FVector& Start, const FVector& End, const AActor* Unit) const;
+
+	// 서버 : 피격 판정 후 이펙트 적용, 제거해야 하면 true
+	bool ProcessServerHits(FSimProjectile& Projectile, const FVector& PrevLocation);
+	void ApplyHit(FSimProjectile& Projectile, const AActor* HitActor);
+
+	void PlayHitEffect(const UParticleSystem* HitEffect, const AActor* HitActor) const;
+
+	int32 AcquireVisual(const FPCProjectileData& Data, const FVector& Location, const FVector& Direction);
+	void ReleaseVisual(int32 VisualIndex);
+	void UpdateVisual(const FSimProjectile& Projectile) const;
+
+	APCProjectileSimReplicator* GetOrCreateReplicator(int32 BoardSeatIndex);
+	void FlushEvents();
+};
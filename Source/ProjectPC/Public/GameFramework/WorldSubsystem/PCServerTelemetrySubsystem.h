@@ -0,0 +1,142 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "PCServerTelemetrySubsystem.generated.h"
+
+class APlayerController;
+
+// 계측 구간 (중첩 호출은 가장 바깥 호출만 측정, 구간끼리는 포함 관계일 수 있음 - 예: StartAllBattle 안의 UnitSpawn)
+enum class EPCTelemetryPhase : uint8
+{
+	StartAllBattle,
+	// StartAllBattle 안의 페어 준비 : 계획 (태스크 대기 포함 전체) / 페어별 적용
+	PairSetupPlan,
+	PairSetupCommit,
+	FinishAllBattle,
+	BTTask,
+	ShopRefresh,
+	SynergyRecompute,
+	LeaderboardRebuild,
+	UnitSpawn,
+	Num
+};
+
+/**
+ * 서버 성능 텔레메트리
+ * 캡처 중에는 프레임마다 구간별 시간 / 호출 수, 살아있는 유닛 / 투사체 수, 연결별 서버 RPC 수를 CSV 로 기록
+ * 라운드가 바뀔 때마다 라운드 요약 (서버 전체 송수신량 포함) 과 연결별 요약을 별도 CSV 에 기록
+ * 파일 : Saved/Profiling/PCTelemetry/<Name>_<Time>_{Frames,Rounds,Connections}.csv
+ * 시작 / 종료 : PC.Telemetry.Start [Name], PC.Telemetry.Stop 또는 커맨드라인 -PCTelemetry[=Name] (-nullrhi 데디 서버용)
+ */
+UCLASS()
+class PROJECTPC_API UPCServerTelemetrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 캡처 중인 월드에서만 반환 (캡처가 하나도 없으면 월드 조회 없이 null)
+	static UPCServerTelemetrySubsystem* FindActive(const UObject* WorldContextObject);
+
+	bool StartCapture(const FString& Name);
+	void StopCapture();
+	bool IsCapturing() const { return FrameWriter.IsValid(); }
+
+	void BeginPhase(EPCTelemetryPhase Phase);
+	void EndPhase(EPCTelemetryPhase Phase);
+
+	void NoteServerRpc(const APlayerController* Controller);
+
+	static const TCHAR* GetPhaseName(EPCTelemetryPhase Phase);
+
+private:
+	static constexpr int32 NumPhases = static_cast<int32>(EPCTelemetryPhase::Num);
+
+	struct FPhaseStats
+	{
+		int32 Depth = 0;
+		uint64 StartCycles = 0;
+
+		uint64 FrameCycles = 0;
+		int32 FrameCalls = 0;
+
+		double RoundMs = 0.0;
+		double RoundMaxFrameMs = 0.0;
+		int64 RoundCalls = 0;
+	};
+
+	struct FConnectionStats
+	{
+		FString Label;
+		int32 FrameRpcs = 0;
+		int64 RoundRpcs = 0;
+		int32 RoundPeakFrameRpcs = 0;
+	};
+
+	FPhaseStats Phases[NumPhases];
+	TMap<TObjectKey<APlayerController>, FConnectionStats> Connections;
+
+	TUniquePtr<FArchive> FrameWriter;
+	TUniquePtr<FArchive> RoundWriter;
+	TUniquePtr<FArchive> ConnectionWriter;
+
+	FString CaptureName;
+	int64 CaptureFrames = 0;
+	uint64 LastTickCycles = 0;
+
+	// 라운드 요약
+	int32 RoundStage = 0;
+	int32 RoundIndex = 0;
+	double RoundStartTime = 0.0;
+	int64 RoundFrames = 0;
+	double RoundFrameMsSum = 0.0;
+	double RoundFrameMsMax = 0.0;
+	int32 RoundPeakUnits = 0;
+	int32 RoundPeakProjectiles = 0;
+	// 넷 드라이버 초당 송수신량을 프레임 시간으로 적분한 값
+	double RoundInBytes = 0.0;
+	double RoundOutBytes = 0.0;
+	uint32 RoundPeakOutBytesPerSec = 0;
+
+	void CountLiveActors(int32& OutLiveUnits, int32& OutPooledUnits, int32& OutProjectiles) const;
+	void WriteRoundRows();
+	void ResetRound(int32 Stage, int32 Round);
+
+	static void WriteLine(FArchive& Writer, const FString& Line);
+};
+
+// 스코프 동안의 시간을 Phase 에 누적 (캡처 중이 아니면 아무것도 안 함)
+struct FPCTelemetryScope
+{
+	FPCTelemetryScope(const UObject* WorldContextObject, EPCTelemetryPhase InPhase)
+		: Telemetry(UPCServerTelemetrySubsystem::FindActive(WorldContextObject))
+		, Phase(InPhase)
+	{
+		if (Telemetry)
+		{
+			Telemetry->BeginPhase(Phase);
+		}
+	}
+
+	~FPCTelemetryScope()
+	{
+		if (Telemetry)
+		{
+			Telemetry->EndPhase(Phase);
+		}
+	}
+
+	UE_NONCOPYABLE(FPCTelemetryScope);
+
+private:
+	UPCServerTelemetrySubsystem* Telemetry;
+	EPCTelemetryPhase Phase;
+};
@@ -5,14 +5,46 @@
 #include "CoreMinimal.h"
 #include "DynamicUIActor/PCUnitCombatTextActor.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UI/Unit/PCUnitCombatText.h"
 #include "PCUnitCombatTextSpawnSubsystem.generated.h"
 
 class APCUnitCombatTextActor;
+class PCSUnitCombatTextLayer;
+
+enum class EPCCombatTextStyle : uint8
+{
+	Damage,
+	Critical,
+	Heal,
+	Miss,
+	Num
+};
+
+// 일괄 렌더러가 그리는 전투 텍스트 하나
+struct FPCCombatTextEntry
+{
+	FVector WorldLocation = FVector::ZeroVector;
+	FString Text;
+	FLinearColor Color = FLinearColor::White;
+	EPCCombatTextStyle Style = EPCCombatTextStyle::Damage;
+	// 생성 시 한 번만 측정 (가운데 정렬용)
+	FVector2f TextSize = FVector2f::ZeroVector;
+	float Age = 0.f;
+	// 스타일 애니메이션 길이
+	float Lifetime = 1.f;
+
+	// Tick 에서 매 프레임 갱신 (뷰포트 픽셀 좌표)
+	FVector2f ScreenPosition = FVector2f::ZeroVector;
+	bool bOnScreen = false;
+};
+
 /**
- * 
+ * 전투 텍스트 (피해 / 회복 / 치명타 / 빗나감)
+ * 기본은 일괄 렌더러 : 살아있는 텍스트를 배열 하나로 관리하고, 뷰포트에 붙인 Slate 레이어 하나가 같은 레이어 / 폰트로 한 번에 그림
+ * PC.CombatText.Batched 0 이면 이전처럼 풀링된 APCUnitCombatTextActor (위젯 컴포넌트) 를 숫자마다 하나씩 사용
  */
 UCLASS()
-class PROJECTPC_API UPCUnitCombatTextSpawnSubsystem : public UWorldSubsystem
+class PROJECTPC_API UPCUnitCombatTextSpawnSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -22,19 +54,77 @@ private:
 
 	int32 PrewarmCount = 20;
 
+	// 동시에 떠 있는 텍스트가 몰렸다가 빠진 뒤 남는 유휴 액터 상한 / 정리 시간
+	int32 MaxPooledCount = 100;
+	float IdleTrimSeconds = 30.f;
+
+	// 일괄 렌더러 동시 표시 상한 (넘치면 새 텍스트를 버림)
+	int32 MaxBatchedTexts = 1024;
+
 public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
 	void InitCombatTextSpawnSubsystem(const TSoftClassPtr<APCUnitCombatTextActor>& InDamageTextActorClass);
-	
+
 	UFUNCTION()
 	void SpawnCombatText(
 		const USceneComponent* AttachToComp,
 		const FCombatTextInitParams& InitParams);
 
+	// AnchorLocation = 부착 소켓 위치 (오프셋 / 흔들림 적용 전)
+	void SpawnCombatTextAt(const FVector& AnchorLocation, const FCombatTextInitParams& InitParams);
+
 	void ReturnToPool(APCUnitCombatTextActor* CombatTextActor);
-	
+
+	const TArray<FPCCombatTextEntry>& GetBatchedTexts() const { return BatchedTexts; }
+	const FSlateFontInfo& GetStyleFont(EPCCombatTextStyle Style) const { return StyleFonts[static_cast<int32>(Style)]; }
+	const FPCCombatTextMotion& GetStyleMotion(EPCCombatTextStyle Style) const { return StyleMotions[static_cast<int32>(Style)]; }
+
+	// 콘솔 : PC.CombatText.Stress [PerSecond] [Seconds]
+	// 초당 PerSecond 개씩 무작위 전투 텍스트를 띄우고, 끝나면 클라 프레임 시간을 로그로 출력
+	void StartStress(float PerSecond, float Seconds);
+	void StopStress();
+
 private:
-	TQueue<APCUnitCombatTextActor*> CombatTextPool;
-	
 	APCUnitCombatTextActor* GetCombatTextActor();
-	APCUnitCombatTextActor* SpawnNewCombatTextActor() const;
+
+	const UPCUnitCombatText* GetCombatTextWidgetCDO() const;
+	bool EnsureTextLayer();
+	void CacheWidgetStyle();
+	void AddBatchedText(const FVector& AnchorLocation, const FCombatTextInitParams& InitParams);
+	void TickStress(float DeltaTime);
+
+	TArray<FPCCombatTextEntry> BatchedTexts;
+	TSharedPtr<PCSUnitCombatTextLayer> TextLayer;
+
+	// 위젯 블루프린트의 글자 색 (없으면 UPCUnitCombatText 기본값)
+	FLinearColor PhysicalDamageColor = FLinearColor::Red;
+	FLinearColor MagicDamageColor = FLinearColor::Blue;
+	FLinearColor TrueDamageColor = FLinearColor::White;
+	FLinearColor HealColor = FLinearColor::Green;
+	FLinearColor MissColor = FLinearColor::Gray;
+
+	// 위젯 블루프린트의 ValueText 폰트 (타입별 글자 크기 적용) / DamageAnim, HealAnim 샘플
+	FSlateFontInfo StyleFonts[static_cast<int32>(EPCCombatTextStyle::Num)];
+	FPCCombatTextMotion StyleMotions[static_cast<int32>(EPCCombatTextStyle::Num)];
+
+	struct FStressState
+	{
+		float PerSecond = 0.f;
+		float Remaining = 0.f;
+		float Duration = 0.f;
+		float Accumulator = 0.f;
+		int32 Emitted = 0;
+		int32 Frames = 0;
+		double FrameMsSum = 0.0;
+		float FrameMsMax = 0.f;
+		int32 PeakLive = 0;
+		TArray<FVector> Anchors;
+		FRandomStream Random;
+	};
+
+	FStressState Stress;
+	bool bStressActive = false;
 };
@@ -6,6 +6,7 @@
 #include "GameplayTagContainer.h"
 #include "DataAsset/Unit/PCDataAsset_UnitDefinition.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Engine/StreamableManager.h"
 #include "PCUnitSpawnSubsystem.generated.h"
 
 /**
@@ -28,9 +29,33 @@ class APCAppearanceChangedHeroCharacter;
 class APCCreepUnitCharacter;
 class UPCDataAsset_UnitDefinitionReg;
 class USoundBase;
+class APCBaseUnitCharacter;
+class AController;
 
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnUnitSpawnedNative, APCBaseUnitCharacter*, int32 );
 
+USTRUCT()
+struct FPCPooledUnitEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<APCBaseUnitCharacter> Unit = nullptr;
+
+	// 반납 시 UnPossess한 AI 컨트롤러, 재사용 시 다시 Possess
+	UPROPERTY()
+	TObjectPtr<AController> Controller = nullptr;
+};
+
+USTRUCT()
+struct FPCPooledUnitList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FPCPooledUnitEntry> Entries;
+};
+
 UCLASS()
 class PROJECTPC_API UPCUnitSpawnSubsystem : public UWorldSubsystem
 {
@@ -63,9 +88,29 @@ private:
 	TSubclassOf<APCUnitAIController> DefaultAIControllerClass;
 
 public:
+	// SpawnConfig의 클래스/에셋을 비동기 로드, 완료 여부는 IsSpawnConfigLoaded()로 확인
 	void InitializeUnitSpawnConfig(const FSpawnSubsystemConfig& SpawnConfig);
 	void EnsureConfigFromGameState();
 
+	// 로딩 단계 배리어: 요청한 SpawnConfig 에셋이 모두 로드되어 적용되었는지
+	bool IsSpawnConfigLoaded() const { return bSpawnConfigRequested && PendingSpawnConfigLoads == 0; }
+	
+	// 비동기 로드가 끝나지 않았는데 즉시 필요할 때 (클라 OnRep 등) 블로킹으로 완료
+	void WaitForSpawnConfig();
+
+private:
+	bool bSpawnConfigRequested = false;
+	int32 PendingSpawnConfigLoads = 0;
+	double SpawnConfigRequestSeconds = 0.0;
+	
+	TArray<TSharedPtr<FStreamableHandle>> SpawnConfigLoadHandles;
+	TArray<TPair<FSoftObjectPath, TFunction<void(UObject*)>>> SpawnConfigAssigners;
+
+	void RequestSpawnConfigAsset(const FSoftObjectPath& Path, TFunction<void(UObject*)>&& Assign);
+	void ApplyLoadedSpawnConfig();
+
+public:
+
 	void PreloadAllHeroUnit(const FVector& SpawnLocation) const;
 
 private:
@@ -95,6 +140,10 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category="Spawner")
 	APCBaseUnitCharacter* SpawnCloneUnitBySourceUnit(const APCBaseUnitCharacter* SourceUnit);
+
+	// 유닛을 파괴하는 대신 UnitTag별 풀로 반납 (풀이 가득 차면 Destroy)
+	UFUNCTION(BlueprintCallable, Category="Spawner")
+	void ReleaseUnit(APCBaseUnitCharacter* Unit);
 	
 	const UPCDataAsset_UnitDefinition* ResolveDefinition(const FGameplayTag& UnitTag) const;
 	void ApplyDefinitionDataVisuals(APCBaseUnitCharacter* Unit, const UPCDataAsset_UnitDefinition* Definition) const;
@@ -106,6 +155,48 @@ private:
 	void ApplyDefinitionData(APCBaseUnitCharacter* Unit, const UPCDataAsset_UnitDefinition* Definition) const;
 	void ApplyDefinitionDataServerOnly(APCBaseUnitCharacter* Unit, const UPCDataAsset_UnitDefinition* Definition) const;
 
+	// Unit Pool
+private:
+	static constexpr int32 MaxPooledUnitsPerTag = 16;
+	
+	UPROPERTY()
+	TMap<FGameplayTag, FPCPooledUnitList> PooledUnitsByTag;
+
+	int32 UnitPoolHits = 0;
+	int32 UnitPoolMisses = 0;
+	int32 UnitPoolReleased = 0;
+	int32 UnitPoolDestroyed = 0;
+	
+	APCBaseUnitCharacter* SpawnNewUnit(
+		const UPCDataAsset_UnitDefinition* Definition,
+		const FGameplayTag& UnitTag,
+		const int32 TeamIndex,
+		const int32 UnitLevel,
+		APCPlayerState* InOwnerPS,
+		AActor* InOwner,
+		APawn* InInstigator,
+		ESpawnActorCollisionHandlingMethod HandlingMethod);
+	
+	APCBaseUnitCharacter* AcquirePooledUnit(
+		const FGameplayTag& UnitTag,
+		const int32 TeamIndex,
+		const int32 UnitLevel,
+		APCPlayerState* InOwnerPS,
+		AActor* InOwner,
+		APawn* InInstigator);
+
+public:
+	UFUNCTION(BlueprintCallable, Category="Debug")
+	void LogUnitPoolStats() const;
+	
+	// 풀에서 재사용된 유닛이 신규 스폰 유닛과 같은 상태인지 검증 (서버)
+	UFUNCTION(BlueprintCallable, Category="Debug")
+	bool DebugValidatePooledUnitReset(FGameplayTag UnitTag, int32 UnitLevel, FGameplayTag ItemTag);
+
+	// 이 월드의 모든 유닛이 풀 플래그에 맞는 로컬 표시 상태인지 검증, 불일치 유닛 수 반환 (클라에서도 실행 가능)
+	UFUNCTION(BlueprintCallable, Category="Debug")
+	int32 DebugValidatePoolLocalState() const;
+
 private:
 	UPROPERTY()
 	TSubclassOf<APCPreviewHeroActor> DefaultPreviewHeroClass;
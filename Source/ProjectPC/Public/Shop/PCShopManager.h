@@ -5,12 +5,15 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Shop/PCShopUnitData.h"
+#include "Shop/PCShopUnitPool.h"
 #include "Shop/PCShopUnitProbabilityData.h"
 #include "Shop/PCShopUnitSellingPriceData.h"
+#include "Utility/PCRandomChannel.h"
 #include "PCShopManager.generated.h"
 
 class APCCombatBoard;
 class APCCombatGameState;
+class APCBaseUnitCharacter;
 class APCHeroUnitCharacter;
 class APCPlayerState;
 
@@ -25,6 +28,9 @@ class PROJECTPC_API UPCShopManager : public UActorComponent
 public:
 	UPCShopManager();
 
+	// DataTable 을 읽어 코스트별 재고 / 태그 맵 / 펜윅 트리 구성 (BeginPlay 에서 호출, 다시 호출하면 재고를 DataTable 값으로 초기화)
+	void InitializeShopData(UDataTable* InUnitDataTable, UDataTable* InProbabilityDataTable, UDataTable* InSellingPriceDataTable);
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -45,6 +51,7 @@ public:
 	// 유닛 구매
 	void BuyUnit(APCPlayerState* TargetPlayer, int32 SlotIndex, FGameplayTag UnitTag);
 	TMap<int32, int32> GetLevelUpUnitMap(const APCPlayerState* TargetPlayer, FGameplayTag UnitTag, int32 ShopAddUnitCount) const;
+	static TMap<int32, int32> BuildLevelUpUnitMap(const TArray<APCBaseUnitCharacter*>& UnitList, int32 ShopAddUnitCount);
 	int32 GetRequiredCountWithFullBench(const APCPlayerState* TargetPlayer, FGameplayTag UnitTag, int32 ShopAddUnitCount) const;
 	void UnitLevelUp(const APCPlayerState* TargetPlayer, FGameplayTag UnitTag, int32 ShopAddUnitCount);
 
@@ -53,6 +60,10 @@ public:
 
 	// 유닛 코스트에 따른 랜덤한 유닛 선택
 	FPCShopUnitData& SelectRandomUnitByCost(int32 UnitCost);
+
+	// 상점 한 칸 뽑기 (레벨별 코스트 확률 -> 코스트 풀에서 남은 수 가중치), 재고는 바꾸지 않음
+	// 뽑은 코스트 풀의 인덱스 반환, 코스트 선택 실패 / 품절이면 INDEX_NONE
+	int32 DrawShopUnitIndex(int32 PlayerLevel, const FPCRandomChannel& Random, int32& OutCost);
 	
 	// 기물 반환
 	void ReturnUnitToShopByTag(FGameplayTag UnitTag);
@@ -88,6 +99,18 @@ protected:
 	TArray<FPCShopUnitData> ShopUnitDataList_Cost4;
 	TArray<FPCShopUnitData> ShopUnitDataList_Cost5;
 
+	// 코스트별 남은 기물 수 펜윅 트리, ShopUnitDataList_CostN 과 같은 인덱스를 사용
+	// UnitCount 는 반드시 AddShopUnitCount 로만 바꿔서 두 쪽이 어긋나지 않도록 함
+	static constexpr int32 NumUnitCosts = 5;
+	FPCShopUnitPool ShopUnitPools[NumUnitCosts];
+
+	// 유닛 태그 -> 코스트 / 코스트별 배열 인덱스
+	TMap<FGameplayTag, int32> ShopUnitCostByTag;
+	TMap<FGameplayTag, int32> ShopUnitIndexByTag;
+
+	FPCShopUnitPool* GetShopUnitPoolByCost(int32 UnitCost);
+	void AddShopUnitCount(FGameplayTag UnitTag, int32 Delta);
+
 public:
 	// Getter
 	const TArray<FPCShopUnitData>& GetShopUnitDataList();
@@ -103,6 +126,15 @@ public:
 	int32 GetSellingPrice(int32 UnitCost, int32 UnitLevel);
 	
 #pragma endregion Data
+
+#pragma region Debug
+
+public:
+	// 상점 새로고침 (5칸 뽑고 반환) 을 반복해서 펜윅 트리 방식과 기존 선형 누적합 방식 시간 비교 로그
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	void DebugBenchmarkShopRefresh(int32 PlayerLevel, int32 NumRefreshes = 100000);
+
+#pragma endregion Debug
 	
 #pragma region TemplateFunc
 	
@@ -149,11 +181,17 @@ private:
 		}
 	}
 	
-	// 누적합을 통한 확률 구현
+	// 상점 난수 채널 (매치 시드 기반), 서브시스템이 없으면 nullptr
+	const FPCRandomChannel* GetShopRandomChannel() const;
+
+	// 풀에서 가중치 뽑기 (Random 이 없으면 FMath 사용), 비어 있으면 INDEX_NONE
+	static int32 DrawFromPool(const FPCShopUnitPool& Pool, const FPCRandomChannel* Random);
+	
+	// 누적합을 통한 확률 구현 (코스트 선택처럼 항목 수가 적은 경우에 사용)
 	template<typename T>
-	const T& WeightedRandomSelect(const TArray<T>& Items, T MinValue, T MaxValue, int32& Index)
+	const T& WeightedRandomSelect(const TArray<T>& Items, T MinValue, T MaxValue, int32& Index, const FPCRandomChannel* Random)
 	{
-		T RandomValue = FMath::RandRange(MinValue, MaxValue);
+		T RandomValue = Random ? Random->RandRange(MinValue, MaxValue) : FMath::RandRange(MinValue, MaxValue);
 		T PrefixSum = MinValue;
 
 		for (const auto& Item : Items)
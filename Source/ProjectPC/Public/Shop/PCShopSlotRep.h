@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Shop/PCShopUnitData.h"
+
+#include "PCShopSlotRep.generated.h"
+
+class APCPlayerState;
+struct FPCShopSlotArray;
+
+/**
+ * 상점 칸 하나 (키 = SlotIndex)
+ * 리롤은 유닛이 바뀐 칸만, 구매는 해당 칸의 bPurchased 만 Dirty
+ */
+USTRUCT()
+struct FPCShopSlotEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 SlotIndex = INDEX_NONE;
+
+	UPROPERTY()
+	FPCShopUnitData UnitData;
+
+	UPROPERTY()
+	bool bPurchased = false;
+
+	void PreReplicatedRemove(const FPCShopSlotArray& InArraySerializer);
+	void PostReplicatedAdd(const FPCShopSlotArray& InArraySerializer);
+	void PostReplicatedChange(const FPCShopSlotArray& InArraySerializer);
+};
+
+USTRUCT()
+struct FPCShopSlotArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FPCShopSlotEntry> Entries;
+
+	// 클라 콜백 전달 대상
+	APCPlayerState* OwnerPlayerState = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
+	{
+		return FastArrayDeltaSerialize<FPCShopSlotEntry, FPCShopSlotArray>(Entries, DeltaParams, *this);
+	}
+
+	// 서버 : 값이 다르면 Dirty 후 true
+	bool SetSlot(int32 SlotIndex, const FPCShopUnitData& UnitData, bool bPurchased);
+	bool SetPurchased(int32 SlotIndex, bool bPurchased);
+	// 서버 : NumSlots 이상 칸 제거
+	void Trim(int32 NumSlots);
+
+	// 클라 : 한 번의 수신에서 바뀐 칸을 모두 적용한 뒤 호출
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+private:
+	FPCShopSlotEntry* FindSlot(int32 SlotIndex);
+};
+
+template<> struct TStructOpsTypeTraits<FPCShopSlotArray> : public TStructOpsTypeTraitsBase2<FPCShopSlotArray>
+{
+	enum { WithNetDeltaSerializer = true };
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPCShopUnitData;
+
+// 코스트별 남은 기물 수에 대한 펜윅 트리 (Binary Indexed Tree)
+// 인덱스는 UPCShopManager 의 ShopUnitDataList_CostN 배열 인덱스와 동일
+// 구매 / 판매 / 반환 시 Add 로 O(log N) 갱신, 가중치 뽑기도 O(log N)
+struct PROJECTPC_API FPCShopUnitPool
+{
+	// 현재 UnitCount 기준으로 트리 재구성
+	void Build(const TArray<FPCShopUnitData>& Units);
+
+	void Add(int32 Index, int32 Delta);
+
+	int32 Num() const { return Tree.Num() - 1; }
+	int32 GetTotal() const { return Total; }
+
+	// Weight 는 [0, Total) 범위, 누적합이 Weight 를 처음 넘는 인덱스 반환 (비어 있으면 INDEX_NONE)
+	int32 FindIndexByWeight(int32 Weight) const;
+
+	// [0, Index] 누적합
+	int32 GetPrefixSum(int32 Index) const;
+
+private:
+	// 1-based, Tree[0] 은 사용하지 않음
+	TArray<int32> Tree;
+	int32 Total = 0;
+	int32 TopBit = 0;
+};
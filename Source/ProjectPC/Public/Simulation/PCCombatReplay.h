@@ -0,0 +1,174 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+// 전투 리플레이 (한 라운드, 페어 하나)
+// 서버의 UPCCombatReplaySubsystem 이 기록하고, FPCCombatReplayPlayer 가 로그만으로 전투 상태를 재구성
+// 파일 = Magic + Version + 본문 크기 + Zlib(본문), 본문의 정수는 전부 가변 길이 (SerializeIntPacked)
+
+enum class EPCReplayPairKind : uint8
+{
+	PvP,
+	Clone,
+	PvE,
+};
+
+enum class EPCReplayResult : uint8
+{
+	None,		// 라운드 종료 시점까지 판정 없음
+	HostWon,
+	GuestWon,
+	Draw,
+};
+
+enum class EPCReplayEventType : uint8
+{
+	Move,		// Value = 타일 인덱스 (UPCTileManager::IndexOf)
+	Ability,	// Value = Names 인덱스 (어빌리티 클래스 이름)
+	Damage,		// Value = 피해량 * 10, Target = 피격 유닛, Flags = EPCReplayDamageFlags
+	Death,
+};
+
+namespace EPCReplayDamageFlags
+{
+	inline constexpr uint8 Critical   = 1 << 0;
+	inline constexpr uint8 Evaded     = 1 << 1;
+	inline constexpr uint8 Physical   = 1 << 2;
+	inline constexpr uint8 Magic      = 1 << 3;
+	inline constexpr uint8 TrueDamage = 1 << 4;
+}
+
+// 기록 시작 시점 난수 채널 상태 (시드 + 그때까지 뽑은 횟수)
+struct FPCReplaySeed
+{
+	int32 NameIndex = 0;
+	int32 Seed = 0;
+	int64 DrawCount = 0;
+
+	bool operator==(const FPCReplaySeed& Other) const { return NameIndex == Other.NameIndex && Seed == Other.Seed && DrawCount == Other.DrawCount; }
+};
+
+// 전투 시작 스냅샷의 유닛 하나 (리플레이 안의 UnitId = 배열 인덱스)
+struct FPCReplayUnit
+{
+	int32 TagNameIndex = 0;
+	int32 Level = 1;
+	int32 Team = INDEX_NONE;
+	int32 TileIndex = INDEX_NONE;
+	// 0.1 단위로 저장
+	float MaxHealth = 0.f;
+	float Health = 0.f;
+
+	bool operator==(const FPCReplayUnit& Other) const;
+};
+
+struct FPCReplayEvent
+{
+	uint32 TimeMs = 0;
+	EPCReplayEventType Type = EPCReplayEventType::Move;
+	uint8 Flags = 0;
+	uint16 Unit = 0;
+	uint16 Target = 0;
+	uint32 Value = 0;
+
+	bool operator==(const FPCReplayEvent& Other) const
+	{
+		return TimeMs == Other.TimeMs && Type == Other.Type && Flags == Other.Flags && Unit == Other.Unit && Target == Other.Target && Value == Other.Value;
+	}
+};
+
+struct PROJECTPC_API FPCCombatReplay
+{
+	static constexpr uint32 Magic = 0x50435250; // 'PCRP'
+	static constexpr uint16 CurrentVersion = 1;
+
+	int32 MatchSeed = 0;
+	int32 StageOne = 0;
+	int32 RoundOne = 0;
+	int32 HostSeat = INDEX_NONE;
+	int32 GuestSeat = INDEX_NONE;
+	EPCReplayPairKind PairKind = EPCReplayPairKind::PvP;
+	EPCReplayResult Result = EPCReplayResult::None;
+	uint32 DurationMs = 0;
+
+	// 전투 필드 크기 (타일 인덱스 해석용)
+	int32 Cols = 0;
+	int32 Rows = 0;
+
+	// 유닛 태그 / 어빌리티 / 난수 채널 이름 테이블 (이벤트에는 인덱스만 저장)
+	TArray<FName> Names;
+	TArray<FPCReplaySeed> Seeds;
+	TArray<FPCReplayUnit> Units;
+	// TimeMs 오름차순
+	TArray<FPCReplayEvent> Events;
+
+	int32 FindOrAddName(FName Name);
+	FName GetName(int32 NameIndex) const { return Names.IsValidIndex(NameIndex) ? Names[NameIndex] : NAME_None; }
+
+	// 본문만 (압축 / 헤더 제외)
+	void SerializeBody(FArchive& Ar);
+
+	// 헤더 + 압축 본문
+	bool SaveToBytes(TArray<uint8>& OutBytes) const;
+	bool LoadFromBytes(const TArray<uint8>& Bytes);
+
+	bool SaveToFile(const FString& Path) const;
+	bool LoadFromFile(const FString& Path);
+
+	bool operator==(const FPCCombatReplay& Other) const;
+
+	// 무작위 리플레이를 저장 / 로드 후 원본과 비교하고, 재생 결과도 비교 (일치하면 true)
+	static bool DebugRoundTrip(int32 NumUnits, int32 NumEvents, int32 Seed);
+};
+
+/**
+ * 리플레이 재생기
+ * 스냅샷에서 시작해 이벤트를 시간순으로 적용, 유닛별 타일 / 체력 / 생존 / 통계를 재구성
+ * 회복은 기록하지 않으므로 체력은 시작 체력 - 누적 피해
+ */
+class PROJECTPC_API FPCCombatReplayPlayer
+{
+public:
+	struct FUnitState
+	{
+		int32 TileIndex = INDEX_NONE;
+		float Health = 0.f;
+		bool bAlive = true;
+		int32 NumMoves = 0;
+		int32 NumAbilities = 0;
+		float DamageDealt = 0.f;
+		float DamageTaken = 0.f;
+
+		bool operator==(const FUnitState& Other) const;
+	};
+
+	explicit FPCCombatReplayPlayer(const FPCCombatReplay& InReplay);
+
+	void Reset();
+
+	// TimeMs 까지의 이벤트 적용 (되감기 없음), 적용한 이벤트 수 반환
+	int32 AdvanceTo(uint32 TimeMs);
+	void AdvanceToEnd() { AdvanceTo(MAX_uint32); }
+
+	bool IsFinished() const { return NextEvent >= Replay.Events.Num(); }
+	int32 GetNextEventIndex() const { return NextEvent; }
+	uint32 GetCurrentTimeMs() const { return CurrentTimeMs; }
+	const FPCCombatReplay& GetReplay() const { return Replay; }
+	const TArray<FUnitState>& GetUnitStates() const { return UnitStates; }
+
+	// 유닛 표시 이름 (태그#UnitId)
+	FString GetUnitLabel(int32 UnitId) const;
+	FString DescribeEvent(const FPCReplayEvent& Event) const;
+
+	// 헤더 + 유닛별 현재 상태 로그
+	void LogState() const;
+
+private:
+	void ApplyEvent(const FPCReplayEvent& Event);
+
+	const FPCCombatReplay& Replay;
+	TArray<FUnitState> UnitStates;
+	int32 NextEvent = 0;
+	uint32 CurrentTimeMs = 0;
+};
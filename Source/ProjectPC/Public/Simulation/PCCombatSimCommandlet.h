@@ -0,0 +1,34 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PCCombatSimCommandlet.generated.h"
+
+class UPCDataAsset_UnitDefinitionReg;
+struct FPCSimBoardDesc;
+
+/**
+ * 헤드리스 전투 시뮬레이션 배치 실행
+ *
+ * UnrealEditor-Cmd ProjectPC -run=PCCombatSim -nullrhi
+ *   -Registry=/Game/.../DA_UnitDefinitionReg.DA_UnitDefinitionReg
+ *   -Matchups=<matchup.csv> -Output=<result.csv> [-Runs=100] [-Seed=1] [-MaxDuration=60]
+ *
+ * Matchup 파일 한 줄 : Name,HostBoard,GuestBoard  ('#' 으로 시작하면 주석)
+ * Board 형식 : UnitTag:Level@Y:X;UnitTag:Level@Y:X;...  (플레이어 보드 좌표, Y = Col, X = Row)
+ */
+UCLASS()
+class PROJECTPC_API UPCCombatSimCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPCCombatSimCommandlet();
+	
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	bool ParseBoard(const FString& BoardString, const UPCDataAsset_UnitDefinitionReg* Registry, FPCSimBoardDesc& OutBoard) const;
+};
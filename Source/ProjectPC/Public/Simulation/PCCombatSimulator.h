@@ -0,0 +1,148 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "GameplayTagContainer.h"
+#include "Utility/PCHexGridTopology.h"
+#include "Utility/PCRandomChannel.h"
+
+struct FBoardFieldSnapShot;
+class UAbilitySystemComponent;
+
+// 헤드리스 전투 시뮬레이터
+// Pawn / NavMesh / Animation / BT 없이 두 보드의 전투를 끝까지 진행
+// 그리드 규칙은 UPCTileManager (FPCHexGridTopology), 스탯은 UPCUnitAttributeSet / UPCHeroUnitAttributeSet,
+// 데미지는 UPCUnitDamageExec 와 같은 PCUnitDamageFormula 를 사용
+
+// 시뮬레이션용 유닛 스탯 (AttributeSet 값 그대로, 퍼센트 단위 동일)
+struct PROJECTPC_API FPCSimUnitStats
+{
+	float MaxHealth = 0.f;
+	float BaseDamage = 0.f;
+	float AttackRange = 1.f;
+	float AttackSpeed = 1.f;
+	float AttackSpeedIncreaseMultiplier = 0.f;
+	float AttackSpeedDecreaseMultiplier = 0.f;
+	float PhysicalDefense = 0.f;
+	float MagicDefense = 0.f;
+	float FlatDamageBlock = 0.f;
+	float EvasionChance = 0.f;
+
+	// Hero 전용
+	float MaxMana = 0.f;
+	float CombatStartMana = 0.f;
+	float ManaRegen = 0.f;
+	float UltimateDamage = 0.f;
+	float UltimateCost = 0.f;
+	float PhysicalDamageMultiplier = 0.f;
+	float MagicDamageMultiplier = 0.f;
+	float DamageMultiplier = 0.f;
+	float CritChance = 0.f;
+	float CritMultiplier = 0.f;
+	float LifeSteal = 0.f;
+
+	bool bIsHero = false;
+
+	// UPCDataAsset_BaseUnitData::FillInitStatMap 결과 적용
+	void ApplyStatMap(const TMap<FGameplayAttribute, float>& StatMap);
+
+	// 살아있는 유닛 ASC 의 현재 값 복사
+	void ReadFromAbilitySystem(const UAbilitySystemComponent* ASC);
+	
+	float GetEffectiveAttackSpeed() const;
+	float GetUltimateManaCost() const;
+};
+
+struct PROJECTPC_API FPCSimUnitDesc
+{
+	FGameplayTag UnitTag;
+	int32 UnitLevel = 1;
+
+	// 플레이어 보드 기준 좌표 (X = Row, Y = Col), 게스트는 시뮬레이터가 미러링
+	FIntPoint GridPoint = FIntPoint::NoneValue;
+	
+	FPCSimUnitStats Stats;
+};
+
+struct PROJECTPC_API FPCSimBoardDesc
+{
+	TArray<FPCSimUnitDesc> Units;
+
+	// 전투 시작 시 CombatManager 가 찍는 스냅샷에서 생성 (유닛 ASC 값 사용)
+	static FPCSimBoardDesc FromSnapShot(const FBoardFieldSnapShot& SnapShot);
+};
+
+struct PROJECTPC_API FPCSimConfig
+{
+	// 기본값은 UPCTileManager CDO 의 Cols / Rows 로 채움
+	int32 Cols = 8;
+	int32 Rows = 7;
+	
+	float TickInterval = 0.05f;
+	float MaxDuration = 60.f;
+
+	// 한 타일 이동에 걸리는 시간 (이동 애니메이션 대체)
+	float MoveTimePerTile = 0.5f;
+
+	// PCEffectSpec_BasicAttackManaGain 규칙 (1레벨 6~10 랜덤, 2레벨 이상 고정)
+	int32 LevelOneManaGainMin = 6;
+	int32 LevelOneManaGainMax = 10;
+	float ManaGainPerBasicAttack = 10.f;
+
+	static FPCSimConfig MakeDefault();
+};
+
+struct PROJECTPC_API FPCSimResult
+{
+	// 0 = Host, 1 = Guest, INDEX_NONE = 시간 초과 무승부
+	int32 WinnerTeam = INDEX_NONE;
+	float Duration = 0.f;
+	int32 HostAlive = 0;
+	int32 GuestAlive = 0;
+	int32 Ticks = 0;
+	float HostDamageDealt = 0.f;
+	float GuestDamageDealt = 0.f;
+};
+
+class PROJECTPC_API FPCCombatSimulator
+{
+public:
+	explicit FPCCombatSimulator(const FPCSimConfig& InConfig = FPCSimConfig::MakeDefault());
+
+	// 같은 입력 + 같은 Seed 면 항상 같은 결과
+	FPCSimResult Run(const FPCSimBoardDesc& Host, const FPCSimBoardDesc& Guest, int32 Seed) const;
+
+	const FPCSimConfig& GetConfig() const { return Config; }
+	
+private:
+	struct FSimUnit
+	{
+		const FPCSimUnitDesc* Desc = nullptr;
+		int32 Team = 0;
+		int32 TileIndex = INDEX_NONE;
+		float Health = 0.f;
+		float Mana = 0.f;
+		float AttackTimer = 0.f;
+		float MoveTimer = 0.f;
+		bool bAlive = true;
+	};
+
+	struct FSimState
+	{
+		TArray<FSimUnit> Units;
+		TArray<int32> TileOwner;
+		FPCRandomChannel Stream;
+		FPCSimResult Result;
+	};
+
+	void PlaceBoard(FSimState& State, const FPCSimBoardDesc& Board, int32 Team) const;
+	void TickUnit(FSimState& State, int32 UnitIndex) const;
+	int32 FindTargetInRange(const FSimState& State, const FSimUnit& Unit) const;
+	bool TryApproach(FSimState& State, FSimUnit& Unit) const;
+	void Attack(FSimState& State, FSimUnit& Attacker, FSimUnit& Target) const;
+	void ApplyDamage(FSimState& State, FSimUnit& Attacker, FSimUnit& Target, float BaseDamage, bool bIsBasic, bool bIsPhysical) const;
+	void CountAlive(const FSimState& State, int32& OutHost, int32& OutGuest) const;
+	
+	FPCSimConfig Config;
+	FPCHexGridTopology Topology;
+};
@@ -118,6 +118,8 @@ protected:
 public:
 	UFUNCTION()
 	void SetupShopSlots();
+	// 바뀐 칸만 갱신 (유닛이 그대로면 숨김 여부만 반영)
+	void RefreshShopSlot(int32 SlotIndex, bool bUnitChanged);
 	UFUNCTION()
 	void SetupPlayerInfo();
 	
@@ -34,6 +34,10 @@ public:
 	UFUNCTION()
 	void CopyVariantBySourceStatusBar(const UPCHeroStatusBarWidget* SourceStatusBar) const;
 
+	// 현재 표시 중인 레벨 변형 (1 ~), 스위처가 없으면 0
+	int32 GetActiveLevel() const;
+	FORCEINLINE const UAbilitySystemComponent* GetBoundASC() const { return ASC.Get(); }
+
 protected:
 	UPROPERTY(meta=(BindWidget))
 	TObjectPtr<UWidgetSwitcher> StatusSwitcher;
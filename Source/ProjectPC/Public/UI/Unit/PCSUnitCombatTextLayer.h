@@ -0,0 +1,24 @@
+#pragma once
+#include "Widgets/SLeafWidget.h"
+
+class UPCUnitCombatTextSpawnSubsystem;
+
+// 전투 텍스트 일괄 렌더러
+// 뷰포트 전체를 덮는 레이어 하나가 UPCUnitCombatTextSpawnSubsystem 의 텍스트를 모두 같은 레이어에 그려 Slate 가 한 배치로 묶음
+class PCSUnitCombatTextLayer : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(PCSUnitCombatTextLayer) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, UPCUnitCombatTextSpawnSubsystem* InOwner);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
+		const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
+		const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override { return FVector2D::ZeroVector; }
+
+private:
+	TWeakObjectPtr<UPCUnitCombatTextSpawnSubsystem> Owner;
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include "Widgets/Notifications/SProgressBar.h"
+#include "Rendering/RenderingCommon.h"
 
 struct FUnitTickStyle
 {
@@ -30,8 +31,41 @@ public:
 		const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
 		const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
 
+	// 콘솔 : PC.UI.BenchmarkHealthBars [NumBars] [Frames]
+	static void DebugBenchmark(int32 NumBars, int32 NumFrames);
+
 private:
 	TAttribute<TOptional<float>> PercentAttr;
 	TAttribute<float> MaxValueAttr;
 	FUnitTickStyle TickStyle;
+	uint32 TickStyleVersion = 0;
+
+	// 눈금 하나 (로컬 좌표, 패딩 포함)
+	struct FCachedTick
+	{
+		float Left = 0.f;
+		float Right = 0.f;
+		bool bMajor = false;
+	};
+
+	// 최대 체력 / 위젯 크기 / 스타일이 바뀔 때만 다시 만드는 눈금 지오메트리
+	// 최대 체력 기준 눈금을 전부 만들어 두고, 그리기는 현재 체력 이하의 앞쪽 눈금만
+	struct FTickCache
+	{
+		float MaxValue = -1.f;
+		FVector2f Size = FVector2f(-1.f, -1.f);
+		uint32 StyleVersion = MAX_uint32;
+		float Top = 0.f;
+		float Bottom = 0.f;
+		TArray<FCachedTick> Ticks;
+	};
+
+	mutable FTickCache TickCache;
+	// 그리기용 임시 버퍼 (매 프레임 재할당 방지)
+	mutable TArray<FSlateVertex> TickVertices;
+	mutable TArray<SlateIndex> TickIndices;
+
+	void UpdateTickCache(float MaxV, const FVector2f& Size) const;
+	void PaintTicksBatched(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 Layer, const FLinearColor& ParentTint, int32 NumLines) const;
+	void PaintTicksPerLine(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 Layer, const FLinearColor& ParentTint, float MaxV, int32 NumLines) const;
 };
\ No newline at end of file
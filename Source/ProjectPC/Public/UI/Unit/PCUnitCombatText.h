@@ -13,8 +13,27 @@
 
 class UImage;
 class UTextBlock;
+class UWidgetAnimation;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCombatTextFinished);
 
+// 위젯 애니메이션 한 시점의 값 (ValueText 와 그 부모 위젯에 걸린 트랙을 합친 값)
+struct FPCCombatTextMotionSample
+{
+	FVector2f Translation = FVector2f::ZeroVector;
+	FVector2f Scale = FVector2f::UnitVector;
+	float Opacity = 1.f;
+};
+
+// 일괄 렌더러가 재생하는 위젯 애니메이션 (0 ~ Duration 을 같은 간격으로 샘플링)
+struct FPCCombatTextMotion
+{
+	float Duration = 0.8f;
+	TArray<FPCCombatTextMotionSample> Samples;
+
+	// 샘플이 없으면 (애니메이션 없음) 위로 떠오르며 사라지는 기본 움직임
+	FPCCombatTextMotionSample Evaluate(float Time) const;
+};
+
 UCLASS()
 class PROJECTPC_API UPCUnitCombatText : public UUserWidget
 {
@@ -36,6 +55,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category="DamageText")
 	void NotifyFinished() const { OnFinished.Broadcast(); }
 
+	// 타입 태그별 글자 색 (일괄 렌더러가 위젯 클래스 CDO 에서 읽어 감)
+	FLinearColor GetTypeColor(const FGameplayTag& CombatTextTypeTag) const;
+
+	// 아래 둘은 일괄 렌더러가 위젯 클래스 CDO 에서 호출
+	// CDO 에는 위젯 트리 / 애니메이션이 바인딩되지 않으므로 위젯 블루프린트 생성 클래스의 아키타입을 읽음
+	bool GetTemplateValueFont(FSlateFontInfo& OutFont) const;
+	bool SampleTemplateAnimation(bool bHeal, int32 NumSamples, FPCCombatTextMotion& OutMotion) const;
+
+	// 타입별 ValueText 글자 크기
+	static constexpr float DamageFontSize = 19.f;
+	static constexpr float HealFontSize = 13.f;
+	static constexpr float MissFontSize = 15.f;
+
 protected:
 	UPROPERTY(meta=(BindWidget))
 	TObjectPtr<UImage> CriticalImage = nullptr;
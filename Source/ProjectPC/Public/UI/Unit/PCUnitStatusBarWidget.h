@@ -87,6 +87,9 @@ private:
 	TArray<TObjectPtr<UImage>> EquipItemImages;
 
 	FDelegateHandle EquipItemChangedHandle;
+
+	// 비동기 텍스처 로드 콜백이 오래된 아이템 목록으로 덮어쓰지 않도록 갱신마다 증가
+	mutable int32 EquipItemImagesRevision = 0;
 	
 	void OnHealthChanged(const FOnAttributeChangeData& Data);
 	void OnMaxHealthChanged(const FOnAttributeChangeData& Data);
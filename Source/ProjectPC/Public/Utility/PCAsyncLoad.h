@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+namespace PCAsyncLoad
+{
+	// 에셋 하나를 비동기 로드하고 완료 시 로드 시간을 로그로 남김
+	// 이미 메모리에 있으면 즉시 OnLoaded 호출 후 nullptr 리턴 (핸들 없음)
+	inline TSharedPtr<FStreamableHandle> RequestAsyncLoad(const FSoftObjectPath& Path, const TCHAR* Context, TFunction<void(UObject*)>&& OnLoaded)
+	{
+		if (Path.IsNull())
+		{
+			OnLoaded(nullptr);
+			return nullptr;
+		}
+
+		if (UObject* Loaded = Path.ResolveObject())
+		{
+			OnLoaded(Loaded);
+			return nullptr;
+		}
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		FString ContextString(Context);
+
+		return UAssetManager::GetStreamableManager().RequestAsyncLoad(Path,
+			[Path, ContextString, StartSeconds, OnLoaded = MoveTemp(OnLoaded)]()
+			{
+				UObject* Loaded = Path.ResolveObject();
+				const double ElapsedMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+				if (Loaded)
+				{
+					UE_LOG(LogTemp, Log, TEXT("[AsyncLoad] %s : %s loaded in %.2f ms"), *ContextString, *Path.ToString(), ElapsedMs);
+				}
+				else
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[AsyncLoad] %s : %s failed after %.2f ms"), *ContextString, *Path.ToString(), ElapsedMs);
+				}
+
+				OnLoaded(Loaded);
+			});
+	}
+}
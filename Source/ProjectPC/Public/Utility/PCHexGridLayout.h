@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// 헥스 필드 배치 (APCPlayerBoard::CreatePlayerField / UPCTileManager::CreateField 와 같은 식)
+// 타일 중심 : X = Col * 1.5R, Y = (RowLocal + 홀수 열 시프트) * sqrt(3)R  (R = TileWidthX / 2)
+// 좌표 -> 타일 변환을 전체 타일 순회 없이 후보 열만 확인해서 계산
+struct FPCHexGridLayout
+{
+	int32 Cols = 0;
+	int32 Rows = 0;
+	float TileWidthX = 0.f;
+	bool bRowZeroAtBottom = true;
+	float OddColumRowShift = 0.f;
+
+	// 0열 0행 타일 중심 (보드 로컬 또는 월드, 호출부 기준과 동일해야 함)
+	FVector2D Origin = FVector2D::ZeroVector;
+
+	float GetColumnStep() const { return 0.75f * TileWidthX; }
+	float GetRowStep() const { return FMath::Sqrt(3.f) * 0.5f * TileWidthX; }
+
+	FVector2D GetTileCenter(int32 Col, int32 Row) const
+	{
+		const int32 RowLocal = bRowZeroAtBottom ? Row : (Rows - 1 - Row);
+		return Origin + FVector2D(Col * GetColumnStep(), (RowLocal + ((Col & 1) ? OddColumRowShift : 0.f)) * GetRowStep());
+	}
+
+	// Point 에서 가장 가까운 타일 (MaxDist 밖이면 false)
+	// 한 열 안에서는 Y 로 가장 가까운 행이 최근접이므로, X 가 MaxDist 안인 열마다 행 하나씩만 비교
+	bool FindNearestTile(const FVector2D& Point, float MaxDist, int32& OutCol, int32& OutRow) const
+	{
+		OutCol = OutRow = INDEX_NONE;
+
+		const float Xs = GetColumnStep();
+		const float Ys = GetRowStep();
+		if (Cols <= 0 || Rows <= 0 || Xs <= 0.f || Ys <= 0.f || MaxDist <= 0.f)
+			return false;
+
+		const FVector2D Rel = Point - Origin;
+		const int32 MinCol = FMath::Max(0, FMath::CeilToInt((Rel.X - MaxDist) / Xs));
+		const int32 MaxCol = FMath::Min(Cols - 1, FMath::FloorToInt((Rel.X + MaxDist) / Xs));
+
+		float BestD2 = FMath::Square(MaxDist);
+		for (int32 Col = MinCol; Col <= MaxCol; ++Col)
+		{
+			const float Shift = (Col & 1) ? OddColumRowShift : 0.f;
+			const int32 RowLocal = FMath::Clamp(FMath::RoundToInt(Rel.Y / Ys - Shift), 0, Rows - 1);
+			const FVector2D Delta(Rel.X - Col * Xs, Rel.Y - (RowLocal + Shift) * Ys);
+
+			const float D2 = Delta.SizeSquared();
+			if (D2 <= BestD2 && (OutCol == INDEX_NONE || D2 < BestD2))
+			{
+				BestD2 = D2;
+				OutCol = Col;
+				OutRow = bRowZeroAtBottom ? RowLocal : (Rows - 1 - RowLocal);
+			}
+		}
+
+		return OutCol != INDEX_NONE;
+	}
+};
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+// 전투 필드(헥스 그리드) 위상 테이블
+// 타일 인덱스 규칙은 UPCTileManager 와 동일 : Index = Y * Rows + X, GridPoint = (X, Y)
+// 생성 시 한 번만 계산해두고 거리 / 이웃 / 반경별 링을 O(1) 로 조회
+struct PROJECTPC_API FPCHexGridTopology
+{
+	void Build(int32 InCols, int32 InRows);
+
+	bool IsBuiltFor(int32 InCols, int32 InRows) const { return Cols == InCols && Rows == InRows && NumTiles > 0; }
+	
+	int32 Num() const { return NumTiles; }
+	int32 GetMaxDistance() const { return MaxDistance; }
+
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < NumTiles; }
+	bool IsInRange(const FIntPoint& Point) const { return Point.Y >= 0 && Point.Y < Cols && Point.X >= 0 && Point.X < Rows; }
+	int32 ToIndex(const FIntPoint& Point) const { return IsInRange(Point) ? Point.Y * Rows + Point.X : INDEX_NONE; }
+	FIntPoint ToPoint(int32 Index) const { return FIntPoint(Index % Rows, Index / Rows); }
+
+	// 두 타일 사이 헥스 거리 (이동 칸 수)
+	int32 GetDistance(int32 A, int32 B) const { return Distances[A * NumTiles + B]; }
+	int32 GetDistance(const FIntPoint& A, const FIntPoint& B) const;
+
+	// 보드 안쪽 인접 타일 인덱스 (짝수/홀수 행 방향 규칙이 이미 반영되어 있음)
+	TConstArrayView<int32> GetNeighbors(int32 Index) const;
+
+	// Index 로부터 정확히 Radius 칸 떨어진 타일들 (Radius 0 은 자기 자신)
+	TConstArrayView<int32> GetRing(int32 Index, int32 Radius) const;
+
+#if !UE_BUILD_SHIPPING
+	// 테이블을 기존 방향 배열 기반 BFS 결과와 모든 타일 쌍에 대해 비교 (불일치 개수 반환)
+	int32 ValidateAgainstBFS() const;
+#endif
+	
+private:
+	int32 Cols = 0;
+	int32 Rows = 0;
+	int32 NumTiles = 0;
+	int32 MaxDistance = 0;
+
+	// [A * NumTiles + B] = 거리
+	TArray<uint8> Distances;
+
+	// 이웃 : NeighborStart[i] ~ NeighborStart[i + 1]
+	TArray<int32> NeighborIndices;
+	TArray<int32> NeighborStart;
+
+	// 링 : 타일별로 거리순 정렬된 인덱스, RingStart[i * (MaxDistance + 2) + r] ~ [.. + r + 1]
+	TArray<int32> RingIndices;
+	TArray<int32> RingStart;
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+// 시드 고정 난수 채널
+// FRandomStream 에 뽑은 횟수를 같이 기록해서, 같은 시드 + 같은 횟수면 같은 상태로 재현 가능
+struct FPCRandomChannel
+{
+	FPCRandomChannel() = default;
+	explicit FPCRandomChannel(int32 InSeed) { Initialize(InSeed); }
+
+	void Initialize(int32 InSeed)
+	{
+		InitialSeed = InSeed;
+		DrawCount = 0;
+		Stream.Initialize(InSeed);
+	}
+
+	// [0, 1)
+	float FRand() const
+	{
+		++DrawCount;
+		return Stream.FRand();
+	}
+
+	// [Min, Max]
+	int32 RandRange(int32 Min, int32 Max) const
+	{
+		++DrawCount;
+		return Stream.RandRange(Min, Max);
+	}
+
+	// [Min, Max)
+	float RandRange(float Min, float Max) const
+	{
+		++DrawCount;
+		return Stream.FRandRange(Min, Max);
+	}
+
+	// [0, Max)
+	int32 RandHelper(int32 Max) const
+	{
+		++DrawCount;
+		return Stream.RandHelper(Max);
+	}
+
+	int32 GetInitialSeed() const { return InitialSeed; }
+	int32 GetCurrentSeed() const { return Stream.GetCurrentSeed(); }
+	int64 GetDrawCount() const { return DrawCount; }
+
+private:
+	FRandomStream Stream;
+	int32 InitialSeed = 0;
+	mutable int64 DrawCount = 0;
+};